@@ -0,0 +1,163 @@
+//////////////////////////////////////////////
+//	bench.hpp								//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#ifndef LLCPP_CITY_BENCH_HPP_
+#define LLCPP_CITY_BENCH_HPP_
+
+#include "../llcityhash/city.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif // _MSC_VER
+	#define LL_CITY_BENCH_HAS_TSC
+#endif // x86
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+// Working set sizes used to keep buffers resident in a given cache level
+constexpr len_t L1_SIZE = 16 * 1024;
+constexpr len_t L2_SIZE = 256 * 1024;
+constexpr len_t LLC_SIZE = 8 * 1024 * 1024;
+constexpr len_t DRAM_SIZE = 512 * 1024 * 1024;
+
+struct Options {
+	std::string suite;		// Suite to run (empty runs all)
+	std::string filter;		// Substring that case names must contain
+	f64 min_time_ms;		// Minimum measured time per case
+	len_t max_working_set;	// Biggest buffer a suite may allocate
+	len_t max_threads;		// Biggest thread count a suite may use
+};
+
+#pragma region Measure
+// Prevents the compiler from discarding a value computed in a benchmark loop
+template<class T>
+__LL_INLINE__ void doNotOptimize(const T& value) noexcept {
+#if defined(_MSC_VER)
+	static volatile T sink;
+	sink = value;
+#else
+	asm volatile("" : : "r,m"(value) : "memory");
+#endif // _MSC_VER
+}
+
+__LL_NODISCARD__ __LL_INLINE__ ui64 readCycles() noexcept {
+#if defined(LL_CITY_BENCH_HAS_TSC)
+	return __rdtsc();
+#else
+	return static_cast<ui64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif // LL_CITY_BENCH_HAS_TSC
+}
+
+__LL_NODISCARD__ __LL_INLINE__ f64 nowNs() noexcept {
+	return static_cast<f64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+struct Measure {
+	f64 ns;				// Wall time of the whole run
+	f64 cycles;			// Reference cycles of the whole run
+	len_t ops;			// Operations executed
+	len_t bytes;		// Bytes hashed
+};
+
+// Runs "body()" with a growing iteration count until the whole run takes
+//	at least options.min_time_ms, then returns the measure of the last run
+template<class Body>
+__LL_NODISCARD__ Measure measure(const Options& options, const len_t ops_per_call, const len_t bytes_per_call, Body&& body) noexcept {
+	len_t iterations = 1;
+	for (;;) {
+		f64 t0 = nowNs();
+		ui64 c0 = readCycles();
+		for (len_t i = 0; i < iterations; ++i) body();
+		ui64 c1 = readCycles();
+		f64 elapsed = nowNs() - t0;
+		if (elapsed >= options.min_time_ms * 1e6 || iterations >= (len_t(1) << 40))
+			return Measure{ elapsed, static_cast<f64>(c1 - c0), iterations * ops_per_call, iterations * bytes_per_call };
+		// Aim for the target directly, but never grow more than 10x per step
+		f64 factor = elapsed > 0 ? (options.min_time_ms * 1e6 * 1.2) / elapsed : 10.0;
+		iterations = static_cast<len_t>(static_cast<f64>(iterations) * (factor > 10.0 ? 10.0 : (factor < 2.0 ? 2.0 : factor)));
+	}
+}
+
+// Runs body(thread) on "threads" threads and waits for all of them
+template<class Body>
+void runThreads(const len_t threads, Body&& body) {
+	std::vector<std::thread> workers;
+	workers.reserve(threads);
+	for (len_t t = 0; t < threads; ++t) workers.emplace_back(body, t);
+	for (std::thread& worker : workers) worker.join();
+}
+
+#pragma endregion
+#pragma region Report
+void printHeader(ll_string_t title) noexcept;
+// Prints one line: ns/op, cycles/byte and GB/s
+void printMeasure(ll_string_t function, ll_string_t group, const std::string& detail, const Measure& m) noexcept;
+// Prints one line: millions of ops per second (for non byte oriented benchmarks)
+void printRate(ll_string_t function, ll_string_t group, const std::string& detail, const Measure& m) noexcept;
+__LL_NODISCARD__ bool matchesFilter(const Options& options, const std::string& name) noexcept;
+__LL_NODISCARD__ std::string sizeToString(const len_t bytes);
+
+#pragma endregion
+#pragma region Data
+// Deterministic random bytes (same generator as CityHash's upstream tests)
+void fillTestData(std::vector<ll_char_t>& buffer);
+
+struct KeyRef {
+	len_t offset;
+	len_t len;
+};
+
+enum class KeyDistribution {
+	Short,		// Uniform in [1, 16]: integer-like and small identifiers
+	Medium,		// Uniform in [1, 64]: column values, names
+	Url,		// Geometric-ish around 40 bytes, capped at 256: urls, paths
+	Mixed		// Log-uniform in [1, 4096]: general purpose keys
+};
+
+__LL_NODISCARD__ ll_string_t distributionName(const KeyDistribution dist) noexcept;
+// Generates "count" keys placed inside a buffer of "buffer_size" bytes
+__LL_NODISCARD__ std::vector<KeyRef> generateKeys(const KeyDistribution dist, const len_t count, const len_t buffer_size, const ui64 seed);
+
+#pragma endregion
+#pragma region Suites
+// Every suite returns false if any of its self checks failed
+bool runHashSuite(const Options& options);
+bool runBatchSuite(const Options& options);
+bool runStreamSuite(const Options& options);
+bool runTreeSuite(const Options& options);
+bool runMapSuite(const Options& options);
+bool runInternSuite(const Options& options);
+bool runBloomSuite(const Options& options);
+bool runHllSuite(const Options& options);
+bool runShardSuite(const Options& options);
+bool runCountMinSuite(const Options& options);
+bool runMinHashSuite(const Options& options);
+bool runCdcSuite(const Options& options);
+bool runFieldsSuite(const Options& options);
+bool runAsyncSuite(const Options& options);
+bool runPipelineSuite(const Options& options);
+
+#pragma endregion
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_BENCH_HPP_
@@ -0,0 +1,147 @@
+//////////////////////////////////////////////
+//	bench_async.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_async.hpp"
+
+#include <filesystem>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+struct FileSet {
+	std::filesystem::path dir;
+	std::vector<std::string> paths;
+	std::vector<hash::Hash128> expected;	// CityHash128 of every file
+	len_t bytes;
+};
+
+// Writes "count" files of "size" bytes each (size + i % 4099 when ragged),
+//	cut from data at different offsets
+bool writeFiles(FileSet& set, ll_string_t name, const std::vector<ll_char_t>& data, const len_t count, const len_t size, const bool ragged) {
+	std::error_code error;
+	set.dir = std::filesystem::temp_directory_path() / name;
+	std::filesystem::remove_all(set.dir, error);
+	if (!std::filesystem::create_directories(set.dir, error)) return false;
+	set.bytes = 0;
+	for (len_t i = 0; i < count; ++i) {
+		len_t len = ragged ? size + (i * 977) % 4099 : size;
+		if (len > data.size()) len = data.size();
+		const len_t offset = (i * 4093) % (data.size() - len + 1);
+		const std::string path = (set.dir / ("file" + std::to_string(i) + ".bin")).string();
+		std::FILE* file = std::fopen(path.c_str(), "wb");
+		const bool ok = file && std::fwrite(data.data() + offset, 1, len, file) == len;
+		if (file) std::fclose(file);
+		if (!ok) return false;
+		set.paths.push_back(path);
+		set.expected.push_back(*city::CityHash128(data.data() + offset, len));
+		set.bytes += len;
+	}
+	return true;
+}
+
+void removeFiles(const FileSet& set) noexcept {
+	std::error_code error;
+	std::filesystem::remove_all(set.dir, error);
+}
+
+ll_string_t backendName(const AsyncBackend backend) noexcept {
+	switch (backend) {
+		case AsyncBackend::IoUring:		return "io_uring";
+		case AsyncBackend::ThreadPool:	return "pool";
+		default:						return "auto";
+	}
+}
+
+// Hashes each file with blocking reads of "block" bytes into a
+//	CityHash128Stream, one file after the other
+void blockingHash(const FileSet& set, std::vector<ll_char_t>& block) {
+	for (const std::string& path : set.paths) {
+		std::FILE* file = std::fopen(path.c_str(), "rb");
+		if (!file) continue;
+		std::fseek(file, 0, SEEK_END);
+		const len_t size = static_cast<len_t>(std::ftell(file));
+		std::fseek(file, 0, SEEK_SET);
+		city::CityHash128Stream stream(size);
+		len_t read = 0;
+		while ((read = std::fread(block.data(), 1, block.size(), file)) > 0)
+			(void)stream.update(block.data(), read);
+		std::fclose(file);
+		doNotOptimize(*stream.finalize());
+	}
+}
+
+void ignore(const CityFileDigest& result, void*) noexcept {
+	doNotOptimize(result.digest);
+}
+
+} // namespace
+
+bool runAsyncSuite(const Options& options) {
+	std::vector<ll_char_t> data(LLC_SIZE);
+	fillTestData(data);
+	std::vector<AsyncBackend> backends = { AsyncBackend::ThreadPool };
+	if (CityAsyncHasher::isIoUringAvailable()) backends.insert(backends.begin(), AsyncBackend::IoUring);
+	else std::printf("io_uring is not available here: only the thread pool backend runs\n");
+
+	// Files come from the page cache once written: this measures how well
+	//	reads overlap with hashing, not the device
+	printHeader("asynchronous file hashing (ns/op per set of files)");
+	struct Workload {
+		len_t count;
+		len_t size;
+	};
+	const len_t budget = options.max_working_set < (len_t(256) << 20) ? options.max_working_set : (len_t(256) << 20);
+	const Workload WORKLOADS[] = {
+		{ budget / 4096 < 4096 ? budget / 4096 : 4096, 4096 },
+		{ budget / 65536 < 1024 ? budget / 65536 : 1024, 65536 },
+		{ budget >> 23 ? budget >> 23 : 1, len_t(8) << 20 },
+	};
+	std::vector<ll_char_t> block(CITYHASH_ASYNC_DEFAULT_BUFFER_SIZE);
+	for (const Workload& workload : WORKLOADS) {
+		FileSet set;
+		if (!writeFiles(set, "llcityhash_async_bench", data, workload.count, workload.size, false)) {
+			std::printf("SKIPPED: could not write %zu files in %s\n", workload.count, set.dir.string().c_str());
+			removeFiles(set);
+			continue;
+		}
+		const std::string detail = std::to_string(workload.count) + "x" + sizeToString(workload.size);
+		if (matchesFilter(options, std::string("read+CityHash128 blocking ") + detail)) {
+			printMeasure("read+CityHash128", "blocking", detail, measure(options, 1, set.bytes, [&]() {
+				blockingHash(set, block);
+			}));
+		}
+		for (const AsyncBackend backend : backends) {
+			for (len_t threads = 1; threads <= options.max_threads && threads <= 4; threads *= 2) {
+				CityAsyncOptions async_options;
+				async_options.backend = backend;
+				async_options.threads = threads;
+				CityAsyncHasher hasher(async_options);
+				const std::string name = detail + " threads=" + std::to_string(threads);
+				if (!matchesFilter(options, std::string("CityAsyncHasher ") + backendName(backend) + " " + name)) continue;
+				printMeasure("CityAsyncHasher", backendName(backend), name, measure(options, 1, set.bytes, [&]() {
+					doNotOptimize(hasher.hashFiles(set.paths, ignore));
+				}));
+				const CityAsyncStats& stats = hasher.stats();
+				std::printf("%-22s %-16s queue depth %.1f avg / %zu max, hashing %.0f%% of thread time%s\n", "", "",
+					stats.average_queue_depth, stats.max_queue_depth,
+					stats.seconds > 0 ? 100.0 * stats.hash_seconds / (stats.seconds * static_cast<f64>(threads)) : 0.0,
+					stats.registered_buffers ? ", registered buffers" : "");
+			}
+		}
+		removeFiles(set);
+	}
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
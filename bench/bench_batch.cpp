@@ -0,0 +1,150 @@
+//////////////////////////////////////////////
+//	bench_batch.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+struct BatchCase {
+	std::string name;
+	std::vector<KeyRef> keys;
+};
+
+struct KernelCase {
+	ll_string_t name;
+	BatchKernel kernel;
+};
+
+constexpr KernelCase KERNELS[] = {
+	{ "auto", BatchKernel::Auto },
+	{ "scalar", BatchKernel::Scalar },
+	{ "avx2", BatchKernel::Avx2 },
+	{ "avx512", BatchKernel::Avx512 },
+	{ "sse41", BatchKernel::Sse41 },
+};
+
+} // namespace
+
+bool runBatchSuite(const Options& options) {
+	constexpr len_t KEYS = 4096;
+	std::vector<ll_char_t> buffer(L2_SIZE);
+	fillTestData(buffer);
+
+	std::vector<BatchCase> cases;
+	constexpr len_t FIXED[] = { 4, 8, 16, 24, 32, 48, 64, 256 };
+	for (const len_t len : FIXED) {
+		std::vector<KeyRef> keys(KEYS);
+		for (len_t i = 0; i < KEYS; ++i) keys[i] = KeyRef{ (i * 64) % (buffer.size() - len), len };
+		cases.push_back(BatchCase{ "len=" + std::to_string(len), keys });
+	}
+	constexpr KeyDistribution DISTRIBUTIONS[] = {
+		KeyDistribution::Short, KeyDistribution::Medium, KeyDistribution::Url, KeyDistribution::Mixed
+	};
+	for (const KeyDistribution dist : DISTRIBUTIONS)
+		cases.push_back(BatchCase{ distributionName(dist), generateKeys(dist, KEYS, buffer.size(), 7) });
+
+	bool ok = true;
+	constexpr ll_string_t BEST[] = { "auto", "scalar", "avx2", "avx512" };
+	std::printf("\nbest batch kernel on this CPU: %s\n", BEST[static_cast<ui8>(city::GetBestBatchKernel())]);
+	printHeader("batch vs scalar loop");
+	for (const BatchCase& c : cases) {
+		std::vector<ll_string_t> ptrs(c.keys.size());
+		std::vector<len_t> lens(c.keys.size());
+		len_t bytes = 0;
+		for (len_t i = 0; i < c.keys.size(); ++i) {
+			ptrs[i] = buffer.data() + c.keys[i].offset;
+			lens[i] = c.keys[i].len;
+			bytes += lens[i];
+		}
+		std::vector<ui32> out32(c.keys.size());
+		std::vector<ui64> out64(c.keys.size());
+		std::vector<hash::Hash128> out128(c.keys.size());
+
+		// Bit exactness against the scalar functions
+		if (!city::CityHash64Batch(ptrs.data(), lens.data(), out64.data(), ptrs.size()) ||
+			!city::CityHash128Batch(ptrs.data(), lens.data(), out128.data(), ptrs.size())) {
+			std::printf("FAILED: batch rejected valid input (%s)\n", c.name.c_str());
+			ok = false;
+		}
+		for (len_t i = 0; i < ptrs.size(); ++i) {
+			if (out64[i] != city::CityHash64(ptrs[i], lens[i])->get() ||
+				out128[i] != *city::CityHash128(ptrs[i], lens[i])) {
+				std::printf("FAILED: batch differs from scalar at key %zu (%s)\n", i, c.name.c_str());
+				ok = false;
+				break;
+			}
+		}
+
+		for (const KernelCase& k : KERNELS) {
+			if (!city::CityHash64Batch(ptrs.data(), lens.data(), out64.data(), ptrs.size(), k.kernel)) continue;
+			for (len_t i = 0; i < ptrs.size(); ++i) {
+				if (out64[i] != city::CityHash64(ptrs[i], lens[i])->get()) {
+					std::printf("FAILED: %s kernel differs from scalar at key %zu (%s)\n", k.name, i, c.name.c_str());
+					ok = false;
+					break;
+				}
+			}
+		}
+
+		for (const KernelCase& k : KERNELS) {
+			if (!city::CityHash32Batch(ptrs.data(), lens.data(), out32.data(), ptrs.size(), k.kernel)) continue;
+			for (len_t i = 0; i < ptrs.size(); ++i) {
+				if (out32[i] != city::CityHash32(ptrs[i], lens[i])->get()) {
+					std::printf("FAILED: %s CityHash32 kernel differs from scalar at key %zu (%s)\n", k.name, i, c.name.c_str());
+					ok = false;
+					break;
+				}
+			}
+		}
+
+		if (matchesFilter(options, "CityHash32 " + c.name)) {
+			printMeasure("CityHash32", "scalar-loop", c.name, measure(options, ptrs.size(), bytes, [&]() {
+				for (len_t i = 0; i < ptrs.size(); ++i) out32[i] = city::CityHash32(ptrs[i], lens[i])->get();
+				doNotOptimize(out32.data());
+			}));
+			for (const KernelCase& k : KERNELS) {
+				if (!city::CityHash32Batch(ptrs.data(), lens.data(), out32.data(), ptrs.size(), k.kernel)) continue;
+				printMeasure("CityHash32Batch", k.name, c.name, measure(options, ptrs.size(), bytes, [&]() {
+					doNotOptimize(city::CityHash32Batch(ptrs.data(), lens.data(), out32.data(), ptrs.size(), k.kernel));
+					doNotOptimize(out32.data());
+				}));
+			}
+		}
+		if (matchesFilter(options, "CityHash64 " + c.name)) {
+			printMeasure("CityHash64", "scalar-loop", c.name, measure(options, ptrs.size(), bytes, [&]() {
+				for (len_t i = 0; i < ptrs.size(); ++i) out64[i] = city::CityHash64(ptrs[i], lens[i])->get();
+				doNotOptimize(out64.data());
+			}));
+			for (const KernelCase& k : KERNELS) {
+				if (!city::CityHash64Batch(ptrs.data(), lens.data(), out64.data(), ptrs.size(), k.kernel)) continue;
+				printMeasure("CityHash64Batch", k.name, c.name, measure(options, ptrs.size(), bytes, [&]() {
+					doNotOptimize(city::CityHash64Batch(ptrs.data(), lens.data(), out64.data(), ptrs.size(), k.kernel));
+					doNotOptimize(out64.data());
+				}));
+			}
+		}
+		if (matchesFilter(options, "CityHash128 " + c.name)) {
+			printMeasure("CityHash128", "scalar-loop", c.name, measure(options, ptrs.size(), bytes, [&]() {
+				for (len_t i = 0; i < ptrs.size(); ++i) out128[i] = *city::CityHash128(ptrs[i], lens[i]);
+				doNotOptimize(out128.data());
+			}));
+			printMeasure("CityHash128Batch", "interleaved", c.name, measure(options, ptrs.size(), bytes, [&]() {
+				doNotOptimize(city::CityHash128Batch(ptrs.data(), lens.data(), out128.data(), ptrs.size()));
+				doNotOptimize(out128.data());
+			}));
+		}
+	}
+	return ok;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,129 @@
+//////////////////////////////////////////////
+//	bench_bloom.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_bloom.hpp"
+#include "../llcityhash/city_cpu.hpp"
+
+#include <memory>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+constexpr len_t KEY_SIZE = 16;
+
+// Keys [0, n) are added, keys [n, 2n) never are
+struct BloomKeys {
+	std::vector<ll_char_t> data;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+	len_t n;
+	__LL_NODISCARD__ ll_string_t present(const len_t i) const noexcept { return this->ptrs[i]; }
+	__LL_NODISCARD__ ll_string_t absent(const len_t i) const noexcept { return this->ptrs[this->n + i]; }
+};
+
+BloomKeys makeKeys(const len_t n) {
+	BloomKeys keys;
+	keys.n = n;
+	keys.data.resize(2 * n * KEY_SIZE);
+	fillTestData(keys.data);
+	keys.ptrs.resize(2 * n);
+	keys.lens.assign(2 * n, KEY_SIZE);
+	for (len_t i = 0; i < 2 * n; ++i) keys.ptrs[i] = keys.data.data() + i * KEY_SIZE;
+	return keys;
+}
+
+// The filter being replaced: one bit array, k seeded CityHash64 per key
+class ClassicBloom {
+	private:
+		std::vector<ui64> words;
+		ui32 k;
+		__LL_NODISCARD__ ui64 bit(ll_string_t s, const ui32 i) const noexcept {
+			const ui64 h = city::CityHash64WithSeedUnchecked(s, KEY_SIZE, i);
+			return static_cast<ui64>((static_cast<ui64>(static_cast<ui32>(h)) * (this->words.size() * 64)) >> 32);
+		}
+	public:
+		ClassicBloom(const len_t n, const ui32 k) : words((n * 10 + 63) / 64), k(k) {}
+		void add(ll_string_t s) noexcept {
+			for (ui32 i = 0; i < this->k; ++i) {
+				const ui64 b = this->bit(s, i);
+				this->words[b / 64] |= ui64(1) << (b % 64);
+			}
+		}
+		__LL_NODISCARD__ ll_bool_t mayContain(ll_string_t s) const noexcept {
+			for (ui32 i = 0; i < this->k; ++i) {
+				const ui64 b = this->bit(s, i);
+				if (!(this->words[b / 64] & (ui64(1) << (b % 64)))) return false;
+			}
+			return true;
+		}
+};
+
+void measureBloom(const Options& options, const len_t n) {
+	const BloomKeys keys = makeKeys(n);
+	const std::string detail = "n=" + std::to_string(n);
+	CityBloomFilter filter(n, 10.0);
+	ClassicBloom classic(n, filter.hashCount());
+	const std::string k = "k=" + std::to_string(filter.hashCount());
+	auto run = [&](ll_string_t name, ll_string_t group, auto&& body) {
+		if (!matchesFilter(options, std::string(name) + " " + group + " " + detail)) return;
+		printRate(name, group, detail, measure(options, n, n * KEY_SIZE, body));
+	};
+
+	run("ClassicBloom", "add", [&]() {
+		for (len_t i = 0; i < n; ++i) classic.add(keys.present(i));
+	});
+	run("CityBloomFilter", "add", [&]() {
+		for (len_t i = 0; i < n; ++i) (void)filter.add(keys.present(i), KEY_SIZE);
+	});
+	// Half of the lookups hit, half miss
+	for (len_t i = 0; i < n; ++i) {
+		classic.add(keys.present(i));
+		(void)filter.add(keys.present(i), KEY_SIZE);
+	}
+	const ll_string_t* queries = keys.ptrs.data() + n / 2;
+	run("ClassicBloom", ("lookup " + k).c_str(), [&]() {
+		len_t hits = 0;
+		for (len_t i = 0; i < n; ++i) hits += classic.mayContain(queries[i]);
+		doNotOptimize(hits);
+	});
+	run("CityBloomFilter", "lookup", [&]() {
+		len_t hits = 0;
+		for (len_t i = 0; i < n; ++i) hits += filter.mayContain(queries[i], KEY_SIZE);
+		doNotOptimize(hits);
+	});
+	std::unique_ptr<ll_bool_t[]> out(new ll_bool_t[n]);
+	run("CityBloomFilter", "batch scalar", [&]() {
+		doNotOptimize(filter.mayContainBatch(queries, keys.lens.data(), out.get(), n, BatchKernel::Scalar));
+	});
+	if (__internal__::GetCpuFeatures().avx2) {
+		run("CityBloomFilter", "batch avx2", [&]() {
+			doNotOptimize(filter.mayContainBatch(queries, keys.lens.data(), out.get(), n, BatchKernel::Avx2));
+		});
+	}
+}
+
+} // namespace
+
+bool runBloomSuite(const Options& options) {
+	printHeader("CityBloomFilter vs k hashes per key, 10 bits/key, 16-byte keys");
+	constexpr len_t SIZES[] = { 100000, 1000000, 10000000, 100000000 };
+	for (const len_t n : SIZES) {
+		// Two keys and a bit more than 2.5 bytes of filters per key
+		if (n * (2 * KEY_SIZE + 3 * sizeof(ll_string_t)) > options.max_working_set) break;
+		measureBloom(options, n);
+	}
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,188 @@
+//////////////////////////////////////////////
+//	bench_cdc.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_cdc.hpp"
+#include "../llcityhash/city_flat_map.hpp"
+
+#include <bit>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+constexpr BatchKernel KERNELS[] = { BatchKernel::Scalar, BatchKernel::Avx2, BatchKernel::Avx512 };
+
+ll_string_t kernelName(const BatchKernel kernel) noexcept {
+	switch (kernel) {
+		case BatchKernel::Scalar:	return "scalar";
+		case BatchKernel::Avx2:		return "avx2";
+		case BatchKernel::Avx512:	return "avx512";
+		default:					return "auto";
+	}
+}
+
+// The chunking documented in city_cdc.hpp, one byte at a time as FastCDC
+//	does it, followed by a second pass that fingerprints the chunks
+void referenceChunks(ll_string_t s, const len_t len, const CityChunker& chunker, std::vector<CityChunk>& out) {
+	const len_t min = chunker.minSize(), avg = chunker.avgSize(), max = chunker.maxSize();
+	const int bits = static_cast<int>(std::bit_width(avg)) - 1;
+	const ui64 mask_small = ~ui64(0) << (64 - (bits + 2));
+	const ui64 mask_large = ~ui64(0) << (64 - (bits - 2));
+	ui64 gear[256];
+	for (ui64 b = 0; b < 256; ++b) gear[b] = city::CityHash64Key(b);
+	for (len_t p = 0; p < len;) {
+		len_t end = p + max < len ? p + max : len;
+		ui64 h = 0;
+		for (len_t i = p; i < end; ++i) {
+			h = (h << 1) + gear[static_cast<ui8>(s[i])];
+			if (i + 1 - p < min) continue;
+			if ((h & (i + 1 - p < avg ? mask_small : mask_large)) == 0) {
+				end = i + 1;
+				break;
+			}
+		}
+		out.push_back(CityChunk{ p, end - p, hash::Hash128() });
+		p = end;
+	}
+	for (CityChunk& chunk : out) chunk.fingerprint = city::CityHash128Unchecked(s + chunk.offset, chunk.length);
+}
+
+// Versions of a file, each one from the previous with a few small edits
+//	(inserted, deleted and overwritten runs of bytes)
+std::vector<std::vector<ll_char_t>> makeCorpus(const std::vector<ll_char_t>& data, const len_t size, const len_t versions, const len_t edits) {
+	std::mt19937_64 rng(7);
+	std::vector<std::vector<ll_char_t>> corpus;
+	corpus.emplace_back(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+	for (len_t v = 1; v < versions; ++v) {
+		std::vector<ll_char_t> next = corpus.back();
+		for (len_t e = 0; e < edits; ++e) {
+			const len_t at = rng() % next.size();
+			const len_t run = 1 + rng() % 64;
+			const std::ptrdiff_t pos = static_cast<std::ptrdiff_t>(at);
+			switch (rng() % 3) {
+				case 0: {
+					const std::ptrdiff_t from = static_cast<std::ptrdiff_t>(rng() % (size - run));
+					next.insert(next.begin() + pos, data.begin() + from, data.begin() + from + static_cast<std::ptrdiff_t>(run));
+					break;
+				}
+				case 1:
+					next.erase(next.begin() + pos, next.begin() + pos + static_cast<std::ptrdiff_t>(run < next.size() - at ? run : next.size() - at));
+					break;
+				default:
+					for (len_t i = at; i < at + run && i < next.size(); ++i) next[i] = static_cast<ll_char_t>(rng());
+					break;
+			}
+		}
+		corpus.push_back(std::move(next));
+	}
+	return corpus;
+}
+
+// Total bytes over the bytes of distinct chunks
+f64 dedupRatio(const std::vector<std::vector<CityChunk>>& chunks) {
+	CityFlatSet<ui64> seen;
+	len_t total = 0, unique = 0;
+	for (const std::vector<CityChunk>& file : chunks) {
+		for (const CityChunk& chunk : file) {
+			total += chunk.length;
+			if (seen.insert(chunk.fingerprint.getLow() ^ chunk.fingerprint.getHigh()).second) unique += chunk.length;
+		}
+	}
+	return unique ? static_cast<f64>(total) / static_cast<f64>(unique) : 0.0;
+}
+
+void reportDedup(const std::vector<ll_char_t>& data, const Options& options) {
+	constexpr len_t VERSIONS = 16;
+	constexpr len_t EDITS = 4;
+	const len_t size = options.max_working_set / 8 < (len_t(4) << 20) ? options.max_working_set / 8 : (len_t(4) << 20);
+	const std::vector<std::vector<ll_char_t>> corpus = makeCorpus(data, size, VERSIONS, EDITS);
+
+	std::printf("\n== dedup ratio of %zu versions of a %s file, %zu small edits each ==\n", VERSIONS, sizeToString(size).c_str(), EDITS);
+	std::printf("%-26s %-12s %s\n", "chunking", "ratio", "mean chunk");
+	// Fixed-size blocks, as the baseline
+	{
+		std::vector<std::vector<CityChunk>> chunks(VERSIONS);
+		len_t count = 0;
+		for (len_t v = 0; v < VERSIONS; ++v) {
+			for (len_t p = 0; p < corpus[v].size(); p += 8192) {
+				const len_t n = corpus[v].size() - p < 8192 ? corpus[v].size() - p : 8192;
+				chunks[v].push_back(CityChunk{ p, n, city::CityHash128Unchecked(corpus[v].data() + p, n) });
+			}
+			count += chunks[v].size();
+		}
+		std::printf("%-26s %-12.2f %.0f\n", "fixed 8K", dedupRatio(chunks), static_cast<f64>(VERSIONS * size) / static_cast<f64>(count));
+	}
+	for (const len_t avg : { len_t(4096), len_t(8192), len_t(16384) }) {
+		const CityChunker chunker(avg / 4, avg, avg * 8);
+		std::vector<std::vector<CityChunk>> chunks(VERSIONS);
+		len_t count = 0;
+		for (len_t v = 0; v < VERSIONS; ++v) {
+			(void)chunker.chunk(corpus[v].data(), corpus[v].size(), chunks[v]);
+			count += chunks[v].size();
+		}
+		const std::string name = "cdc " + sizeToString(avg / 4) + "/" + sizeToString(avg) + "/" + sizeToString(avg * 8);
+		std::printf("%-26s %-12.2f %.0f\n", name.c_str(), dedupRatio(chunks), static_cast<f64>(VERSIONS * size) / static_cast<f64>(count));
+	}
+}
+
+} // namespace
+
+bool runCdcSuite(const Options& options) {
+	const len_t size = options.max_working_set < (len_t(64) << 20) ? options.max_working_set : (len_t(64) << 20);
+	std::vector<ll_char_t> data(size);
+	fillTestData(data);
+	reportDedup(data, options);
+
+	printHeader("content-defined chunking + CityHash128 fingerprints (ns/op per buffer)");
+	const std::string detail = "len=" + sizeToString(size) + ", avg=8K";
+	std::vector<CityChunk> chunks;
+	chunks.reserve(2 * size / city::CITYHASH_CDC_DEFAULT_AVG);
+	if (matchesFilter(options, "FastCDC two passes " + detail)) {
+		const CityChunker chunker;
+		printMeasure("FastCDC", "two passes", detail, measure(options, 1, size, [&]() {
+			chunks.clear();
+			referenceChunks(data.data(), size, chunker, chunks);
+			doNotOptimize(chunks.back());
+		}));
+	}
+	for (const BatchKernel kernel : KERNELS) {
+		const CityChunker chunker(city::CITYHASH_CDC_DEFAULT_MIN, city::CITYHASH_CDC_DEFAULT_AVG, city::CITYHASH_CDC_DEFAULT_MAX, kernel);
+		const std::string group = kernelName(kernel);
+		if (!matchesFilter(options, "CityChunker " + group + " " + detail)) continue;
+		if (!chunker.chunk(data.data(), L1_SIZE, chunks)) continue;
+		printMeasure("CityChunker", group.c_str(), detail, measure(options, 1, size, [&]() {
+			chunks.clear();
+			doNotOptimize(chunker.chunk(data.data(), size, chunks));
+		}));
+	}
+	const CityChunker chunker;
+	for (len_t threads = 2; threads <= options.max_threads; threads *= 2) {
+		const std::string name = detail + " threads=" + std::to_string(threads);
+		if (!matchesFilter(options, "CityChunker auto " + name)) continue;
+		printMeasure("CityChunker", "auto", name, measure(options, 1, size, [&]() {
+			chunks.clear();
+			doNotOptimize(chunker.chunk(data.data(), size, chunks, threads));
+		}));
+	}
+	if (matchesFilter(options, "CityChunkerStream 64K pieces " + detail)) {
+		printMeasure("CityChunkerStream", "64K pieces", detail, measure(options, 1, size, [&]() {
+			CityChunkerStream stream(chunker);
+			chunks.clear();
+			for (len_t i = 0; i < size; i += 65536) (void)stream.update(data.data() + i, size - i < 65536 ? size - i : 65536, chunks);
+			doNotOptimize(stream.finalize(chunks));
+		}));
+	}
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
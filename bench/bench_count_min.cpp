@@ -0,0 +1,166 @@
+//////////////////////////////////////////////
+//	bench_count_min.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_count_min.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+constexpr ui32 WIDTH = 1 << 16;
+constexpr ui32 DEPTH = 4;
+constexpr ui32 TOP_K = 16;
+
+// A stream of events over "distinct" keys whose frequencies follow a Zipf
+//	law: key r (from 0) appears about 1 / (r + 1)^1.1 as often as key 0
+struct CountStream {
+	std::vector<std::string> keys;		// Distinct keys
+	std::vector<ui32> events;			// Index of the key of every event
+	std::vector<ll_string_t> ptrs;		// Per event
+	std::vector<len_t> lens;
+};
+
+CountStream makeStream(const len_t distinct, const len_t events) {
+	CountStream stream;
+	stream.keys.reserve(distinct);
+	for (len_t i = 0; i < distinct; ++i) stream.keys.push_back("user:" + std::to_string(i * 7919 % 1000003) + ":req");
+	std::vector<f64> cdf(distinct);
+	f64 sum = 0.0;
+	for (len_t i = 0; i < distinct; ++i) cdf[i] = sum += 1.0 / std::pow(static_cast<f64>(i + 1), 1.1);
+	std::mt19937_64 rng(events);
+	std::uniform_real_distribution<f64> uniform(0.0, sum);
+	stream.events.resize(events);
+	stream.ptrs.resize(events);
+	stream.lens.resize(events);
+	for (len_t i = 0; i < events; ++i) {
+		const ui32 key = static_cast<ui32>(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+		stream.events[i] = key < distinct ? key : static_cast<ui32>(distinct - 1);
+		stream.ptrs[i] = stream.keys[stream.events[i]].data();
+		stream.lens[i] = stream.keys[stream.events[i]].size();
+	}
+	return stream;
+}
+
+std::vector<ui32> exactCounts(const CountStream& stream) {
+	std::vector<ui32> counts(stream.keys.size(), 0);
+	for (const ui32 key : stream.events) ++counts[key];
+	return counts;
+}
+
+// Estimates of every distinct key
+std::vector<ui32> estimates(const CityCountMinSketch& sketch, const CountStream& stream) {
+	std::vector<ll_string_t> ptrs(stream.keys.size());
+	std::vector<len_t> lens(stream.keys.size());
+	for (len_t i = 0; i < stream.keys.size(); ++i) {
+		ptrs[i] = stream.keys[i].data();
+		lens[i] = stream.keys[i].size();
+	}
+	std::vector<ui32> out(stream.keys.size());
+	if (!sketch.estimateBatch(ptrs.data(), lens.data(), out.data(), out.size())) out.clear();
+	return out;
+}
+
+// Not a timing line: tests/test_count_min.cpp checks the bounds
+void printOverestimate(const CountStream& stream) {
+	const std::vector<ui32> exact = exactCounts(stream);
+	f64 mean_error[2]{};
+	for (const CountMinUpdate update : { CountMinUpdate::Standard, CountMinUpdate::Conservative }) {
+		CityCountMinSketch sketch(WIDTH, DEPTH, update);
+		(void)sketch.addBatch(stream.ptrs.data(), stream.lens.data(), stream.events.size());
+		const std::vector<ui32> values = estimates(sketch, stream);
+		for (len_t i = 0; i < values.size(); ++i)
+			mean_error[update == CountMinUpdate::Conservative] += static_cast<f64>(values[i] - exact[i]) / static_cast<f64>(exact.size());
+	}
+	std::printf("\nCityCountMinSketch %ux%u, %zu events over %zu keys: mean overestimate %.3f standard, %.3f conservative\n",
+		WIDTH, DEPTH, stream.events.size(), exact.size(), mean_error[0], mean_error[1]);
+}
+
+void measureSingle(const Options& options, const CountStream& stream, const ui32 width) {
+	const len_t n = stream.events.size();
+	const std::string detail = "sketch=" + sizeToString(len_t(width) * DEPTH * sizeof(ui32));
+	auto run = [&](ll_string_t name, ll_string_t group, auto&& body) {
+		if (!matchesFilter(options, std::string(name) + " " + group + " " + detail)) return;
+		printRate(name, group, detail, measure(options, n, 0, body));
+	};
+
+	run("std::unordered_map", "exact", [&]() {
+		std::unordered_map<std::string_view, ui32> counts;
+		for (len_t i = 0; i < n; ++i) ++counts[std::string_view(stream.ptrs[i], stream.lens[i])];
+		doNotOptimize(counts.size());
+	});
+	CityCountMinSketch sketch(width, DEPTH), conservative(width, DEPTH, CountMinUpdate::Conservative);
+	run("CityCountMinSketch", "add", [&]() {
+		for (len_t i = 0; i < n; ++i) (void)sketch.add(stream.ptrs[i], stream.lens[i]);
+		doNotOptimize(sketch.width());
+	});
+	run("CityCountMinSketch", "addBatch", [&]() {
+		doNotOptimize(sketch.addBatch(stream.ptrs.data(), stream.lens.data(), n));
+	});
+	run("CityCountMinSketch", "conservative", [&]() {
+		doNotOptimize(conservative.addBatch(stream.ptrs.data(), stream.lens.data(), n));
+	});
+	CityHeavyHitters tracker(TOP_K, width, DEPTH);
+	run("CityHeavyHitters", "add", [&]() {
+		for (len_t i = 0; i < n; ++i) (void)tracker.add(stream.ptrs[i], stream.lens[i]);
+	});
+	run("CityHeavyHitters", "addBatch", [&]() {
+		doNotOptimize(tracker.addBatch(stream.ptrs.data(), stream.lens.data(), n));
+	});
+}
+
+// Every thread adds the whole stream, starting at a different event
+void measureThreads(const Options& options, const CountStream& stream) {
+	const len_t n = stream.events.size();
+	auto work = [&](CityCountMinSketch& sketch, const len_t t, const len_t threads) {
+		const len_t begin = t * n / threads;
+		(void)sketch.addBatch(stream.ptrs.data() + begin, stream.lens.data() + begin, n - begin);
+		(void)sketch.addBatch(stream.ptrs.data(), stream.lens.data(), begin);
+	};
+	for (len_t threads = 1; threads <= options.max_threads && threads <= 64; threads *= 2) {
+		const std::string detail = "threads=" + std::to_string(threads);
+		// Sketches of the threads are merged into the first one at the end
+		if (matchesFilter(options, "CityCountMinSketch per-thread merge " + detail)) {
+			std::vector<CityCountMinSketch> locals(threads, CityCountMinSketch(WIDTH, DEPTH));
+			printRate("CityCountMinSketch", "per-thread+merge", detail, measure(options, threads * n, 0, [&]() {
+				runThreads(threads, [&](const len_t t) { work(locals[t], t, threads); });
+				for (len_t t = 1; t < threads; ++t) (void)locals[0].merge(locals[t]);
+			}));
+		}
+		if (matchesFilter(options, "CityCountMinSketch shared " + detail)) {
+			CityCountMinSketch shared(WIDTH, DEPTH, CountMinUpdate::Standard, true);
+			printRate("CityCountMinSketch", "shared", detail, measure(options, threads * n, 0, [&]() {
+				runThreads(threads, [&](const len_t t) { work(shared, t, threads); });
+			}));
+		}
+	}
+}
+
+} // namespace
+
+bool runCountMinSuite(const Options& options) {
+	const CountStream stream = makeStream(100000, 1000000);
+	printOverestimate(stream);
+
+	printHeader("1M Zipf(1.1) events over 100K keys, depth 4");
+	for (const ui32 width : { ui32(1) << 14, ui32(1) << 20 })
+		measureSingle(options, stream, width);
+	printHeader("CityCountMinSketch 1 MiB, 1M events per thread");
+	measureThreads(options, stream);
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
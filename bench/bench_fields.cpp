@@ -0,0 +1,146 @@
+//////////////////////////////////////////////
+//	bench_fields.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_fields.hpp"
+
+#include <cstring>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+// 14 packed bytes in 24: 4 bytes of padding after customer, 6 at the end
+struct OrderKey {
+	ui32 customer;
+	ui64 order;
+	ui16 line;
+
+	bool operator==(const OrderKey&) const = default;
+};
+
+// 26 packed bytes: a string, floating point and an array
+struct RowKey {
+	std::string name;
+	ui32 id;
+	f64 price;
+	std::array<ui16, 3> codes;
+};
+
+// Packs the low SIZE bytes of v little-endian at out[0] ... out[SIZE - 1]
+template<len_t SIZE>
+ll_char_t* packBytes(ll_char_t* out, const ui64 v) noexcept {
+	if constexpr (std::endian::native == std::endian::little) std::memcpy(out, &v, SIZE);
+	else for (len_t i = 0; i < SIZE; ++i) out[i] = static_cast<ll_char_t>(v >> (8 * i));
+	return out + SIZE;
+}
+ui64 stringHash(const std::string_view str) noexcept {
+	return city::CityHash64Unchecked(str.data(), str.size());
+}
+
+// What callers did before: the fields packed by hand into a buffer
+void packOrder(const OrderKey& key, ll_char_t (&buffer)[14]) noexcept {
+	ll_char_t* p = packBytes<4>(buffer, key.customer);
+	p = packBytes<8>(p, key.order);
+	(void)packBytes<2>(p, key.line);
+}
+ui64 packedOrderHash(const OrderKey& key) noexcept {
+	ll_char_t buffer[14];
+	packOrder(key, buffer);
+	return city::CityHash64Unchecked(buffer, sizeof(buffer));
+}
+ui64 packedRowHash(const RowKey& key) noexcept {
+	ll_char_t buffer[26];
+	ll_char_t* p = packBytes<8>(buffer, stringHash(key.name));
+	p = packBytes<4>(p, key.id);
+	p = packBytes<8>(p, std::bit_cast<ui64>(key.price));
+	for (const ui16 code : key.codes) p = packBytes<2>(p, code);
+	return city::CityHash64Unchecked(buffer, sizeof(buffer));
+}
+
+OrderKey makeOrder(const ui64 i) noexcept {
+	OrderKey key;
+	// Garbage in the padding, which must not change the hash
+	std::memset(static_cast<void*>(&key), static_cast<int>(i * 37), sizeof(key));
+	key.customer = static_cast<ui32>(city::CityHash64Key(i));
+	key.order = city::CityHash64Key(i + 1);
+	key.line = static_cast<ui16>(i);
+	return key;
+}
+
+void measureKeys(const Options& options) {
+	constexpr len_t KEYS = 4096;
+	std::vector<OrderKey> orders(KEYS);
+	std::vector<std::tuple<ui32, ui64, ui16>> tuples(KEYS);
+	std::vector<RowKey> rows(KEYS);
+	for (len_t i = 0; i < KEYS; ++i) {
+		orders[i] = makeOrder(i);
+		tuples[i] = std::make_tuple(orders[i].customer, orders[i].order, orders[i].line);
+		rows[i] = RowKey{ "customer-" + std::to_string(i), static_cast<ui32>(i), static_cast<f64>(i) / 4.0, { 1, 2, static_cast<ui16>(i) } };
+	}
+	const std::string order_detail = "14 of 24 bytes";
+	if (matchesFilter(options, "CityHash64 packed " + order_detail)) {
+		printMeasure("CityHash64", "packed buffer", order_detail, measure(options, KEYS, KEYS * 14, [&]() {
+			ui64 sum = 0;
+			for (const OrderKey& key : orders) sum += packedOrderHash(key);
+			doNotOptimize(sum);
+		}));
+	}
+	if (matchesFilter(options, "CityHash64 raw bytes " + order_detail)) {
+		// Hashes the padding: not deterministic, shown for the cost only
+		printMeasure("CityHash64<T>", "raw bytes", order_detail, measure(options, KEYS, KEYS * 14, [&]() {
+			ui64 sum = 0;
+			for (const OrderKey& key : orders) sum += city::CityHash64Unchecked(reinterpret_cast<ll_string_t>(&key), sizeof(key));
+			doNotOptimize(sum);
+		}));
+	}
+	if (matchesFilter(options, "CityHash64Fields struct " + order_detail)) {
+		printMeasure("CityHash64Fields", "struct", order_detail, measure(options, KEYS, KEYS * 14, [&]() {
+			ui64 sum = 0;
+			for (const OrderKey& key : orders) sum += city::CityHash64Fields(key);
+			doNotOptimize(sum);
+		}));
+	}
+	if (matchesFilter(options, "CityHash64Fields tuple " + order_detail)) {
+		printMeasure("CityHash64Fields", "tuple", order_detail, measure(options, KEYS, KEYS * 14, [&]() {
+			ui64 sum = 0;
+			for (const auto& key : tuples) sum += city::CityHash64Fields(key);
+			doNotOptimize(sum);
+		}));
+	}
+
+	const std::string row_detail = "string + 18 bytes";
+	if (matchesFilter(options, "CityHash64 packed " + row_detail)) {
+		printMeasure("CityHash64", "packed buffer", row_detail, measure(options, KEYS, KEYS * 26, [&]() {
+			ui64 sum = 0;
+			for (const RowKey& key : rows) sum += packedRowHash(key);
+			doNotOptimize(sum);
+		}));
+	}
+	if (matchesFilter(options, "CityHash64Fields struct " + row_detail)) {
+		printMeasure("CityHash64Fields", "struct", row_detail, measure(options, KEYS, KEYS * 26, [&]() {
+			ui64 sum = 0;
+			for (const RowKey& key : rows) sum += city::CityHash64Fields(key);
+			doNotOptimize(sum);
+		}));
+	}
+}
+
+} // namespace
+
+bool runFieldsSuite(const Options& options) {
+	printHeader("composite keys, 4096 keys per run (ns/op per key)");
+	measureKeys(options);
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,452 @@
+//////////////////////////////////////////////
+//	bench_hash.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+// Lengths chosen to exercise every internal path of city.cpp
+struct LengthCase {
+	len_t len;
+	ll_string_t bucket;
+};
+
+constexpr LengthCase LENGTHS_64[] = {
+	{ 0, "HashLen0to16" }, { 3, "HashLen0to16" }, { 4, "HashLen0to16" },
+	{ 8, "HashLen0to16" }, { 12, "HashLen0to16" }, { 16, "HashLen0to16" },
+	{ 17, "HashLen17to32" }, { 24, "HashLen17to32" }, { 32, "HashLen17to32" },
+	{ 33, "HashLen33to64" }, { 48, "HashLen33to64" }, { 64, "HashLen33to64" },
+	{ 65, "Loop64" }, { 96, "Loop64" }, { 128, "Loop64" },
+	{ 256, "Loop64" }, { 1024, "Loop64" }, { 4096, "Loop64" },
+};
+// CityHash128 consumes 16 bytes as seed, so CityMurmur handles up to 143 bytes
+constexpr LengthCase LENGTHS_128[] = {
+	{ 8, "CityMurmur" }, { 16, "CityMurmur" }, { 32, "CityMurmur" },
+	{ 64, "CityMurmur" }, { 96, "CityMurmur" }, { 143, "CityMurmur" },
+	{ 144, "Loop128" }, { 256, "Loop128" }, { 1024, "Loop128" },
+	{ 4096, "Loop128" }, { 65536, "Loop128" },
+};
+// CityHashCrc128 is CityHash128 up to 900 bytes
+constexpr LengthCase LENGTHS_CRC[] = {
+	{ 256, "CityHash128" }, { 900, "CityHash128" }, { 901, "Crc256Long" },
+	{ 1024, "Crc256Long" }, { 4096, "Crc256Long" }, { 65536, "Crc256Long" },
+};
+constexpr LengthCase LENGTHS_32[] = {
+	{ 4, "Hash32Len0to4" }, { 8, "Hash32Len5to12" }, { 12, "Hash32Len5to12" },
+	{ 16, "Hash32Len13to24" }, { 24, "Hash32Len13to24" }, { 64, "Loop20" },
+	{ 256, "Loop20" }, { 4096, "Loop20" },
+};
+
+constexpr ui64 SEED0 = 0x0123456789abcdefull;
+constexpr ui64 SEED1 = 0xfedcba9876543210ull;
+
+// Signature of the adapters below: hash "len" bytes at "s", return a
+//	value that depends on every output bit
+using Kernel = ui64(*)(ll_string_t s, const len_t len);
+
+ui64 kernel32(ll_string_t s, const len_t len) { return city::CityHash32(s, len)->get(); }
+ui64 kernel64(ll_string_t s, const len_t len) { return city::CityHash64(s, len)->get(); }
+ui64 kernel64Seed(ll_string_t s, const len_t len) { return city::CityHash64WithSeed(s, len, SEED0)->get(); }
+ui64 kernel64Seeds(ll_string_t s, const len_t len) { return city::CityHash64WithSeeds(s, len, SEED0, SEED1)->get(); }
+ui64 kernel128(ll_string_t s, const len_t len) {
+	hash::Hash128 h = *city::CityHash128(s, len);
+	return h.getLow() ^ h.getHigh();
+}
+
+ui64 kernelCrc128(ll_string_t s, const len_t len) {
+	hash::Hash128 h = *city::CityHashCrc128(s, len);
+	return h.getLow() ^ h.getHigh();
+}
+
+// CityHash64(ll_wstring_t) before it hashed in place: every character went
+//	through conversor into a 512-byte buffer, and longer strings failed
+hash::OptionalHash64 legacyWideHash64(ll_wstring_t str, len_t size) noexcept {
+	constexpr len_t PARSER_BUFFER_SIZE = 512;
+	ll_char_t buffer[PARSER_BUFFER_SIZE]{};
+	len_t buffer_len = sizeof(ll_wchar_t) * size;
+	if (buffer_len > PARSER_BUFFER_SIZE) return hash::INVALID_HASH64;
+
+	ll_char_t* i = buffer;
+	for (ll_wstring_t data_end = str + size; str < data_end; ++str)
+		hash::basic_type_hash::conversor<ll_wchar_t>(i, *str);
+	return city::CityHash64(buffer, buffer_len);
+}
+
+bool runWide(const Options& options) {
+	std::vector<ll_wchar_t> wide(1 << 16);
+	std::mt19937_64 rng(3);
+	for (ll_wchar_t& c : wide) c = static_cast<ll_wchar_t>(rng() & 0xffff);
+
+	bool ok = true;
+	const len_t legacy_max = 512 / sizeof(ll_wchar_t);
+	for (len_t size = 0; size <= legacy_max; ++size) {
+		if (city::CityHash64(wide.data(), size)->get() != legacyWideHash64(wide.data(), size)->get()) {
+			std::printf("FAILED: wide CityHash64 changed its value at %zu characters\n", size);
+			ok = false;
+			break;
+		}
+	}
+	if (!city::CityHash64(wide.data(), wide.size())) {
+		std::printf("FAILED: wide CityHash64 rejected %zu characters\n", wide.size());
+		ok = false;
+	}
+
+	printHeader("wide strings");
+	constexpr len_t SIZES[] = { 4, 16, 64, 128, 1024, 65536 };
+	for (const len_t size : SIZES) {
+		const std::string detail = "chars=" + std::to_string(size);
+		const len_t bytes = sizeof(ll_wchar_t) * size;
+		if (size <= legacy_max && matchesFilter(options, "CityHash64 wide legacy " + detail)) {
+			printMeasure("CityHash64", "wide legacy", detail, measure(options, 1, bytes, [&]() {
+				doNotOptimize(legacyWideHash64(wide.data(), size)->get());
+			}));
+		}
+		if (matchesFilter(options, "CityHash64 wide " + detail)) {
+			printMeasure("CityHash64", "wide", detail, measure(options, 1, bytes, [&]() {
+				doNotOptimize(city::CityHash64(wide.data(), size)->get());
+			}));
+		}
+	}
+	return ok;
+}
+
+// Keys of a switch, hashed by the compiler
+constexpr std::string_view CONST_KEYS[] = { "", "id", "host", "content-length", "x-forwarded-for-client-address", "a configuration key that is longer than sixty-four bytes in total" };
+constexpr ui32 CONST_KEYS_32[] = {
+	city::CityHash32Const(CONST_KEYS[0]), city::CityHash32Const(CONST_KEYS[1]), city::CityHash32Const(CONST_KEYS[2]),
+	city::CityHash32Const(CONST_KEYS[3]), city::CityHash32Const(CONST_KEYS[4]), city::CityHash32Const(CONST_KEYS[5]),
+};
+constexpr ui64 CONST_KEYS_64[] = {
+	city::CityHash64Const(CONST_KEYS[0]), city::CityHash64Const(CONST_KEYS[1]), city::CityHash64Const(CONST_KEYS[2]),
+	city::CityHash64Const(CONST_KEYS[3]), city::CityHash64Const(CONST_KEYS[4]), city::CityHash64Const(CONST_KEYS[5]),
+};
+constexpr ui64 CONST_KEYS_64_SEED[] = {
+	city::CityHash64WithSeedConst(CONST_KEYS[0], SEED0), city::CityHash64WithSeedConst(CONST_KEYS[1], SEED0),
+	city::CityHash64WithSeedConst(CONST_KEYS[2], SEED0), city::CityHash64WithSeedConst(CONST_KEYS[3], SEED0),
+	city::CityHash64WithSeedConst(CONST_KEYS[4], SEED0), city::CityHash64WithSeedConst(CONST_KEYS[5], SEED0),
+};
+
+len_t constKeyIndex(const std::string_view key) noexcept {
+	switch (city::CityHash64Const(key)) {
+		case city::CityHash64Const("id"): return 1;
+		case city::CityHash64Const("host"): return 2;
+		case city::CityHash64Const("content-length"): return 3;
+		default: return 0;
+	}
+}
+
+bool runConstexpr(const Options& options, const std::vector<ll_char_t>& buffer) {
+	namespace header = city::__internal__::header;
+	bool ok = true;
+	// The header copies, evaluated at run time, against city.cpp
+	for (len_t len = 0; len <= 1024 && ok; ++len) {
+		for (len_t offset = 0; offset < 8 && ok; offset += 3) {
+			ll_string_t s = buffer.data() + offset * 4099;
+			if (header::CityHash32(s, len) != city::CityHash32(s, len)->get() ||
+				header::CityHash64(s, len) != city::CityHash64(s, len)->get() ||
+				header::HashLen16(header::CityHash64(s, len) - header::k2, SEED0 + len) != city::CityHash64WithSeed(s, len, SEED0 + len)->get()) {
+				std::printf("FAILED: constexpr CityHash differs from city.cpp at len=%zu\n", len);
+				ok = false;
+			}
+		}
+	}
+	// Values computed by the compiler
+	for (len_t i = 0; i < sizeof(CONST_KEYS) / sizeof(CONST_KEYS[0]); ++i) {
+		const std::string key(CONST_KEYS[i]);
+		if (CONST_KEYS_32[i] != city::CityHash32(key.data(), key.size())->get() ||
+			CONST_KEYS_64[i] != city::CityHash64(key)->get() ||
+			CONST_KEYS_64_SEED[i] != city::CityHash64WithSeed(key.data(), key.size(), SEED0)->get()) {
+			std::printf("FAILED: compile-time CityHash differs from city.cpp for \"%s\"\n", key.c_str());
+			ok = false;
+		}
+	}
+	if (constKeyIndex(std::string("content-length")) != 3 || constKeyIndex("content-type") != 0) {
+		std::printf("FAILED: switch on CityHash64Const picked the wrong case\n");
+		ok = false;
+	}
+
+	printHeader("constexpr hashing at run time");
+	for (len_t i = 1; i < sizeof(CONST_KEYS) / sizeof(CONST_KEYS[0]); ++i) {
+		const std::string key(CONST_KEYS[i]);
+		const std::string detail = "len=" + std::to_string(key.size());
+		if (matchesFilter(options, "CityHash64 " + detail)) {
+			printMeasure("CityHash64", "runtime", detail, measure(options, 1, key.size(), [&]() {
+				doNotOptimize(city::CityHash64(key.data(), key.size())->get());
+			}));
+		}
+		if (matchesFilter(options, "CityHash64Const " + detail)) {
+			printMeasure("CityHash64Const", "runtime", detail, measure(options, 1, key.size(), [&]() {
+				doNotOptimize(city::CityHash64Const(key));
+			}));
+		}
+	}
+	return ok;
+}
+
+template<len_t... N>
+bool checkFixed(ll_string_t s, std::index_sequence<N...>) noexcept {
+	bool ok = true;
+	((ok = ok && city::CityHash64Fixed<N>(s) == city::CityHash64(s, N)->get()) , ...);
+	return ok;
+}
+
+// Hashes KEYS_PER_CALL consecutive keys of the L1 buffer with an inlinable
+//	body, so the call overhead is part of what is measured
+template<class Body>
+Measure measureInline(const Options& options, const std::vector<ll_char_t>& buffer, const len_t len, Body&& body) {
+	constexpr len_t KEYS_PER_CALL = 256;
+	const len_t stride = len < 64 ? 64 : len;
+	const len_t slots = L1_SIZE / stride;
+	len_t next = 0;
+	return measure(options, KEYS_PER_CALL, KEYS_PER_CALL * len, [&]() {
+		ui64 acc = 0;
+		for (len_t i = 0; i < KEYS_PER_CALL; ++i) {
+			acc ^= body(buffer.data() + next * stride);
+			if (++next == slots) next = 0;
+		}
+		doNotOptimize(acc);
+	});
+}
+
+template<len_t N>
+void measureFixedApi(const Options& options, const std::vector<ll_char_t>& buffer) {
+	const std::string detail = "len=" + std::to_string(N);
+	if (matchesFilter(options, "CityHash64 checked " + detail)) {
+		printMeasure("CityHash64", "checked", detail, measureInline(options, buffer, N, [](ll_string_t s) {
+			return city::CityHash64(s, N)->get();
+		}));
+	}
+	if (matchesFilter(options, "CityHash64Unchecked " + detail)) {
+		printMeasure("CityHash64Unchecked", "inline", detail, measureInline(options, buffer, N, [](ll_string_t s) {
+			return city::CityHash64Unchecked(s, N);
+		}));
+	}
+	if (matchesFilter(options, "CityHash64Fixed " + detail)) {
+		printMeasure("CityHash64Fixed", "inline", detail, measureInline(options, buffer, N, [](ll_string_t s) {
+			return city::CityHash64Fixed<N>(s);
+		}));
+	}
+}
+
+bool runUnchecked(const Options& options, const std::vector<ll_char_t>& buffer) {
+	bool ok = true;
+	const hash::Hash128 seed(SEED0, SEED1);
+	for (len_t len = 0; len <= 1024 && ok; ++len) {
+		ll_string_t s = buffer.data() + len;
+		if (city::CityHash32Unchecked(s, len) != city::CityHash32(s, len)->get() ||
+			city::CityHash64Unchecked(s, len) != city::CityHash64(s, len)->get() ||
+			city::CityHash64WithSeedUnchecked(s, len, SEED0) != city::CityHash64WithSeed(s, len, SEED0)->get() ||
+			city::CityHash128Unchecked(s, len) != *city::CityHash128(s, len) ||
+			city::CityHash128WithSeedUnchecked(s, len, seed) != *city::CityHash128WithSeed(s, len, seed)) {
+			std::printf("FAILED: unchecked CityHash differs from the checked one at len=%zu\n", len);
+			ok = false;
+		}
+	}
+	if (!checkFixed(buffer.data() + 5, std::make_index_sequence<160>())) {
+		std::printf("FAILED: CityHash64Fixed differs from CityHash64\n");
+		ok = false;
+	}
+
+	printHeader("unchecked and fixed length, L1 resident");
+	measureFixedApi<4>(options, buffer);
+	measureFixedApi<8>(options, buffer);
+	measureFixedApi<16>(options, buffer);
+	measureFixedApi<24>(options, buffer);
+	measureFixedApi<32>(options, buffer);
+	measureFixedApi<64>(options, buffer);
+	measureFixedApi<256>(options, buffer);
+	return ok;
+}
+
+enum class KeyEnum : ui32 {};
+
+// CityHash64Key and the object templates against the byte array function
+template<class T>
+bool checkKey(const T key) noexcept {
+	ll_string_t bytes = reinterpret_cast<ll_string_t>(&key);
+	const ui64 expected = city::CityHash64(bytes, sizeof(T))->get();
+	return city::CityHash64Key(key) == expected &&
+		city::CityHash64<T>(key)->get() == expected &&
+		city::CityHash64WithSeed<T>(key, SEED0)->get() == city::CityHash64WithSeed(bytes, sizeof(T), SEED0)->get() &&
+		city::CityHash64WithSeeds<T>(key, SEED0, SEED1)->get() == city::CityHash64WithSeeds(bytes, sizeof(T), SEED0, SEED1)->get();
+}
+
+// Hashes every key of "keys" with "body"
+template<class T, class Body>
+Measure measureKeyLoop(const Options& options, const std::vector<T>& keys, Body&& body) {
+	return measure(options, keys.size(), keys.size() * sizeof(T), [&]() {
+		ui64 acc = 0;
+		for (const T key : keys) acc ^= body(key);
+		doNotOptimize(acc);
+	});
+}
+
+template<class T>
+void measureKeys(const Options& options, ll_string_t type, const std::vector<T>& keys) {
+	const std::string detail = std::string(type) + " keys=" + std::to_string(keys.size());
+	if (matchesFilter(options, "CityHash64 bytes " + detail)) {
+		printRate("CityHash64", "bytes", detail, measureKeyLoop(options, keys, [](const T key) {
+			return city::CityHash64(reinterpret_cast<ll_string_t>(&key), sizeof(T))->get();
+		}));
+	}
+	if (matchesFilter(options, "CityHash64Key register " + detail)) {
+		printRate("CityHash64Key", "register", detail, measureKeyLoop(options, keys, [](const T key) {
+			return city::CityHash64Key(key);
+		}));
+	}
+}
+
+bool runKeys(const Options& options) {
+	bool ok = true;
+	std::mt19937_64 rng(11);
+	for (len_t i = 0; i < 10000 && ok; ++i) {
+		const ui64 v = i < 512 ? i : rng();
+		ok = checkKey(static_cast<ui8>(v)) && checkKey(static_cast<ui16>(v)) &&
+			checkKey(static_cast<ui32>(v)) && checkKey(v) && checkKey(static_cast<i32>(v)) &&
+			checkKey(static_cast<KeyEnum>(v)) && checkKey(reinterpret_cast<const void*>(v)) &&
+			checkKey(static_cast<bool>(v & 1));
+#if defined(__SIZEOF_INT128__)
+		ok = ok && checkKey((static_cast<unsigned __int128>(rng()) << 64) | v);
+#endif // __SIZEOF_INT128__
+		ll_char_t pair[16];
+		const ui64 high = rng();
+		std::memcpy(pair, &v, 8);
+		std::memcpy(pair + 8, &high, 8);
+		ok = ok && city::CityHash64Key(v, high) == city::CityHash64(pair, 16)->get() &&
+			city::CityHash64Key(hash::Hash128(v, high)) == city::CityHash64(pair, 16)->get() &&
+			city::CityHash64(hash::Hash64(v))->get() == hash::basic_type_hash::hashValue<ui64>(v, city::CityHash64)->get();
+		if (!ok) std::printf("FAILED: CityHash64Key differs from CityHash64 for key 0x%llx\n", static_cast<unsigned long long>(v));
+	}
+
+	printHeader("integer and pointer keys");
+	std::vector<ui64> keys64(4096);
+	for (ui64& key : keys64) key = rng();
+	std::vector<ui32> keys32(keys64.begin(), keys64.end());
+	std::vector<const void*> pointers(keys64.size());
+	for (len_t i = 0; i < pointers.size(); ++i) pointers[i] = &keys64[i];
+	measureKeys(options, "ui32", keys32);
+	measureKeys(options, "ui64", keys64);
+	measureKeys(options, "pointer", pointers);
+	return ok;
+}
+
+struct KernelCase {
+	ll_string_t name;
+	Kernel kernel;
+	const LengthCase* lengths;
+	len_t lengths_size;
+};
+
+const KernelCase KERNELS[] = {
+	{ "CityHash32", kernel32, LENGTHS_32, sizeof(LENGTHS_32) / sizeof(LengthCase) },
+	{ "CityHash64", kernel64, LENGTHS_64, sizeof(LENGTHS_64) / sizeof(LengthCase) },
+	{ "CityHash64WithSeed", kernel64Seed, LENGTHS_64, sizeof(LENGTHS_64) / sizeof(LengthCase) },
+	{ "CityHash64WithSeeds", kernel64Seeds, LENGTHS_64, sizeof(LENGTHS_64) / sizeof(LengthCase) },
+	{ "CityHash128", kernel128, LENGTHS_128, sizeof(LENGTHS_128) / sizeof(LengthCase) },
+	{ "CityHashCrc128", kernelCrc128, LENGTHS_CRC, sizeof(LENGTHS_CRC) / sizeof(LengthCase) },
+};
+
+// Hashes consecutive keys of "len" bytes spread over the whole buffer, so the
+//	buffer size decides in which cache level the data lives
+Measure measureFixed(const Options& options, const std::vector<ll_char_t>& buffer, const len_t working_set, const Kernel kernel, const len_t len) {
+	constexpr len_t KEYS_PER_CALL = 256;
+	len_t stride = len < 64 ? 64 : len;
+	len_t slots = working_set / stride;
+	if (slots == 0) slots = 1;
+	len_t next = 0;
+	return measure(options, KEYS_PER_CALL, KEYS_PER_CALL * len, [&]() {
+		ui64 acc = 0;
+		for (len_t i = 0; i < KEYS_PER_CALL; ++i) {
+			acc ^= kernel(buffer.data() + next * stride, len);
+			if (++next == slots) next = 0;
+		}
+		doNotOptimize(acc);
+	});
+}
+
+Measure measureKeys(const Options& options, const std::vector<ll_char_t>& buffer, const std::vector<KeyRef>& keys, const Kernel kernel) {
+	len_t bytes = 0;
+	for (const KeyRef& key : keys) bytes += key.len;
+	return measure(options, keys.size(), bytes, [&]() {
+		ui64 acc = 0;
+		for (const KeyRef& key : keys)
+			acc ^= kernel(buffer.data() + key.offset, key.len);
+		doNotOptimize(acc);
+	});
+}
+
+} // namespace
+
+bool runHashSuite(const Options& options) {
+	std::vector<ll_char_t> buffer(options.max_working_set < L2_SIZE ? L2_SIZE : options.max_working_set);
+	fillTestData(buffer);
+
+	bool ok = true;
+	const hash::Hash128 seed(SEED0, SEED1);
+	for (len_t len = 0; len <= 900; len += 9) {
+		if (*city::CityHashCrc128(buffer.data(), len) != *city::CityHash128(buffer.data(), len) ||
+			*city::CityHashCrc128WithSeed(buffer.data(), len, seed) != *city::CityHash128WithSeed(buffer.data(), len, seed)) {
+			std::printf("FAILED: CityHashCrc128 differs from CityHash128 at len=%zu\n", len);
+			ok = false;
+			break;
+		}
+	}
+	std::printf("\ncrc32 instruction: %s\n", city::CityHashCrcIsAccelerated() ? "yes" : "no (table-driven CRC32C)");
+
+	printHeader("fixed length, L1 resident");
+	for (const KernelCase& k : KERNELS) {
+		for (len_t i = 0; i < k.lengths_size; ++i) {
+			const LengthCase& l = k.lengths[i];
+			std::string detail = "len=" + std::to_string(l.len);
+			if (!matchesFilter(options, std::string(k.name) + " " + l.bucket + " " + detail)) continue;
+			printMeasure(k.name, l.bucket, detail, measureFixed(options, buffer, L1_SIZE, k.kernel, l.len));
+		}
+	}
+
+	printHeader("key distributions, L2 resident");
+	constexpr KeyDistribution DISTRIBUTIONS[] = {
+		KeyDistribution::Short, KeyDistribution::Medium, KeyDistribution::Url, KeyDistribution::Mixed
+	};
+	for (const KeyDistribution dist : DISTRIBUTIONS) {
+		std::vector<KeyRef> keys = generateKeys(dist, 4096, L2_SIZE, 42);
+		for (const KernelCase& k : KERNELS) {
+			if (!matchesFilter(options, std::string(k.name) + " " + distributionName(dist))) continue;
+			printMeasure(k.name, "distribution", distributionName(dist), measureKeys(options, buffer, keys, k.kernel));
+		}
+	}
+
+	printHeader("working set");
+	constexpr len_t WORKING_SETS[] = { L1_SIZE, L2_SIZE, LLC_SIZE, DRAM_SIZE };
+	constexpr len_t WORKING_SET_LENGTHS[] = { 16, 64, 256, 4096 };
+	for (const len_t ws : WORKING_SETS) {
+		if (ws > buffer.size()) continue;
+		for (const len_t len : WORKING_SET_LENGTHS) {
+			for (const KernelCase& k : KERNELS) {
+				if (k.kernel == kernel64Seed || k.kernel == kernel64Seeds) continue;
+				std::string detail = "len=" + std::to_string(len) + " ws=" + sizeToString(ws);
+				if (!matchesFilter(options, std::string(k.name) + " " + detail)) continue;
+				printMeasure(k.name, "working-set", detail, measureFixed(options, buffer, ws, k.kernel, len));
+			}
+		}
+	}
+	ok &= runWide(options);
+	ok &= runConstexpr(options, buffer);
+	ok &= runUnchecked(options, buffer);
+	ok &= runKeys(options);
+	return ok;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,120 @@
+//////////////////////////////////////////////
+//	bench_hll.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_hll.hpp"
+
+#include <unordered_set>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+// Key i is the 8 bytes of i
+struct HllKeys {
+	std::vector<ui64> values;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+};
+
+HllKeys makeKeys(const len_t n, const ui64 first = 0) {
+	HllKeys keys;
+	keys.values.resize(n);
+	keys.ptrs.resize(n);
+	keys.lens.assign(n, sizeof(ui64));
+	for (len_t i = 0; i < n; ++i) keys.values[i] = first + i;
+	for (len_t i = 0; i < n; ++i) keys.ptrs[i] = reinterpret_cast<ll_string_t>(&keys.values[i]);
+	return keys;
+}
+
+// Not a timing table: printHeader's columns do not apply.  tests/test_hll.cpp
+//	checks the bounds.
+void printAccuracy() {
+	constexpr len_t CARDINALITIES[] = { 0, 1, 10, 100, 1000, 4000, 10000, 100000, 1000000, 10000000 };
+	std::printf("\n== CityHyperLogLog accuracy, precision 14, against exact counts ==\n");
+	std::printf("%-14s %-14s %-10s %s\n", "exact", "estimate", "error", "mode");
+	CityHyperLogLog sketch(CITYHASH_HLL_DEFAULT_PRECISION);
+	len_t added = 0;
+	for (const len_t n : CARDINALITIES) {
+		for (; added < n; ++added) (void)sketch.addHash(city::CityHash64Key(static_cast<ui64>(added)));
+		const f64 estimate = sketch.estimate();
+		const f64 error = n ? (estimate - static_cast<f64>(n)) / static_cast<f64>(n) : estimate;
+		std::printf("%-14zu %-14.1f %+9.4f%% %s\n", n, estimate, 100.0 * error, sketch.isSparse() ? "sparse" : "dense");
+	}
+}
+
+void measureCount(const Options& options, const len_t n) {
+	const HllKeys keys = makeKeys(n);
+	const std::string detail = "n=" + std::to_string(n);
+	auto run = [&](ll_string_t name, ll_string_t group, auto&& body) {
+		if (!matchesFilter(options, std::string(name) + " " + group + " " + detail)) return;
+		printRate(name, group, detail, measure(options, n, n * sizeof(ui64), body));
+	};
+
+	run("std::unordered_set", "exact", [&]() {
+		std::unordered_set<ui64> seen;
+		for (len_t i = 0; i < n; ++i) seen.insert(city::CityHash64Unchecked(keys.ptrs[i], keys.lens[i]));
+		doNotOptimize(seen.size());
+	});
+	run("CityHyperLogLog", "add", [&]() {
+		CityHyperLogLog sketch;
+		for (len_t i = 0; i < n; ++i) (void)sketch.add(keys.ptrs[i], keys.lens[i]);
+		doNotOptimize(sketch.estimate());
+	});
+	run("CityHyperLogLog", "addBatch", [&]() {
+		CityHyperLogLog sketch;
+		(void)sketch.addBatch(keys.ptrs.data(), keys.lens.data(), n);
+		doNotOptimize(sketch.estimate());
+	});
+}
+
+void measureMerge(const Options& options) {
+	for (const ui32 p : { ui32(12), CITYHASH_HLL_DEFAULT_PRECISION, CITYHASH_HLL_MAX_PRECISION }) {
+		const len_t m = len_t(1) << p;
+		CityHyperLogLog a(p), b(p);
+		const HllKeys keys = makeKeys(8 * m);
+		(void)a.addBatch(keys.ptrs.data(), keys.lens.data(), 4 * m);
+		(void)b.addBatch(keys.ptrs.data() + 4 * m, keys.lens.data() + 4 * m, 4 * m);
+		std::vector<ui8> x(m), y(m);
+		const std::string detail = "m=" + std::to_string(m);
+		if (matchesFilter(options, "byte loop merge " + detail)) {
+			printMeasure("byte loop", "merge", detail, measure(options, 1, m, [&]() {
+				for (len_t i = 0; i < m; ++i) x[i] = x[i] < y[i] ? y[i] : x[i];
+				doNotOptimize(x[0]);
+			}));
+		}
+		if (matchesFilter(options, "CityHyperLogLog merge " + detail)) {
+			printMeasure("CityHyperLogLog", "merge", detail, measure(options, 1, m, [&]() {
+				doNotOptimize(a.merge(b));
+			}));
+		}
+	}
+}
+
+} // namespace
+
+bool runHllSuite(const Options& options) {
+	printAccuracy();
+
+	printHeader("distinct count: exact set vs CityHyperLogLog, 8-byte keys");
+	constexpr len_t SIZES[] = { 100000, 1000000, 10000000 };
+	for (const len_t n : SIZES) {
+		// Keys, pointers, lengths and the exact set's nodes
+		if (n * 64 > options.max_working_set) break;
+		measureCount(options, n);
+	}
+	printHeader("CityHyperLogLog dense merge");
+	measureMerge(options);
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
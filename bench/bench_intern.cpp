@@ -0,0 +1,96 @@
+//////////////////////////////////////////////
+//	bench_intern.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_intern.hpp"
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+std::vector<std::string> makeStrings(const len_t count) {
+	std::vector<std::string> strings;
+	strings.reserve(count);
+	std::mt19937_64 rng(count);
+	for (len_t i = 0; i < count; ++i)
+		strings.push_back("/intern/" + std::to_string(rng() % 100000) + "/" + std::to_string(i));
+	return strings;
+}
+
+// Every thread interns all the strings, each starting at a different one
+void measureContention(const Options& options, const std::vector<std::string>& strings, const len_t shards) {
+	const len_t n = strings.size();
+	const std::string name = shards == 1 ? "1 shard" : "sharded";
+	const std::string hit = "hit, " + name;
+	const std::string insert = "insert, " + name;
+	std::vector<CityHashedString> handles;
+	handles.reserve(n);
+	for (const std::string& s : strings) handles.emplace_back(s.data(), s.size());
+	auto work = [&](CityStringInterner& interner, const len_t t, const len_t threads) {
+		ui64 acc = 0;
+		for (len_t i = 0, index = t * n / threads; i < n; ++i, index = index + 1 == n ? 0 : index + 1)
+			acc += interner.intern(handles[index])->len();
+		doNotOptimize(acc);
+	};
+
+	for (len_t threads = 1; threads <= options.max_threads && threads <= 64; threads *= 2) {
+		const std::string detail = "threads=" + std::to_string(threads);
+		if (matchesFilter(options, "CityStringInterner " + hit + " " + detail)) {
+			CityStringInterner interner(shards);
+			for (const CityHashedString& str : handles) (void)interner.intern(str);
+			printRate("CityStringInterner", hit.c_str(), detail, measure(options, threads * n, 0, [&]() {
+				runThreads(threads, [&](const len_t t) { work(interner, t, threads); });
+			}));
+		}
+		// A fresh interner per run: the first thread to reach a string copies it
+		if (matchesFilter(options, "CityStringInterner " + insert + " " + detail)) {
+			printRate("CityStringInterner", insert.c_str(), detail, measure(options, threads * n, 0, [&]() {
+				CityStringInterner interner(shards);
+				runThreads(threads, [&](const len_t t) { work(interner, t, threads); });
+				doNotOptimize(interner.size());
+			}));
+		}
+	}
+}
+
+} // namespace
+
+bool runInternSuite(const Options& options) {
+	const std::vector<std::string> strings = makeStrings(100000);
+
+	printHeader("CityHashedString: cached hash vs CityHash64");
+	std::vector<CityHashedString> handles;
+	handles.reserve(strings.size());
+	for (const std::string& s : strings) handles.emplace_back(s.data(), s.size());
+	const std::string detail = "n=" + std::to_string(strings.size());
+	if (matchesFilter(options, "CityHash64 " + detail)) {
+		printRate("CityHash64", "bytes", detail, measure(options, strings.size(), 0, [&]() {
+			ui64 acc = 0;
+			for (const std::string& s : strings) acc += city::CityHash64Unchecked(s.data(), s.size());
+			doNotOptimize(acc);
+		}));
+	}
+	if (matchesFilter(options, "CityHashedString " + detail)) {
+		printRate("CityHashedString", "cached", detail, measure(options, strings.size(), 0, [&]() {
+			ui64 acc = 0;
+			for (const CityHashedString& str : handles) acc += str.hash();
+			doNotOptimize(acc);
+		}));
+	}
+
+	printHeader("CityStringInterner contention, 100K strings per thread");
+	measureContention(options, strings, 1);
+	measureContention(options, strings, 0);
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////
+//	bench_map.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_flat_map.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+using FlatMap = city::CityFlatMap<ui64, ui64>;
+using StdMap = std::unordered_map<ui64, ui64, city::CityHasher>;
+
+// Keys in random order and keys that are not in the table
+struct Keys {
+	std::vector<ui64> present;
+	std::vector<ui64> shuffled;
+	std::vector<ui64> absent;
+};
+
+Keys makeKeys(const len_t n) {
+	Keys keys;
+	std::mt19937_64 rng(n);
+	keys.present.resize(n);
+	keys.absent.resize(n);
+	for (len_t i = 0; i < n; ++i) {
+		keys.present[i] = rng() | 1;
+		keys.absent[i] = rng() & ~ui64(1);
+	}
+	keys.shuffled = keys.present;
+	std::shuffle(keys.shuffled.begin(), keys.shuffled.end(), rng);
+	return keys;
+}
+
+template<class Map>
+void measureMap(const Options& options, ll_string_t name, const Keys& keys) {
+	const len_t n = keys.present.size();
+	const std::string detail = "n=" + std::to_string(n);
+	auto run = [&](ll_string_t group, auto&& body) {
+		if (!matchesFilter(options, std::string(name) + " " + group + " " + detail)) return;
+		printRate(name, group, detail, measure(options, n, n * sizeof(ui64), body));
+	};
+
+	run("insert", [&]() {
+		Map map;
+		for (const ui64 key : keys.present) map.emplace(key, key);
+		doNotOptimize(map.size());
+	});
+
+	Map map;
+	for (const ui64 key : keys.present) map.emplace(key, key);
+	run("find hit", [&]() {
+		ui64 acc = 0;
+		for (const ui64 key : keys.shuffled) acc += map.find(key) != map.end();
+		doNotOptimize(acc);
+	});
+	run("find miss", [&]() {
+		ui64 acc = 0;
+		for (const ui64 key : keys.absent) acc += map.find(key) != map.end();
+		doNotOptimize(acc);
+	});
+	// Erase every key and put it back: the table keeps its size
+	run("erase+insert", [&]() {
+		for (const ui64 key : keys.shuffled) {
+			map.erase(key);
+			map.emplace(key, key);
+		}
+		doNotOptimize(map.size());
+	});
+}
+
+// std::unordered_map's interface for CityFlatMap, so both share measureMap
+struct FlatAdapter {
+	FlatMap map;
+	__LL_NODISCARD__ const ui64* end() const noexcept { return nullptr; }
+	__LL_NODISCARD__ const ui64* find(const ui64 key) const noexcept { return this->map.find(key); }
+	void emplace(const ui64 key, const ui64 value) { (void)this->map.emplace(key, value); }
+	void erase(const ui64 key) noexcept { (void)this->map.erase(key); }
+	__LL_NODISCARD__ len_t size() const noexcept { return this->map.size(); }
+};
+
+} // namespace
+
+bool runMapSuite(const Options& options) {
+	printHeader("CityFlatMap vs std::unordered_map, ui64 -> ui64");
+	constexpr len_t SIZES[] = { 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+	for (const len_t n : SIZES) {
+		// std::unordered_map needs about 48 bytes per entry
+		if (n * 48 > options.max_working_set) break;
+		const Keys keys = makeKeys(n);
+		measureMap<FlatAdapter>(options, "CityFlatMap", keys);
+		measureMap<StdMap>(options, "std::unordered_map", keys);
+	}
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,126 @@
+//////////////////////////////////////////////
+//	bench_minhash.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_minhash.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+constexpr ui32 SEEDS = 128;
+constexpr BatchKernel KERNELS[] = { BatchKernel::Scalar, BatchKernel::Avx2, BatchKernel::Avx512 };
+
+ll_string_t kernelName(const BatchKernel kernel) noexcept {
+	switch (kernel) {
+		case BatchKernel::Scalar:	return "scalar";
+		case BatchKernel::Avx2:		return "avx2";
+		case BatchKernel::Avx512:	return "avx512";
+		default:					return "auto";
+	}
+}
+
+// Two sets of 20000 shingles (8-byte integers) with a given Jaccard
+//	similarity.  tests/test_minhash.cpp checks the bounds.
+void printSimilarity() {
+	constexpr ui32 K = 512;
+	constexpr len_t SET = 20000;
+	const CityMinHash minhash(K);
+	std::printf("\n");
+	for (const f64 jaccard : { 0.1, 0.5, 0.9 }) {
+		// |A & B| / |A | B| = shared / (2 * SET - shared)
+		const len_t shared = static_cast<len_t>(std::llround(2.0 * SET * jaccard / (1.0 + jaccard)));
+		std::vector<ui64> a(SET), b(SET);
+		for (len_t i = 0; i < SET; ++i) {
+			a[i] = city::CityHash64Key(i);
+			b[i] = city::CityHash64Key(i < shared ? i : i + SET);
+		}
+		std::vector<ui64> sig_a(K), sig_b(K);
+		(void)minhash.signatureHashes(a.data(), SET, sig_a.data());
+		(void)minhash.signatureHashes(b.data(), SET, sig_b.data());
+		const f64 exact = static_cast<f64>(shared) / static_cast<f64>(2 * SET - shared);
+		std::printf("Jaccard %.3f: MinHash %.3f", exact, CityMinHashSimilarity(sig_a.data(), sig_b.data(), K));
+		for (const ui32 bits : { 1u, 2u, 8u }) {
+			std::vector<ui64> packed_a(CityMinHashPackedWords(K, bits)), packed_b(packed_a.size());
+			(void)CityMinHashPack(sig_a.data(), K, bits, packed_a.data());
+			(void)CityMinHashPack(sig_b.data(), K, bits, packed_b.data());
+			std::printf(", %u-bit %.3f", bits, CityMinHashPackedSimilarity(packed_a.data(), packed_b.data(), K, bits));
+		}
+		std::printf("\n");
+	}
+}
+
+void measureSeeds(const Options& options, const std::vector<ll_char_t>& data) {
+	std::vector<ui64> seeds(SEEDS), out(SEEDS);
+	for (ui32 i = 0; i < SEEDS; ++i) seeds[i] = city::CityHash64Key(i);
+	for (const len_t len : { len_t(16), len_t(256), len_t(4096) }) {
+		const std::string detail = "len=" + std::to_string(len);
+		if (matchesFilter(options, "CityHash64WithSeeds loop " + detail)) {
+			printMeasure("CityHash64WithSeeds", "loop", detail, measure(options, SEEDS, SEEDS * len, [&]() {
+				for (ui32 i = 0; i < SEEDS; ++i) out[i] = city::CityHash64WithSeedUnchecked(data.data(), len, seeds[i]);
+				doNotOptimize(out[0]);
+			}));
+		}
+		for (const BatchKernel kernel : KERNELS) {
+			const std::string group = std::string("multi ") + kernelName(kernel);
+			if (!matchesFilter(options, "CityHash64WithSeeds " + group + " " + detail)) continue;
+			if (!city::CityHash64WithSeedsMulti(data.data(), len, nullptr, seeds.data(), out.data(), SEEDS, kernel)) continue;
+			printMeasure("CityHash64WithSeeds", group.c_str(), detail, measure(options, SEEDS, SEEDS * len, [&]() {
+				doNotOptimize(city::CityHash64WithSeedsMulti(data.data(), len, nullptr, seeds.data(), out.data(), SEEDS, kernel));
+			}));
+		}
+	}
+}
+
+// One signature of a document's 8-byte shingles per op
+void measureSignature(const Options& options, const std::vector<ll_char_t>& data) {
+	constexpr len_t W = 8;
+	const CityMinHash minhash(SEEDS);
+	std::vector<ui64> sig(SEEDS);
+	for (const len_t len : { len_t(1024), len_t(16384) }) {
+		const std::string detail = "doc=" + sizeToString(len) + ", k=128";
+		if (matchesFilter(options, "CityHash64WithSeed per seed " + detail)) {
+			printMeasure("CityHash64WithSeed", "per seed", detail, measure(options, 1, len, [&]() {
+				for (ui32 k = 0; k < SEEDS; ++k) {
+					ui64 m = ~ui64(0);
+					for (len_t i = 0; i + W <= len; ++i) m = std::min(m, city::CityHash64WithSeedUnchecked(data.data() + i, W, minhash.getSeeds()[k]));
+					sig[k] = m;
+				}
+				doNotOptimize(sig[0]);
+			}));
+		}
+		if (matchesFilter(options, "CityMinHash shingles " + detail)) {
+			printMeasure("CityMinHash", "shingles", detail, measure(options, 1, len, [&]() {
+				doNotOptimize(minhash.signatureShingles(data.data(), len, W, sig.data()));
+			}));
+		}
+	}
+}
+
+} // namespace
+
+bool runMinHashSuite(const Options& options) {
+	std::vector<ll_char_t> data(1 << 16);
+	fillTestData(data);
+	printSimilarity();
+
+	printHeader("one key under 128 seeds (ns/op per seed)");
+	measureSeeds(options, data);
+	printHeader("MinHash signature of a document, 8-byte shingles (ns/op per document)");
+	measureSignature(options, data);
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,180 @@
+//////////////////////////////////////////////
+//	bench_pipeline.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_pipeline.hpp"
+
+#include <memory>
+#include <new>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+constexpr ui64 NOT_FOUND = ~ui64(0);
+constexpr len_t QUERIES = 1 << 20;
+
+// Open addressing with linear probing, half full.  Keys are the 8 bytes of
+//	an integer, identified by their CityHash64 (0 marks an empty bucket).
+struct Bucket {
+	ui64 tag;
+	ui64 value;
+};
+
+__LL_NODISCARD__ __LL_INLINE__ ui64 TagOf(const ui64 hash) noexcept { return hash ? hash : 1; }
+
+class Table {
+	private:
+		std::unique_ptr<Bucket[]> buckets;
+		len_t mask;
+
+	public:
+		// 2^bits buckets, or none if they cannot be allocated
+		explicit Table(const len_t bits) noexcept
+			: buckets(new (std::nothrow) Bucket[len_t(1) << bits]())
+			, mask((len_t(1) << bits) - 1)
+		{}
+		__LL_NODISCARD__ ll_bool_t isValid() const noexcept { return this->buckets != nullptr; }
+		__LL_NODISCARD__ len_t capacity() const noexcept { return this->mask + 1; }
+
+		void insert(const ui64 hash, const ui64 value) noexcept {
+			const ui64 tag = TagOf(hash);
+			Bucket* b = this->locate(hash);
+			while (b->tag != 0 && b->tag != tag) b = this->next(b);
+			*b = Bucket{ tag, value };
+		}
+		__LL_NODISCARD__ Bucket* locate(const ui64 hash) const noexcept {
+			return this->buckets.get() + (hash & this->mask);
+		}
+		__LL_NODISCARD__ Bucket* next(const Bucket* b) const noexcept {
+			return this->buckets.get() + ((static_cast<len_t>(b - this->buckets.get()) + 1) & this->mask);
+		}
+		// Checks one bucket: nullptr once the key is found (out = its value)
+		//	or known to be missing (out = NOT_FOUND), else the next bucket
+		__LL_NODISCARD__ const Bucket* probe(const ui64 hash, const Bucket* b, ui64& out) const noexcept {
+			if (b->tag == TagOf(hash)) out = b->value;
+			else if (b->tag == 0) out = NOT_FOUND;
+			else return this->next(b);
+			return nullptr;
+		}
+		__LL_NODISCARD__ ui64 find(const ui64 hash) const noexcept {
+			ui64 out = NOT_FOUND;
+			for (const Bucket* b = this->locate(hash); b; b = this->probe(hash, b, out)) {}
+			return out;
+		}
+};
+
+// Integer keys looked up as 8-byte strings
+struct Queries {
+	std::vector<ui64> keys;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+
+	Queries(const len_t n, const ui64 key_space, const ui64 seed)
+		: keys(n), ptrs(n), lens(n, sizeof(ui64))
+	{
+		std::mt19937_64 rng(seed);
+		for (len_t i = 0; i < n; ++i) {
+			this->keys[i] = rng() % key_space;
+			this->ptrs[i] = reinterpret_cast<ll_string_t>(&this->keys[i]);
+		}
+	}
+};
+
+__LL_NODISCARD__ ui64 HashKey(const ui64& key) noexcept {
+	return city::CityHash64(reinterpret_cast<ll_string_t>(&key), sizeof(key))->get();
+}
+
+// Keys 0 to inserted - 1 map to themselves
+void fillTable(Table& table, const len_t inserted) noexcept {
+	for (ui64 key = 0; key < inserted; ++key) table.insert(HashKey(key), key);
+}
+
+ll_bool_t lookupPipeline(const Table& table, const Queries& queries, ui64* out, const len_t window) noexcept {
+	return city::CityLookupPipeline(queries.ptrs.data(), queries.lens.data(), queries.ptrs.size(),
+		[&](const ui64 hash) noexcept -> const void* { return table.locate(hash); },
+		[&](const len_t i, const ui64 hash, const void* bucket) noexcept -> const void* {
+			return table.probe(hash, static_cast<const Bucket*>(bucket), out[i]);
+		}, window);
+}
+
+__LL_NODISCARD__ bool checkResults(ll_string_t name, const Queries& queries, const std::vector<ui64>& out, const len_t inserted) {
+	for (len_t i = 0; i < queries.keys.size(); ++i) {
+		const ui64 expected = queries.keys[i] < inserted ? queries.keys[i] : NOT_FOUND;
+		if (out[i] != expected) {
+			std::printf("FAILED: %s found %llu for key %llu\n", name,
+				static_cast<unsigned long long>(out[i]), static_cast<unsigned long long>(queries.keys[i]));
+			return false;
+		}
+	}
+	return true;
+}
+
+bool measurePipeline(const Options& options, const len_t bits) {
+	const len_t bytes = sizeof(Bucket) << bits;
+	const std::string size = sizeToString(bytes);
+	if (!matchesFilter(options, "pipeline " + size)) return true;
+	Table table(bits);
+	if (!table.isValid()) {
+		std::printf("%-22s %-16s %-28s could not allocate the table\n", "lookup", "", size.c_str());
+		return true;
+	}
+	const len_t inserted = table.capacity() / 2;
+	fillTable(table, inserted);
+	// Half of the keys are present
+	const Queries queries(QUERIES, 2 * inserted, bits);
+	std::vector<ui64> out(QUERIES);
+	bool ok = true;
+
+	printRate("CityHash64+probe", "loop", size, measure(options, QUERIES, 0, [&]() {
+		for (len_t i = 0; i < QUERIES; ++i) out[i] = table.find(HashKey(queries.keys[i]));
+		doNotOptimize(out.data());
+	}));
+	ok &= checkResults("loop", queries, out, inserted);
+
+	ui64 hashes[256];
+	printRate("CityHash64Batch+probe", "loop", size, measure(options, QUERIES, 0, [&]() {
+		for (len_t base = 0; base < QUERIES; base += 256) {
+			(void)city::CityHash64Batch(queries.ptrs.data() + base, queries.lens.data() + base, hashes, 256);
+			for (len_t i = 0; i < 256; ++i) out[base + i] = table.find(hashes[i]);
+		}
+		doNotOptimize(out.data());
+	}));
+	ok &= checkResults("batch loop", queries, out, inserted);
+
+	constexpr len_t WINDOWS[] = { 4, 8, 16, 32, 64 };
+	for (const len_t window : WINDOWS) {
+		const std::string group = "window=" + std::to_string(window);
+		printRate("CityLookupPipeline", group.c_str(), size, measure(options, QUERIES, 0, [&]() {
+			doNotOptimize(lookupPipeline(table, queries, out.data(), window));
+			doNotOptimize(out.data());
+		}));
+		ok &= checkResults("CityLookupPipeline", queries, out, inserted);
+	}
+	return ok;
+}
+
+} // namespace
+
+bool runPipelineSuite(const Options& options) {
+	bool ok = true;
+
+	printHeader("CityLookupPipeline vs hash-then-probe loops, half full linear probing table, 50% hits");
+	// 1 MiB to 16 GiB of 16-byte buckets
+	for (len_t bits = 16; bits <= 30; bits += 2) {
+		if ((sizeof(Bucket) << bits) > options.max_working_set) break;
+		ok &= measurePipeline(options, bits);
+	}
+	return ok;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
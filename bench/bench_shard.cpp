@@ -0,0 +1,124 @@
+//////////////////////////////////////////////
+//	bench_shard.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include "../llcityhash/city_shard.hpp"
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+constexpr len_t KEY_SIZE = 16;
+
+struct ShardKeys {
+	std::vector<ll_char_t> data;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+	std::vector<ui64> hashes;
+};
+
+ShardKeys makeKeys(const len_t n) {
+	ShardKeys keys;
+	keys.data.resize(n * KEY_SIZE);
+	fillTestData(keys.data);
+	keys.ptrs.resize(n);
+	keys.lens.assign(n, KEY_SIZE);
+	keys.hashes.resize(n);
+	for (len_t i = 0; i < n; ++i) {
+		keys.ptrs[i] = keys.data.data() + i * KEY_SIZE;
+		keys.hashes[i] = city::CityHash64Unchecked(keys.ptrs[i], KEY_SIZE);
+	}
+	return keys;
+}
+
+std::vector<ui64> makeIds(const ui32 count) {
+	std::vector<ui64> ids(count);
+	for (ui32 i = 0; i < count; ++i) ids[i] = 0x5eed000000000000ull + i;
+	return ids;
+}
+
+void measureNodes(const Options& options, const ShardKeys& keys, const ui32 nodes) {
+	// Fewer keys per run for many nodes, so that runs stay short
+	const len_t n = (len_t(1) << 20) / nodes < 256 ? 256 : (len_t(1) << 20) / nodes;
+	const std::vector<ui64> ids = makeIds(nodes);
+	std::vector<ui64> seeds(nodes);
+	for (ui32 i = 0; i < nodes; ++i) seeds[i] = city::CityHash64Key(ids[i]);
+	std::vector<f64> weights(nodes);
+	for (ui32 i = 0; i < nodes; ++i) weights[i] = 1.0 + (i % 4);
+	std::vector<ui32> out(n);
+	const std::string detail = "nodes=" + std::to_string(nodes);
+	auto run = [&](ll_string_t name, ll_string_t group, auto&& body) {
+		if (!matchesFilter(options, std::string(name) + " " + group + " " + detail)) return;
+		printRate(name, group, detail, measure(options, n, n * KEY_SIZE, body));
+	};
+
+	// What CityRendezvous replaces: a full CityHash64WithSeed per node
+	run("CityHash64WithSeed", "per node", [&]() {
+		for (len_t i = 0; i < n; ++i) {
+			ui64 best_score = 0;
+			ui32 best = 0;
+			for (ui32 node = 0; node < nodes; ++node) {
+				const ui64 score = city::CityHash64WithSeedUnchecked(keys.ptrs[i], KEY_SIZE, seeds[node]);
+				best = score > best_score ? node : best;
+				best_score = score > best_score ? score : best_score;
+			}
+			out[i] = best;
+		}
+		doNotOptimize(out[0]);
+	});
+	const CityRendezvous rendezvous(ids.data(), nodes);
+	run("CityRendezvous", "pick", [&]() {
+		for (len_t i = 0; i < n; ++i) out[i] = *rendezvous.pick(keys.ptrs[i], KEY_SIZE);
+		doNotOptimize(out[0]);
+	});
+	run("CityRendezvous", "pickBatch", [&]() {
+		doNotOptimize(rendezvous.pickBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n));
+	});
+	const CityRendezvous weighted(ids.data(), nodes, weights.data());
+	run("CityRendezvous", "weighted batch", [&]() {
+		doNotOptimize(weighted.pickBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n));
+	});
+	run("CityJumpHash", "pick", [&]() {
+		for (len_t i = 0; i < n; ++i) out[i] = *city::CityJumpHash(keys.ptrs[i], KEY_SIZE, nodes);
+		doNotOptimize(out[0]);
+	});
+	run("CityJumpHash", "batch", [&]() {
+		doNotOptimize(city::CityJumpHashBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n, nodes));
+	});
+	const CityMaglev maglev(ids.data(), nodes);
+	run("CityMaglev", "pick", [&]() {
+		for (len_t i = 0; i < n; ++i) out[i] = *maglev.pick(keys.ptrs[i], KEY_SIZE);
+		doNotOptimize(out[0]);
+	});
+	run("CityMaglev", "pickBatch", [&]() {
+		doNotOptimize(maglev.pickBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n));
+	});
+	if (matchesFilter(options, "CityMaglev build " + detail)) {
+		printRate("CityMaglev", "build", detail, measure(options, 1, 0, [&]() {
+			const CityMaglev table(ids.data(), nodes);
+			doNotOptimize(table.tableSize());
+		}));
+	}
+}
+
+} // namespace
+
+bool runShardSuite(const Options& options) {
+	const ShardKeys keys = makeKeys(len_t(1) << 20);
+
+	printHeader("keys routed per second vs node count, 16-byte keys");
+	for (const ui32 nodes : { 10u, 100u, 1000u, 10000u })
+		measureNodes(options, keys, nodes);
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
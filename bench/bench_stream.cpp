@@ -0,0 +1,116 @@
+//////////////////////////////////////////////
+//	bench_stream.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+namespace {
+
+constexpr ui64 SEED0 = 0x0123456789abcdefull;
+constexpr ui64 SEED1 = 0xfedcba9876543210ull;
+
+// Feeds s[0] ... s[len - 1] in chunks of "chunk" bytes
+template<class Stream>
+void feed(Stream& stream, ll_string_t s, len_t len, const len_t chunk) noexcept {
+	for (; len > chunk; s += chunk, len -= chunk)
+		(void)stream.update(s, chunk);
+	(void)stream.update(s, len);
+}
+
+bool checkStreams(const std::vector<ll_char_t>& buffer) {
+	constexpr len_t CHUNKS[] = { 1, 7, 16, 63, 64, 127, 128, 129, 1000 };
+	const hash::Hash128 seed(SEED0, SEED1);
+	for (len_t len = 0; len <= 1100; len += (len < 300 ? 1 : 37)) {
+		ll_string_t s = buffer.data() + (len % 29);
+		const hash::Hash128 expected128 = *city::CityHash128(s, len);
+		const hash::Hash128 expected_seed = *city::CityHash128WithSeed(s, len, seed);
+		const hash::Hash64 expected64 = *city::CityHash64(s, len);
+		ll_string_t tail = s + (len > 64 ? len - 64 : 0);
+		for (const len_t chunk : CHUNKS) {
+			city::CityHash128Stream h128(len);
+			city::CityHash128Stream h128_seed(len, seed);
+			city::CityHash64Stream h64(len, tail);
+			feed(h128, s, len, chunk);
+			feed(h128_seed, s, len, chunk);
+			feed(h64, s, len, chunk);
+			if (*h128.finalize() != expected128 || *h128_seed.finalize() != expected_seed ||
+				h64.finalize()->get() != expected64.get()) {
+				std::printf("FAILED: stream differs from one-shot at len=%zu chunk=%zu\n", len, chunk);
+				return false;
+			}
+		}
+	}
+
+	// Misuse is reported, not hashed
+	city::CityHash128Stream short_stream(100);
+	(void)short_stream.update(buffer.data(), 99);
+	city::CityHash128Stream long_stream(100);
+	const ll_bool_t accepted = long_stream.update(buffer.data(), 101);
+	city::CityHash64Stream no_tail(100, nullptr);
+	if (short_stream.finalize() || accepted || long_stream.finalize() || no_tail.finalize()) {
+		std::printf("FAILED: stream accepted a wrong length or a null tail\n");
+		return false;
+	}
+	return true;
+}
+
+} // namespace
+
+bool runStreamSuite(const Options& options) {
+	std::vector<ll_char_t> buffer(options.max_working_set < LLC_SIZE ? L2_SIZE : LLC_SIZE);
+	fillTestData(buffer);
+	const bool ok = checkStreams(buffer);
+
+	printHeader("stream vs one-shot");
+	constexpr len_t LENGTHS[] = { 4096, 65536, 1024 * 1024 };
+	constexpr len_t CHUNKS[] = { 100, 1500, 4096, 65536 };
+	for (const len_t len : LENGTHS) {
+		if (len > buffer.size()) continue;
+		ll_string_t s = buffer.data();
+		const std::string size = "len=" + sizeToString(len);
+		if (matchesFilter(options, "CityHash128 " + size)) {
+			printMeasure("CityHash128", "one-shot", size, measure(options, 1, len, [&]() {
+				doNotOptimize(*city::CityHash128(s, len));
+			}));
+		}
+		for (const len_t chunk : CHUNKS) {
+			if (chunk > len) continue;
+			const std::string detail = size + " chunk=" + std::to_string(chunk);
+			if (matchesFilter(options, "CityHash128Stream " + detail)) {
+				printMeasure("CityHash128Stream", "update", detail, measure(options, 1, len, [&]() {
+					city::CityHash128Stream stream(len);
+					feed(stream, s, len, chunk);
+					doNotOptimize(*stream.finalize());
+				}));
+			}
+		}
+		if (matchesFilter(options, "CityHash64 " + size)) {
+			printMeasure("CityHash64", "one-shot", size, measure(options, 1, len, [&]() {
+				doNotOptimize(*city::CityHash64(s, len));
+			}));
+		}
+		for (const len_t chunk : CHUNKS) {
+			if (chunk > len) continue;
+			const std::string detail = size + " chunk=" + std::to_string(chunk);
+			if (matchesFilter(options, "CityHash64Stream " + detail)) {
+				printMeasure("CityHash64Stream", "update", detail, measure(options, 1, len, [&]() {
+					city::CityHash64Stream stream(len, s + len - 64);
+					feed(stream, s, len, chunk);
+					doNotOptimize(*stream.finalize());
+				}));
+			}
+		}
+	}
+	return ok;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
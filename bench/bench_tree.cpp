@@ -0,0 +1,46 @@
+//////////////////////////////////////////////
+//	bench_tree.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+bool runTreeSuite(const Options& options) {
+	len_t size = options.max_working_set < DRAM_SIZE ? options.max_working_set : DRAM_SIZE;
+	std::vector<ll_char_t> buffer(size);
+	fillTestData(buffer);
+
+	printHeader("tree hash vs CityHash128");
+	const std::string detail = "len=" + sizeToString(size);
+	if (matchesFilter(options, "CityHash128 " + detail)) {
+		printMeasure("CityHash128", "one-shot", detail, measure(options, 1, size, [&]() {
+			doNotOptimize(*city::CityHash128(buffer.data(), size));
+		}));
+	}
+	for (len_t threads = 1; threads <= options.max_threads; threads *= 2) {
+		const std::string name = detail + " threads=" + std::to_string(threads);
+		if (!matchesFilter(options, "CityHashTree " + name)) continue;
+		printMeasure("CityHashTree", "leaf=1M", name, measure(options, 1, size, [&]() {
+			doNotOptimize(*city::CityHashTree(buffer.data(), size, city::CITYHASH_TREE_DEFAULT_LEAF_SIZE, threads));
+		}));
+	}
+	// Rehashing one changed leaf out of all of them
+	std::vector<hash::Hash128> leaves(city::CityHashTreeLeafCount(size));
+	(void)city::CityHashTree(buffer.data(), size, leaves.data());
+	if (matchesFilter(options, "CityHashTreeUpdate " + detail)) {
+		printMeasure("CityHashTreeUpdate", "one leaf", detail, measure(options, 1, city::CITYHASH_TREE_DEFAULT_LEAF_SIZE, [&]() {
+			doNotOptimize(*city::CityHashTreeUpdate(buffer.data(), size, leaves.data(), size, size / 2, size / 2 + 1));
+		}));
+	}
+	return true;
+}
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
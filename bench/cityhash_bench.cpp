@@ -0,0 +1,191 @@
+//////////////////////////////////////////////
+//	cityhash_bench.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "bench.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace llcpp {
+namespace city {
+namespace bench {
+
+#pragma region Report
+void printHeader(ll_string_t title) noexcept {
+	std::printf("\n== %s ==\n", title);
+	std::printf("%-22s %-16s %-28s %12s %12s %10s\n",
+		"function", "group", "case", "ns/op", "cycles/byte", "GB/s");
+}
+void printMeasure(ll_string_t function, ll_string_t group, const std::string& detail, const Measure& m) noexcept {
+	f64 ns_per_op = m.ns / static_cast<f64>(m.ops);
+	f64 cycles_per_byte = m.bytes ? m.cycles / static_cast<f64>(m.bytes) : 0.0;
+	f64 gbps = m.bytes ? static_cast<f64>(m.bytes) / m.ns : 0.0;
+	std::printf("%-22s %-16s %-28s %12.2f %12.3f %10.2f\n",
+		function, group, detail.c_str(), ns_per_op, cycles_per_byte, gbps);
+	std::fflush(stdout);
+}
+void printRate(ll_string_t function, ll_string_t group, const std::string& detail, const Measure& m) noexcept {
+	f64 ns_per_op = m.ns / static_cast<f64>(m.ops);
+	f64 mops = static_cast<f64>(m.ops) * 1e3 / m.ns;
+	std::printf("%-22s %-16s %-28s %12.2f %9.2f Mop/s\n",
+		function, group, detail.c_str(), ns_per_op, mops);
+	std::fflush(stdout);
+}
+bool matchesFilter(const Options& options, const std::string& name) noexcept {
+	return options.filter.empty() || name.find(options.filter) != std::string::npos;
+}
+std::string sizeToString(const len_t bytes) {
+	char buffer[32];
+	if (bytes >= (len_t(1) << 30) && bytes % (len_t(1) << 30) == 0)
+		std::snprintf(buffer, sizeof(buffer), "%zuG", bytes >> 30);
+	else if (bytes >= (len_t(1) << 20) && bytes % (len_t(1) << 20) == 0)
+		std::snprintf(buffer, sizeof(buffer), "%zuM", bytes >> 20);
+	else if (bytes >= (len_t(1) << 10) && bytes % (len_t(1) << 10) == 0)
+		std::snprintf(buffer, sizeof(buffer), "%zuK", bytes >> 10);
+	else std::snprintf(buffer, sizeof(buffer), "%zu", bytes);
+	return buffer;
+}
+
+#pragma endregion
+#pragma region Data
+void fillTestData(std::vector<ll_char_t>& buffer) {
+	constexpr ui64 k0 = llcpp::meta::hash::city::CityHash::k0;
+	ui64 a = 9;
+	ui64 b = 777;
+	for (len_t i = 0; i < buffer.size(); ++i) {
+		a += b;
+		b += a;
+		a = (a ^ (a >> 41)) * k0;
+		b = (b ^ (b >> 41)) * k0 + i;
+		buffer[i] = static_cast<ll_char_t>(b >> 37);
+	}
+}
+ll_string_t distributionName(const KeyDistribution dist) noexcept {
+	switch (dist) {
+		case KeyDistribution::Short:	return "short[1,16]";
+		case KeyDistribution::Medium:	return "medium[1,64]";
+		case KeyDistribution::Url:		return "url[~40,256]";
+		case KeyDistribution::Mixed:	return "mixed[1,4096]";
+		default:						return "unknown";
+	}
+}
+std::vector<KeyRef> generateKeys(const KeyDistribution dist, const len_t count, const len_t buffer_size, const ui64 seed) {
+	std::mt19937_64 rng(seed);
+	std::vector<KeyRef> keys;
+	keys.reserve(count);
+	for (len_t i = 0; i < count; ++i) {
+		len_t len = 0;
+		switch (dist) {
+			case KeyDistribution::Short:
+				len = 1 + rng() % 16;
+				break;
+			case KeyDistribution::Medium:
+				len = 1 + rng() % 64;
+				break;
+			case KeyDistribution::Url: {
+				std::geometric_distribution<len_t> geo(1.0 / 40.0);
+				len = 8 + geo(rng);
+				if (len > 256) len = 256;
+				break;
+			}
+			case KeyDistribution::Mixed:
+			default: {
+				std::uniform_real_distribution<f64> exponent(0.0, 12.0);
+				len = static_cast<len_t>(std::exp2(exponent(rng)));
+				break;
+			}
+		}
+		if (len > buffer_size) len = buffer_size;
+		keys.push_back(KeyRef{ static_cast<len_t>(rng() % (buffer_size - len + 1)), len });
+	}
+	return keys;
+}
+
+#pragma endregion
+
+} // namespace bench
+} // namespace city
+} // namespace llcpp
+
+namespace {
+
+using llcpp::city::bench::Options;
+
+struct Suite {
+	ll_string_t name;
+	ll_string_t description;
+	bool (*run)(const Options&);
+};
+
+constexpr Suite SUITES[] = {
+	{ "hash", "CityHash32/64/128 per length bucket, key distribution and working set", llcpp::city::bench::runHashSuite },
+	{ "batch", "CityHash32Batch/CityHash64Batch/CityHash128Batch against a loop of scalar calls", llcpp::city::bench::runBatchSuite },
+	{ "stream", "CityHash128Stream/CityHash64Stream against the one-shot functions", llcpp::city::bench::runStreamSuite },
+	{ "tree", "CityHashTree scaling with threads and partial updates", llcpp::city::bench::runTreeSuite },
+	{ "map", "CityFlatMap against std::unordered_map from 1K to 100M entries", llcpp::city::bench::runMapSuite },
+	{ "intern", "CityStringInterner contention from 1 to 64 threads", llcpp::city::bench::runInternSuite },
+	{ "bloom", "CityBloomFilter lookups, batched and AVX2, against a k-hash Bloom filter", llcpp::city::bench::runBloomSuite },
+	{ "hll", "CityHyperLogLog accuracy, add/addBatch throughput and merges", llcpp::city::bench::runHllSuite },
+	{ "shard", "Jump, rendezvous and Maglev routing from 10 to 10,000 nodes", llcpp::city::bench::runShardSuite },
+	{ "count", "CityCountMinSketch/CityHeavyHitters accuracy and throughput from 1 to 64 threads", llcpp::city::bench::runCountMinSuite },
+	{ "minhash", "CityHash64WithSeedsMulti and MinHash signatures against a hash per seed", llcpp::city::bench::runMinHashSuite },
+	{ "cdc", "Content-defined chunking with CityHash128 fingerprints, GB/s and dedup ratio", llcpp::city::bench::runCdcSuite },
+	{ "fields", "CityHash64Fields of composite keys against packing them into a buffer", llcpp::city::bench::runFieldsSuite },
+	{ "async", "CityAsyncHasher (io_uring or pread pool) against blocking reads of many files", llcpp::city::bench::runAsyncSuite },
+	{ "pipeline", "CityLookupPipeline against hash-then-probe loops on tables of 1 MiB to 16 GiB", llcpp::city::bench::runPipelineSuite },
+};
+
+void usage(ll_string_t program) noexcept {
+	std::printf(
+		"usage: %s [--suite=NAME] [--filter=TEXT] [--min-time=MS] [--max-working-set=BYTES] [--max-threads=N] [--quick]\n"
+		"suites:\n", program);
+	for (const Suite& suite : SUITES)
+		std::printf("  %-12s %s\n", suite.name, suite.description);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	Options options{};
+	options.min_time_ms = 200.0;
+	options.max_working_set = llcpp::city::bench::DRAM_SIZE;
+	options.max_threads = std::thread::hardware_concurrency();
+	if (options.max_threads == 0) options.max_threads = 1;
+
+	for (int i = 1; i < argc; ++i) {
+		ll_string_t arg = argv[i];
+		if (std::strncmp(arg, "--suite=", 8) == 0) options.suite = arg + 8;
+		else if (std::strncmp(arg, "--filter=", 9) == 0) options.filter = arg + 9;
+		else if (std::strncmp(arg, "--min-time=", 11) == 0) options.min_time_ms = std::atof(arg + 11);
+		else if (std::strncmp(arg, "--max-working-set=", 18) == 0) options.max_working_set = std::strtoull(arg + 18, nullptr, 10);
+		else if (std::strncmp(arg, "--max-threads=", 14) == 0) options.max_threads = std::strtoull(arg + 14, nullptr, 10);
+		else if (std::strcmp(arg, "--quick") == 0) {
+			options.min_time_ms = 20.0;
+			options.max_working_set = llcpp::city::bench::LLC_SIZE;
+		}
+		else {
+			usage(argv[0]);
+			return std::strcmp(arg, "--help") == 0 ? 0 : 1;
+		}
+	}
+
+	bool found = false;
+	bool ok = true;
+	for (const Suite& suite : SUITES) {
+		if (!options.suite.empty() && options.suite != suite.name) continue;
+		found = true;
+		ok &= suite.run(options);
+	}
+	if (!found) {
+		std::fprintf(stderr, "Unknown suite: %s\n", options.suite.c_str());
+		usage(argv[0]);
+		return 1;
+	}
+	return ok ? 0 : 1;
+}
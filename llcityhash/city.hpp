@@ -38,7 +38,7 @@
 // nearest competitor is Bob Jenkins' Spooky.  We don't have great data for
 // other 64-bit CPUs, but for long strings we know that Spooky is slightly
 // faster than CityHash on some relatively recent AMD x86-64 CPUs, for example.
-// Note that CityHashCrc128 is declared in citycrc.h.
+// Note that CityHashCrc128 is declared below and runs on any CPU.
 //
 // For 32-bit x86 code, we don't know of anything faster than CityHash32 that
 // is of comparable quality.  We believe our nearest competitor is Murmur3A.
@@ -73,12 +73,419 @@
 #include <llanylib/cityhash.hpp>
 #include <llanylib/hash_tools.hpp>
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
 namespace llcpp {
 namespace city {
 
 namespace traits = llcpp::meta::traits;
 namespace hash = llcpp::meta::hash;
 
+#pragma region Header
+namespace __internal__ {
+namespace header {
+// The CityHash32 / CityHash64 code.  city.cpp and city_internal.hpp call it,
+// and being constexpr it can also be inlined into callers and run in
+// constant expressions.  There std::memcpy is not allowed, so bytes are read
+// one at a time, in the little-endian order Fetch32 / Fetch64 use on every
+// host.
+
+__LL_NODISCARD__ constexpr ui32 Bswap32(const ui32 x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap32(x);
+#else
+	return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+#endif
+}
+__LL_NODISCARD__ constexpr ui64 Bswap64(const ui64 x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap64(x);
+#else
+	return (static_cast<ui64>(Bswap32(static_cast<ui32>(x))) << 32) | Bswap32(static_cast<ui32>(x >> 32));
+#endif
+}
+
+__LL_NODISCARD__ constexpr ui32 Fetch32(ll_string_t p) noexcept {
+	ui32 result = 0;
+	if (std::is_constant_evaluated()) {
+		for (len_t i = 0; i < 4; ++i)
+			result |= static_cast<ui32>(static_cast<ui8>(p[i])) << (8 * i);
+		return result;
+	}
+	std::memcpy(&result, p, sizeof(result));
+	if constexpr (std::endian::native == std::endian::big) result = Bswap32(result);
+	return result;
+}
+__LL_NODISCARD__ constexpr ui64 Fetch64(ll_string_t p) noexcept {
+	ui64 result = 0;
+	if (std::is_constant_evaluated()) {
+		for (len_t i = 0; i < 8; ++i)
+			result |= static_cast<ui64>(static_cast<ui8>(p[i])) << (8 * i);
+		return result;
+	}
+	std::memcpy(&result, p, sizeof(result));
+	if constexpr (std::endian::native == std::endian::big) result = Bswap64(result);
+	return result;
+}
+__LL_NODISCARD__ constexpr ui32 Rotate32(const ui32 val, const i32 shift) noexcept {
+	return shift == 0 ? val : ((val >> shift) | (val << (32 - shift)));
+}
+__LL_NODISCARD__ constexpr ui64 Rotate(const ui64 val, const i32 shift) noexcept {
+	return shift == 0 ? val : ((val >> shift) | (val << (64 - shift)));
+}
+__LL_NODISCARD__ constexpr ui64 ShiftMix(const ui64 val) noexcept {
+	return val ^ (val >> 47);
+}
+
+#pragma region Hash32
+constexpr ui32 c1 = llcpp::meta::hash::city::CityHash::c1;
+constexpr ui32 c2 = llcpp::meta::hash::city::CityHash::c2;
+
+__LL_NODISCARD__ constexpr ui32 fmix(ui32 h) noexcept {
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+	return h;
+}
+__LL_NODISCARD__ constexpr ui32 Mur(ui32 a, ui32 h) noexcept {
+	a *= c1;
+	a = Rotate32(a, 17);
+	a *= c2;
+	h ^= a;
+	h = Rotate32(h, 19);
+	return h * 5 + 0xe6546b64;
+}
+__LL_NODISCARD__ constexpr ui32 Hash32Len13to24(ll_string_t s, const len_t len) noexcept {
+	ui32 a = Fetch32(s - 4 + (len >> 1));
+	ui32 b = Fetch32(s + 4);
+	ui32 c = Fetch32(s + len - 8);
+	ui32 d = Fetch32(s + (len >> 1));
+	ui32 e = Fetch32(s);
+	ui32 f = Fetch32(s + len - 4);
+	ui32 h = static_cast<ui32>(len);
+	return fmix(Mur(f, Mur(e, Mur(d, Mur(c, Mur(b, Mur(a, h)))))));
+}
+__LL_NODISCARD__ constexpr ui32 Hash32Len0to4(ll_string_t s, const len_t len) noexcept {
+	ui32 b = 0;
+	ui32 c = 9;
+	for (len_t i = 0; i < len; ++i) {
+		signed char v = static_cast<signed char>(s[i]);
+		b = b * c1 + static_cast<ui32>(v);
+		c ^= b;
+	}
+	return fmix(Mur(b, Mur(static_cast<ui32>(len), c)));
+}
+__LL_NODISCARD__ constexpr ui32 Hash32Len5to12(ll_string_t s, const len_t len) noexcept {
+	ui32 a = static_cast<ui32>(len), b = a * 5, c = 9, d = b;
+	a += Fetch32(s);
+	b += Fetch32(s + len - 4);
+	c += Fetch32(s + ((len >> 1) & 4));
+	return fmix(Mur(c, Mur(b, Mur(a, d))));
+}
+__LL_NODISCARD__ constexpr ui32 CityHash32(ll_string_t s, const len_t len) noexcept {
+	if (len <= 24) {
+		return len <= 12 ?
+			(len <= 4 ? Hash32Len0to4(s, len) : Hash32Len5to12(s, len)) :
+			Hash32Len13to24(s, len);
+	}
+
+	ui32 h = static_cast<ui32>(len), g = c1 * h, f = g;
+	ui32 b0 = Rotate32(Fetch32(s + len - 4) * c1, 17) * c2;
+	ui32 b1 = Rotate32(Fetch32(s + len - 8) * c1, 17) * c2;
+	ui32 b2 = Rotate32(Fetch32(s + len - 16) * c1, 17) * c2;
+	ui32 b3 = Rotate32(Fetch32(s + len - 12) * c1, 17) * c2;
+	ui32 b4 = Rotate32(Fetch32(s + len - 20) * c1, 17) * c2;
+	h ^= b0;
+	h = Rotate32(h, 19);
+	h = h * 5 + 0xe6546b64;
+	h ^= b2;
+	h = Rotate32(h, 19);
+	h = h * 5 + 0xe6546b64;
+	g ^= b1;
+	g = Rotate32(g, 19);
+	g = g * 5 + 0xe6546b64;
+	g ^= b3;
+	g = Rotate32(g, 19);
+	g = g * 5 + 0xe6546b64;
+	f += b4;
+	f = Rotate32(f, 19);
+	f = f * 5 + 0xe6546b64;
+	len_t iters = (len - 1) / 20;
+	do {
+		ui32 a0 = Rotate32(Fetch32(s) * c1, 17) * c2;
+		ui32 a1 = Fetch32(s + 4);
+		ui32 a2 = Rotate32(Fetch32(s + 8) * c1, 17) * c2;
+		ui32 a3 = Rotate32(Fetch32(s + 12) * c1, 17) * c2;
+		ui32 a4 = Fetch32(s + 16);
+		h ^= a0;
+		h = Rotate32(h, 18);
+		h = h * 5 + 0xe6546b64;
+		f += a1;
+		f = Rotate32(f, 19);
+		f = f * c1;
+		g += a2;
+		g = Rotate32(g, 18);
+		g = g * 5 + 0xe6546b64;
+		h ^= a3 + a1;
+		h = Rotate32(h, 19);
+		h = h * 5 + 0xe6546b64;
+		g ^= a4;
+		g = Bswap32(g) * 5;
+		h += a4 * 5;
+		h = Bswap32(h);
+		f += a0;
+		// PERMUTE3(f, h, g)
+		const ui32 t = f;
+		f = g;
+		g = h;
+		h = t;
+		s += 20;
+	} while (--iters != 0);
+	g = Rotate32(g, 11) * c1;
+	g = Rotate32(g, 17) * c1;
+	f = Rotate32(f, 11) * c1;
+	f = Rotate32(f, 17) * c1;
+	h = Rotate32(h + g, 19);
+	h = h * 5 + 0xe6546b64;
+	h = Rotate32(h, 17) * c1;
+	h = Rotate32(h + f, 19);
+	h = h * 5 + 0xe6546b64;
+	h = Rotate32(h, 17) * c1;
+	return h;
+}
+
+#pragma endregion
+#pragma region Hash64
+constexpr ui64 k0 = llcpp::meta::hash::city::CityHash::k0;
+constexpr ui64 k1 = llcpp::meta::hash::city::CityHash::k1;
+constexpr ui64 k2 = llcpp::meta::hash::city::CityHash::k2;
+
+// Hash128 to 64 bits (hash::Hash128's conversion to ui64)
+__LL_NODISCARD__ constexpr ui64 HashLen16(const ui64 u, const ui64 v, const ui64 mul = 0x9ddfea08eb382d69ull) noexcept {
+	ui64 a = (u ^ v) * mul;
+	a ^= (a >> 47);
+	ui64 b = (v ^ a) * mul;
+	b ^= (b >> 47);
+	b *= mul;
+	return b;
+}
+__LL_NODISCARD__ constexpr ui64 HashLen0to16(ll_string_t s, const len_t len) noexcept {
+	if (len >= 8) {
+		ui64 mul = k2 + len * 2;
+		ui64 a = Fetch64(s) + k2;
+		ui64 b = Fetch64(s + len - 8);
+		ui64 c = Rotate(b, 37) * mul + a;
+		ui64 d = (Rotate(a, 25) + b) * mul;
+		return HashLen16(c, d, mul);
+	}
+	if (len >= 4) {
+		ui64 mul = k2 + len * 2;
+		ui64 a = Fetch32(s);
+		return HashLen16(len + (a << 3), Fetch32(s + len - 4), mul);
+	}
+	if (len > 0) {
+		ui8 a = static_cast<ui8>(s[0]);
+		ui8 b = static_cast<ui8>(s[len >> 1]);
+		ui8 c = static_cast<ui8>(s[len - 1]);
+		ui32 y = static_cast<ui32>(a) + (static_cast<ui32>(b) << 8);
+		ui32 z = static_cast<ui32>(len) + (static_cast<ui32>(c) << 2);
+		return ShiftMix(y * k2 ^ z * k0) * k2;
+	}
+	return k2;
+}
+// HashLen17to32 and HashLen33to64 of a key whose 8 bytes at "offset" are
+// fetch(offset): keys assembled in registers pass a fetch that shifts them
+// out of their words instead of reading memory
+template<class Fetch>
+__LL_NODISCARD__ constexpr ui64 HashWords17to32(const Fetch& fetch, const len_t len) noexcept {
+	ui64 mul = k2 + len * 2;
+	ui64 a = fetch(0) * k1;
+	ui64 b = fetch(8);
+	ui64 c = fetch(len - 8) * mul;
+	ui64 d = fetch(len - 16) * k2;
+	return HashLen16(Rotate(a + b, 43) + Rotate(c, 30) + d,
+		a + Rotate(b + k2, 18) + c, mul);
+}
+template<class Fetch>
+__LL_NODISCARD__ constexpr ui64 HashWords33to64(const Fetch& fetch, const len_t len) noexcept {
+	ui64 mul = k2 + len * 2;
+	ui64 a = fetch(0) * k2;
+	ui64 b = fetch(8);
+	ui64 c = fetch(len - 24);
+	ui64 d = fetch(len - 32);
+	ui64 e = fetch(16) * k2;
+	ui64 f = fetch(24) * 9;
+	ui64 g = fetch(len - 8);
+	ui64 h = fetch(len - 16) * mul;
+	ui64 u = Rotate(a + g, 43) + (Rotate(b, 30) + c) * 9;
+	ui64 v = ((a + g) ^ d) + f + 1;
+	ui64 w = Bswap64((u + v) * mul) + h;
+	ui64 x = Rotate(e + f, 42) + c;
+	ui64 y = (Bswap64((v + w) * mul) + g) * mul;
+	ui64 z = e + f + c;
+	a = Bswap64((x + z) * mul + y) + b;
+	b = ShiftMix((z + a) * mul + d + h) * mul;
+	return b + x;
+}
+__LL_NODISCARD__ constexpr ui64 HashLen17to32(ll_string_t s, const len_t len) noexcept {
+	return HashWords17to32([s](const len_t offset) { return Fetch64(s + offset); }, len);
+}
+__LL_NODISCARD__ constexpr ui64 HashLen33to64(ll_string_t s, const len_t len) noexcept {
+	return HashWords33to64([s](const len_t offset) { return Fetch64(s + offset); }, len);
+}
+
+struct Pair {
+	ui64 low, high;
+};
+
+__LL_NODISCARD__ constexpr Pair WeakHashLen32WithSeeds(ll_string_t s, ui64 a, ui64 b) noexcept {
+	const ui64 w = Fetch64(s), x = Fetch64(s + 8), y = Fetch64(s + 16), z = Fetch64(s + 24);
+	a += w;
+	b = Rotate(b + a + z, 21);
+	ui64 c = a;
+	a += x;
+	a += y;
+	b += Rotate(a, 44);
+	return Pair{ a + z, b + c };
+}
+
+// 56 bytes of state of the CityHash64 and CityHash128 main loops
+struct LoopState {
+	Pair v, w;
+	ui64 x, y, z;
+};
+
+// CityHash64, len > 64: initial state from the last 64 bytes of the input
+// ("end" points just past them) and its first 8 bytes
+constexpr void CityHash64Init(LoopState& st, ll_string_t end, const len_t len, const ui64 first) noexcept {
+	st.x = Fetch64(end - 40);
+	st.y = Fetch64(end - 16) + Fetch64(end - 56);
+	st.z = HashLen16(Fetch64(end - 48) + len, Fetch64(end - 24));
+	st.v = WeakHashLen32WithSeeds(end - 64, len, st.z);
+	st.w = WeakHashLen32WithSeeds(end - 32, st.y + k1, st.x);
+	st.x = st.x * k1 + first;
+}
+// Hashes s[0] ... s[63]
+constexpr void CityHash64Round(LoopState& st, ll_string_t s) noexcept {
+	st.x = Rotate(st.x + st.y + st.v.low + Fetch64(s + 8), 37) * k1;
+	st.y = Rotate(st.y + st.v.high + Fetch64(s + 48), 42) * k1;
+	st.x ^= st.w.high;
+	st.y += st.v.low + Fetch64(s + 40);
+	st.z = Rotate(st.z + st.w.low, 33) * k1;
+	st.v = WeakHashLen32WithSeeds(s, st.v.high * k1, st.x + st.w.low);
+	st.w = WeakHashLen32WithSeeds(s + 32, st.z + st.w.high, st.y + Fetch64(s + 16));
+	const ui64 t = st.z;
+	st.z = st.x;
+	st.x = t;
+}
+__LL_NODISCARD__ constexpr ui64 CityHash64Final(const LoopState& st) noexcept {
+	return HashLen16(HashLen16(st.v.low, st.w.low) + ShiftMix(st.y) * k1 + st.z,
+		HashLen16(st.v.high, st.w.high) + st.x);
+}
+
+__LL_NODISCARD__ constexpr ui64 CityHash64(ll_string_t s, len_t len) noexcept {
+	if (len <= 32) {
+		if (len <= 16) return HashLen0to16(s, len);
+		else return HashLen17to32(s, len);
+	}
+	else if (len <= 64) return HashLen33to64(s, len);
+
+	// For strings over 64 bytes we hash the end first, and then as we
+	// loop we keep 56 bytes of state: v, w, x, y, and z.
+	LoopState st{};
+	CityHash64Init(st, s + len, len, Fetch64(s));
+
+	// Decrease len to the nearest multiple of 64, and operate on 64-byte chunks.
+	len = (len - 1) & ~static_cast<len_t>(63);
+	do {
+		CityHash64Round(st, s);
+		s += 64;
+		len -= 64;
+	} while (len != 0);
+	return CityHash64Final(st);
+}
+
+#pragma endregion
+
+#pragma region Keys
+// HashLen0to16 of keys of 1, 2, 4, 8 and 16 bytes held in registers, given
+// as the little-endian reading of their bytes
+__LL_NODISCARD__ constexpr ui64 HashKey1(const ui8 v) noexcept {
+	const ui32 y = static_cast<ui32>(v) + (static_cast<ui32>(v) << 8);
+	const ui32 z = 1 + (static_cast<ui32>(v) << 2);
+	return ShiftMix(y * k2 ^ z * k0) * k2;
+}
+__LL_NODISCARD__ constexpr ui64 HashKey2(const ui16 v) noexcept {
+	const ui32 y = v;
+	const ui32 z = 2 + (static_cast<ui32>(v >> 8) << 2);
+	return ShiftMix(y * k2 ^ z * k0) * k2;
+}
+__LL_NODISCARD__ constexpr ui64 HashKey4(const ui32 v) noexcept {
+	return HashLen16(4 + (static_cast<ui64>(v) << 3), v, k2 + 8);
+}
+// First and last 8 bytes of a key of 8 to 16 bytes
+__LL_NODISCARD__ constexpr ui64 HashKeyWords(const ui64 first, const ui64 last, const ui64 mul) noexcept {
+	const ui64 a = first + k2;
+	const ui64 c = Rotate(last, 37) * mul + a;
+	const ui64 d = (Rotate(a, 25) + last) * mul;
+	return HashLen16(c, d, mul);
+}
+__LL_NODISCARD__ constexpr ui64 HashKey8(const ui64 v) noexcept {
+	return HashKeyWords(v, v, k2 + 16);
+}
+__LL_NODISCARD__ constexpr ui64 HashKey16(const ui64 low, const ui64 high) noexcept {
+	return HashKeyWords(low, high, k2 + 32);
+}
+
+#if defined(__SIZEOF_INT128__)
+template<class T>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_INT128 = std::is_same_v<std::remove_cv_t<T>, __int128> || std::is_same_v<std::remove_cv_t<T>, unsigned __int128>;
+#else
+template<class T>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_INT128 = false;
+#endif // __SIZEOF_INT128__
+
+template<class T>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_REGISTER_KEY =
+	(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T> || IS_INT128<T>) &&
+	(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 16);
+
+// CityHash64 of the bytes of "key" as they are in memory
+template<class T>
+__LL_NODISCARD__ constexpr ui64 HashKey(const T key) noexcept {
+	static_assert(IS_REGISTER_KEY<T>, "keys are integers, enums or pointers of 1, 2, 4, 8 or 16 bytes");
+	constexpr ll_bool_t SWAP = std::endian::native == std::endian::big;
+	if constexpr (std::is_enum_v<T>) return HashKey(static_cast<std::underlying_type_t<T>>(key));
+	else if constexpr (std::is_pointer_v<T>) return HashKey(reinterpret_cast<std::uintptr_t>(key));
+	else if constexpr (sizeof(T) == 1) return HashKey1(static_cast<ui8>(key));
+	else if constexpr (sizeof(T) == 2) {
+		const ui16 v = static_cast<ui16>(key);
+		return HashKey2(SWAP ? static_cast<ui16>((v >> 8) | (v << 8)) : v);
+	}
+	else if constexpr (sizeof(T) == 4) return HashKey4(SWAP ? Bswap32(static_cast<ui32>(key)) : static_cast<ui32>(key));
+	else if constexpr (sizeof(T) == 8) return HashKey8(SWAP ? Bswap64(static_cast<ui64>(key)) : static_cast<ui64>(key));
+#if defined(__SIZEOF_INT128__)
+	else {
+		const unsigned __int128 v = static_cast<unsigned __int128>(key);
+		const ui64 low = static_cast<ui64>(v);
+		const ui64 high = static_cast<ui64>(v >> 64);
+		return SWAP ? HashKey16(Bswap64(high), Bswap64(low)) : HashKey16(low, high);
+	}
+#endif // __SIZEOF_INT128__
+}
+
+#pragma endregion
+
+} // namespace header
+} // namespace __internal__
+
+#pragma endregion
 #pragma region Hash32
 // Hash function for a byte array.  Most useful in 32-bit binaries.
 __LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash32 CityHash32(ll_string_t buf, len_t len) noexcept;
@@ -105,17 +512,25 @@ __LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash64 CityHash64WithSeed(ll_strin
 __LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash64 CityHash64WithSeeds(ll_string_t buf, const len_t len, const ui64 seed0, const ui64 seed1) noexcept;
 
 #pragma region Objects
+// Integer, enum and pointer keys are hashed from the register (see
+// CityHash64Key); other objects as an array of sizeof(U) bytes.
 template<class U, class W = traits::cinput<U>>
 __LL_NODISCARD__ __LL_INLINE__ hash::OptionalHash64 CityHash64(W data) noexcept {
-	return city::CityHash64(reinterpret_cast<ll_string_t>(&data), sizeof(U));
+	if constexpr (__internal__::header::IS_REGISTER_KEY<U>)
+		return __internal__::header::HashKey<U>(data);
+	else return city::CityHash64(reinterpret_cast<ll_string_t>(&data), sizeof(U));
 }
 template<class U, class W = traits::cinput<U>>
 __LL_NODISCARD__ __LL_INLINE__ hash::OptionalHash64 CityHash64WithSeed(W data, const ui64 seed) noexcept {
-	return city::CityHash64WithSeed(reinterpret_cast<ll_string_t>(&data), sizeof(U), seed);
+	if constexpr (__internal__::header::IS_REGISTER_KEY<U>)
+		return __internal__::header::HashLen16(__internal__::header::HashKey<U>(data) - __internal__::header::k2, seed);
+	else return city::CityHash64WithSeed(reinterpret_cast<ll_string_t>(&data), sizeof(U), seed);
 }
 template<class U, class W = traits::cinput<U>>
 __LL_NODISCARD__ __LL_INLINE__ hash::OptionalHash64 CityHash64WithSeeds(W data, const ui64 seed0, const ui64 seed1) noexcept {
-	return city::CityHash64WithSeeds(reinterpret_cast<ll_string_t>(&data), sizeof(U), seed0, seed1);
+	if constexpr (__internal__::header::IS_REGISTER_KEY<U>)
+		return __internal__::header::HashLen16(__internal__::header::HashKey<U>(data) - seed0, seed1);
+	else return city::CityHash64WithSeeds(reinterpret_cast<ll_string_t>(&data), sizeof(U), seed0, seed1);
 }
 
 #pragma endregion
@@ -144,6 +559,312 @@ __LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash128 CityHash128(ll_string_t s,
 // hashed into the result.
 __LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash128 CityHash128WithSeed(ll_string_t s, len_t len, const hash::Hash128& seed) noexcept;
 
+// Same as CityHash128 and CityHash128WithSeed, without std::optional or the
+// null check: s must not be null.
+__LL_NODISCARD__ LL_SHARED_LIB  hash::Hash128 CityHash128Unchecked(ll_string_t s, len_t len) noexcept;
+__LL_NODISCARD__ LL_SHARED_LIB  hash::Hash128 CityHash128WithSeedUnchecked(ll_string_t s, len_t len, const hash::Hash128& seed) noexcept;
+
+#pragma endregion
+#pragma region Inline
+// CityHash32, CityHash64 and CityHash64WithSeed of a string, usable in
+// constant expressions (case labels, template arguments, static tables):
+//	switch (city::CityHash64Const(name)) {
+//		case city::CityHash64Const("content-length"): ...
+//	}
+// The compiler runs the header code above; at run time they call the
+// functions of city.cpp, which run that same code.  A string_view cannot
+// be invalid, so these return the hash value itself.
+__LL_NODISCARD__ __LL_INLINE__ constexpr ui32 CityHash32Const(const std::string_view str) noexcept {
+	if (std::is_constant_evaluated() || !str.data())
+		return __internal__::header::CityHash32(str.data(), str.size());
+	return city::CityHash32(str.data(), str.size())->get();
+}
+__LL_NODISCARD__ __LL_INLINE__ constexpr ui64 CityHash64Const(const std::string_view str) noexcept {
+	if (std::is_constant_evaluated() || !str.data())
+		return __internal__::header::CityHash64(str.data(), str.size());
+	return city::CityHash64(str.data(), str.size())->get();
+}
+__LL_NODISCARD__ __LL_INLINE__ constexpr ui64 CityHash64WithSeedConst(const std::string_view str, const ui64 seed) noexcept {
+	if (std::is_constant_evaluated() || !str.data())
+		return __internal__::header::HashLen16(
+			__internal__::header::CityHash64(str.data(), str.size()) - __internal__::header::k2, seed);
+	return city::CityHash64WithSeed(str.data(), str.size(), seed)->get();
+}
+
+// CityHash32, CityHash64 and CityHash64WithSeed for hot paths: inlined into
+// the caller, with no std::optional and no null check (s must not be null).
+// Same values as the checked functions.
+__LL_NODISCARD__ __LL_INLINE__ ui32 CityHash32Unchecked(ll_string_t s, const len_t len) noexcept {
+	return __internal__::header::CityHash32(s, len);
+}
+__LL_NODISCARD__ __LL_INLINE__ ui64 CityHash64Unchecked(ll_string_t s, const len_t len) noexcept {
+	return __internal__::header::CityHash64(s, len);
+}
+__LL_NODISCARD__ __LL_INLINE__ ui64 CityHash64WithSeedUnchecked(ll_string_t s, const len_t len, const ui64 seed) noexcept {
+	return __internal__::header::HashLen16(__internal__::header::CityHash64(s, len) - __internal__::header::k2, seed);
+}
+
+// CityHash64 of exactly N bytes at s (not null).  The length bucket is
+// chosen at compile time, so keys of 8 or 16 bytes (integers, pairs, ids)
+// become a few loads and multiplies with no branches.
+template<len_t N>
+__LL_NODISCARD__ __LL_INLINE__ ui64 CityHash64Fixed(const void* s) noexcept {
+	ll_string_t p = static_cast<ll_string_t>(s);
+	if constexpr (N <= 16) return __internal__::header::HashLen0to16(p, N);
+	else if constexpr (N <= 32) return __internal__::header::HashLen17to32(p, N);
+	else if constexpr (N <= 64) return __internal__::header::HashLen33to64(p, N);
+	else return __internal__::header::CityHash64(p, N);
+}
+
+// CityHash64 of an integer, enum or pointer key of 1, 2, 4, 8 or 16 bytes:
+// the value of CityHash64<T>(key), i.e. of its bytes in memory, computed
+// from the register with a few multiplies instead of loads and the length
+// dispatch.
+template<class T>
+__LL_NODISCARD__ __LL_INLINE__ constexpr ui64 CityHash64Key(const T key) noexcept {
+	return __internal__::header::HashKey<T>(key);
+}
+// 128-bit key: CityHash64 of low then high, 8 little-endian bytes each
+__LL_NODISCARD__ __LL_INLINE__ constexpr ui64 CityHash64Key(const ui64 low, const ui64 high) noexcept {
+	return __internal__::header::HashKey16(low, high);
+}
+__LL_NODISCARD__ __LL_INLINE__ ui64 CityHash64Key(const hash::Hash128& key) noexcept {
+	return __internal__::header::HashKey16(key.getLow(), key.getHigh());
+}
+
+#pragma endregion
+#pragma region HashedString
+class CityStringInterner;
+
+// A string (pointer and length, not owned) with its CityHash64, computed
+// once.  Hashing it again is free, and two of them with different hashes or
+// lengths compare unequal without reading any byte.  CityStringInterner
+// hands them out for the strings it stores, so equal interned strings also
+// share their pointer.
+class CityHashedString {
+	private:
+		ll_string_t str;
+		len_t length;
+		ui64 hash_value;
+
+	private:
+		friend class CityStringInterner;
+		// Same string stored elsewhere, with a hash already computed
+		constexpr CityHashedString(ll_string_t s, const len_t len, const ui64 hash) noexcept
+			: str(s), length(len), hash_value(hash) {}
+
+	public:
+		constexpr CityHashedString() noexcept
+			: str(""), length(0), hash_value(__internal__::header::k2) {}
+		// A null s is the empty string
+		constexpr CityHashedString(ll_string_t s, const len_t len) noexcept
+			: str(s ? s : "")
+			, length(s ? len : 0)
+			, hash_value(__internal__::header::CityHash64(this->str, this->length))
+		{}
+		constexpr explicit CityHashedString(const std::string_view s) noexcept
+			: CityHashedString(s.data(), s.size()) {}
+
+		__LL_NODISCARD__ constexpr ll_string_t begin() const noexcept { return this->str; }
+		__LL_NODISCARD__ constexpr ll_string_t end() const noexcept { return this->str + this->length; }
+		__LL_NODISCARD__ constexpr len_t len() const noexcept { return this->length; }
+		// CityHash64(begin(), len())
+		__LL_NODISCARD__ constexpr ui64 hash() const noexcept { return this->hash_value; }
+		__LL_NODISCARD__ constexpr std::string_view view() const noexcept { return std::string_view(this->str, this->length); }
+
+		__LL_NODISCARD__ ll_bool_t operator==(const CityHashedString& other) const noexcept {
+			return this->hash_value == other.hash_value && this->length == other.length &&
+				(this->str == other.str || std::memcmp(this->str, other.str, this->length) == 0);
+		}
+		__LL_NODISCARD__ ll_bool_t operator!=(const CityHashedString& other) const noexcept {
+			return !(*this == other);
+		}
+};
+
+// The cached hash: same value as CityHash64(str.begin(), str.len())
+__LL_NODISCARD__ __LL_INLINE__ hash::OptionalHash64 CityHash64(const CityHashedString& str) noexcept {
+	return hash::Hash64(str.hash());
+}
+
+#pragma endregion
+#pragma region Crc
+// Hash function for a byte array.  Uses the crc32 instruction of SSE4.2 when
+// this CPU has it, and a table-driven CRC32C with the same output otherwise.
+// For strings of up to 900 bytes the result equals CityHash128.
+__LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash128 CityHashCrc128(ll_string_t s, len_t len) noexcept;
+
+// Hash function for a byte array.  For convenience, a 128-bit seed is also
+// hashed into the result.
+__LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash128 CityHashCrc128WithSeed(ll_string_t s, len_t len, const hash::Hash128& seed) noexcept;
+
+// Hash function for a byte array.  Sets result[0] ... result[3].
+// Returns false if s or result is null.
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityHashCrc256(ll_string_t s, len_t len, ui64* result) noexcept;
+
+// True if the Crc functions run on the crc32 instruction on this CPU.
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityHashCrcIsAccelerated() noexcept;
+
+#pragma endregion
+#pragma region Batch
+// Instruction sets the batch functions can run on.  AVX2 hashes 4 keys of
+// 4 to 64 bytes at once and AVX-512 8.  For CityHash64Batch, Auto keeps the
+// scalar lanes except on runs of 17 to 64 byte keys, which it hashes with
+// AVX-512 if this CPU has it: those are the only buckets where the vectors
+// measured faster (see city_simd.cpp).  SSE4.1 only has
+// CityHash32 kernels; CityHash32Batch hashes 4, 8 or 16 keys of up to 24
+// bytes at once with SSE4.1, AVX2 or AVX-512.
+enum class BatchKernel : ui8 {
+	Auto,
+	Scalar,
+	Avx2,
+	Avx512,
+	Sse41
+};
+
+// Avx512 if Auto uses AVX-512 kernels on this CPU, Scalar otherwise.
+__LL_NODISCARD__ LL_SHARED_LIB  BatchKernel GetBestBatchKernel() noexcept;
+
+// Hashes "n" independent keys: out[i] = CityHash64(ptrs[i], lens[i]).
+// Keys are grouped by length bucket.  Keys up to 16 bytes are hashed four
+// at a time, interleaved, which keeps the multiplier busy; a SIMD kernel
+// takes keys up to 64 bytes in vector lanes; the rest are hashed one by
+// one.  Returns false if any array is null, if the requested kernel is not
+// supported by this CPU, or if any key is null (its output is 0).
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityHash64Batch(const ll_string_t* ptrs, const len_t* lens, ui64* out, len_t n, const BatchKernel kernel = BatchKernel::Auto) noexcept;
+
+// Same as CityHash64Batch with out[i] = CityHash32(ptrs[i], lens[i]).  Here
+// Auto prefers AVX-512, then AVX2, then SSE4.1: all the multiplies are
+// 32-bit, and one pmulld does them in every lane.  Keys over 24 bytes are
+// hashed one by one.
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityHash32Batch(const ll_string_t* ptrs, const len_t* lens, ui32* out, len_t n, const BatchKernel kernel = BatchKernel::Auto) noexcept;
+
+// Same as CityHash64Batch with out[i] = CityHash128(ptrs[i], lens[i]).
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityHash128Batch(const ll_string_t* ptrs, const len_t* lens, hash::Hash128* out, len_t n) noexcept;
+
+// One key under many seeds: out[i] = CityHash64WithSeeds(s, len, seeds0[i],
+// seeds1[i]), or CityHash64WithSeed(s, len, seeds1[i]) if seeds0 is null.
+// s is hashed once and the seeds are mixed into that hash 4 (AVX2) or 8
+// (AVX-512) at a time; here Auto prefers AVX-512, as the mixing is all
+// 64-bit multiplies.  Returns false if s, seeds1 or out is null, or if the
+// requested kernel is not supported by this CPU.
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityHash64WithSeedsMulti(ll_string_t s, const len_t len, const ui64* seeds0, const ui64* seeds1, ui64* out, const len_t n, const BatchKernel kernel = BatchKernel::Auto) noexcept;
+
+#pragma endregion
+#pragma region Stream
+namespace __internal__ {
+using CityHashLoopState = header::LoopState;
+
+} // namespace __internal__
+
+// Incremental CityHash128 / CityHash128WithSeed for data that arrives in
+// chunks.  CityHash128 mixes the total length into its state before reading
+// the first round, so the length has to be known up front.  update() takes
+// chunks of any size and hashes every 128-byte round as soon as it is
+// complete; only a partial round and the 32 bytes before it are buffered.
+// finalize() returns the same value as the one-shot function, or nullopt if
+// a chunk was null or the chunks do not add up to total_len.
+class LL_SHARED_LIB CityHash128Stream {
+	private:
+		__internal__::CityHashLoopState state;
+		hash::Hash128 seed;
+		len_t total_len;	// Bytes announced
+		len_t fed;			// Bytes received
+		len_t seeded_len;	// Bytes hashed with "seed" (total_len minus the 16-byte prefix of CityHash128)
+		len_t rounds;		// 128-byte rounds still to hash
+		len_t buffered;
+		ui8 prefix;			// Bytes of the CityHash128 seed prefix, 16 or 0
+		ll_bool_t started;
+		ll_bool_t failed;
+		// [0, 32): last 32 bytes of the last round, [32, 160): pending bytes
+		ll_char_t buffer[32 + 128];
+
+	private:
+		// Hashes "count" consecutive 128-byte rounds
+		void hashRounds(ll_string_t s, const len_t count) noexcept;
+
+	public:
+		// Same result as CityHash128(s, total_len)
+		CityHash128Stream(const len_t total_len) noexcept;
+		// Same result as CityHash128WithSeed(s, total_len, seed)
+		CityHash128Stream(const len_t total_len, const hash::Hash128& seed) noexcept;
+
+		// Returns false if s is null or total_len would be exceeded;
+		//	finalize() fails from then on
+		ll_bool_t update(ll_string_t s, len_t len) noexcept;
+		__LL_NODISCARD__ hash::OptionalHash128 finalize() const noexcept;
+};
+
+// Incremental CityHash64 for inputs of known length.  CityHash64 starts from
+// the last 64 bytes of the input, so they are passed to the constructor
+// ("tail" points at the last min(total_len, 64) bytes, e.g. read first from
+// the end of a file).  The input is then fed from the start with update(),
+// in chunks of any size, and finalize() returns CityHash64(s, total_len), or
+// nullopt if tail or a chunk was null or the chunks do not add up to
+// total_len.
+class LL_SHARED_LIB CityHash64Stream {
+	private:
+		__internal__::CityHashLoopState state;
+		len_t total_len;
+		len_t fed;
+		len_t blocks;		// 64-byte blocks still to hash
+		len_t buffered;
+		ll_bool_t started;
+		ll_bool_t failed;
+		ll_char_t tail[64];
+		ll_char_t buffer[64];
+
+	private:
+		// Hashes "count" consecutive 64-byte blocks
+		void hashBlocks(ll_string_t s, const len_t count) noexcept;
+
+	public:
+		CityHash64Stream(const len_t total_len, ll_string_t tail) noexcept;
+
+		// Returns false if s is null or total_len would be exceeded;
+		//	finalize() fails from then on
+		ll_bool_t update(ll_string_t s, len_t len) noexcept;
+		__LL_NODISCARD__ hash::OptionalHash64 finalize() const noexcept;
+};
+
+#pragma endregion
+#pragma region Tree
+// Tree hash for multi-gigabyte buffers.  This is a different function from
+// CityHash128, with its own output:
+//	- the input is cut into leaves of leaf_size bytes (the last one may be
+//		shorter), and leaf i is CityHash128WithSeed(leaf, leaf_len,
+//		Hash128(i, leaf_size)),
+//	- the root is CityHash128WithSeed over the leaf digests (low then high
+//		64 bits, little-endian), seeded with Hash128(len,
+//		CITYHASH_TREE_VERSION).
+// Leaves are hashed in parallel, but the result only depends on the data and
+// leaf_size, never on the number of threads.  CITYHASH_TREE_VERSION changes
+// whenever this layout does, so stored digests can be told apart.
+__LL_VAR_INLINE__ constexpr ui64 CITYHASH_TREE_VERSION = 1;
+__LL_VAR_INLINE__ constexpr len_t CITYHASH_TREE_DEFAULT_LEAF_SIZE = 1 << 20;
+
+// Number of leaves of a "len" bytes input
+__LL_NODISCARD__ __LL_INLINE__ constexpr len_t CityHashTreeLeafCount(const len_t len, const len_t leaf_size = CITYHASH_TREE_DEFAULT_LEAF_SIZE) noexcept {
+	return leaf_size ? (len + leaf_size - 1) / leaf_size : 0;
+}
+
+// Tree hash of s[0] ... s[len - 1] on up to "threads" threads (0 uses every
+// core).  Returns nullopt if s is null or leaf_size is 0.
+__LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash128 CityHashTree(ll_string_t s, len_t len, const len_t leaf_size = CITYHASH_TREE_DEFAULT_LEAF_SIZE, const len_t threads = 0) noexcept;
+
+// Same, and stores the digest of every leaf in leaves[0] ...
+// leaves[CityHashTreeLeafCount(len, leaf_size) - 1] for CityHashTreeUpdate.
+// Also returns nullopt if leaves is null.
+__LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash128 CityHashTree(ll_string_t s, len_t len, hash::Hash128* leaves, const len_t leaf_size = CITYHASH_TREE_DEFAULT_LEAF_SIZE, const len_t threads = 0) noexcept;
+
+// Tree hash of s[0] ... s[len - 1], given the digests "leaves" of the same
+// buffer when it was old_len bytes long, of which only the bytes in
+// [changed_begin, changed_end) have changed since.  The leaves overlapping
+// that range are hashed again, and so are the leaves from the shorter of
+// old_len and len on (they grew, shrank or are new); the others are reused.
+// "leaves" is updated and must have room for the new leaf count.  Returns
+// nullopt if s or leaves is null or leaf_size is 0.
+__LL_NODISCARD__ LL_SHARED_LIB  hash::OptionalHash128 CityHashTreeUpdate(ll_string_t s, len_t len, hash::Hash128* leaves, const len_t old_len, const len_t changed_begin, const len_t changed_end, const len_t leaf_size = CITYHASH_TREE_DEFAULT_LEAF_SIZE, const len_t threads = 0) noexcept;
+
 #pragma endregion
 
 namespace __internal__ {
@@ -0,0 +1,766 @@
+//////////////////////////////////////////////
+//	city_async.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_async.hpp"
+#include "city_parallel.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define LL_CITY_ASYNC_POSIX
+#endif // POSIX
+
+#if defined(__linux__) && defined(LL_CITY_ASYNC_POSIX) && __has_include(<linux/io_uring.h>)
+	#include <linux/io_uring.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <sys/uio.h>
+	#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+		#define LL_CITY_ASYNC_IO_URING
+	#endif // __NR_io_uring_setup
+#endif // __linux__
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+#if defined(LL_CITY_ASYNC_POSIX)
+
+// Buffers are aligned for the page cache copy (and O_DIRECT, if ever used)
+constexpr len_t ASYNC_ALIGNMENT = 4096;
+
+__LL_NODISCARD__ __LL_INLINE__ f64 AsyncNow() noexcept {
+	return std::chrono::duration<f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// A read of "length" bytes at "offset" of fd into buffer "buffer"
+struct AsyncRead {
+	len_t buffer;
+	i32 fd;
+	ll_char_t* data;
+	len_t length;
+	len_t offset;
+};
+struct AsyncCompletion {
+	len_t buffer;
+	i64 result;		// Bytes read, or -errno
+};
+
+#pragma region IoUring
+#if defined(LL_CITY_ASYNC_IO_URING)
+class IoUringEngine {
+	private:
+		i32 ring_fd;
+		void* sq_map;
+		void* cq_map;
+		io_uring_sqe* sqes;
+		len_t sq_map_size;
+		len_t cq_map_size;
+		len_t sqes_size;
+		ui32* sq_tail;
+		ui32 sq_mask;
+		ui32* sq_array;
+		ui32* cq_head;
+		ui32* cq_tail;
+		ui32 cq_mask;
+		io_uring_cqe* cqes;
+		ui32 unsubmitted;
+		ll_bool_t registered;
+		std::unique_ptr<iovec[]> iovecs;	// One per buffer, for IORING_OP_READV
+
+	private:
+		__LL_NODISCARD__ static i32 enter(const i32 fd, const ui32 to_submit, const ui32 min_complete, const ui32 flags) noexcept {
+			return static_cast<i32>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+		}
+
+	public:
+		IoUringEngine() noexcept
+			: ring_fd(-1), sq_map(MAP_FAILED), cq_map(MAP_FAILED), sqes(nullptr)
+			, sq_map_size(0), cq_map_size(0), sqes_size(0)
+			, sq_tail(nullptr), sq_mask(0), sq_array(nullptr)
+			, cq_head(nullptr), cq_tail(nullptr), cq_mask(0), cqes(nullptr)
+			, unsubmitted(0), registered(false), iovecs()
+		{}
+		IoUringEngine(const IoUringEngine&) = delete;
+		IoUringEngine& operator=(const IoUringEngine&) = delete;
+		~IoUringEngine() noexcept {
+			if (this->sqes) (void)::munmap(this->sqes, this->sqes_size);
+			if (this->cq_map != MAP_FAILED && this->cq_map != this->sq_map) (void)::munmap(this->cq_map, this->cq_map_size);
+			if (this->sq_map != MAP_FAILED) (void)::munmap(this->sq_map, this->sq_map_size);
+			if (this->ring_fd >= 0) (void)::close(this->ring_fd);
+		}
+
+		// A ring of at least "entries" reads over buffers[0] ... buffers[count *
+		//	size - 1], registered with the kernel if it accepts them
+		__LL_NODISCARD__ ll_bool_t init(const ui32 entries, ll_char_t* buffers, const len_t size, const len_t count) noexcept {
+			io_uring_params params{};
+			this->ring_fd = static_cast<i32>(::syscall(__NR_io_uring_setup, entries, &params));
+			if (this->ring_fd < 0) return false;
+
+			this->sq_map_size = params.sq_off.array + params.sq_entries * sizeof(ui32);
+			this->cq_map_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+			if (params.features & IORING_FEAT_SINGLE_MMAP) {
+				if (this->cq_map_size > this->sq_map_size) this->sq_map_size = this->cq_map_size;
+				this->cq_map_size = this->sq_map_size;
+			}
+			this->sq_map = ::mmap(nullptr, this->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->ring_fd, IORING_OFF_SQ_RING);
+			if (this->sq_map == MAP_FAILED) return false;
+			this->cq_map = (params.features & IORING_FEAT_SINGLE_MMAP) ? this->sq_map :
+				::mmap(nullptr, this->cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->ring_fd, IORING_OFF_CQ_RING);
+			if (this->cq_map == MAP_FAILED) return false;
+			this->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+			void* sqes_map = ::mmap(nullptr, this->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->ring_fd, IORING_OFF_SQES);
+			if (sqes_map == MAP_FAILED) return false;
+			this->sqes = static_cast<io_uring_sqe*>(sqes_map);
+
+			ui8* sq = static_cast<ui8*>(this->sq_map);
+			ui8* cq = static_cast<ui8*>(this->cq_map);
+			this->sq_tail = reinterpret_cast<ui32*>(sq + params.sq_off.tail);
+			this->sq_mask = *reinterpret_cast<ui32*>(sq + params.sq_off.ring_mask);
+			this->sq_array = reinterpret_cast<ui32*>(sq + params.sq_off.array);
+			this->cq_head = reinterpret_cast<ui32*>(cq + params.cq_off.head);
+			this->cq_tail = reinterpret_cast<ui32*>(cq + params.cq_off.tail);
+			this->cq_mask = *reinterpret_cast<ui32*>(cq + params.cq_off.ring_mask);
+			this->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+			this->iovecs.reset(new (std::nothrow) iovec[count]);
+			if (!this->iovecs) return false;
+			for (len_t i = 0; i < count; ++i)
+				this->iovecs[i] = iovec{ buffers + i * size, size };
+			// Pinned buffers save the kernel a page walk per read; this fails
+			//	when RLIMIT_MEMLOCK is too low, and plain reads are used instead
+			this->registered = ::syscall(__NR_io_uring_register, this->ring_fd, IORING_REGISTER_BUFFERS,
+				this->iovecs.get(), static_cast<ui32>(count)) == 0;
+			return true;
+		}
+		__LL_NODISCARD__ ll_bool_t isRegistered() const noexcept { return this->registered; }
+
+		// There is always room: no more reads are in flight than buffers, and
+		//	the ring has at least as many entries
+		void submit(const AsyncRead& read) noexcept {
+			const ui32 tail = std::atomic_ref<ui32>(*this->sq_tail).load(std::memory_order_relaxed);
+			const ui32 index = tail & this->sq_mask;
+			io_uring_sqe& sqe = this->sqes[index];
+			std::memset(&sqe, 0, sizeof(sqe));
+			sqe.fd = read.fd;
+			sqe.off = read.offset;
+			sqe.user_data = read.buffer;
+			if (this->registered) {
+				sqe.opcode = IORING_OP_READ_FIXED;
+				sqe.addr = reinterpret_cast<ui64>(read.data);
+				sqe.len = static_cast<ui32>(read.length);
+				sqe.buf_index = static_cast<ui16>(read.buffer);
+			}
+			else {
+				// READV needs a live iovec until the read is submitted
+				iovec& vec = this->iovecs[read.buffer];
+				vec.iov_base = read.data;
+				vec.iov_len = read.length;
+				sqe.opcode = IORING_OP_READV;
+				sqe.addr = reinterpret_cast<ui64>(&vec);
+				sqe.len = 1;
+			}
+			this->sq_array[index] = index;
+			std::atomic_ref<ui32>(*this->sq_tail).store(tail + 1, std::memory_order_release);
+			++this->unsubmitted;
+		}
+
+		// Submits the pending reads, waits for at least one completion and
+		//	returns those available (up to max).  0 means the ring failed.
+		__LL_NODISCARD__ len_t wait(AsyncCompletion* out, const len_t max) noexcept {
+			ui32 head = std::atomic_ref<ui32>(*this->cq_head).load(std::memory_order_relaxed);
+			for (;;) {
+				// New reads go to the device even when completions are waiting
+				const ll_bool_t ready = head != std::atomic_ref<ui32>(*this->cq_tail).load(std::memory_order_acquire);
+				if (ready && this->unsubmitted == 0) break;
+				const i32 result = enter(this->ring_fd, this->unsubmitted, ready ? 0 : 1, ready ? 0 : IORING_ENTER_GETEVENTS);
+				if (result < 0) {
+					if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+					return 0;
+				}
+				this->unsubmitted -= static_cast<ui32>(result);
+			}
+			len_t n = 0;
+			const ui32 tail = std::atomic_ref<ui32>(*this->cq_tail).load(std::memory_order_acquire);
+			for (; head != tail && n < max; ++head, ++n) {
+				const io_uring_cqe& cqe = this->cqes[head & this->cq_mask];
+				out[n] = AsyncCompletion{ static_cast<len_t>(cqe.user_data), cqe.res };
+			}
+			std::atomic_ref<ui32>(*this->cq_head).store(head, std::memory_order_release);
+			return n;
+		}
+};
+#endif // LL_CITY_ASYNC_IO_URING
+
+#pragma endregion
+#pragma region ThreadPool
+// Reads run on a pool of threads calling pread, as many as buffers (up to
+//	ASYNC_POOL_MAX_THREADS): a blocked pread is one read in flight
+constexpr len_t ASYNC_POOL_MAX_THREADS = 64;
+
+class ThreadPoolEngine {
+	private:
+		std::mutex lock;
+		std::condition_variable requests_ready;
+		std::condition_variable completions_ready;
+		std::deque<AsyncRead> requests;		// Oldest first, in the order a file is read
+		std::vector<AsyncCompletion> completions;
+		std::vector<std::thread> threads;
+		ll_bool_t stopping;
+
+	private:
+		void run() noexcept {
+			std::unique_lock<std::mutex> guard(this->lock);
+			for (;;) {
+				this->requests_ready.wait(guard, [this]() { return this->stopping || !this->requests.empty(); });
+				if (this->requests.empty()) return;
+				const AsyncRead read = this->requests.front();
+				this->requests.pop_front();
+				guard.unlock();
+				i64 result = ::pread(read.fd, read.data, read.length, static_cast<off_t>(read.offset));
+				if (result < 0) result = -static_cast<i64>(errno);
+				guard.lock();
+				// Room was reserved when the buffer's read was requested
+				this->completions.push_back(AsyncCompletion{ read.buffer, result });
+				this->completions_ready.notify_one();
+			}
+		}
+
+	public:
+		ThreadPoolEngine() noexcept
+			: lock(), requests_ready(), completions_ready(), requests(), completions(), threads(), stopping(false) {}
+		ThreadPoolEngine(const ThreadPoolEngine&) = delete;
+		ThreadPoolEngine& operator=(const ThreadPoolEngine&) = delete;
+		~ThreadPoolEngine() noexcept {
+			{
+				std::lock_guard<std::mutex> guard(this->lock);
+				this->stopping = true;
+			}
+			this->requests_ready.notify_all();
+			for (std::thread& t : this->threads) t.join();
+		}
+
+		__LL_NODISCARD__ ll_bool_t init(const len_t count) noexcept {
+			try {
+				this->completions.reserve(count);
+				const len_t workers = count < ASYNC_POOL_MAX_THREADS ? count : ASYNC_POOL_MAX_THREADS;
+				for (len_t i = 0; i < workers; ++i)
+					this->threads.emplace_back([this]() { this->run(); });
+			}
+			catch (...) {
+				// Fewer threads still make progress
+				return !this->threads.empty();
+			}
+			return true;
+		}
+
+		void submit(const AsyncRead& read) noexcept {
+			{
+				std::lock_guard<std::mutex> guard(this->lock);
+				this->requests.push_back(read);
+			}
+			this->requests_ready.notify_one();
+		}
+
+		__LL_NODISCARD__ len_t wait(AsyncCompletion* out, const len_t max) noexcept {
+			std::unique_lock<std::mutex> guard(this->lock);
+			this->completions_ready.wait(guard, [this]() { return !this->completions.empty(); });
+			len_t n = 0;
+			for (; n < max && !this->completions.empty(); ++n) {
+				out[n] = this->completions.back();
+				this->completions.pop_back();
+			}
+			return n;
+		}
+};
+
+#pragma endregion
+#pragma region Worker
+// Shared by the hashing threads of one hashFiles call
+struct AsyncShared {
+	const ll_string_t* paths;
+	len_t count;
+	std::atomic<len_t> next;		// Next file to open
+	CityAsyncCallback callback;
+	void* user;
+	std::mutex callback_lock;
+	CityAsyncStats stats;			// Sums, under callback_lock
+	ui64 depth_sum;					// Reads in flight, summed over waits
+	len_t depth_samples;			// Waits
+};
+
+struct AsyncFile {
+	len_t index;
+	i32 fd;
+	i32 error;
+	len_t size;
+	len_t submitted;				// Bytes whose reads were submitted
+	std::vector<len_t> queue;		// Buffers of the file in offset order; queue[head] is hashed next
+	len_t head;
+	CityHash128Stream stream;
+
+	AsyncFile() noexcept
+		: index(0), fd(-1), error(0), size(0), submitted(0), queue(), head(0), stream(0) {}
+};
+
+struct AsyncBuffer {
+	len_t file;			// Slot of the file it reads for
+	len_t offset;		// Offset of data[0] in the file
+	len_t length;		// Bytes wanted
+	len_t filled;		// Bytes read so far
+	ll_bool_t done;		// Filled, or failed
+};
+
+// One hashing thread: reads files through "engine" into count buffers of
+//	size bytes and hashes them in order
+template<class Engine>
+class AsyncWorker {
+	private:
+		Engine& engine;
+		AsyncShared& shared;
+		ll_char_t* data;
+		len_t size;
+		std::vector<AsyncBuffer> buffers;
+		std::vector<len_t> free_buffers;
+		std::vector<AsyncFile> files;			// One slot per buffer
+		std::vector<len_t> free_files;
+		std::vector<len_t> active;				// Open files, oldest first
+		std::vector<AsyncCompletion> completions;
+		len_t in_flight;
+		ll_bool_t exhausted;					// No file left to open
+		CityAsyncStats stats;
+		ui64 depth_sum;
+		len_t depth_samples;
+
+	private:
+		void report(const AsyncFile& file, const hash::Hash128& digest) noexcept {
+			const CityFileDigest result{ file.index, this->shared.paths[file.index], digest, file.size, file.error };
+			++this->stats.files;
+			if (file.error) ++this->stats.failed;
+			else this->stats.bytes += file.size;
+			std::lock_guard<std::mutex> guard(this->shared.callback_lock);
+			this->shared.callback(result, this->shared.user);
+		}
+
+		// Opens the next file of the list into a free slot, or reports it if it
+		//	is empty or cannot be opened.  Returns false when none is left.
+		__LL_NODISCARD__ ll_bool_t openNext() noexcept {
+			if (this->exhausted) return false;
+			const len_t index = this->shared.next++;
+			if (index >= this->shared.count) {
+				this->exhausted = true;
+				return false;
+			}
+			const len_t slot = this->free_files.back();
+			AsyncFile& file = this->files[slot];
+			file.index = index;
+			file.error = 0;
+			file.size = 0;
+			file.submitted = 0;
+			file.queue.clear();
+			file.head = 0;
+
+			ll_string_t path = this->shared.paths[index];
+			file.fd = path ? ::open(path, O_RDONLY | O_CLOEXEC) : -1;
+			struct stat st{};
+			if (file.fd < 0) file.error = path ? errno : EINVAL;
+			else if (::fstat(file.fd, &st) != 0) file.error = errno;
+			else if (!S_ISREG(st.st_mode)) file.error = S_ISDIR(st.st_mode) ? EISDIR : EINVAL;
+			else file.size = static_cast<len_t>(st.st_size);
+
+			if (file.error || file.size == 0) {
+				if (file.fd >= 0) (void)::close(file.fd);
+				this->report(file, file.error ? hash::Hash128() : *CityHash128Stream(0).finalize());
+				return true;
+			}
+#if defined(POSIX_FADV_SEQUENTIAL)
+			(void)::posix_fadvise(file.fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif // POSIX_FADV_SEQUENTIAL
+			file.stream = CityHash128Stream(file.size);
+			this->free_files.pop_back();
+			this->active.push_back(slot);
+			return true;
+		}
+
+		void submit(const len_t b) noexcept {
+			const AsyncBuffer& buffer = this->buffers[b];
+			this->engine.submit(AsyncRead{ b, this->files[buffer.file].fd, this->data + b * this->size + buffer.filled,
+				buffer.length - buffer.filled, buffer.offset + buffer.filled });
+			++this->in_flight;
+			++this->stats.reads;
+		}
+
+		// Gives every free buffer a read, of the oldest file with bytes left
+		//	or else of a newly opened one.  Returns false when there is no
+		//	more to read.
+		__LL_NODISCARD__ ll_bool_t fill() noexcept {
+			len_t next = 0;
+			while (!this->free_buffers.empty()) {
+				while (next < this->active.size()) {
+					const AsyncFile& file = this->files[this->active[next]];
+					if (!file.error && file.submitted < file.size) break;
+					++next;
+				}
+				if (next == this->active.size() && (this->free_files.empty() || !this->openNext()))
+					return this->in_flight > 0;
+				if (next == this->active.size()) continue;
+
+				const len_t slot = this->active[next];
+				AsyncFile& file = this->files[slot];
+				const len_t b = this->free_buffers.back();
+				this->free_buffers.pop_back();
+				const len_t left = file.size - file.submitted;
+				this->buffers[b] = AsyncBuffer{ slot, file.submitted, left < this->size ? left : this->size, 0, false };
+				file.submitted += this->buffers[b].length;
+				file.queue.push_back(b);
+				this->submit(b);
+			}
+			return true;
+		}
+
+		// Hashes the buffers of a file that are next in order, and closes it
+		//	once it is hashed or failed with no read left in flight
+		void advance(const len_t slot) noexcept {
+			AsyncFile& file = this->files[slot];
+			while (file.head < file.queue.size() && this->buffers[file.queue[file.head]].done) {
+				const len_t b = file.queue[file.head++];
+				if (!file.error) {
+					const f64 t0 = AsyncNow();
+					(void)file.stream.update(this->data + b * this->size, this->buffers[b].length);
+					this->stats.hash_seconds += AsyncNow() - t0;
+				}
+				this->free_buffers.push_back(b);
+			}
+			const ll_bool_t finished = file.error ?
+				file.head == file.queue.size() :
+				file.head == file.queue.size() && file.submitted == file.size;
+			if (!finished) return;
+
+			(void)::close(file.fd);
+			file.fd = -1;
+			if (file.error) this->report(file, hash::Hash128());
+			else {
+				const hash::OptionalHash128 digest = file.stream.finalize();
+				if (!digest) file.error = EIO;
+				this->report(file, digest ? *digest : hash::Hash128());
+			}
+			for (len_t i = 0; i < this->active.size(); ++i) {
+				if (this->active[i] != slot) continue;
+				this->active.erase(this->active.begin() + static_cast<std::ptrdiff_t>(i));
+				break;
+			}
+			this->free_files.push_back(slot);
+		}
+
+		void complete(const AsyncCompletion& completion) noexcept {
+			--this->in_flight;
+			AsyncBuffer& buffer = this->buffers[completion.buffer];
+			AsyncFile& file = this->files[buffer.file];
+			if (completion.result == -EINTR || completion.result == -EAGAIN) {
+				this->submit(completion.buffer);
+				return;
+			}
+			if (completion.result < 0) file.error = static_cast<i32>(-completion.result);
+			// The file shrank since it was opened
+			else if (completion.result == 0) file.error = EIO;
+			else {
+				buffer.filled += static_cast<len_t>(completion.result);
+				// Short read: ask for the rest
+				if (buffer.filled < buffer.length) {
+					this->submit(completion.buffer);
+					return;
+				}
+			}
+			buffer.done = true;
+			this->advance(buffer.file);
+		}
+
+	public:
+		AsyncWorker(Engine& engine, AsyncShared& shared, ll_char_t* data, const len_t size, const len_t count)
+			: engine(engine), shared(shared), data(data), size(size)
+			, buffers(count), free_buffers(), files(count), free_files(), active(), completions(count)
+			, in_flight(0), exhausted(false), stats(), depth_sum(0), depth_samples(0)
+		{
+			this->free_buffers.reserve(count);
+			this->free_files.reserve(count);
+			this->active.reserve(count);
+			for (len_t i = count; i > 0; --i) {
+				this->free_buffers.push_back(i - 1);
+				this->free_files.push_back(i - 1);
+			}
+		}
+
+		// Returns false if the engine failed; the files still open are
+		//	reported as failed
+		ll_bool_t run() noexcept {
+			ll_bool_t ok = true;
+			while (this->fill()) {
+				this->depth_sum += this->in_flight;
+				++this->depth_samples;
+				if (this->in_flight > this->stats.max_queue_depth) this->stats.max_queue_depth = this->in_flight;
+				const f64 t0 = AsyncNow();
+				const len_t n = this->engine.wait(this->completions.data(), this->completions.size());
+				this->stats.wait_seconds += AsyncNow() - t0;
+				if (n == 0) {
+					ok = false;
+					break;
+				}
+				for (len_t i = 0; i < n; ++i) this->complete(this->completions[i]);
+			}
+			if (!ok) {
+				// Reads still in flight may write into the buffers until the
+				//	engine is torn down, which the caller does before freeing them
+				for (const len_t slot : this->active) {
+					AsyncFile& file = this->files[slot];
+					(void)::close(file.fd);
+					file.error = EIO;
+					this->report(file, hash::Hash128());
+				}
+				this->active.clear();
+			}
+
+			std::lock_guard<std::mutex> guard(this->shared.callback_lock);
+			CityAsyncStats& total = this->shared.stats;
+			total.files += this->stats.files;
+			total.failed += this->stats.failed;
+			total.bytes += this->stats.bytes;
+			total.reads += this->stats.reads;
+			total.hash_seconds += this->stats.hash_seconds;
+			total.wait_seconds += this->stats.wait_seconds;
+			total.max_queue_depth = total.max_queue_depth > this->stats.max_queue_depth ? total.max_queue_depth : this->stats.max_queue_depth;
+			this->shared.depth_sum += this->depth_sum;
+			this->shared.depth_samples += this->depth_samples;
+			return ok;
+		}
+		__LL_NODISCARD__ len_t inFlight() const noexcept { return this->in_flight; }
+};
+
+#pragma endregion
+#pragma region Context
+// Buffers and ring (or pool) of one hashing thread, kept between calls
+struct AsyncContext {
+	std::unique_ptr<ll_char_t[], void(*)(ll_char_t*)> data;
+#if defined(LL_CITY_ASYNC_IO_URING)
+	std::unique_ptr<IoUringEngine> ring;
+#endif // LL_CITY_ASYNC_IO_URING
+	std::unique_ptr<ThreadPoolEngine> pool;
+
+	AsyncContext() noexcept
+		: data(nullptr, [](ll_char_t* p) { ::operator delete[](p, std::align_val_t(ASYNC_ALIGNMENT)); })
+#if defined(LL_CITY_ASYNC_IO_URING)
+		, ring()
+#endif // LL_CITY_ASYNC_IO_URING
+		, pool()
+	{}
+	~AsyncContext() noexcept {
+		// Declared after the buffers, but must be torn down before them
+#if defined(LL_CITY_ASYNC_IO_URING)
+		this->ring.reset();
+#endif // LL_CITY_ASYNC_IO_URING
+		this->pool.reset();
+	}
+
+	// Sets up count buffers of size bytes and the engine of "backend"
+	__LL_NODISCARD__ ll_bool_t init(const AsyncBackend backend, const len_t size, const len_t count) noexcept {
+		this->data.reset(static_cast<ll_char_t*>(::operator new[](size * count, std::align_val_t(ASYNC_ALIGNMENT), std::nothrow)));
+		if (!this->data) return false;
+#if defined(LL_CITY_ASYNC_IO_URING)
+		if (backend == AsyncBackend::IoUring) {
+			ui32 entries = 1;
+			while (entries < count) entries <<= 1;
+			this->ring.reset(new (std::nothrow) IoUringEngine());
+			if (this->ring && this->ring->init(entries, this->data.get(), size, count)) return true;
+			this->ring.reset();
+			return false;
+		}
+#endif // LL_CITY_ASYNC_IO_URING
+		(void)backend;
+		this->pool.reset(new (std::nothrow) ThreadPoolEngine());
+		if (this->pool && this->pool->init(count)) return true;
+		this->pool.reset();
+		return false;
+	}
+};
+
+#pragma endregion
+
+#else
+struct AsyncContext {};
+
+#endif // LL_CITY_ASYNC_POSIX
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+#pragma region Hasher
+CityAsyncHasher::CityAsyncHasher(const CityAsyncOptions& options) noexcept
+	: options(options)
+	, last()
+	, contexts()
+{
+	if (this->options.buffer_size == 0) this->options.buffer_size = 1;
+	if (this->options.buffer_count == 0) this->options.buffer_count = 1;
+}
+CityAsyncHasher::CityAsyncHasher(CityAsyncHasher&&) noexcept = default;
+CityAsyncHasher& CityAsyncHasher::operator=(CityAsyncHasher&&) noexcept = default;
+CityAsyncHasher::~CityAsyncHasher() noexcept = default;
+
+ll_bool_t CityAsyncHasher::hashFiles(const std::vector<std::string>& paths, CityAsyncCallback callback, void* user) noexcept {
+	std::vector<ll_string_t> list;
+	try {
+		list.reserve(paths.size());
+		for (const std::string& path : paths) list.push_back(path.c_str());
+	}
+	catch (...) {
+		return false;
+	}
+	static constexpr ll_string_t NONE[1] = {};
+	return this->hashFiles(list.empty() ? NONE : list.data(), list.size(), callback, user);
+}
+
+const CityAsyncStats& CityAsyncHasher::stats() const noexcept { return this->last; }
+const CityAsyncOptions& CityAsyncHasher::getOptions() const noexcept { return this->options; }
+
+ll_bool_t CityAsyncHasher::isIoUringAvailable() noexcept {
+#if defined(LL_CITY_ASYNC_IO_URING)
+	static const ll_bool_t AVAILABLE = []() {
+		io_uring_params params{};
+		const i32 fd = static_cast<i32>(::syscall(__NR_io_uring_setup, 1, &params));
+		if (fd < 0) return false;
+		(void)::close(fd);
+		return true;
+	}();
+	return AVAILABLE;
+#else
+	return false;
+#endif // LL_CITY_ASYNC_IO_URING
+}
+
+#if defined(LL_CITY_ASYNC_POSIX)
+ll_bool_t CityAsyncHasher::hashFiles(const ll_string_t* paths, const len_t count, CityAsyncCallback callback, void* user) noexcept {
+	this->last = CityAsyncStats();
+	if (!paths || !callback) return false;
+	AsyncBackend backend = this->options.backend;
+	if (backend == AsyncBackend::Auto)
+		backend = isIoUringAvailable() ? AsyncBackend::IoUring : AsyncBackend::ThreadPool;
+	if (backend == AsyncBackend::IoUring && !isIoUringAvailable()) return false;
+
+	const len_t size = (this->options.buffer_size + ASYNC_ALIGNMENT - 1) & ~(ASYNC_ALIGNMENT - 1);
+	const len_t buffers = this->options.buffer_count;
+	// Registered buffers are indexed with 16 bits and reads are 32-bit long
+	if (size > 0x7ffff000 || (backend == AsyncBackend::IoUring && buffers > 0x8000)) return false;
+	const len_t threads = WorkerCount(count, this->options.threads);
+	try {
+		if (this->contexts.size() < threads) this->contexts.resize(threads);
+	}
+	catch (...) {
+		return false;
+	}
+
+	AsyncShared shared;
+	shared.paths = paths;
+	shared.count = count;
+	shared.next = 0;
+	shared.callback = callback;
+	shared.user = user;
+	shared.stats = CityAsyncStats();
+	shared.depth_sum = 0;
+	shared.depth_samples = 0;
+
+	std::atomic<ll_bool_t> registered{ true };
+	std::atomic<len_t> started{ 0 };
+	auto worker = [&](const len_t thread) noexcept {
+		std::unique_ptr<AsyncContext>& context = this->contexts[thread];
+		if (!context) {
+			context.reset(new (std::nothrow) AsyncContext());
+			if (!context || !context->init(backend, size, buffers)) {
+				context.reset();
+				return;
+			}
+		}
+		try {
+#if defined(LL_CITY_ASYNC_IO_URING)
+			if (backend == AsyncBackend::IoUring) {
+				if (!context->ring->isRegistered()) registered = false;
+				++started;
+				AsyncWorker<IoUringEngine> hasher(*context->ring, shared, context->data.get(), size, buffers);
+				if (hasher.run()) return;
+				// The kernel may still write into the buffers of a failed ring
+				//	after it is closed: they are leaked rather than reused
+				if (hasher.inFlight()) (void)context->data.release();
+				context.reset();
+				return;
+			}
+#endif // LL_CITY_ASYNC_IO_URING
+			registered = false;
+			++started;
+			AsyncWorker<ThreadPoolEngine> hasher(*context->pool, shared, context->data.get(), size, buffers);
+			(void)hasher.run();
+		}
+		catch (...) {
+			// Only the vectors of the worker throw, before it takes a file
+		}
+	};
+
+	const f64 t0 = AsyncNow();
+	// Task i runs on ring i; a thread that finishes early may run another
+	//	task, never the same one as another thread
+	ParallelFor(threads, threads, worker);
+	const f64 t1 = AsyncNow();
+
+	// Files no worker could take, for lack of memory or of a ring, are
+	//	reported as failed so every one of them gets its callback
+	if (started == 0) return false;
+	for (len_t index = shared.next++; index < count; index = shared.next++) {
+		const CityFileDigest result{ index, paths[index], hash::Hash128(), 0, ENOMEM };
+		++shared.stats.files;
+		++shared.stats.failed;
+		callback(result, user);
+	}
+
+	CityAsyncStats& stats = shared.stats;
+	stats.average_queue_depth = shared.depth_samples ? static_cast<f64>(shared.depth_sum) / static_cast<f64>(shared.depth_samples) : 0.0;
+	stats.backend = backend;
+	stats.registered_buffers = backend == AsyncBackend::IoUring && registered;
+	stats.seconds = t1 - t0;
+	this->last = stats;
+	return true;
+}
+#else
+ll_bool_t CityAsyncHasher::hashFiles(const ll_string_t*, const len_t, CityAsyncCallback, void*) noexcept {
+	this->last = CityAsyncStats();
+	return false;
+}
+#endif // LL_CITY_ASYNC_POSIX
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
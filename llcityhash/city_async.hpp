@@ -0,0 +1,130 @@
+//////////////////////////////////////////////
+//	city_async.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Asynchronous CityHash128 of many files.  Every hashing thread owns a ring
+// of buffers and keeps up to one read per buffer in flight, so the device
+// queue stays full while the thread hashes the buffers that have arrived.
+// Reads go through io_uring (Linux), into buffers registered with the kernel
+// when it allows, or else through a pool of threads calling pread.
+//
+// A file is hashed with a CityHash128Stream of its size: a buffer is hashed
+// as soon as every byte before it has been, and then reused, so a file is
+// never held in memory whole, and no file gets more buffers than the ring
+// has.  Reads of a file are spread over the ring, oldest file first, and new
+// files are opened while the ring has free buffers, which keeps small files
+// in flight together.
+//
+// Only regular files can be hashed (their size is read before the first
+// byte), and only on POSIX systems.
+
+#ifndef LLCPP_CITY_HASH_ASYNC_HPP_
+#define LLCPP_CITY_HASH_ASYNC_HPP_
+
+#include "city.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace llcpp {
+namespace city {
+
+namespace __internal__ {
+struct AsyncContext;
+} // namespace __internal__
+
+#pragma region Options
+enum class AsyncBackend : ui8 {
+	Auto,			// io_uring if this kernel lets us use it, else ThreadPool
+	IoUring,
+	ThreadPool
+};
+
+constexpr len_t CITYHASH_ASYNC_DEFAULT_BUFFER_SIZE = 128 * 1024;
+constexpr len_t CITYHASH_ASYNC_DEFAULT_BUFFER_COUNT = 32;
+
+struct CityAsyncOptions {
+	len_t buffer_size = CITYHASH_ASYNC_DEFAULT_BUFFER_SIZE;		// Bytes per read
+	len_t buffer_count = CITYHASH_ASYNC_DEFAULT_BUFFER_COUNT;	// Buffers per ring: reads in flight per thread
+	len_t threads = 1;											// Hashing threads, each with its own ring (0 uses every core)
+	AsyncBackend backend = AsyncBackend::Auto;
+};
+
+#pragma endregion
+#pragma region Results
+struct CityFileDigest {
+	len_t index;			// Position in the list of paths
+	ll_string_t path;
+	hash::Hash128 digest;	// CityHash128 of the contents (0 on error)
+	len_t bytes;			// Size of the file
+	i32 error;				// errno of the failed open or read, 0 on success
+};
+
+// Called once per file, as soon as it is hashed, in any order.  Calls never
+// overlap, even with several threads.
+using CityAsyncCallback = void(*)(const CityFileDigest& result, void* user) noexcept;
+
+struct CityAsyncStats {
+	len_t files;
+	len_t failed;				// Files that could not be opened or read
+	len_t bytes;				// Bytes hashed
+	len_t reads;				// Reads submitted, retries included
+	f64 seconds;				// Wall time of the call
+	f64 hash_seconds;			// Time spent hashing, summed over threads
+	f64 wait_seconds;			// Time threads waited for reads, summed
+	f64 average_queue_depth;	// Reads in flight whenever a thread waited
+	len_t max_queue_depth;
+	AsyncBackend backend;		// Backend that ran (IoUring or ThreadPool)
+	ll_bool_t registered_buffers;	// io_uring read into registered buffers
+
+	__LL_NODISCARD__ f64 gbps() const noexcept {
+		return this->seconds > 0 ? static_cast<f64>(this->bytes) * 1e-9 / this->seconds : 0.0;
+	}
+};
+
+#pragma endregion
+#pragma region Hasher
+// The buffers and the ring (or pool) of every thread are set up by the
+// first hashFiles call and kept for the next ones.  One call at a time.
+class LL_SHARED_LIB CityAsyncHasher {
+	private:
+		CityAsyncOptions options;
+		CityAsyncStats last;
+		std::vector<std::unique_ptr<__internal__::AsyncContext>> contexts;	// One per hashing thread
+
+	public:
+		// buffer_size and buffer_count are raised to 1 if 0
+		explicit CityAsyncHasher(const CityAsyncOptions& options = CityAsyncOptions()) noexcept;
+		CityAsyncHasher(const CityAsyncHasher&) = delete;
+		CityAsyncHasher& operator=(const CityAsyncHasher&) = delete;
+		CityAsyncHasher(CityAsyncHasher&&) noexcept;
+		CityAsyncHasher& operator=(CityAsyncHasher&&) noexcept;
+		~CityAsyncHasher() noexcept;
+
+		// Hashes paths[0] ... paths[count - 1] and calls callback(result, user)
+		//	for each of them; a file that cannot be opened or read is reported
+		//	with its errno and does not stop the others.  Returns false, having
+		//	hashed nothing, if paths or callback is null, the backend cannot
+		//	run or memory runs out; otherwise true once every file is reported.
+		ll_bool_t hashFiles(const ll_string_t* paths, const len_t count, CityAsyncCallback callback, void* user = nullptr) noexcept;
+		ll_bool_t hashFiles(const std::vector<std::string>& paths, CityAsyncCallback callback, void* user = nullptr) noexcept;
+
+		// Statistics of the last hashFiles call
+		__LL_NODISCARD__ const CityAsyncStats& stats() const noexcept;
+		__LL_NODISCARD__ const CityAsyncOptions& getOptions() const noexcept;
+
+		// True if io_uring can be set up here (Linux 5.1 or later, and not
+		//	disabled by sysctl or seccomp)
+		__LL_NODISCARD__ static ll_bool_t isIoUringAvailable() noexcept;
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_ASYNC_HPP_
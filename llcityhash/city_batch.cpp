@@ -0,0 +1,457 @@
+//////////////////////////////////////////////
+//	city_batch.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Batch hashing: keys are grouped by length bucket and the short buckets are
+// hashed LANES keys at a time.  Inside a group each step of the hash is done
+// for all lanes before the next step starts, so the multiplies of independent
+// keys overlap instead of waiting on a single dependency chain.  Longer keys
+// already keep several chains busy and are hashed one by one.
+
+#include "city_internal.hpp"
+#include "city_simd.hpp"
+
+#include <type_traits>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+// The lane loops only pay off once they are fully unrolled and every lane
+// lives in registers; gcc does not do it on its own at -O2
+#if defined(__clang__)
+	#define LL_CITY_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+	#define LL_CITY_UNROLL _Pragma("GCC unroll 8")
+#else
+	#define LL_CITY_UNROLL
+#endif
+
+namespace llcpp {
+namespace city {
+
+using namespace __internal__;
+
+namespace {
+
+// Keys hashed together in the same group
+constexpr len_t LANES = 4;
+// Keys classified per pass (keeps the bucket tables small and on the stack)
+constexpr len_t BLOCK = 128;
+
+// Key waiting in a bucket: where it is and where its hash goes
+struct Key {
+	ll_string_t s;
+	len_t len;
+	len_t out;
+};
+
+// Kernels read their keys through one of these two views
+template<class T>
+struct StagedKeys {
+	const Key* keys;
+	T* out;
+	__LL_INLINE__ ll_string_t s(const len_t i) const noexcept { return keys[i].s; }
+	__LL_INLINE__ len_t len(const len_t i) const noexcept { return keys[i].len; }
+	__LL_INLINE__ void set(const len_t i, const T& value) const noexcept { out[keys[i].out] = value; }
+};
+template<class T>
+struct DirectKeys {
+	const ll_string_t* ptrs;
+	const len_t* lens;
+	T* out;
+	__LL_INLINE__ ll_string_t s(const len_t i) const noexcept { return ptrs[i]; }
+	__LL_INLINE__ len_t len(const len_t i) const noexcept { return lens[i]; }
+	__LL_INLINE__ void set(const len_t i, const T& value) const noexcept { out[i] = value; }
+};
+
+enum Bucket : ui8 {
+	BUCKET_0TO3,
+	BUCKET_4TO7,
+	BUCKET_8TO16,
+	BUCKET_17TO32,
+	BUCKET_33TO64,
+	BUCKET_LONG,
+	BUCKET_COUNT
+};
+
+__LL_NODISCARD__ __LL_INLINE__ Bucket Bucket64(const len_t len) noexcept {
+	if (len <= 16) return len >= 8 ? BUCKET_8TO16 : (len >= 4 ? BUCKET_4TO7 : BUCKET_0TO3);
+	if (len <= 32) return BUCKET_17TO32;
+	return len <= 64 ? BUCKET_33TO64 : BUCKET_LONG;
+}
+
+// Only buckets with a lane kernel are worth regrouping.  The others are
+//	hashed one key at a time, in place, while the block is classified:
+//	on a loop of 4096 keys (ns/key, per-key loop / interleaved) 24 bytes
+//	6.04 / 6.58, 48 bytes 7.71 / 8.81, and staging them too made mixed
+//	lengths 10-25% slower than the plain loop.
+__LL_NODISCARD__ __LL_INLINE__ ll_bool_t IsStaged64(const Bucket bucket, const SimdKernels64* simd) noexcept {
+	if (bucket == BUCKET_4TO7 || bucket == BUCKET_8TO16) return true;
+	return simd && (bucket == BUCKET_17TO32 || bucket == BUCKET_33TO64);
+}
+
+enum Bucket32 : ui8 {
+	BUCKET32_0TO4,
+	BUCKET32_5TO12,
+	BUCKET32_13TO24,
+	BUCKET32_LONG,
+	BUCKET32_COUNT
+};
+
+__LL_NODISCARD__ __LL_INLINE__ Bucket32 Bucket32Of(const len_t len) noexcept {
+	if (len <= 12) return len <= 4 ? BUCKET32_0TO4 : BUCKET32_5TO12;
+	return len <= 24 ? BUCKET32_13TO24 : BUCKET32_LONG;
+}
+
+#pragma region Lanes64
+// Every kernel hashes keys [first, first + N) and is equivalent to calling
+// the matching HashLen* function once per key.
+template<len_t N, class Keys>
+void HashLen8to16Lanes(const Keys& keys, const len_t first) noexcept {
+	ui64 mul[N], a[N], b[N], c[N], d[N];
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		ll_string_t s = keys.s(first + l);
+		len_t len = keys.len(first + l);
+		mul[l] = k2 + len * 2;
+		a[l] = Fetch64(s) + k2;
+		b[l] = Fetch64(s + len - 8);
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		c[l] = Rotate(b[l], 37) * mul[l] + a[l];
+		d[l] = (Rotate(a[l], 25) + b[l]) * mul[l];
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l)
+		keys.set(first + l, HashLen16(c[l], d[l], mul[l]));
+}
+
+template<len_t N, class Keys>
+void HashLen4to7Lanes(const Keys& keys, const len_t first) noexcept {
+	ui64 mul[N], u[N], v[N];
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		ll_string_t s = keys.s(first + l);
+		len_t len = keys.len(first + l);
+		mul[l] = k2 + len * 2;
+		u[l] = len + (static_cast<ui64>(Fetch32(s)) << 3);
+		v[l] = Fetch32(s + len - 4);
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l)
+		keys.set(first + l, HashLen16(u[l], v[l], mul[l]));
+}
+
+#pragma endregion
+#pragma region Lanes32
+template<len_t N, class Keys>
+void Hash32Len5to12Lanes(const Keys& keys, const len_t first) noexcept {
+	ui32 a[N], b[N], c[N], d[N];
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		ll_string_t s = keys.s(first + l);
+		len_t len = keys.len(first + l);
+		d[l] = static_cast<ui32>(len) * 5;
+		a[l] = static_cast<ui32>(len) + Fetch32(s);
+		b[l] = d[l] + Fetch32(s + len - 4);
+		c[l] = 9 + Fetch32(s + ((len >> 1) & 4));
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) d[l] = Mur(a[l], d[l]);
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) d[l] = Mur(b[l], d[l]);
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l)
+		keys.set(first + l, fmix(Mur(c[l], d[l])));
+}
+
+template<len_t N, class Keys>
+void Hash32Len13to24Lanes(const Keys& keys, const len_t first) noexcept {
+	ui32 h[N];
+	ll_string_t s[N];
+	len_t len[N];
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		s[l] = keys.s(first + l);
+		len[l] = keys.len(first + l);
+		h[l] = Mur(Fetch32(s[l] - 4 + (len[l] >> 1)), static_cast<ui32>(len[l]));
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) h[l] = Mur(Fetch32(s[l] + 4), h[l]);
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) h[l] = Mur(Fetch32(s[l] + len[l] - 8), h[l]);
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) h[l] = Mur(Fetch32(s[l] + (len[l] >> 1)), h[l]);
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) h[l] = Mur(Fetch32(s[l]), h[l]);
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l)
+		keys.set(first + l, fmix(Mur(Fetch32(s[l] + len[l] - 4), h[l])));
+}
+
+#pragma endregion
+#pragma region Lanes128
+// CityHash128 of keys up to 32 bytes: CityMurmur with at most 16 bytes left
+template<len_t N, class Keys>
+void CityHash128ShortLanes(const Keys& keys, const len_t first) noexcept {
+	ui64 a[N], b[N], c[N], d[N];
+	ll_string_t s[N];
+	len_t len[N];
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		s[l] = keys.s(first + l);
+		len[l] = keys.len(first + l);
+		if (len[l] >= 16) {
+			a[l] = Fetch64(s[l]);
+			b[l] = Fetch64(s[l] + 8) + k0;
+			s[l] += 16;
+			len[l] -= 16;
+		}
+		else {
+			a[l] = k0;
+			b[l] = k1;
+		}
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		a[l] = ShiftMix(a[l] * k1) * k1;
+		c[l] = b[l] * k1 + HashLen0to16(s[l], len[l]);
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l)
+		d[l] = ShiftMix(a[l] + (len[l] >= 8 ? Fetch64(s[l]) : c[l]));
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l) {
+		a[l] = hash::Hash128(a[l], c[l]);
+		b[l] = hash::Hash128(d[l], b[l]);
+	}
+	LL_CITY_UNROLL
+	for (len_t l = 0; l < N; ++l)
+		keys.set(first + l, hash::Hash128(a[l] ^ b[l], hash::Hash128(b[l], a[l])));
+}
+
+#pragma endregion
+
+#define LL_CITY_LANE_KERNEL(name) \
+	template<len_t N, class Keys> \
+	struct name##Kernel { \
+		static __LL_INLINE__ void run(const Keys& keys, const len_t first) noexcept { name<N, Keys>(keys, first); } \
+	}
+LL_CITY_LANE_KERNEL(HashLen4to7Lanes);
+LL_CITY_LANE_KERNEL(HashLen8to16Lanes);
+LL_CITY_LANE_KERNEL(Hash32Len5to12Lanes);
+LL_CITY_LANE_KERNEL(Hash32Len13to24Lanes);
+LL_CITY_LANE_KERNEL(CityHash128ShortLanes);
+#undef LL_CITY_LANE_KERNEL
+
+// Hashes as many keys as possible in groups of "lanes", returns how many
+//	(none without a kernel)
+template<class T, class Keys>
+__LL_INLINE__ len_t RunSimd(const len_t lanes, void (*kernel)(const ll_string_t*, const len_t*, T*) noexcept, const Keys& keys, const len_t count) noexcept {
+	constexpr len_t MAX_LANES = 16;
+	len_t i = 0;
+	if (!kernel) return i;
+	if constexpr (std::is_same_v<Keys, DirectKeys<T>>) {
+		for (; i + lanes <= count; i += lanes)
+			kernel(keys.ptrs + i, keys.lens + i, keys.out + i);
+	}
+	else {
+		ll_string_t s[MAX_LANES];
+		len_t len[MAX_LANES];
+		T out[MAX_LANES];
+		for (; i + lanes <= count; i += lanes) {
+			for (len_t l = 0; l < lanes; ++l) {
+				s[l] = keys.s(i + l);
+				len[l] = keys.len(i + l);
+			}
+			kernel(s, len, out);
+			for (len_t l = 0; l < lanes; ++l) keys.set(i + l, out[l]);
+		}
+	}
+	return i;
+}
+
+// Hashes keys [first, first + count) of the same bucket with the scalar lanes
+template<template<len_t, class> class Kernel, class Keys>
+__LL_INLINE__ void RunLanesFrom(const Keys& keys, const len_t first, const len_t count) noexcept {
+	len_t i = first;
+	for (; i + LANES <= count; i += LANES) Kernel<LANES, Keys>::run(keys, i);
+	for (; i < count; ++i) Kernel<1, Keys>::run(keys, i);
+}
+
+template<class Keys>
+__LL_INLINE__ void RunBucket64(const Bucket bucket, const Keys& keys, const len_t count, const SimdKernels64* simd) noexcept {
+	switch (bucket) {
+		case BUCKET_0TO3:
+			for (len_t i = 0; i < count; ++i) keys.set(i, HashLen0to16(keys.s(i), keys.len(i)));
+			break;
+		case BUCKET_4TO7:
+			RunLanesFrom<HashLen4to7LanesKernel>(keys, simd ? RunSimd(simd->lanes, simd->len4to7, keys, count) : 0, count);
+			break;
+		case BUCKET_8TO16:
+			RunLanesFrom<HashLen8to16LanesKernel>(keys, simd ? RunSimd(simd->lanes, simd->len8to16, keys, count) : 0, count);
+			break;
+		// No lane kernel: interleaving these measured slower (see IsStaged64)
+		case BUCKET_17TO32:
+			for (len_t i = simd ? RunSimd(simd->lanes, simd->len17to32, keys, count) : 0; i < count; ++i)
+				keys.set(i, HashLen17to32(keys.s(i), keys.len(i)));
+			break;
+		case BUCKET_33TO64:
+			for (len_t i = simd ? RunSimd(simd->lanes, simd->len33to64, keys, count) : 0; i < count; ++i)
+				keys.set(i, HashLen33to64(keys.s(i), keys.len(i)));
+			break;
+		default:
+			// Long keys already keep several independent chains busy
+			for (len_t i = 0; i < count; ++i) keys.set(i, CityHash64Unchecked(keys.s(i), keys.len(i)));
+			break;
+	}
+}
+
+template<class Keys>
+__LL_INLINE__ void RunBucket32(const Bucket32 bucket, const Keys& keys, const len_t count, const SimdKernels32* simd) noexcept {
+	switch (bucket) {
+		case BUCKET32_0TO4: {
+			const len_t done = simd ? RunSimd(simd->lanes, simd->len0to4, keys, count) : 0;
+			for (len_t i = done; i < count; ++i) keys.set(i, Hash32Len0to4(keys.s(i), keys.len(i)));
+			break;
+		}
+		case BUCKET32_5TO12:
+			RunLanesFrom<Hash32Len5to12LanesKernel>(keys, simd ? RunSimd(simd->lanes, simd->len5to12, keys, count) : 0, count);
+			break;
+		case BUCKET32_13TO24:
+			RunLanesFrom<Hash32Len13to24LanesKernel>(keys, simd ? RunSimd(simd->lanes, simd->len13to24, keys, count) : 0, count);
+			break;
+		default:
+			for (len_t i = 0; i < count; ++i) keys.set(i, city::CityHash32(keys.s(i), keys.len(i))->get());
+			break;
+	}
+}
+
+} // namespace
+
+#pragma region Batch
+BatchKernel GetBestBatchKernel() noexcept {
+	return GetSimdKernels64(BatchKernel::Auto) ? BatchKernel::Avx512 : BatchKernel::Scalar;
+}
+ll_bool_t CityHash64Batch(const ll_string_t* ptrs, const len_t* lens, ui64* out, len_t n, const BatchKernel kernel) noexcept {
+	if (!ptrs || !lens || !out) return false;
+	const SimdKernels64* simd = GetSimdKernels64(kernel);
+	if (!simd && kernel != BatchKernel::Auto && kernel != BatchKernel::Scalar) return false;
+	// Moving regrouped keys in and out of vectors costs more than it saves,
+	// unless the caller asked for a specific kernel
+	const SimdKernels64* staged_simd = kernel == BatchKernel::Auto ? nullptr : simd;
+	ll_bool_t ok = true;
+	Key keys[BUCKET_COUNT][BLOCK];
+	len_t count[BUCKET_COUNT];
+
+	for (len_t base = 0; base < n; base += BLOCK) {
+		const len_t block = (n - base) < BLOCK ? (n - base) : BLOCK;
+
+		// Columns of fixed size keys need no regrouping at all
+		const Bucket first = Bucket64(lens[base]);
+		len_t same = 0;
+		while (same < block && ptrs[base + same] && Bucket64(lens[base + same]) == first) ++same;
+		if (same == block) {
+			RunBucket64(first, DirectKeys<ui64>{ ptrs + base, lens + base, out + base }, block, simd);
+			continue;
+		}
+
+		for (len_t b = 0; b < BUCKET_COUNT; ++b) count[b] = 0;
+		for (len_t i = base; i < base + block; ++i) {
+			if (!ptrs[i]) {
+				out[i] = 0;
+				ok = false;
+				continue;
+			}
+			const Bucket b = Bucket64(lens[i]);
+			if (IsStaged64(b, staged_simd)) keys[b][count[b]++] = Key{ ptrs[i], lens[i], i };
+			else out[i] = CityHash64Unchecked(ptrs[i], lens[i]);
+		}
+		for (len_t b = 0; b < BUCKET_COUNT; ++b)
+			if (count[b]) RunBucket64(static_cast<Bucket>(b), StagedKeys<ui64>{ keys[b], out }, count[b], staged_simd);
+	}
+	return ok;
+}
+ll_bool_t CityHash32Batch(const ll_string_t* ptrs, const len_t* lens, ui32* out, len_t n, const BatchKernel kernel) noexcept {
+	if (!ptrs || !lens || !out) return false;
+	const SimdKernels32* simd = GetSimdKernels32(kernel);
+	if (!simd && kernel != BatchKernel::Auto && kernel != BatchKernel::Scalar) return false;
+	ll_bool_t ok = true;
+	Key keys[BUCKET32_COUNT][BLOCK];
+	len_t count[BUCKET32_COUNT];
+
+	for (len_t base = 0; base < n; base += BLOCK) {
+		const len_t block = (n - base) < BLOCK ? (n - base) : BLOCK;
+
+		const Bucket32 first = Bucket32Of(lens[base]);
+		len_t same = 0;
+		while (same < block && ptrs[base + same] && Bucket32Of(lens[base + same]) == first) ++same;
+		if (same == block) {
+			RunBucket32(first, DirectKeys<ui32>{ ptrs + base, lens + base, out + base }, block, simd);
+			continue;
+		}
+
+		for (len_t b = 0; b < BUCKET32_COUNT; ++b) count[b] = 0;
+		for (len_t i = base; i < base + block; ++i) {
+			if (!ptrs[i]) {
+				out[i] = 0;
+				ok = false;
+				continue;
+			}
+			Bucket32 b = Bucket32Of(lens[i]);
+			keys[b][count[b]++] = Key{ ptrs[i], lens[i], i };
+		}
+		for (len_t b = 0; b < BUCKET32_COUNT; ++b)
+			RunBucket32(static_cast<Bucket32>(b), StagedKeys<ui32>{ keys[b], out }, count[b], simd);
+	}
+	return ok;
+}
+ll_bool_t CityHash128Batch(const ll_string_t* ptrs, const len_t* lens, hash::Hash128* out, len_t n) noexcept {
+	if (!ptrs || !lens || !out) return false;
+	ll_bool_t ok = true;
+	Key keys[BLOCK];
+
+	for (len_t base = 0; base < n; base += BLOCK) {
+		const len_t block = (n - base) < BLOCK ? (n - base) : BLOCK;
+
+		len_t count = 0;
+		for (len_t i = base; i < base + block; ++i) {
+			if (!ptrs[i]) {
+				out[i] = hash::Hash128(0, 0);
+				ok = false;
+			}
+			else if (lens[i] <= 32) keys[count++] = Key{ ptrs[i], lens[i], i };
+			else out[i] = *city::CityHash128(ptrs[i], lens[i]);
+		}
+		RunLanesFrom<CityHash128ShortLanesKernel>(StagedKeys<hash::Hash128>{ keys, out }, 0, count);
+	}
+	return ok;
+}
+ll_bool_t CityHash64WithSeedsMulti(ll_string_t s, const len_t len, const ui64* seeds0, const ui64* seeds1, ui64* out, const len_t n, const BatchKernel kernel) noexcept {
+	if (!s || !seeds1 || !out) return false;
+	const SimdKernels64* simd = GetSeedKernels64(kernel);
+	if (!simd && kernel != BatchKernel::Auto && kernel != BatchKernel::Scalar) return false;
+	const ui64 hash = CityHash64Unchecked(s, len);
+	const len_t done = simd ? simd->seeds(hash, seeds0, seeds1, out, n) : 0;
+	for (len_t i = done; i < n; ++i) out[i] = header::HashLen16(hash - (seeds0 ? seeds0[i] : k2), seeds1[i]);
+	return true;
+}
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#undef LL_CITY_UNROLL
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
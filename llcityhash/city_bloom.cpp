@@ -0,0 +1,352 @@
+//////////////////////////////////////////////
+//	city_bloom.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_bloom.hpp"
+#include "city_cpu.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+constexpr len_t BLOOM_WORDS = CITYHASH_BLOOM_BLOCK_SIZE / sizeof(ui64);
+constexpr ui32 BLOOM_ENDIAN = 0x01020304;
+
+// Where a key lives: its block, the word its positions start at, and two
+//	48-bit pools of 6-bit fields, one field per word.  Position i lands in
+//	word w = (rotation + i) % 8, on bit ((i < 8 ? first : second) >> 6 * w)
+//	& 63, so the first 8 positions hit 8 different words.  Without the
+//	rotation a filter with fewer than 8 positions per key would only fill its
+//	first words.
+struct BloomProbe {
+	len_t block;
+	ui32 rotation;
+	ui64 first;
+	ui64 second;
+};
+
+__LL_NODISCARD__ __LL_INLINE__ BloomProbe MakeBloomProbe(const hash::Hash128& h, const len_t block_count) noexcept {
+	const ui64 low = h.getLow();
+	const ui64 high = h.getHigh();
+	// Multiply and shift instead of a modulo (Lemire's fastrange); the bits
+	//	right below the block index give the rotation
+	const ui64 scaled = static_cast<ui64>(static_cast<ui32>(low)) * block_count;
+	return BloomProbe{
+		static_cast<len_t>(scaled >> 32),
+		static_cast<ui32>(scaled >> 29) & 7,
+		high & 0xffffffffffffull,
+		(low >> 32) | ((high >> 48) << 32)
+	};
+}
+
+__LL_INLINE__ void BloomMask(const BloomProbe& probe, const ui32 hash_count, ui64* mask) noexcept {
+	for (len_t w = 0; w < BLOOM_WORDS; ++w) mask[w] = 0;
+	for (ui32 i = 0; i < hash_count; ++i) {
+		const ui32 word = (probe.rotation + i) % BLOOM_WORDS;
+		const ui64 pool = i < BLOOM_WORDS ? probe.first : probe.second;
+		mask[word] |= ui64(1) << ((pool >> (6 * word)) & 63);
+	}
+}
+
+// Stops at the first clear bit, so most misses read one or two words
+__LL_NODISCARD__ __LL_INLINE__ ll_bool_t BloomTestScalar(const ui64* block, const BloomProbe& probe, const ui32 hash_count) noexcept {
+	for (ui32 i = 0; i < hash_count; ++i) {
+		const ui32 word = (probe.rotation + i) % BLOOM_WORDS;
+		const ui64 pool = i < BLOOM_WORDS ? probe.first : probe.second;
+		if (!(block[word] & (ui64(1) << ((pool >> (6 * word)) & 63)))) return false;
+	}
+	return true;
+}
+
+__LL_INLINE__ void BloomPrefetch(const void* p) noexcept {
+#if defined(LL_CITY_X86_64) && defined(_MSC_VER)
+	_mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(p);
+#else
+	(void)p;
+#endif
+}
+
+#if defined(LL_CITY_X86_64)
+// The mask of a block in two vectors: every lane shifts a 1 by its 6-bit
+//	field, and lanes of unused positions by 64, which vpsllvq turns into 0.
+//	Which lanes are used depends on the rotation.
+struct BloomAvx2 {
+	__m256i unused[8][4];	// Per rotation: words 0-3 and 4-7 of the first pool, then of the second
+
+	LL_CITY_TARGET_AVX2 explicit BloomAvx2(const ui32 hash_count) noexcept {
+		for (ui32 rotation = 0; rotation < 8; ++rotation) {
+			alignas(32) ui64 counts[16];
+			for (ui32 w = 0; w < 8; ++w) {
+				const ui32 position = (w + 8 - rotation) % 8;
+				counts[w] = position < hash_count ? 0 : 64;
+				counts[8 + w] = position + 8 < hash_count ? 0 : 64;
+			}
+			for (len_t v = 0; v < 4; ++v)
+				this->unused[rotation][v] = _mm256_load_si256(reinterpret_cast<const __m256i*>(counts + 4 * v));
+		}
+	}
+
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ __m256i bits(const __m256i pool, const __m256i shift, const __m256i unused) noexcept {
+		const __m256i count = _mm256_or_si256(_mm256_and_si256(_mm256_srlv_epi64(pool, shift), _mm256_set1_epi64x(63)), unused);
+		return _mm256_sllv_epi64(_mm256_set1_epi64x(1), count);
+	}
+	// Not forced inline: gcc refuses to inline AVX2 code into the generic loop
+	LL_CITY_TARGET_AVX2 __LL_NODISCARD__ ll_bool_t test(const ui64* block, const BloomProbe& probe) const noexcept {
+		const __m256i shift_lo = _mm256_setr_epi64x(0, 6, 12, 18);
+		const __m256i shift_hi = _mm256_setr_epi64x(24, 30, 36, 42);
+		const __m256i first = _mm256_set1_epi64x(static_cast<long long>(probe.first));
+		const __m256i second = _mm256_set1_epi64x(static_cast<long long>(probe.second));
+		const __m256i* unused = this->unused[probe.rotation];
+		const __m256i mask_lo = _mm256_or_si256(bits(first, shift_lo, unused[0]), bits(second, shift_lo, unused[2]));
+		const __m256i mask_hi = _mm256_or_si256(bits(first, shift_hi, unused[1]), bits(second, shift_hi, unused[3]));
+		const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+		const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 4));
+		// testc: (~block & mask) == 0
+		return _mm256_testc_si256(lo, mask_lo) & _mm256_testc_si256(hi, mask_hi);
+	}
+};
+#endif // LL_CITY_X86_64
+
+// Keys hashed and prefetched together.  The blocks of one group are
+//	loaded while the next group is hashed.
+constexpr len_t BLOOM_GROUP = 16;
+
+template<class Test>
+__LL_INLINE__ ll_bool_t BloomBatch(const ll_string_t* ptrs, const len_t* lens, ll_bool_t* out, const len_t n,
+	const ui64* blocks, const len_t block_count, Test&& test) noexcept {
+	ll_bool_t ok = true;
+	BloomProbe probes[2][BLOOM_GROUP];
+	auto stage = [&](const len_t base, BloomProbe* group) noexcept {
+		hash::Hash128 hashes[BLOOM_GROUP];
+		const len_t count = n - base < BLOOM_GROUP ? n - base : BLOOM_GROUP;
+		ok &= city::CityHash128Batch(ptrs + base, lens + base, hashes, count);
+		for (len_t i = 0; i < count; ++i) {
+			group[i] = MakeBloomProbe(hashes[i], block_count);
+			BloomPrefetch(blocks + group[i].block * BLOOM_WORDS);
+		}
+	};
+	auto finish = [&](const len_t base, const BloomProbe* group) noexcept {
+		const len_t count = n - base < BLOOM_GROUP ? n - base : BLOOM_GROUP;
+		for (len_t i = 0; i < count; ++i)
+			out[base + i] = ptrs[base + i] && test(blocks + group[i].block * BLOOM_WORDS, group[i]);
+	};
+
+	if (n == 0) return true;
+	stage(0, probes[0]);
+	len_t base = 0;
+	for (len_t g = 0; base + BLOOM_GROUP < n; base += BLOOM_GROUP, g ^= 1) {
+		stage(base + BLOOM_GROUP, probes[g ^ 1]);
+		finish(base, probes[g]);
+	}
+	finish(base, probes[(base / BLOOM_GROUP) & 1]);
+	return ok;
+}
+
+__LL_NODISCARD__ ui64* AllocateBloomBlocks(const len_t block_count) noexcept {
+	return static_cast<ui64*>(::operator new(block_count * CITYHASH_BLOOM_BLOCK_SIZE, std::align_val_t(CITYHASH_BLOOM_BLOCK_SIZE), std::nothrow));
+}
+
+// Header of a serialized filter if it can be used on this host
+__LL_NODISCARD__ const CityBloomHeader* CheckBloomBuffer(const void* data, const len_t size) noexcept {
+	if (!data || size < sizeof(CityBloomHeader) || reinterpret_cast<std::uintptr_t>(data) % alignof(ui64) != 0) return nullptr;
+	const CityBloomHeader* header = static_cast<const CityBloomHeader*>(data);
+	if (header->magic != CITYHASH_BLOOM_MAGIC || header->version != CITYHASH_BLOOM_VERSION || header->endian != BLOOM_ENDIAN)
+		return nullptr;
+	if (header->block_count == 0 || header->block_count > CITYHASH_BLOOM_MAX_BLOCKS) return nullptr;
+	if (header->hash_count == 0 || header->hash_count > CITYHASH_BLOOM_MAX_HASHES) return nullptr;
+	if ((size - sizeof(CityBloomHeader)) / CITYHASH_BLOOM_BLOCK_SIZE < header->block_count) return nullptr;
+	return header;
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+CityBloomFilter::CityBloomFilter(ui64* blocks, const len_t block_count, const ui32 hash_count, const ll_bool_t owned) noexcept
+	: blocks(blocks)
+	, block_count(block_count)
+	, hash_count(hash_count)
+	, owned(owned)
+{}
+CityBloomFilter::CityBloomFilter() noexcept : CityBloomFilter(nullptr, 0, 0, true) {}
+CityBloomFilter::CityBloomFilter(const len_t expected_keys, const f64 bits_per_key) noexcept
+	: CityBloomFilter()
+{
+	if (!(bits_per_key > 0.0)) return;
+	const f64 bits = static_cast<f64>(expected_keys > 0 ? expected_keys : 1) * bits_per_key;
+	const f64 blocks = std::ceil(bits / (8.0 * CITYHASH_BLOOM_BLOCK_SIZE));
+	if (!(blocks <= static_cast<f64>(CITYHASH_BLOOM_MAX_BLOCKS))) return;
+	const len_t block_count = blocks < 1.0 ? 1 : static_cast<len_t>(blocks);
+	ui64* memory = AllocateBloomBlocks(block_count);
+	if (!memory) return;
+	std::memset(memory, 0, block_count * CITYHASH_BLOOM_BLOCK_SIZE);
+
+	// k = bits_per_key * ln 2 minimizes the false positive rate of a classic
+	//	filter; the blocked one is close to it
+	const f64 k = std::round(bits_per_key * 0.6931471805599453);
+	this->blocks = memory;
+	this->block_count = block_count;
+	this->hash_count = k < 1.0 ? 1 : (k > CITYHASH_BLOOM_MAX_HASHES ? CITYHASH_BLOOM_MAX_HASHES : static_cast<ui32>(k));
+}
+CityBloomFilter::~CityBloomFilter() noexcept {
+	this->release();
+}
+CityBloomFilter::CityBloomFilter(CityBloomFilter&& other) noexcept
+	: CityBloomFilter(other.blocks, other.block_count, other.hash_count, other.owned)
+{
+	other.blocks = nullptr;
+	other.block_count = 0;
+	other.hash_count = 0;
+	other.owned = true;
+}
+CityBloomFilter& CityBloomFilter::operator=(CityBloomFilter&& other) noexcept {
+	if (this != &other) {
+		this->release();
+		this->blocks = other.blocks;
+		this->block_count = other.block_count;
+		this->hash_count = other.hash_count;
+		this->owned = other.owned;
+		other.blocks = nullptr;
+		other.block_count = 0;
+		other.hash_count = 0;
+		other.owned = true;
+	}
+	return *this;
+}
+void CityBloomFilter::release() noexcept {
+	if (this->owned && this->blocks)
+		::operator delete(this->blocks, std::align_val_t(CITYHASH_BLOOM_BLOCK_SIZE));
+	this->blocks = nullptr;
+}
+
+ll_bool_t CityBloomFilter::add(ll_string_t s, const len_t len) noexcept {
+	if (!s) return false;
+	return this->addHash(*city::CityHash128(s, len));
+}
+ll_bool_t CityBloomFilter::addHash(const hash::Hash128& h) noexcept {
+	if (!this->blocks || !this->owned) return false;
+	const BloomProbe probe = MakeBloomProbe(h, this->block_count);
+	ui64 mask[BLOOM_WORDS];
+	BloomMask(probe, this->hash_count, mask);
+	ui64* block = this->blocks + probe.block * BLOOM_WORDS;
+	for (len_t w = 0; w < BLOOM_WORDS; ++w) block[w] |= mask[w];
+	return true;
+}
+ll_bool_t CityBloomFilter::mayContain(ll_string_t s, const len_t len) const noexcept {
+	if (!s) return false;
+	return this->mayContainHash(*city::CityHash128(s, len));
+}
+ll_bool_t CityBloomFilter::mayContainHash(const hash::Hash128& h) const noexcept {
+	if (!this->blocks) return false;
+	const BloomProbe probe = MakeBloomProbe(h, this->block_count);
+	return BloomTestScalar(this->blocks + probe.block * BLOOM_WORDS, probe, this->hash_count);
+}
+ll_bool_t CityBloomFilter::mayContainBatch(const ll_string_t* ptrs, const len_t* lens, ll_bool_t* out, const len_t n, const BatchKernel kernel) const noexcept {
+	if (!ptrs || !lens || !out) return false;
+	const CpuFeatures& cpu = GetCpuFeatures();
+	// AVX-512 would not test a 64-byte block any faster; CPUs with it run AVX2
+	ll_bool_t vector = false;
+	switch (kernel) {
+		case BatchKernel::Auto:
+			vector = cpu.avx2;
+			break;
+		case BatchKernel::Scalar:
+			break;
+		case BatchKernel::Avx2:
+			if (!cpu.avx2) return false;
+			vector = true;
+			break;
+		case BatchKernel::Avx512:
+			if (!cpu.avx2 || !cpu.avx512) return false;
+			vector = true;
+			break;
+		// No SSE4.1 kernel, as in CityHash64Batch
+		default:
+			return false;
+	}
+	if (!this->blocks) {
+		ll_bool_t ok = true;
+		for (len_t i = 0; i < n; ++i) {
+			out[i] = false;
+			ok &= ptrs[i] != nullptr;
+		}
+		return ok;
+	}
+
+#if defined(LL_CITY_X86_64)
+	if (vector) {
+		const BloomAvx2 avx2(this->hash_count);
+		return BloomBatch(ptrs, lens, out, n, this->blocks, this->block_count,
+			[&avx2](const ui64* block, const BloomProbe& probe) noexcept { return avx2.test(block, probe); });
+	}
+#endif // LL_CITY_X86_64
+	const ui32 hash_count = this->hash_count;
+	return BloomBatch(ptrs, lens, out, n, this->blocks, this->block_count,
+		[hash_count](const ui64* block, const BloomProbe& probe) noexcept { return BloomTestScalar(block, probe, hash_count); });
+}
+
+ll_bool_t CityBloomFilter::clear() noexcept {
+	if (!this->owned) return false;
+	if (this->blocks) std::memset(this->blocks, 0, this->bytes());
+	return true;
+}
+len_t CityBloomFilter::blockCount() const noexcept { return this->block_count; }
+ui32 CityBloomFilter::hashCount() const noexcept { return this->hash_count; }
+len_t CityBloomFilter::bytes() const noexcept { return this->block_count * CITYHASH_BLOOM_BLOCK_SIZE; }
+ll_bool_t CityBloomFilter::isView() const noexcept { return !this->owned; }
+
+len_t CityBloomFilter::serializedSize() const noexcept {
+	return sizeof(CityBloomHeader) + this->bytes();
+}
+ll_bool_t CityBloomFilter::serialize(void* out, const len_t size) const noexcept {
+	if (!out || size < this->serializedSize()) return false;
+	CityBloomHeader header{};
+	header.magic = CITYHASH_BLOOM_MAGIC;
+	header.version = CITYHASH_BLOOM_VERSION;
+	header.endian = BLOOM_ENDIAN;
+	header.block_count = this->block_count;
+	header.hash_count = this->hash_count;
+	std::memcpy(out, &header, sizeof(header));
+	if (this->blocks) std::memcpy(static_cast<ui8*>(out) + sizeof(header), this->blocks, this->bytes());
+	return true;
+}
+std::optional<CityBloomFilter> CityBloomFilter::view(const void* data, const len_t size) noexcept {
+	const CityBloomHeader* header = CheckBloomBuffer(data, size);
+	if (!header) return std::nullopt;
+	// Views never write: the const is only dropped to share the member
+	ui64* blocks = const_cast<ui64*>(reinterpret_cast<const ui64*>(header + 1));
+	return CityBloomFilter(blocks, static_cast<len_t>(header->block_count), header->hash_count, false);
+}
+std::optional<CityBloomFilter> CityBloomFilter::load(const void* data, const len_t size) noexcept {
+	const CityBloomHeader* header = CheckBloomBuffer(data, size);
+	if (!header) return std::nullopt;
+	const len_t block_count = static_cast<len_t>(header->block_count);
+	ui64* blocks = AllocateBloomBlocks(block_count);
+	if (!blocks) return std::nullopt;
+	std::memcpy(blocks, header + 1, block_count * CITYHASH_BLOOM_BLOCK_SIZE);
+	return CityBloomFilter(blocks, block_count, header->hash_count, true);
+}
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
@@ -0,0 +1,116 @@
+//////////////////////////////////////////////
+//	city_bloom.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Cache-line blocked Bloom filter.  The filter is an array of 64-byte
+// blocks, and a key only ever sets or tests bits of one of them, so a
+// lookup costs one cache miss whatever the number of bits per key.  One
+// CityHash128 of the key gives everything: 32 bits of its low half pick
+// the block, and the other 96 bits give up to 16 bit positions of 6 bits,
+// spread over the 8 words of the block.
+
+#ifndef LLCPP_CITY_HASH_BLOOM_HPP_
+#define LLCPP_CITY_HASH_BLOOM_HPP_
+
+#include "city.hpp"
+
+#include <optional>
+
+namespace llcpp {
+namespace city {
+
+#pragma region Bloom
+constexpr len_t CITYHASH_BLOOM_BLOCK_SIZE = 64;
+constexpr ui32 CITYHASH_BLOOM_MAX_HASHES = 16;
+// Blocks are picked with 32 bits of the hash
+constexpr ui64 CITYHASH_BLOOM_MAX_BLOCKS = ui64(1) << 32;
+constexpr ui32 CITYHASH_BLOOM_VERSION = 1;
+
+// Layout of a serialized filter: this header, then blockCount() blocks of
+// 8 ui64 words in the byte order given by "endian".  The header is one block
+// long, so the blocks of a page aligned buffer stay cache line aligned.
+struct CityBloomHeader {
+	ui64 magic;			// CITYHASH_BLOOM_MAGIC
+	ui32 version;		// CITYHASH_BLOOM_VERSION
+	ui32 endian;		// 0x01020304 as written by the host that serialized it
+	ui64 block_count;
+	ui32 hash_count;
+	ui32 reserved0;
+	ui64 reserved[4];
+};
+static_assert(sizeof(CityBloomHeader) == CITYHASH_BLOOM_BLOCK_SIZE, "the header must keep the blocks aligned");
+constexpr ui64 CITYHASH_BLOOM_MAGIC = 0x4d4f4f4c42595443ull;	// "CTYBLOOM"
+
+class LL_SHARED_LIB CityBloomFilter {
+	private:
+		ui64* blocks;			// 8 words per block
+		len_t block_count;
+		ui32 hash_count;
+		ll_bool_t owned;		// False for views of a serialized buffer
+
+	private:
+		CityBloomFilter(ui64* blocks, const len_t block_count, const ui32 hash_count, const ll_bool_t owned) noexcept;
+		void release() noexcept;
+
+	public:
+		// Filter with no blocks: it contains nothing and accepts nothing
+		CityBloomFilter() noexcept;
+		// Sized for "expected_keys" keys at "bits_per_key" bits each; picks the
+		//	number of bits set per key (1 to 16) from bits_per_key.  If memory
+		//	runs out, or the size needs more than CITYHASH_BLOOM_MAX_BLOCKS
+		//	blocks, the filter has no blocks.
+		explicit CityBloomFilter(const len_t expected_keys, const f64 bits_per_key = 10.0) noexcept;
+		~CityBloomFilter() noexcept;
+		CityBloomFilter(const CityBloomFilter&) = delete;
+		CityBloomFilter& operator=(const CityBloomFilter&) = delete;
+		CityBloomFilter(CityBloomFilter&& other) noexcept;
+		CityBloomFilter& operator=(CityBloomFilter&& other) noexcept;
+
+		// Adds a key.  Returns false if s is null, or if the filter has no
+		//	blocks or is a view.
+		ll_bool_t add(ll_string_t s, const len_t len) noexcept;
+		// Same, from the key's CityHash128
+		ll_bool_t addHash(const hash::Hash128& h) noexcept;
+		// False if the key was never added; true if it probably was.  A null s
+		//	is never contained.
+		__LL_NODISCARD__ ll_bool_t mayContain(ll_string_t s, const len_t len) const noexcept;
+		__LL_NODISCARD__ ll_bool_t mayContainHash(const hash::Hash128& h) const noexcept;
+		// out[i] = mayContain(ptrs[i], lens[i]).  Keys are hashed in groups with
+		//	CityHash128Batch and the blocks of a group are prefetched before any
+		//	of them is tested, so the cache misses overlap.  Avx2 (and Auto on
+		//	CPUs that have it) tests a block with two 256-bit compares.  Returns
+		//	false if any array is null, if the kernel is Sse41 or not supported
+		//	by this CPU, or if any key is null (its output is false).
+		__LL_NODISCARD__ ll_bool_t mayContainBatch(const ll_string_t* ptrs, const len_t* lens, ll_bool_t* out, const len_t n, const BatchKernel kernel = BatchKernel::Auto) const noexcept;
+
+		// Clears every bit.  Returns false for views.
+		ll_bool_t clear() noexcept;
+		__LL_NODISCARD__ len_t blockCount() const noexcept;
+		__LL_NODISCARD__ ui32 hashCount() const noexcept;
+		__LL_NODISCARD__ len_t bytes() const noexcept;
+		__LL_NODISCARD__ ll_bool_t isView() const noexcept;
+
+		// sizeof(CityBloomHeader) + bytes()
+		__LL_NODISCARD__ len_t serializedSize() const noexcept;
+		// Writes the header and the blocks to out.  Returns false if out is
+		//	null or smaller than serializedSize().
+		ll_bool_t serialize(void* out, const len_t size) const noexcept;
+		// Read-only filter over a serialized buffer, without copying or
+		//	parsing it: the blocks are used where they are (for example in a
+		//	file mapped with mmap), so the buffer must outlive the view.
+		//	Returns nullopt if the buffer is not 8-byte aligned, is too small,
+		//	or was written by another version or byte order.
+		__LL_NODISCARD__ static std::optional<CityBloomFilter> view(const void* data, const len_t size) noexcept;
+		// Owning copy of a serialized buffer, with the same checks
+		__LL_NODISCARD__ static std::optional<CityBloomFilter> load(const void* data, const len_t size) noexcept;
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_BLOOM_HPP_
@@ -0,0 +1,496 @@
+//////////////////////////////////////////////
+//	city_cdc.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_cdc.hpp"
+#include "city_cpu.hpp"
+#include "city_parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+	#pragma warning(disable:4996) // std::fopen
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+// Cut point bitmaps are computed for this many bytes at a time (or twice
+//	max, if bigger): their data is still in L2 when the chunks are hashed
+constexpr len_t CDC_WINDOW = 256 * 1024;
+// Smallest segment a thread chunks on its own (or 16 times max, if bigger)
+constexpr len_t CDC_SEGMENT = 1024 * 1024;
+// Block size of chunkFile
+constexpr len_t CDC_FILE_BLOCK = 1024 * 1024;
+
+constexpr std::array<ui64, 256> CDC_GEAR = []() {
+	std::array<ui64, 256> gear{};
+	for (ui64 b = 0; b < 256; ++b) gear[b] = city::CityHash64Key(b);
+	return gear;
+}();
+
+__LL_NODISCARD__ __LL_INLINE__ len_t CdcWindow(const len_t max) noexcept {
+	const len_t twice = (2 * max + 63) & ~len_t(63);
+	return twice > CDC_WINDOW ? twice : CDC_WINDOW;
+}
+
+#pragma region Kernels
+// Cut point bitmaps of bytes [from, to) into small[0], large[0], ...: bit t
+//	of word w is byte from + 64 * w + t.  The Gear hash starts 64 bytes
+//	before "from" (or at 0), which is all it depends on.
+using CdcScanKernel = len_t(*)(const ui8* data, const len_t from, const len_t to, const ui64 mask_small, const ui64 mask_large, ui64* small, ui64* large) noexcept;
+
+// Bits of the next "count" bytes (up to 64)
+__LL_NODISCARD__ __LL_INLINE__ ui64 CdcScanWord(const ui8* data, const len_t count, const ui64 mask_small, const ui64 mask_large, ui64& h, ui64& small) noexcept {
+	ui64 s = 0, l = 0;
+	for (len_t t = 0; t < count; ++t) {
+		h = (h << 1) + CDC_GEAR[data[t]];
+		// Cut points are rare, and every small one is also a large one
+		if ((h & mask_large) == 0) {
+			l |= ui64(1) << t;
+			if ((h & mask_small) == 0) s |= ui64(1) << t;
+		}
+	}
+	small = s;
+	return l;
+}
+
+len_t CdcScanScalar(const ui8* data, const len_t from, const len_t to, const ui64 mask_small, const ui64 mask_large, ui64* small, ui64* large) noexcept {
+	ui64 h = 0;
+	for (len_t i = from < 64 ? 0 : from - 64; i < from; ++i) h = (h << 1) + CDC_GEAR[data[i]];
+	len_t i = from;
+	for (; i + 64 <= to; i += 64) *large++ = CdcScanWord(data + i, 64, mask_small, mask_large, h, *small++);
+	if (i < to) *large = CdcScanWord(data + i, to - i, mask_small, mask_large, h, *small);
+	return to - from;
+}
+
+// The SIMD kernels split [from, to) in one stretch per lane, a multiple of
+//	64 bytes each, and return the bytes they covered; the rest is left to the
+//	scalar kernel.  Lanes read their bytes 8 at a time with one gather and
+//	look up the Gear values with another.  "from" must be at least 64.
+#if defined(LL_CITY_X86_64)
+LL_CITY_TARGET_AVX2 len_t CdcScanAvx2(const ui8* data, const len_t from, const len_t to, const ui64 mask_small, const ui64 mask_large, ui64* small, ui64* large) noexcept {
+	constexpr len_t LANES = 4;
+	const len_t lane = (to - from) / (64 * LANES) * 64;
+	if (lane == 0) return 0;
+	const long long* gear = reinterpret_cast<const long long*>(CDC_GEAR.data());
+	const __m256i ms = _mm256_set1_epi64x(static_cast<long long>(mask_small));
+	const __m256i ml = _mm256_set1_epi64x(static_cast<long long>(mask_large));
+	const __m256i byte = _mm256_set1_epi64x(0xff);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i step = _mm256_set1_epi64x(8);
+	__m256i pos = _mm256_setr_epi64x(
+		static_cast<long long>(from - 64), static_cast<long long>(from + lane - 64),
+		static_cast<long long>(from + 2 * lane - 64), static_cast<long long>(from + 3 * lane - 64));
+	__m256i h = zero;
+	for (len_t t = 0; t < 64; t += 8) {
+		const __m256i bytes = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(data), pos, 1);
+		pos = _mm256_add_epi64(pos, step);
+		for (int b = 0; b < 8; ++b) {
+			const __m256i g = _mm256_i64gather_epi64(gear, _mm256_and_si256(_mm256_srli_epi64(bytes, 8 * b), byte), 8);
+			h = _mm256_add_epi64(_mm256_add_epi64(h, h), g);
+		}
+	}
+	alignas(32) ui64 words[2][LANES];
+	for (len_t w = 0; w < lane; w += 64) {
+		__m256i s = zero, l = zero;
+		for (len_t t = 0; t < 64; t += 8) {
+			const __m256i bytes = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(data), pos, 1);
+			pos = _mm256_add_epi64(pos, step);
+			for (int b = 0; b < 8; ++b) {
+				const __m256i g = _mm256_i64gather_epi64(gear, _mm256_and_si256(_mm256_srli_epi64(bytes, 8 * b), byte), 8);
+				h = _mm256_add_epi64(_mm256_add_epi64(h, h), g);
+				const __m256i bit = _mm256_set1_epi64x(static_cast<long long>(ui64(1) << (t + b)));
+				s = _mm256_or_si256(s, _mm256_and_si256(_mm256_cmpeq_epi64(_mm256_and_si256(h, ms), zero), bit));
+				l = _mm256_or_si256(l, _mm256_and_si256(_mm256_cmpeq_epi64(_mm256_and_si256(h, ml), zero), bit));
+			}
+		}
+		_mm256_store_si256(reinterpret_cast<__m256i*>(words[0]), s);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(words[1]), l);
+		for (len_t j = 0; j < LANES; ++j) {
+			small[(j * lane + w) / 64] = words[0][j];
+			large[(j * lane + w) / 64] = words[1][j];
+		}
+	}
+	return LANES * lane;
+}
+
+LL_CITY_TARGET_AVX512 len_t CdcScanAvx512(const ui8* data, const len_t from, const len_t to, const ui64 mask_small, const ui64 mask_large, ui64* small, ui64* large) noexcept {
+	constexpr len_t LANES = 8;
+	const len_t lane = (to - from) / (64 * LANES) * 64;
+	if (lane == 0) return 0;
+	const __m512i ms = _mm512_set1_epi64(static_cast<long long>(mask_small));
+	const __m512i ml = _mm512_set1_epi64(static_cast<long long>(mask_large));
+	const __m512i byte = _mm512_set1_epi64(0xff);
+	const __m512i step = _mm512_set1_epi64(8);
+	const __m512i lane_index = _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+	// Lane j starts at from + j * lane; its words are lane / 64 apart
+	__m512i pos = _mm512_add_epi64(_mm512_set1_epi64(static_cast<long long>(from - 64)),
+		_mm512_mullo_epi64(lane_index, _mm512_set1_epi64(static_cast<long long>(lane))));
+	const __m512i word_index = _mm512_mullo_epi64(lane_index, _mm512_set1_epi64(static_cast<long long>(lane / 64)));
+	__m512i h = _mm512_setzero_si512();
+	for (len_t t = 0; t < 64; t += 8) {
+		const __m512i bytes = _mm512_i64gather_epi64(pos, data, 1);
+		pos = _mm512_add_epi64(pos, step);
+		for (int b = 0; b < 8; ++b) {
+			const __m512i g = _mm512_i64gather_epi64(_mm512_and_si512(_mm512_srli_epi64(bytes, 8 * b), byte), CDC_GEAR.data(), 8);
+			h = _mm512_add_epi64(_mm512_add_epi64(h, h), g);
+		}
+	}
+	for (len_t w = 0; w < lane; w += 64) {
+		__m512i s = _mm512_setzero_si512(), l = _mm512_setzero_si512();
+		for (len_t t = 0; t < 64; t += 8) {
+			const __m512i bytes = _mm512_i64gather_epi64(pos, data, 1);
+			pos = _mm512_add_epi64(pos, step);
+			for (int b = 0; b < 8; ++b) {
+				const __m512i g = _mm512_i64gather_epi64(_mm512_and_si512(_mm512_srli_epi64(bytes, 8 * b), byte), CDC_GEAR.data(), 8);
+				h = _mm512_add_epi64(_mm512_add_epi64(h, h), g);
+				const __m512i bit = _mm512_set1_epi64(static_cast<long long>(ui64(1) << (t + b)));
+				s = _mm512_mask_or_epi64(s, _mm512_testn_epi64_mask(h, ms), s, bit);
+				l = _mm512_mask_or_epi64(l, _mm512_testn_epi64_mask(h, ml), l, bit);
+			}
+		}
+		_mm512_i64scatter_epi64(small + w / 64, word_index, s, 8);
+		_mm512_i64scatter_epi64(large + w / 64, word_index, l, 8);
+	}
+	return LANES * lane;
+}
+#endif // LL_CITY_X86_64
+
+// SIMD kernel of the requested set: nullptr for the scalar one, and false
+//	if this CPU cannot run it.  Auto prefers AVX-512; with AVX2, gathering 4
+//	Gear values is no faster than 4 scalar loads, so it stays scalar.
+__LL_NODISCARD__ ll_bool_t GetCdcKernel(const BatchKernel kernel, CdcScanKernel& out) noexcept {
+	out = nullptr;
+#if defined(LL_CITY_X86_64)
+	const CpuFeatures& cpu = GetCpuFeatures();
+	switch (kernel) {
+		case BatchKernel::Auto:
+			if (cpu.avx512) out = CdcScanAvx512;
+			return true;
+		case BatchKernel::Avx2:
+			out = CdcScanAvx2;
+			return cpu.avx2;
+		case BatchKernel::Avx512:
+			out = CdcScanAvx512;
+			return cpu.avx512;
+		case BatchKernel::Scalar:
+		default:
+			return true;
+	}
+#else
+	return kernel == BatchKernel::Auto || kernel == BatchKernel::Scalar;
+#endif // LL_CITY_X86_64
+}
+
+#pragma endregion
+#pragma region Scanner
+// First byte in [from, to) whose bit is set, or to
+__LL_NODISCARD__ __LL_INLINE__ len_t CdcFindCut(const ui64* bits, const len_t base, len_t from, const len_t to) noexcept {
+	while (from < to) {
+		const len_t shift = (from - base) % 64;
+		const ui64 word = bits[(from - base) / 64] >> shift;
+		if (word) {
+			const len_t i = from + static_cast<len_t>(std::countr_zero(word));
+			return i < to ? i : to;
+		}
+		from += 64 - shift;
+	}
+	return to;
+}
+
+// Chunks one input: keeps the cut point bitmaps of a window of it, which
+//	slides forward as chunks are cut
+struct CdcScanner {
+	const CityChunker& chunker;
+	CdcScanKernel kernel;
+	const ll_char_t* data;
+	len_t len;
+	ui64* small;
+	ui64* large;
+	len_t window;		// Bytes the bitmaps can hold
+	len_t base;			// First byte of the bitmaps, a multiple of 64
+	len_t end;			// Bytes [base, end) are computed
+
+	// bitmaps holds 2 * CdcWindow(max) / 64 words
+	CdcScanner(const CityChunker& chunker, const CdcScanKernel kernel, const ll_char_t* data, const len_t len, ui64* bitmaps) noexcept
+		: chunker(chunker)
+		, kernel(kernel)
+		, data(data)
+		, len(len)
+		, small(bitmaps)
+		, large(bitmaps + CdcWindow(chunker.max_size) / 64)
+		, window(CdcWindow(chunker.max_size))
+		, base(0)
+		, end(0)
+	{}
+
+	void scan(len_t from, const len_t to) noexcept {
+		const ui8* bytes = reinterpret_cast<const ui8*>(this->data);
+		ui64* small = this->small + (from - this->base) / 64;
+		ui64* large = this->large + (from - this->base) / 64;
+		if (this->kernel && from < 64 && from < to) {
+			// SIMD lanes start 64 bytes early
+			from += CdcScanScalar(bytes, from, to < 64 ? to : 64, this->chunker.mask_small, this->chunker.mask_large, small++, large++);
+		}
+		if (this->kernel && from < to) {
+			const len_t done = this->kernel(bytes, from, to, this->chunker.mask_small, this->chunker.mask_large, small, large);
+			from += done;
+			small += done / 64;
+			large += done / 64;
+		}
+		if (from < to) (void)CdcScanScalar(bytes, from, to, this->chunker.mask_small, this->chunker.mask_large, small, large);
+	}
+	// Makes bytes [p + min - 1, to) available, for the chunk starting at p
+	void ensure(const len_t p, const len_t to) noexcept {
+		if (to <= this->end) return;
+		// Bytes before p + min - 1 are no longer needed
+		const len_t keep = (p + this->chunker.min_size - 1) & ~len_t(63);
+		if (keep >= this->end) this->base = this->end = keep;
+		else if (keep > this->base) {
+			const len_t shift = (keep - this->base) / 64;
+			const len_t words = (this->end - keep + 63) / 64;
+			std::memmove(this->small, this->small + shift, words * sizeof(ui64));
+			std::memmove(this->large, this->large + shift, words * sizeof(ui64));
+			this->base = keep;
+		}
+		const len_t end = this->base + this->window < this->len ? this->base + this->window : this->len;
+		this->scan(this->end, end);
+		this->end = end;
+	}
+	// End of the chunk that starts at p (p < len), or 0 if the bytes up to
+	//	len are not enough to tell
+	__LL_NODISCARD__ len_t next(const len_t p, const ll_bool_t eof) noexcept {
+		const CityChunker& c = this->chunker;
+		const len_t first = p + c.min_size - 1;
+		const len_t middle = p + c.avg_size - 1;
+		const len_t last = p + c.max_size - 1 < this->len ? p + c.max_size - 1 : this->len;
+		if (first < last) this->ensure(p, last);
+
+		const len_t small_end = middle < this->len ? middle : this->len;
+		len_t i = CdcFindCut(this->small, this->base, first, small_end);
+		if (i < small_end) return i + 1;
+		if (middle > this->len) return eof ? this->len : 0;
+		i = CdcFindCut(this->large, this->base, middle, last);
+		if (i < last) return i + 1;
+		if (p + c.max_size <= this->len) return p + c.max_size;
+		return eof ? this->len : 0;
+	}
+};
+
+#pragma endregion
+
+// Appends the chunks of the chain that starts at p while they start before
+//	stop, and returns the end of the last one
+len_t CdcChain(CdcScanner& scanner, len_t p, const len_t stop, std::vector<CityChunk>& out) {
+	while (p < stop) {
+		const len_t end = scanner.next(p, true);
+		out.push_back(CityChunk{ p, end - p, city::CityHash128Unchecked(scanner.data + p, end - p) });
+		p = end;
+	}
+	return p;
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+#pragma region Chunker
+CityChunker::CityChunker(const len_t min, const len_t avg, const len_t max, const BatchKernel kernel) noexcept
+	: min_size(min < 64 ? 64 : min)
+	, avg_size(avg < this->min_size ? this->min_size : avg)
+	, max_size(max < this->avg_size ? this->avg_size : max)
+	, mask_small()
+	, mask_large()
+	, kernel(kernel)
+{
+	// Normalized chunking, level 2: cut points are 4 times rarer than 1 /
+	//	avg before avg, and 4 times more frequent after it
+	int bits = static_cast<int>(std::bit_width(this->avg_size)) - 1;
+	bits = bits > 60 ? 60 : bits;
+	this->mask_small = ~ui64(0) << (64 - (bits + 2));
+	this->mask_large = ~ui64(0) << (64 - (bits - 2));
+}
+
+ll_bool_t CityChunker::chunk(ll_string_t s, const len_t len, std::vector<CityChunk>& out, const len_t threads) const noexcept {
+	CdcScanKernel kernel;
+	if (!s || !GetCdcKernel(this->kernel, kernel)) return false;
+	if (len == 0) return true;
+	const len_t segment = 16 * this->max_size > CDC_SEGMENT ? 16 * this->max_size : CDC_SEGMENT;
+	const len_t segments = (len + segment - 1) / segment;
+	try {
+		std::vector<ui64> bitmaps(2 * CdcWindow(this->max_size) / 64);
+		CdcScanner scanner(*this, kernel, s, len, bitmaps.data());
+		if (WorkerCount(segments, threads) <= 1) {
+			(void)CdcChain(scanner, 0, len, out);
+			return true;
+		}
+
+		// Every segment is chunked as if a chunk started at its first byte.
+		//	The chain from the start of the input soon meets the chain of the
+		//	segment (both cut at the same byte), and from then on both are the
+		//	same chunks.
+		std::vector<std::vector<CityChunk>> parts(segments);
+		std::atomic<ll_bool_t> ok = true;
+		ParallelFor(segments, threads, [&](const len_t task) noexcept {
+			try {
+				std::vector<ui64> own(bitmaps.size());
+				CdcScanner part(*this, kernel, s, len, own.data());
+				const len_t stop = len - task * segment < segment ? len : (task + 1) * segment;
+				(void)CdcChain(part, task * segment, stop, parts[task]);
+			}
+			catch (...) {
+				ok = false;
+			}
+		});
+		if (!ok) return false;
+
+		len_t p = 0;
+		for (len_t task = 0; task < segments; ++task) {
+			const std::vector<CityChunk>& part = parts[task];
+			const len_t stop = len - task * segment < segment ? len : (task + 1) * segment;
+			while (p < stop) {
+				const auto found = std::lower_bound(part.begin(), part.end(), p,
+					[](const CityChunk& chunk, const len_t offset) { return chunk.offset < offset; });
+				if (found != part.end() && found->offset == p) {
+					out.insert(out.end(), found, part.end());
+					p = part.back().offset + part.back().length;
+					break;
+				}
+				const len_t end = scanner.next(p, true);
+				out.push_back(CityChunk{ p, end - p, city::CityHash128Unchecked(s + p, end - p) });
+				p = end;
+			}
+		}
+		return true;
+	}
+	catch (...) {
+		return false;
+	}
+}
+ll_bool_t CityChunker::chunkFile(ll_string_t path, std::vector<CityChunk>& out) const noexcept {
+	if (!path) return false;
+	std::FILE* file = std::fopen(path, "rb");
+	if (!file) return false;
+	CityChunkerStream stream(*this);
+	ll_bool_t ok = true;
+	try {
+		std::vector<ll_char_t> block(CDC_FILE_BLOCK);
+		len_t read = 0;
+		while (ok && (read = std::fread(block.data(), 1, block.size(), file)) > 0)
+			ok = stream.update(block.data(), read, out);
+		ok = ok && !std::ferror(file);
+	}
+	catch (...) {
+		ok = false;
+	}
+	std::fclose(file);
+	return stream.finalize(out) && ok;
+}
+
+len_t CityChunker::minSize() const noexcept { return this->min_size; }
+len_t CityChunker::avgSize() const noexcept { return this->avg_size; }
+len_t CityChunker::maxSize() const noexcept { return this->max_size; }
+BatchKernel CityChunker::getKernel() const noexcept { return this->kernel; }
+
+#pragma endregion
+#pragma region Stream
+CityChunkerStream::CityChunkerStream(const CityChunker& chunker) noexcept
+	: chunker(chunker)
+	, pending()
+	, bitmaps()
+	, offset(0)
+	, failed(false)
+{}
+
+len_t CityChunkerStream::cut(const ll_char_t* data, const len_t len, const ll_bool_t eof, std::vector<CityChunk>& out) noexcept {
+	CdcScanKernel kernel;
+	if (!GetCdcKernel(this->chunker.getKernel(), kernel)) {
+		this->failed = true;
+		return 0;
+	}
+	try {
+		this->bitmaps.resize(2 * CdcWindow(this->chunker.maxSize()) / 64);
+		CdcScanner scanner(this->chunker, kernel, data, len, this->bitmaps.data());
+		len_t p = 0;
+		for (len_t end; p < len && (end = scanner.next(p, eof)) != 0; p = end)
+			out.push_back(CityChunk{ this->offset + p, end - p, city::CityHash128Unchecked(data + p, end - p) });
+		return p;
+	}
+	catch (...) {
+		this->failed = true;
+		return 0;
+	}
+}
+
+ll_bool_t CityChunkerStream::update(ll_string_t s, len_t len, std::vector<CityChunk>& out) noexcept {
+	if (!s) this->failed = true;
+	if (this->failed) return false;
+	// Pieces are gathered up to this size before they are scanned, so small
+	//	pieces do not scan the same pending bytes over and over
+	const len_t target = 4 * this->chunker.maxSize();
+	try {
+		while (len > 0) {
+			if (this->pending.empty()) {
+				const len_t done = this->cut(s, len, false, out);
+				if (this->failed) return false;
+				this->offset += done;
+				this->pending.assign(s + done, s + len);
+				return true;
+			}
+			const len_t take = target - this->pending.size() < len ? target - this->pending.size() : len;
+			this->pending.insert(this->pending.end(), s, s + take);
+			s += take;
+			len -= take;
+			if (this->pending.size() < target) return true;
+
+			const len_t done = this->cut(this->pending.data(), this->pending.size(), false, out);
+			if (this->failed) return false;
+			this->offset += done;
+			const len_t rest = this->pending.size() - done;
+			// Bytes left over from this piece go back to it, to be scanned in place
+			if (rest <= take) {
+				s -= rest;
+				len += rest;
+				this->pending.clear();
+			}
+			else this->pending.erase(this->pending.begin(), this->pending.begin() + static_cast<std::ptrdiff_t>(done));
+		}
+		return true;
+	}
+	catch (...) {
+		this->failed = true;
+		return false;
+	}
+}
+ll_bool_t CityChunkerStream::finalize(std::vector<CityChunk>& out) noexcept {
+	ll_bool_t ok = !this->failed;
+	if (ok) (void)this->cut(this->pending.data(), this->pending.size(), true, out);
+	ok = ok && !this->failed;
+	this->pending.clear();
+	this->offset = 0;
+	this->failed = false;
+	return ok;
+}
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
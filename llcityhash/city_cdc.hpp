@@ -0,0 +1,126 @@
+//////////////////////////////////////////////
+//	city_cdc.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Content-defined chunking (Gear hash with FastCDC normalized chunking) and
+// CityHash128 fingerprints, for deduplication.
+//
+// The Gear hash of byte i is h(i) = sum of GEAR[s[i - k]] << k for k < 64:
+// a rolling hash of the 64 bytes ending at i, with GEAR[b] =
+// CityHash64Key(b).  Byte i is a cut point when the top bits of h(i) are
+// all zero.  A chunk starting at p ends after the first byte i in
+//	- [p + min - 1, p + avg - 1) with the top log2(avg) + 2 bits zero,
+//	- or else [p + avg - 1, p + max - 1) with the top log2(avg) - 2 bits zero,
+//	- or else after p + max bytes,
+// so chunks are never shorter than min (but for the last one) nor longer
+// than max, and most fall near avg (a little above it on average).  As min
+// is at least 64, whether a byte is a cut point only depends on the data
+// around it, not on where its chunk started: chunks realign right after an
+// insertion or deletion, and the same data can be scanned with SIMD lanes,
+// by threads or in pieces and give the same chunks.
+//
+// Cut points are found 4 (AVX2) or 8 (AVX-512) bytes at a time, one lane
+// per stretch of the input (BatchKernel::Auto uses AVX-512 when the CPU has
+// it, and scalar code otherwise), and every chunk is fingerprinted with
+// CityHash128 as soon as it is cut, while it is still in cache: the input is
+// read from memory once.
+
+#ifndef LLCPP_CITY_HASH_CDC_HPP_
+#define LLCPP_CITY_HASH_CDC_HPP_
+
+#include "city.hpp"
+
+#include <vector>
+
+namespace llcpp {
+namespace city {
+
+namespace __internal__ {
+struct CdcScanner;
+} // namespace __internal__
+
+#pragma region Chunker
+constexpr len_t CITYHASH_CDC_DEFAULT_MIN = 2 * 1024;
+constexpr len_t CITYHASH_CDC_DEFAULT_AVG = 8 * 1024;
+constexpr len_t CITYHASH_CDC_DEFAULT_MAX = 64 * 1024;
+
+struct CityChunk {
+	len_t offset;					// From the start of the input
+	len_t length;
+	hash::Hash128 fingerprint;		// CityHash128 of the chunk
+};
+
+class LL_SHARED_LIB CityChunker {
+	private:
+		len_t min_size;
+		len_t avg_size;
+		len_t max_size;
+		ui64 mask_small;	// Cut points before avg: log2(avg) + 2 top bits
+		ui64 mask_large;	// Cut points after avg: log2(avg) - 2 top bits
+		BatchKernel kernel;
+
+	public:
+		// Sizes are adjusted to 64 <= min <= avg <= max, and only the power of
+		//	two at or below avg counts for the cut points.  The kernel scans
+		//	for cut points; chunking fails if this CPU cannot run it.
+		CityChunker(const len_t min = CITYHASH_CDC_DEFAULT_MIN, const len_t avg = CITYHASH_CDC_DEFAULT_AVG,
+			const len_t max = CITYHASH_CDC_DEFAULT_MAX, const BatchKernel kernel = BatchKernel::Auto) noexcept;
+
+		// Appends the chunks of s[0] ... s[len - 1] to out.  With more than one
+		//	thread (0 uses every core) the input is cut in segments chunked in
+		//	parallel and then stitched, with the same chunks as one thread.
+		//	Returns false if s is null, the kernel cannot run or memory runs
+		//	out.
+		ll_bool_t chunk(ll_string_t s, const len_t len, std::vector<CityChunk>& out, const len_t threads = 1) const noexcept;
+		// Same for the contents of a file, read in blocks through a
+		//	CityChunkerStream (to chunk a large file on several threads, map
+		//	it and call chunk()).  Also returns false if the file cannot be
+		//	read.
+		ll_bool_t chunkFile(ll_string_t path, std::vector<CityChunk>& out) const noexcept;
+
+		__LL_NODISCARD__ len_t minSize() const noexcept;
+		__LL_NODISCARD__ len_t avgSize() const noexcept;
+		__LL_NODISCARD__ len_t maxSize() const noexcept;
+		__LL_NODISCARD__ BatchKernel getKernel() const noexcept;
+
+		friend struct __internal__::CdcScanner;
+};
+
+#pragma endregion
+#pragma region Stream
+// Chunks data that arrives in pieces: update() appends the chunks that are
+// complete, and finalize() the rest.  The chunks are the same as those of
+// CityChunker::chunk() over the concatenation of the pieces.  At most about
+// 4 * max bytes are buffered.
+class LL_SHARED_LIB CityChunkerStream {
+	private:
+		CityChunker chunker;
+		std::vector<ll_char_t> pending;		// Bytes of the chunks not cut yet
+		std::vector<ui64> bitmaps;
+		len_t offset;						// Input offset of pending[0]
+		ll_bool_t failed;
+
+	private:
+		// Appends the chunks of data[0] ... data[len - 1] that can be cut
+		//	(all of them if eof) and returns the bytes they cover
+		__LL_NODISCARD__ len_t cut(const ll_char_t* data, const len_t len, const ll_bool_t eof, std::vector<CityChunk>& out) noexcept;
+
+	public:
+		explicit CityChunkerStream(const CityChunker& chunker = CityChunker()) noexcept;
+
+		// Returns false if s is null, the kernel cannot run or memory runs out;
+		//	update() and finalize() fail from then on
+		ll_bool_t update(ll_string_t s, len_t len, std::vector<CityChunk>& out) noexcept;
+		// Appends the last chunks and starts a new input at offset 0
+		ll_bool_t finalize(std::vector<CityChunk>& out) noexcept;
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_CDC_HPP_
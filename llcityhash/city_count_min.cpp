@@ -0,0 +1,422 @@
+//////////////////////////////////////////////
+//	city_count_min.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_count_min.hpp"
+#include "city_cpu.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+constexpr ui32 COUNT_MIN_MAX = std::numeric_limits<ui32>::max();
+// Keys hashed and prefetched together by addBatch and estimateBatch
+constexpr len_t COUNT_MIN_GROUP = 16;
+
+__LL_NODISCARD__ __LL_INLINE__ ui32 SaturatingAdd(const ui32 a, const ui32 b) noexcept {
+	const ui32 sum = a + b;
+	return sum < a ? COUNT_MIN_MAX : sum;
+}
+
+__LL_INLINE__ void CountMinPrefetch(const void* p) noexcept {
+#if defined(LL_CITY_X86_64) && defined(_MSC_VER)
+	_mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(p, 1);
+#else
+	(void)p;
+#endif
+}
+
+#pragma region Merge
+__LL_INLINE__ void MergeCountersScalar(ui32* dst, const ui32* src, const len_t begin, const len_t n) noexcept {
+	for (len_t i = begin; i < n; ++i) dst[i] = SaturatingAdd(dst[i], src[i]);
+}
+
+// There is no unsigned 32-bit saturating add: a lane overflowed if its sum
+//	is below dst, compared as signed after flipping the sign bits, and is
+//	then set to all ones
+#if defined(LL_CITY_X86_64)
+LL_CITY_TARGET_AVX2 void MergeCountersAvx2(ui32* dst, const ui32* src, const len_t n) noexcept {
+	const __m256i sign = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+	len_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+		const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+		const __m256i sum = _mm256_add_epi32(a, b);
+		const __m256i overflow = _mm256_cmpgt_epi32(_mm256_xor_si256(a, sign), _mm256_xor_si256(sum, sign));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_or_si256(sum, overflow));
+	}
+	MergeCountersScalar(dst, src, i, n);
+}
+// SSE2 is part of x86-64
+void MergeCountersSse2(ui32* dst, const ui32* src, const len_t n) noexcept {
+	const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+	len_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		const __m128i sum = _mm_add_epi32(a, b);
+		const __m128i overflow = _mm_cmpgt_epi32(_mm_xor_si128(a, sign), _mm_xor_si128(sum, sign));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(sum, overflow));
+	}
+	MergeCountersScalar(dst, src, i, n);
+}
+#endif // LL_CITY_X86_64
+
+void MergeCounters(ui32* dst, const ui32* src, const len_t n) noexcept {
+#if defined(LL_CITY_X86_64)
+	if (GetCpuFeatures().avx2) MergeCountersAvx2(dst, src, n);
+	else MergeCountersSse2(dst, src, n);
+#else
+	MergeCountersScalar(dst, src, 0, n);
+#endif // LL_CITY_X86_64
+}
+
+#pragma endregion
+
+// Hashes the keys of a batch in groups and calls body(i, cells) for each
+//	non-null key i, with the counters of the next group already prefetched
+template<class Cells, class Body>
+__LL_INLINE__ ll_bool_t CountMinBatch(const ll_string_t* ptrs, const len_t* lens, const len_t n,
+	const ui32* counters, const ui32 depth, Cells&& cells, Body&& body) noexcept {
+	ll_bool_t ok = true;
+	len_t group_cells[2][COUNT_MIN_GROUP][CITYHASH_COUNT_MIN_MAX_DEPTH];
+	auto stage = [&](const len_t base, len_t (*group)[CITYHASH_COUNT_MIN_MAX_DEPTH]) noexcept {
+		hash::Hash128 hashes[COUNT_MIN_GROUP];
+		const len_t count = n - base < COUNT_MIN_GROUP ? n - base : COUNT_MIN_GROUP;
+		ok &= city::CityHash128Batch(ptrs + base, lens + base, hashes, count);
+		for (len_t i = 0; i < count; ++i) {
+			cells(hashes[i], group[i]);
+			for (ui32 row = 0; row < depth; ++row) CountMinPrefetch(counters + group[i][row]);
+		}
+	};
+	auto finish = [&](const len_t base, len_t (*group)[CITYHASH_COUNT_MIN_MAX_DEPTH]) noexcept {
+		const len_t count = n - base < COUNT_MIN_GROUP ? n - base : COUNT_MIN_GROUP;
+		for (len_t i = 0; i < count; ++i) body(base + i, group[i]);
+	};
+
+	if (n == 0) return true;
+	stage(0, group_cells[0]);
+	len_t base = 0;
+	for (len_t g = 0; base + COUNT_MIN_GROUP < n; base += COUNT_MIN_GROUP, g ^= 1) {
+		stage(base + COUNT_MIN_GROUP, group_cells[g ^ 1]);
+		finish(base, group_cells[g]);
+	}
+	finish(base, group_cells[(base / COUNT_MIN_GROUP) & 1]);
+	return ok;
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+#pragma region CountMin
+CityCountMinSketch::CityCountMinSketch(const ui32 width, const ui32 depth, const CountMinUpdate update, const ll_bool_t shared) noexcept
+	: counters()
+	, width_(width ? width : 1)
+	, depth_(depth == 0 ? 1 : (depth > CITYHASH_COUNT_MIN_MAX_DEPTH ? CITYHASH_COUNT_MIN_MAX_DEPTH : depth))
+	, update(shared ? CountMinUpdate::Standard : update)
+	, shared(shared)
+{
+	this->counters.reset(new (std::nothrow) ui32[this->bytes() / sizeof(ui32)]());
+	if (!this->counters) this->width_ = 0;
+}
+CityCountMinSketch CityCountMinSketch::fromError(const f64 epsilon, const f64 delta, const CountMinUpdate update, const ll_bool_t shared) noexcept {
+	constexpr f64 E = 2.718281828459045;
+	const f64 width = epsilon > 0.0 ? std::ceil(E / epsilon) : 1.0;
+	const f64 depth = delta > 0.0 && delta < 1.0 ? std::ceil(std::log(1.0 / delta)) : 1.0;
+	return CityCountMinSketch(
+		width < static_cast<f64>(COUNT_MIN_MAX) ? static_cast<ui32>(width) : COUNT_MIN_MAX,
+		depth < static_cast<f64>(CITYHASH_COUNT_MIN_MAX_DEPTH) ? static_cast<ui32>(depth) : CITYHASH_COUNT_MIN_MAX_DEPTH,
+		update, shared);
+}
+CityCountMinSketch::CityCountMinSketch(const CityCountMinSketch& other) noexcept
+	: counters()
+	, width_(other.width_)
+	, depth_(other.depth_)
+	, update(other.update)
+	, shared(other.shared)
+{
+	const len_t n = this->bytes() / sizeof(ui32);
+	if (n == 0) return;
+	this->counters.reset(new (std::nothrow) ui32[n]);
+	if (this->counters) std::memcpy(this->counters.get(), other.counters.get(), this->bytes());
+	else this->width_ = 0;
+}
+CityCountMinSketch& CityCountMinSketch::operator=(const CityCountMinSketch& other) noexcept {
+	if (this != &other) *this = CityCountMinSketch(other);
+	return *this;
+}
+
+void CityCountMinSketch::cells(const hash::Hash128& hash, len_t* out) const noexcept {
+	const ui64 low = hash.getLow();
+	const ui64 high = hash.getHigh();
+	len_t row = 0;
+	for (ui32 i = 0; i < this->depth_; ++i, row += this->width_) {
+		// Multiply and shift instead of a modulo
+		const ui64 h = low + i * high;
+		out[i] = row + static_cast<len_t>(((h >> 32) * this->width_) >> 32);
+	}
+}
+ui32 CityCountMinSketch::addCells(const len_t* cells, const ui32 count) noexcept {
+	ui32* counters = this->counters.get();
+	ui32 estimate = COUNT_MIN_MAX;
+	if (!this->shared) {
+		if (this->update == CountMinUpdate::Standard) {
+			for (ui32 i = 0; i < this->depth_; ++i) {
+				ui32& c = counters[cells[i]];
+				c = SaturatingAdd(c, count);
+				estimate = c < estimate ? c : estimate;
+			}
+			return estimate;
+		}
+		for (ui32 i = 0; i < this->depth_; ++i)
+			estimate = counters[cells[i]] < estimate ? counters[cells[i]] : estimate;
+		const ui32 target = SaturatingAdd(estimate, count);
+		for (ui32 i = 0; i < this->depth_; ++i)
+			if (counters[cells[i]] < target) counters[cells[i]] = target;
+		return target;
+	}
+
+	// Shared: compare and swap loops that saturate like the private path
+	for (ui32 i = 0; i < this->depth_; ++i) {
+		std::atomic_ref<ui32> c(counters[cells[i]]);
+		ui32 current = c.load(std::memory_order_relaxed);
+		ui32 next;
+		do next = SaturatingAdd(current, count);
+		while (!c.compare_exchange_weak(current, next, std::memory_order_relaxed));
+		estimate = next < estimate ? next : estimate;
+	}
+	return estimate;
+}
+ui32 CityCountMinSketch::estimateCells(const len_t* cells) const noexcept {
+	ui32* counters = this->counters.get();
+	ui32 estimate = COUNT_MIN_MAX;
+	for (ui32 i = 0; i < this->depth_; ++i) {
+		const ui32 c = this->shared
+			? std::atomic_ref<ui32>(counters[cells[i]]).load(std::memory_order_relaxed)
+			: counters[cells[i]];
+		estimate = c < estimate ? c : estimate;
+	}
+	return estimate;
+}
+
+std::optional<ui32> CityCountMinSketch::add(ll_string_t s, const len_t len, const ui32 count) noexcept {
+	if (!s) return std::nullopt;
+	return this->addHash(city::CityHash128Unchecked(s, len), count);
+}
+ui32 CityCountMinSketch::addHash(const hash::Hash128& hash, const ui32 count) noexcept {
+	if (this->width_ == 0) return 0;
+	len_t cells[CITYHASH_COUNT_MIN_MAX_DEPTH];
+	this->cells(hash, cells);
+	return this->addCells(cells, count);
+}
+ll_bool_t CityCountMinSketch::addBatch(const ll_string_t* ptrs, const len_t* lens, const len_t n, const ui32* counts, ui32* estimates) noexcept {
+	if (!ptrs || !lens) return false;
+	if (this->width_ == 0) {
+		ll_bool_t ok = true;
+		for (len_t i = 0; i < n; ++i) {
+			if (estimates) estimates[i] = 0;
+			ok &= ptrs[i] != nullptr;
+		}
+		return ok;
+	}
+	return CountMinBatch(ptrs, lens, n, this->counters.get(), this->depth_,
+		[this](const hash::Hash128& hash, len_t* out) noexcept { this->cells(hash, out); },
+		[&](const len_t i, const len_t* cells) noexcept {
+			const ui32 estimate = ptrs[i] ? this->addCells(cells, counts ? counts[i] : 1) : 0;
+			if (estimates) estimates[i] = estimate;
+		});
+}
+
+std::optional<ui32> CityCountMinSketch::estimate(ll_string_t s, const len_t len) const noexcept {
+	if (!s) return std::nullopt;
+	return this->estimateHash(city::CityHash128Unchecked(s, len));
+}
+ui32 CityCountMinSketch::estimateHash(const hash::Hash128& hash) const noexcept {
+	if (this->width_ == 0) return 0;
+	len_t cells[CITYHASH_COUNT_MIN_MAX_DEPTH];
+	this->cells(hash, cells);
+	return this->estimateCells(cells);
+}
+ll_bool_t CityCountMinSketch::estimateBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n) const noexcept {
+	if (!ptrs || !lens || !out) return false;
+	if (this->width_ == 0) {
+		ll_bool_t ok = true;
+		for (len_t i = 0; i < n; ++i) {
+			out[i] = 0;
+			ok &= ptrs[i] != nullptr;
+		}
+		return ok;
+	}
+	return CountMinBatch(ptrs, lens, n, this->counters.get(), this->depth_,
+		[this](const hash::Hash128& hash, len_t* cells) noexcept { this->cells(hash, cells); },
+		[&](const len_t i, const len_t* cells) noexcept { out[i] = ptrs[i] ? this->estimateCells(cells) : 0; });
+}
+
+ll_bool_t CityCountMinSketch::merge(const CityCountMinSketch& other) noexcept {
+	if (other.width_ != this->width_ || other.depth_ != this->depth_) return false;
+	if (this->width_ == 0) return true;
+	MergeCounters(this->counters.get(), other.counters.get(), this->bytes() / sizeof(ui32));
+	return true;
+}
+
+void CityCountMinSketch::clear() noexcept {
+	if (this->counters) std::memset(this->counters.get(), 0, this->bytes());
+}
+ui32 CityCountMinSketch::width() const noexcept { return this->width_; }
+ui32 CityCountMinSketch::depth() const noexcept { return this->depth_; }
+CountMinUpdate CityCountMinSketch::getUpdate() const noexcept { return this->update; }
+ll_bool_t CityCountMinSketch::isShared() const noexcept { return this->shared; }
+len_t CityCountMinSketch::bytes() const noexcept {
+	return len_t(this->width_) * this->depth_ * sizeof(ui32);
+}
+
+#pragma endregion
+#pragma region HeavyHitters
+CityHeavyHitters::CityHeavyHitters(const ui32 k, const ui32 width, const ui32 depth) noexcept
+	: sketch(width, depth, CountMinUpdate::Conservative)
+	, heap()
+	, positions()
+	, k(k)
+{}
+
+void CityHeavyHitters::siftDown(ui32 i) noexcept {
+	const ui32 size = static_cast<ui32>(this->heap.size());
+	for (;;) {
+		const ui32 left = 2 * i + 1;
+		if (left >= size) break;
+		const ui32 child = left + 1 < size && this->heap[left + 1].count < this->heap[left].count ? left + 1 : left;
+		if (this->heap[i].count <= this->heap[child].count) break;
+		std::swap(this->heap[i], this->heap[child]);
+		*this->positions.find(std::string_view(this->heap[i].key)) = i;
+		i = child;
+	}
+	*this->positions.find(std::string_view(this->heap[i].key)) = i;
+}
+ll_bool_t CityHeavyHitters::offer(ll_string_t s, const len_t len, const ui32 count) noexcept {
+	// A key at or below the minimum of a full heap is either out of it, or in
+	//	it with that same count: nothing to do
+	if (this->k == 0 || (this->heap.size() == this->k && count <= this->heap[0].count)) return true;
+	const std::string_view key(s, len);
+	if (ui32* position = this->positions.find(key)) {
+		this->heap[*position].count = count;
+		this->siftDown(*position);
+		return true;
+	}
+	try {
+		if (this->heap.size() < this->k) {
+			// A new key has the lowest count of the keys that entered after it:
+			//	sift it up
+			ui32 i = static_cast<ui32>(this->heap.size());
+			this->heap.push_back(CityHeavyHitter{ std::string(key), count });
+			if (!this->positions.emplace(std::string(key), i).first) {
+				this->heap.pop_back();
+				return false;
+			}
+			while (i > 0 && this->heap[(i - 1) / 2].count > this->heap[i].count) {
+				const ui32 parent = (i - 1) / 2;
+				std::swap(this->heap[i], this->heap[parent]);
+				*this->positions.find(std::string_view(this->heap[i].key)) = i;
+				i = parent;
+			}
+			*this->positions.find(key) = i;
+			return true;
+		}
+		// Replace the minimum.  If the map cannot take the new key, the old one
+		//	leaves anyway, so that heap and map still agree.
+		std::string copy(key);
+		(void)this->positions.erase(std::string_view(this->heap[0].key));
+		const ll_bool_t inserted = this->positions.emplace(copy, 0u).first != nullptr;
+		if (inserted) this->heap[0] = CityHeavyHitter{ std::move(copy), count };
+		else {
+			this->heap[0] = std::move(this->heap.back());
+			this->heap.pop_back();
+		}
+		if (!this->heap.empty()) this->siftDown(0);
+		return inserted;
+	}
+	catch (...) {
+		return false;
+	}
+}
+
+ll_bool_t CityHeavyHitters::add(ll_string_t s, const len_t len, const ui32 count) noexcept {
+	if (!s) return false;
+	return this->offer(s, len, *this->sketch.add(s, len, count));
+}
+ll_bool_t CityHeavyHitters::addBatch(const ll_string_t* ptrs, const len_t* lens, const len_t n, const ui32* counts) noexcept {
+	if (!ptrs || !lens) return false;
+	constexpr len_t BLOCK = 256;
+	ui32 estimates[BLOCK];
+	ll_bool_t ok = true;
+	for (len_t base = 0; base < n; base += BLOCK) {
+		const len_t block = n - base < BLOCK ? n - base : BLOCK;
+		ok &= this->sketch.addBatch(ptrs + base, lens + base, block, counts ? counts + base : nullptr, estimates);
+		for (len_t i = 0; i < block; ++i)
+			if (ptrs[base + i] && !this->offer(ptrs[base + i], lens[base + i], estimates[i])) return false;
+	}
+	return ok;
+}
+ll_bool_t CityHeavyHitters::merge(const CityHeavyHitters& other) noexcept {
+	if (!this->sketch.merge(other.sketch)) return false;
+	try {
+		std::vector<CityHeavyHitter> candidates = std::move(this->heap);
+		candidates.insert(candidates.end(), other.heap.begin(), other.heap.end());
+		for (CityHeavyHitter& candidate : candidates)
+			candidate.count = *this->sketch.estimate(candidate.key.data(), candidate.key.size());
+		this->heap.clear();
+		this->positions.clear();
+		for (const CityHeavyHitter& candidate : candidates)
+			if (!this->offer(candidate.key.data(), candidate.key.size(), candidate.count)) return false;
+		return true;
+	}
+	catch (...) {
+		return false;
+	}
+}
+
+std::vector<CityHeavyHitter> CityHeavyHitters::top() const noexcept {
+	try {
+		std::vector<CityHeavyHitter> result(this->heap);
+		std::sort(result.begin(), result.end(), [](const CityHeavyHitter& a, const CityHeavyHitter& b) {
+			return a.count != b.count ? a.count > b.count : a.key < b.key;
+		});
+		return result;
+	}
+	catch (...) {
+		return {};
+	}
+}
+const CityCountMinSketch& CityHeavyHitters::getSketch() const noexcept { return this->sketch; }
+void CityHeavyHitters::clear() noexcept {
+	this->sketch.clear();
+	this->heap.clear();
+	this->positions.clear();
+}
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
@@ -0,0 +1,155 @@
+//////////////////////////////////////////////
+//	city_count_min.hpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Count-Min sketch (Cormode and Muthukrishnan) over CityHash128, and a
+// top-k heavy hitter tracker built on it.  A sketch of width w and depth d
+// keeps d rows of w counters; every key adds to one counter per row, and its
+// count is estimated as the smallest of them.  Estimates never fall below
+// the true count and exceed it by at most e / w of the total count with
+// probability 1 - e^-d.  The d columns of a key come from one CityHash128:
+// column i is taken from low + i * high (Kirsch and Mitzenmacher), so a key
+// costs a single hash at any depth.
+//
+// Counters are 32 bits and saturate instead of wrapping.  A sketch is either
+// private to a thread, and then merged with other threads' sketches, or
+// shared: every counter is then updated with atomic compare and swap, which
+// never blocks, and any number of threads can add and estimate at once.
+// Shared sketches always use standard updates: two threads raising the same
+// key conservatively could both start from its old estimate, and one of the
+// counts would be lost.
+
+#ifndef LLCPP_CITY_HASH_COUNT_MIN_HPP_
+#define LLCPP_CITY_HASH_COUNT_MIN_HPP_
+
+#include "city_flat_map.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace llcpp {
+namespace city {
+
+#pragma region CountMin
+constexpr ui32 CITYHASH_COUNT_MIN_MAX_DEPTH = 16;
+
+enum class CountMinUpdate : ui8 {
+	Standard,		// Every row adds the count
+	Conservative,	// Rows only rise to the key's new estimate: same guarantees, smaller overestimates
+};
+
+class LL_SHARED_LIB CityCountMinSketch {
+	private:
+		std::unique_ptr<ui32[]> counters;	// depth rows of width counters
+		ui32 width_;
+		ui32 depth_;
+		CountMinUpdate update;
+		ll_bool_t shared;
+
+	private:
+		// Counters of a key, one per row, as indices into counters
+		void cells(const hash::Hash128& hash, len_t* out) const noexcept;
+		__LL_NODISCARD__ ui32 addCells(const len_t* cells, const ui32 count) noexcept;
+		__LL_NODISCARD__ ui32 estimateCells(const len_t* cells) const noexcept;
+
+	public:
+		// width counters per row (at least 1) and depth rows (clamped to
+		//	[1, CITYHASH_COUNT_MIN_MAX_DEPTH]).  A shared sketch can be used by
+		//	many threads at once, and ignores update (see above).  If memory runs
+		//	out the sketch has width 0, counts nothing and estimates 0.
+		CityCountMinSketch(const ui32 width, const ui32 depth, const CountMinUpdate update = CountMinUpdate::Standard, const ll_bool_t shared = false) noexcept;
+		// Sketch that overestimates by at most epsilon times the total count
+		//	with probability 1 - delta
+		__LL_NODISCARD__ static CityCountMinSketch fromError(const f64 epsilon, const f64 delta, const CountMinUpdate update = CountMinUpdate::Standard, const ll_bool_t shared = false) noexcept;
+		CityCountMinSketch(const CityCountMinSketch& other) noexcept;
+		CityCountMinSketch& operator=(const CityCountMinSketch& other) noexcept;
+		CityCountMinSketch(CityCountMinSketch&&) noexcept = default;
+		CityCountMinSketch& operator=(CityCountMinSketch&&) noexcept = default;
+		~CityCountMinSketch() noexcept = default;
+
+		// Adds count to a key and returns its new estimate, or nullopt if s is
+		//	null
+		std::optional<ui32> add(ll_string_t s, const len_t len, const ui32 count = 1) noexcept;
+		// Same, for a key given by its CityHash128
+		ui32 addHash(const hash::Hash128& hash, const ui32 count = 1) noexcept;
+		// Adds counts[i] (1 if counts is null) to key i, and stores its new
+		//	estimate in estimates[i] if estimates is not null.  Keys are hashed
+		//	in groups with CityHash128Batch and the counters of a group are
+		//	prefetched while the previous group is updated.  Null keys are
+		//	skipped (estimate 0) and make it return false.
+		ll_bool_t addBatch(const ll_string_t* ptrs, const len_t* lens, const len_t n, const ui32* counts = nullptr, ui32* estimates = nullptr) noexcept;
+
+		// Estimated count of a key, or nullopt if s is null
+		__LL_NODISCARD__ std::optional<ui32> estimate(ll_string_t s, const len_t len) const noexcept;
+		__LL_NODISCARD__ ui32 estimateHash(const hash::Hash128& hash) const noexcept;
+		// out[i] = estimate of key i (0 for null keys, which make it return false)
+		ll_bool_t estimateBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n) const noexcept;
+
+		// Adds the counts of other (for example a per-thread sketch), counter
+		//	by counter with saturating vector adds.  Returns false if widths or
+		//	depths differ.  Not atomic: no thread may add to this sketch
+		//	meanwhile, even if it is shared.
+		ll_bool_t merge(const CityCountMinSketch& other) noexcept;
+
+		void clear() noexcept;
+		__LL_NODISCARD__ ui32 width() const noexcept;
+		__LL_NODISCARD__ ui32 depth() const noexcept;
+		__LL_NODISCARD__ CountMinUpdate getUpdate() const noexcept;
+		__LL_NODISCARD__ ll_bool_t isShared() const noexcept;
+		__LL_NODISCARD__ len_t bytes() const noexcept;
+};
+
+#pragma endregion
+#pragma region HeavyHitters
+struct CityHeavyHitter {
+	std::string key;
+	ui32 count;		// Estimate of the sketch
+};
+
+// The k keys with the highest estimated counts in a stream.  Every key goes
+// through a conservative update CityCountMinSketch; a key becomes a candidate
+// when its estimate beats the smallest of the current k, which sit in a
+// min-heap indexed by a CityFlatMap.  Keys below that minimum never touch
+// the heap.  Not thread safe: use one tracker per thread and merge them.
+class LL_SHARED_LIB CityHeavyHitters {
+	private:
+		CityCountMinSketch sketch;
+		std::vector<CityHeavyHitter> heap;		// Min-heap on count
+		CityFlatMap<std::string, ui32> positions;	// Key to index in heap
+		ui32 k;
+
+	private:
+		void siftDown(ui32 i) noexcept;
+		__LL_NODISCARD__ ll_bool_t offer(ll_string_t s, const len_t len, const ui32 count) noexcept;
+
+	public:
+		// Tracks the top k keys with a width x depth sketch
+		CityHeavyHitters(const ui32 k, const ui32 width, const ui32 depth) noexcept;
+
+		// Counts a key.  Returns false if s is null or memory runs out.
+		ll_bool_t add(ll_string_t s, const len_t len, const ui32 count = 1) noexcept;
+		// Counts n keys (counts[i] each, or 1 if counts is null) with the
+		//	sketch's addBatch.  Null keys are skipped and make it return false.
+		ll_bool_t addBatch(const ll_string_t* ptrs, const len_t* lens, const len_t n, const ui32* counts = nullptr) noexcept;
+		// Adds other's sketch and re-ranks both sets of candidates against the
+		//	merged counts.  Returns false if the sketches differ in shape or
+		//	memory runs out.
+		ll_bool_t merge(const CityHeavyHitters& other) noexcept;
+
+		// The tracked keys, highest count first (empty if memory runs out)
+		__LL_NODISCARD__ std::vector<CityHeavyHitter> top() const noexcept;
+		__LL_NODISCARD__ const CityCountMinSketch& getSketch() const noexcept;
+		void clear() noexcept;
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_COUNT_MIN_HPP_
@@ -0,0 +1,98 @@
+//////////////////////////////////////////////
+//	city_cpu.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Runtime detection of the instruction sets used by the optional kernels of
+// llcityhash, and the attributes needed to compile those kernels without
+// raising the baseline of the whole library.  Not part of the public
+// interface.
+
+#ifndef LLCPP_CITY_HASH_CPU_HPP_
+#define LLCPP_CITY_HASH_CPU_HPP_
+
+#include "city.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define LL_CITY_X86_64
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <immintrin.h>
+	#endif // _MSC_VER
+#endif // x86-64
+
+// MSVC accepts any intrinsic without extra flags; gcc and clang need the
+// target enabled per function
+#if defined(LL_CITY_X86_64) && !defined(_MSC_VER)
+	#define LL_CITY_TARGET(isa) __attribute__((target(isa)))
+#else
+	#define LL_CITY_TARGET(isa)
+#endif
+
+#define LL_CITY_TARGET_SSE41 LL_CITY_TARGET("sse4.1")
+#define LL_CITY_TARGET_SSE42 LL_CITY_TARGET("sse4.2")
+#define LL_CITY_TARGET_AVX2 LL_CITY_TARGET("avx2")
+#define LL_CITY_TARGET_AVX512 LL_CITY_TARGET("avx512f,avx512dq,avx512bw")
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+struct CpuFeatures {
+	ll_bool_t sse41;
+	ll_bool_t sse42;
+	ll_bool_t avx2;
+	ll_bool_t avx512;	// F + DQ + BW
+};
+
+__LL_NODISCARD__ __LL_INLINE__ CpuFeatures DetectCpuFeatures() noexcept {
+	CpuFeatures features{};
+#if defined(LL_CITY_X86_64)
+	#if defined(_MSC_VER)
+	int regs[4]{};
+	__cpuid(regs, 0);
+	const int max_leaf = regs[0];
+	__cpuid(regs, 1);
+	features.sse41 = (regs[2] & (1 << 19)) != 0;
+	features.sse42 = (regs[2] & (1 << 20)) != 0;
+	// The OS must save the ymm/zmm registers on context switches
+	const ll_bool_t osxsave = (regs[2] & (1 << 27)) != 0;
+	const ui64 xcr0 = osxsave ? _xgetbv(0) : 0;
+	const ll_bool_t os_avx = (xcr0 & 0x6) == 0x6;
+	const ll_bool_t os_avx512 = (xcr0 & 0xe6) == 0xe6;
+	if (max_leaf >= 7) {
+		__cpuidex(regs, 7, 0);
+		features.avx2 = os_avx && (regs[1] & (1 << 5)) != 0;
+		features.avx512 = os_avx512 &&
+			(regs[1] & (1 << 16)) != 0 &&	// F
+			(regs[1] & (1 << 17)) != 0 &&	// DQ
+			(regs[1] & (1 << 30)) != 0;		// BW
+	}
+	#else
+	__builtin_cpu_init();
+	features.sse41 = __builtin_cpu_supports("sse4.1");
+	features.sse42 = __builtin_cpu_supports("sse4.2");
+	features.avx2 = __builtin_cpu_supports("avx2");
+	features.avx512 =
+		__builtin_cpu_supports("avx512f") &&
+		__builtin_cpu_supports("avx512dq") &&
+		__builtin_cpu_supports("avx512bw");
+	#endif // _MSC_VER
+#endif // LL_CITY_X86_64
+	return features;
+}
+
+// Detected once, on first use
+__LL_NODISCARD__ __LL_INLINE__ const CpuFeatures& GetCpuFeatures() noexcept {
+	static const CpuFeatures features = DetectCpuFeatures();
+	return features;
+}
+
+} // namespace __internal__
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_CPU_HPP_
@@ -0,0 +1,153 @@
+//////////////////////////////////////////////
+//	city_crc.cpp							//
+//											//
+//	Author: Geoff Pike and Jyrki Alakuijala	//
+//	Edited: Francisco Julio Ruiz Fernandez	//
+//	Edited: llanyro							//
+//////////////////////////////////////////////
+
+// CityHashCrc128 and CityHashCrc256.  The long-input core is compiled twice:
+// once on the SSE4.2 crc32 instruction (with a target attribute, so the rest of
+// the library keeps its baseline) and once on a table-driven CRC32C that
+// gives the same values.  The first call picks one using CPUID.
+
+#include "city_internal.hpp"
+#include "city_cpu.hpp"
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+using CityHashCrc256LongFunction = void(*)(ll_string_t s, len_t len, const ui32 seed, ui64* result) noexcept;
+
+#pragma region Software
+namespace software {
+
+// Slicing-by-8 tables of CRC32C (Castagnoli, reflected polynomial 0x82f63b78)
+struct Crc32cTables {
+	ui32 t[8][256];
+};
+
+constexpr Crc32cTables MakeCrc32cTables() noexcept {
+	Crc32cTables tables{};
+	for (ui32 i = 0; i < 256; ++i) {
+		ui32 crc = i;
+		for (i32 bit = 0; bit < 8; ++bit)
+			crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1)));
+		tables.t[0][i] = crc;
+	}
+	for (ui32 i = 0; i < 256; ++i)
+		for (len_t k = 1; k < 8; ++k)
+			tables.t[k][i] = (tables.t[k - 1][i] >> 8) ^ tables.t[0][tables.t[k - 1][i] & 0xff];
+	return tables;
+}
+
+constexpr Crc32cTables CRC32C_TABLES = MakeCrc32cTables();
+
+// Same result as _mm_crc32_u64(crc, v)
+__LL_NODISCARD__ __LL_INLINE__ ui64 Crc32u64(const ui64 crc, const ui64 v) noexcept {
+	const auto& t = CRC32C_TABLES.t;
+	const ui32 lo = static_cast<ui32>(crc) ^ static_cast<ui32>(v);
+	const ui32 hi = static_cast<ui32>(v >> 32);
+	return
+		t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+		t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+}
+
+#define LL_CITY_CRC_TARGET
+#include "city_crc_kernels.inl"
+#undef LL_CITY_CRC_TARGET
+
+} // namespace software
+
+#pragma endregion
+#if defined(LL_CITY_X86_64)
+#pragma region Sse42
+namespace sse42 {
+
+LL_CITY_TARGET_SSE42 __LL_NODISCARD__ __LL_INLINE__ ui64 Crc32u64(const ui64 crc, const ui64 v) noexcept {
+	return _mm_crc32_u64(crc, v);
+}
+
+#define LL_CITY_CRC_TARGET LL_CITY_TARGET_SSE42
+#include "city_crc_kernels.inl"
+#undef LL_CITY_CRC_TARGET
+
+} // namespace sse42
+
+#pragma endregion
+#endif // LL_CITY_X86_64
+
+__LL_NODISCARD__ __LL_INLINE__ CityHashCrc256LongFunction GetCityHashCrc256Long() noexcept {
+#if defined(LL_CITY_X86_64)
+	static const CityHashCrc256LongFunction function = GetCpuFeatures().sse42 ?
+		sse42::CityHashCrc256Long : software::CityHashCrc256Long;
+	return function;
+#else
+	return software::CityHashCrc256Long;
+#endif // LL_CITY_X86_64
+}
+
+// Requires len < 240.
+void CityHashCrc256Short(ll_string_t s, len_t len, ui64* result) noexcept {
+	ll_char_t buf[240];
+	std::memcpy(buf, s, len);
+	std::memset(buf + len, 0, 240 - len);
+	GetCityHashCrc256Long()(buf, 240, ~static_cast<ui32>(len), result);
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+ll_bool_t CityHashCrcIsAccelerated() noexcept {
+#if defined(LL_CITY_X86_64)
+	return GetCpuFeatures().sse42;
+#else
+	return false;
+#endif // LL_CITY_X86_64
+}
+
+ll_bool_t CityHashCrc256(ll_string_t s, len_t len, ui64* result) noexcept {
+	if (!s || !result) return false;
+	if (LIKELY(len >= 240)) GetCityHashCrc256Long()(s, len, 0, result);
+	else CityHashCrc256Short(s, len, result);
+	return true;
+}
+
+hash::OptionalHash128 CityHashCrc128WithSeed(ll_string_t s, len_t len, const hash::Hash128& seed) noexcept {
+	if (!s) return std::nullopt;
+	if (len <= 900) return CityHash128WithSeed(s, len, seed);
+
+	ui64 result[4];
+	GetCityHashCrc256Long()(s, len, 0, result);
+	ui64 u = seed.getHigh() + result[0];
+	ui64 v = seed.getLow() + result[1];
+	return hash::Hash128(
+		HashLen16(u, v + result[2]),
+		HashLen16(Rotate(v, 32), u * k0 + result[3])
+	);
+}
+
+hash::OptionalHash128 CityHashCrc128(ll_string_t s, len_t len) noexcept {
+	if (!s) return std::nullopt;
+	if (len <= 900) return CityHash128(s, len);
+
+	ui64 result[4];
+	GetCityHashCrc256Long()(s, len, 0, result);
+	return hash::Hash128(result[2], result[3]);
+}
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
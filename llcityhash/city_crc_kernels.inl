@@ -0,0 +1,100 @@
+//////////////////////////////////////////////
+//	city_crc_kernels.inl					//
+//											//
+//	Author: Geoff Pike and Jyrki Alakuijala	//
+//	Edited: Francisco Julio Ruiz Fernandez	//
+//	Edited: llanyro							//
+//////////////////////////////////////////////
+
+// Long-input core of CityHashCrc256.  Included by city_crc.cpp once per CRC32C
+// implementation, with Crc32u64(crc, v) computing the CRC32C of the 8 bytes of
+// v (what _mm_crc32_u64 does) and LL_CITY_CRC_TARGET the matching target
+// attribute.
+
+// Requires len >= 240.
+LL_CITY_CRC_TARGET void CityHashCrc256Long(ll_string_t s, len_t len, const ui32 seed, ui64* result) noexcept {
+	ui64 a = Fetch64(s + 56) + k0;
+	ui64 b = Fetch64(s + 96) + k0;
+	ui64 c = result[0] = HashLen16(b, len);
+	ui64 d = result[1] = Fetch64(s + 120) * k0 + len;
+	ui64 e = Fetch64(s + 184) + seed;
+	ui64 f = 0;
+	ui64 g = 0;
+	ui64 h = c + d;
+	ui64 x = seed;
+	ui64 y = 0;
+	ui64 z = 0;
+
+	// 240 bytes of input per iter.
+	len_t iters = len / 240;
+	len -= iters * 240;
+	do {
+#undef CHUNK
+#define CHUNK(r)                            \
+PERMUTE3(x, z, y);                          \
+b += Fetch64(s);                            \
+c += Fetch64(s + 8);                        \
+d += Fetch64(s + 16);                       \
+e += Fetch64(s + 24);                       \
+f += Fetch64(s + 32);                       \
+a += b;                                     \
+h += f;                                     \
+b += c;                                     \
+f += d;                                     \
+g += e;                                     \
+e += z;                                     \
+g += x;                                     \
+z = Crc32u64(z, b + g);                     \
+y = Crc32u64(y, e + h);                     \
+x = Crc32u64(x, f + a);                     \
+e = Rotate(e, r);                           \
+c += e;                                     \
+s += 40
+
+		CHUNK(0); PERMUTE3(a, h, c);
+		CHUNK(33); PERMUTE3(a, h, f);
+		CHUNK(0); PERMUTE3(b, h, f);
+		CHUNK(42); PERMUTE3(b, h, d);
+		CHUNK(0); PERMUTE3(b, h, e);
+		CHUNK(33); PERMUTE3(a, h, e);
+	} while (--iters > 0);
+
+	while (len >= 40) {
+		CHUNK(29);
+		e ^= Rotate(a, 20);
+		h += Rotate(b, 30);
+		g ^= Rotate(c, 40);
+		f += Rotate(d, 34);
+		PERMUTE3(c, h, g);
+		len -= 40;
+	}
+	if (len > 0) {
+		s = s + len - 40;
+		CHUNK(33);
+		e ^= Rotate(a, 43);
+		h += Rotate(b, 42);
+		g ^= Rotate(c, 41);
+		f += Rotate(d, 40);
+	}
+#undef CHUNK
+	result[0] ^= h;
+	result[1] ^= g;
+	g += h;
+	a = HashLen16(a, g + z);
+	x += y << 32;
+	b += x;
+	c = HashLen16(c, z) + h;
+	d = HashLen16(d, e + result[0]);
+	g += e;
+	h += HashLen16(x, f);
+	e = HashLen16(a, d) + g;
+	z = HashLen16(b, c) + a;
+	y = HashLen16(g, h) + c;
+	result[0] = e + z + y + x;
+	a = ShiftMix((a + y) * k0) * k0 + b;
+	result[1] += a + result[0];
+	a = ShiftMix(a * k0) * k0 + c;
+	result[2] = a + result[1];
+	a = ShiftMix((a + e) * k0) * k0;
+	result[3] = a + result[2];
+}
@@ -0,0 +1,404 @@
+//////////////////////////////////////////////
+//	city_fields.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// CityHash64 of composite keys (aggregates, std::pair, std::tuple, arrays)
+// computed field by field.  A key hashes as the CityHash64 of its packed
+// bytes: the little-endian bytes of its fields in order, with no padding,
+// where
+//	- integers, enums, bool and characters give their bytes, pointers those
+//		of their address, and float and double those of their bits (-0.0 as
+//		0.0, so values that compare equal hash equal),
+//	- strings (every kind CityHasher takes) give the 8 bytes of the
+//		CityHash64 of their contents, hash::Hash64 its value and
+//		hash::Hash128 its low then high word,
+//	- aggregates, pairs, tuples, std::array and C arrays give their fields.
+// Padding and the layout the compiler picks (std::tuple stores its
+// elements backwards) do not count: a struct, a pair and a tuple with the
+// same fields hash the same, and the same as CityHash64 of a buffer packed
+// by hand.  The value only depends on the field values and their sizes.
+//
+// The packed size is known at compile time and nothing is copied to a
+// buffer.  Fields are shifted into 64-bit words, adjacent fields sharing a
+// word, and parts with no padding (integers and arrays or aggregates of
+// them) are read in place 8 bytes at a time.  Keys of up to 64 packed bytes
+// are hashed from their words in registers; longer keys read the words back
+// from memory.
+//
+// Aggregates are split with structured bindings: up to 16 fields, no base
+// classes and no C array members (use std::array).  Other classes can list
+// their fields with a member cityFields() returning a tuple, usually
+// std::tie(this->a, this->b).
+
+#ifndef LLCPP_CITY_HASH_FIELDS_HPP_
+#define LLCPP_CITY_HASH_FIELDS_HPP_
+
+#include "city_flat_map.hpp"
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+namespace llcpp {
+namespace city {
+
+#pragma region Fields
+namespace __internal__ {
+enum class FieldKind : ui8 {
+	String,			// 8 bytes: CityHash64 of its contents
+	Hash64,
+	Hash128,
+	Float,
+	Integer,		// Integers, enums, bool, characters and pointers
+	Array,			// C arrays and std::array
+	Tuple,			// std::pair and std::tuple
+	Custom,			// Classes with cityFields()
+	Members,		// Aggregates, through structured bindings
+	Invalid
+};
+
+template<class T>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_STD_ARRAY = false;
+template<class T, len_t N>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_STD_ARRAY<std::array<T, N>> = true;
+
+template<class T>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_TUPLE = false;
+template<class A, class B>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_TUPLE<std::pair<A, B>> = true;
+template<class... A>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_TUPLE<std::tuple<A...>> = true;
+
+template<class T>
+__LL_NODISCARD__ consteval FieldKind GetFieldKind() noexcept {
+	// Char arrays are arrays, not C strings
+	if constexpr (IS_STRING_KEY<T> && !std::is_array_v<T>) return FieldKind::String;
+	else if constexpr (std::is_same_v<T, hash::Hash64>) return FieldKind::Hash64;
+	else if constexpr (std::is_same_v<T, hash::Hash128>) return FieldKind::Hash128;
+	else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) return FieldKind::Float;
+	else if constexpr (header::IS_REGISTER_KEY<T>) return FieldKind::Integer;
+	else if constexpr (std::is_bounded_array_v<T> || IS_STD_ARRAY<T>) return FieldKind::Array;
+	else if constexpr (IS_TUPLE<T>) return FieldKind::Tuple;
+	else if constexpr (requires (const T& v) { v.cityFields(); }) return FieldKind::Custom;
+	else if constexpr (std::is_aggregate_v<T> && std::is_class_v<T>) return FieldKind::Members;
+	else return FieldKind::Invalid;
+}
+template<class T>
+__LL_VAR_INLINE__ constexpr FieldKind FIELD_KIND = GetFieldKind<std::remove_cv_t<T>>();
+
+#pragma region Members
+// Converts to anything: T{ AnyField{}, ... } compiles with as many of them
+//	as T has fields (or fewer)
+struct AnyField {
+	template<class U>
+	constexpr operator U() const noexcept;
+};
+template<len_t>
+using AnyFieldAt = AnyField;
+
+__LL_VAR_INLINE__ constexpr len_t MAX_FIELDS = 16;
+
+template<class T, len_t... I>
+__LL_NODISCARD__ consteval ll_bool_t IsBraceConstructible(std::index_sequence<I...>) noexcept {
+	return requires { T{ AnyFieldAt<I>{}... }; };
+}
+template<class T, len_t N = MAX_FIELDS>
+__LL_NODISCARD__ consteval len_t FieldCount() noexcept {
+	if constexpr (N == MAX_FIELDS) {
+		static_assert(!IsBraceConstructible<T>(std::make_index_sequence<MAX_FIELDS + 1>{}),
+			"aggregates of more than 16 fields need a cityFields() member");
+	}
+	if constexpr (N == 0 || std::is_empty_v<T>) return 0;
+	else if constexpr (IsBraceConstructible<T>(std::make_index_sequence<N>{})) return N;
+	else return FieldCount<T, N - 1>();
+}
+
+// References to the N fields of an aggregate, in order
+template<len_t N, class T>
+__LL_NODISCARD__ constexpr auto TieFields(const T& v) noexcept {
+	if constexpr (N == 0) return std::tuple<>();
+	else if constexpr (N == 1) { const auto& [a] = v; return std::tie(a); }
+	else if constexpr (N == 2) { const auto& [a, b] = v; return std::tie(a, b); }
+	else if constexpr (N == 3) { const auto& [a, b, c] = v; return std::tie(a, b, c); }
+	else if constexpr (N == 4) { const auto& [a, b, c, d] = v; return std::tie(a, b, c, d); }
+	else if constexpr (N == 5) { const auto& [a, b, c, d, e] = v; return std::tie(a, b, c, d, e); }
+	else if constexpr (N == 6) { const auto& [a, b, c, d, e, f] = v; return std::tie(a, b, c, d, e, f); }
+	else if constexpr (N == 7) { const auto& [a, b, c, d, e, f, g] = v; return std::tie(a, b, c, d, e, f, g); }
+	else if constexpr (N == 8) { const auto& [a, b, c, d, e, f, g, h] = v; return std::tie(a, b, c, d, e, f, g, h); }
+	else if constexpr (N == 9) { const auto& [a, b, c, d, e, f, g, h, i] = v; return std::tie(a, b, c, d, e, f, g, h, i); }
+	else if constexpr (N == 10) { const auto& [a, b, c, d, e, f, g, h, i, j] = v; return std::tie(a, b, c, d, e, f, g, h, i, j); }
+	else if constexpr (N == 11) { const auto& [a, b, c, d, e, f, g, h, i, j, k] = v; return std::tie(a, b, c, d, e, f, g, h, i, j, k); }
+	else if constexpr (N == 12) { const auto& [a, b, c, d, e, f, g, h, i, j, k, l] = v; return std::tie(a, b, c, d, e, f, g, h, i, j, k, l); }
+	else if constexpr (N == 13) { const auto& [a, b, c, d, e, f, g, h, i, j, k, l, m] = v; return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m); }
+	else if constexpr (N == 14) { const auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n] = v; return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n); }
+	else if constexpr (N == 15) { const auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n, o] = v; return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o); }
+	else { const auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p] = v; return std::tie(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p); }
+}
+
+// The fields of a Tuple, Custom or Members key, as a tuple (or a reference
+//	to the key itself)
+template<class T>
+__LL_NODISCARD__ constexpr decltype(auto) FieldsOf(const T& v) noexcept {
+	if constexpr (FIELD_KIND<T> == FieldKind::Tuple) return (v);
+	else if constexpr (FIELD_KIND<T> == FieldKind::Custom) return v.cityFields();
+	else return TieFields<FieldCount<T>()>(v);
+}
+template<class T>
+using FieldTuple = std::remove_cvref_t<decltype(FieldsOf(std::declval<const T&>()))>;
+template<class F, len_t I>
+using FieldType = std::remove_cvref_t<std::tuple_element_t<I, F>>;
+
+#pragma endregion
+#pragma region Layout
+template<class T>
+__LL_NODISCARD__ consteval len_t PackedSize() noexcept;
+
+template<class F, len_t... I>
+__LL_NODISCARD__ consteval std::array<len_t, sizeof...(I) + 1> PackedOffsets(std::index_sequence<I...>) noexcept {
+	const len_t sizes[] = { PackedSize<FieldType<F, I>>()..., 0 };
+	std::array<len_t, sizeof...(I) + 1> offsets{};
+	for (len_t i = 0; i < sizeof...(I); ++i) offsets[i + 1] = offsets[i] + sizes[i];
+	return offsets;
+}
+// Packed offset of every field of a tuple of fields, and the total size last
+template<class F>
+__LL_VAR_INLINE__ constexpr auto PACKED_OFFSETS = PackedOffsets<F>(std::make_index_sequence<std::tuple_size_v<F>>{});
+
+template<class T>
+using ArrayElement = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<const T&>()[0])>>;
+template<class T>
+__LL_VAR_INLINE__ constexpr len_t ARRAY_SIZE = std::is_bounded_array_v<T> ? std::extent_v<T> : std::tuple_size_v<T>;
+
+template<class T>
+__LL_NODISCARD__ consteval len_t PackedSize() noexcept {
+	constexpr FieldKind KIND = FIELD_KIND<T>;
+	static_assert(KIND != FieldKind::Invalid,
+		"CityHash64Fields hashes integers, float, double, strings, hashes, arrays, pairs, tuples, aggregates and classes with cityFields()");
+	if constexpr (KIND == FieldKind::String || KIND == FieldKind::Hash64) return 8;
+	else if constexpr (KIND == FieldKind::Hash128) return 16;
+	else if constexpr (KIND == FieldKind::Float || KIND == FieldKind::Integer) return sizeof(T);
+	else if constexpr (KIND == FieldKind::Array) {
+		if constexpr (std::is_bounded_array_v<T>) return std::extent_v<T> * PackedSize<std::remove_cv_t<std::remove_extent_t<T>>>();
+		else return std::tuple_size_v<T> * PackedSize<typename T::value_type>();
+	}
+	else if constexpr (KIND == FieldKind::Invalid) return 0;
+	else return PACKED_OFFSETS<FieldTuple<T>>.back();
+}
+
+template<class F, len_t... I>
+__LL_NODISCARD__ consteval ll_bool_t AllInPlace(std::index_sequence<I...>) noexcept;
+
+// True if the bytes of T in memory are its packed bytes: integers, and
+//	arrays and aggregates of them with no padding, on little-endian hosts
+template<class T>
+__LL_NODISCARD__ consteval ll_bool_t IsInPlace() noexcept {
+	constexpr FieldKind KIND = FIELD_KIND<T>;
+	if constexpr (std::endian::native != std::endian::little) return false;
+	else if constexpr (KIND == FieldKind::Integer) return true;
+	else if constexpr (KIND == FieldKind::Array) {
+		if constexpr (std::is_bounded_array_v<T>) return IsInPlace<std::remove_cv_t<std::remove_extent_t<T>>>();
+		else return sizeof(T) == PackedSize<T>() && IsInPlace<typename T::value_type>();
+	}
+	// Members of an aggregate are laid out in order: with no padding they
+	//	are back to back
+	else if constexpr (KIND == FieldKind::Members) {
+		using F = FieldTuple<T>;
+		return sizeof(T) == PackedSize<T>() && AllInPlace<F>(std::make_index_sequence<std::tuple_size_v<F>>{});
+	}
+	else return false;
+}
+template<class F, len_t... I>
+__LL_NODISCARD__ consteval ll_bool_t AllInPlace(std::index_sequence<I...>) noexcept {
+	return (true && ... && IsInPlace<FieldType<F, I>>());
+}
+template<class T>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_IN_PLACE = IsInPlace<T>();
+
+#pragma endregion
+#pragma region Pack
+// Packed bytes of a key of N bytes, as little-endian 64-bit words
+template<len_t N>
+struct FieldWords {
+	ui64 words[N == 0 ? 1 : (N + 7) / 8] = {};
+
+	// Stores the low SIZE (at most 8) bytes of v at packed offset OFF;
+	//	the other bytes of v are 0
+	template<len_t OFF, len_t SIZE>
+	__LL_INLINE__ void put(const ui64 v) noexcept {
+		constexpr len_t SHIFT = (OFF % 8) * 8;
+		if constexpr (SHIFT == 0) this->words[OFF / 8] |= v;
+		else {
+			this->words[OFF / 8] |= v << SHIFT;
+			if constexpr (OFF % 8 + SIZE > 8) this->words[OFF / 8 + 1] |= v >> (64 - SHIFT);
+		}
+	}
+};
+
+template<len_t OFF, len_t N, class T>
+__LL_INLINE__ void PackField(FieldWords<N>& w, const T& v) noexcept;
+
+template<len_t OFF, len_t N, class F, len_t... I>
+__LL_INLINE__ void PackFields(FieldWords<N>& w, const F& fields, std::index_sequence<I...>) noexcept {
+	(PackField<OFF + PACKED_OFFSETS<F>[I]>(w, std::get<I>(fields)), ...);
+}
+template<len_t OFF, len_t N, class T, len_t... I>
+__LL_INLINE__ void PackElements(FieldWords<N>& w, const T& v, std::index_sequence<I...>) noexcept {
+	constexpr len_t SIZE = PackedSize<ArrayElement<T>>();
+	(PackField<OFF + I * SIZE>(w, v[I]), ...);
+}
+
+template<len_t OFF, len_t N, class T>
+__LL_INLINE__ void PackField(FieldWords<N>& w, const T& v) noexcept {
+	constexpr FieldKind KIND = FIELD_KIND<T>;
+	if constexpr (KIND == FieldKind::String) {
+		if constexpr (std::is_same_v<T, CityHashedString>) w.template put<OFF, 8>(v.hash());
+		else if constexpr (std::is_pointer_v<T>) {
+			const std::string_view str = v ? std::string_view(v) : std::string_view();
+			w.template put<OFF, 8>(CityHash64Unchecked(str.data(), str.size()));
+		}
+		else {
+			const std::string_view str = ToStringView(v);
+			w.template put<OFF, 8>(CityHash64Unchecked(str.data(), str.size()));
+		}
+	}
+	else if constexpr (KIND == FieldKind::Hash64) w.template put<OFF, 8>(v.get());
+	else if constexpr (KIND == FieldKind::Hash128) {
+		w.template put<OFF, 8>(v.getLow());
+		w.template put<OFF + 8, 8>(v.getHigh());
+	}
+	else if constexpr (KIND == FieldKind::Float) {
+		const T value = v == T(0) ? T(0) : v;
+		if constexpr (sizeof(T) == 4) w.template put<OFF, 4>(std::bit_cast<ui32>(value));
+		else w.template put<OFF, 8>(std::bit_cast<ui64>(value));
+	}
+	else if constexpr (KIND == FieldKind::Integer) {
+		if constexpr (std::is_enum_v<T>) PackField<OFF>(w, static_cast<std::underlying_type_t<T>>(v));
+		else if constexpr (std::is_pointer_v<T>) PackField<OFF>(w, reinterpret_cast<std::uintptr_t>(v));
+		else if constexpr (sizeof(T) == 1) w.template put<OFF, 1>(static_cast<ui8>(v));
+		else if constexpr (sizeof(T) == 2) w.template put<OFF, 2>(static_cast<ui16>(v));
+		else if constexpr (sizeof(T) == 4) w.template put<OFF, 4>(static_cast<ui32>(v));
+		else if constexpr (sizeof(T) == 8) w.template put<OFF, 8>(static_cast<ui64>(v));
+#if defined(__SIZEOF_INT128__)
+		else {
+			const unsigned __int128 value = static_cast<unsigned __int128>(v);
+			w.template put<OFF, 8>(static_cast<ui64>(value));
+			w.template put<OFF + 8, 8>(static_cast<ui64>(value >> 64));
+		}
+#endif // __SIZEOF_INT128__
+	}
+	else if constexpr (IS_IN_PLACE<T> && sizeof(T) >= 8) {
+		// Padding-free part: whole 8-byte blocks, then the tail
+		ll_string_t p = reinterpret_cast<ll_string_t>(&v);
+		[&]<len_t... I>(std::index_sequence<I...>) {
+			(w.template put<OFF + I * 8, 8>(header::Fetch64(p + I * 8)), ...);
+		}(std::make_index_sequence<sizeof(T) / 8>{});
+		if constexpr (sizeof(T) % 8 != 0) {
+			ui64 tail = 0;
+			std::memcpy(&tail, p + sizeof(T) / 8 * 8, sizeof(T) % 8);
+			w.template put<OFF + sizeof(T) / 8 * 8, sizeof(T) % 8>(tail);
+		}
+	}
+	else if constexpr (IS_IN_PLACE<T>) {
+		ui64 value = 0;
+		std::memcpy(&value, &v, sizeof(T));
+		w.template put<OFF, sizeof(T)>(value);
+	}
+	else if constexpr (KIND == FieldKind::Array)
+		PackElements<OFF>(w, v, std::make_index_sequence<ARRAY_SIZE<T>>{});
+	else {
+		const auto& fields = FieldsOf(v);
+		using F = FieldTuple<T>;
+		PackFields<OFF>(w, fields, std::make_index_sequence<std::tuple_size_v<F>>{});
+	}
+}
+
+// HashLen0to16 of N packed bytes held in two little-endian words
+template<len_t N>
+__LL_NODISCARD__ __LL_INLINE__ ui64 HashPacked16(const ui64 low, const ui64 high) noexcept {
+	if constexpr (N == 0) return header::k2;
+	else if constexpr (N < 4) {
+		const ui32 a = static_cast<ui8>(low);
+		const ui32 b = static_cast<ui8>(low >> (8 * (N >> 1)));
+		const ui32 c = static_cast<ui8>(low >> (8 * (N - 1)));
+		const ui32 y = a + (b << 8);
+		const ui32 z = static_cast<ui32>(N) + (c << 2);
+		return header::ShiftMix(y * header::k2 ^ z * header::k0) * header::k2;
+	}
+	else if constexpr (N < 8) {
+		const ui64 a = static_cast<ui32>(low);
+		const ui64 b = static_cast<ui32>(low >> (8 * (N - 4)));
+		return header::HashLen16(N + (a << 3), b, header::k2 + N * 2);
+	}
+	else {
+		// Last 8 bytes
+		ui64 last = high;
+		if constexpr (N == 8) last = low;
+		else if constexpr (N < 16) last = (low >> (8 * (N - 8))) | (high << (64 - 8 * (N - 8)));
+		return header::HashKeyWords(low, last, header::k2 + N * 2);
+	}
+}
+
+template<class T>
+__LL_NODISCARD__ __LL_INLINE__ ui64 HashFields(const T& v) noexcept {
+	constexpr len_t N = PackedSize<T>();
+	if constexpr (IS_IN_PLACE<T>) return CityHash64Fixed<N>(&v);
+	else {
+		FieldWords<N> w;
+		PackField<0>(w, v);
+		if constexpr (N <= 8) return HashPacked16<N>(w.words[0], 0);
+		else if constexpr (N <= 16) return HashPacked16<N>(w.words[0], w.words[1]);
+		else if constexpr (N <= 64) {
+			// The 8 bytes at a constant offset, from one or two words
+			const auto fetch = [&w](const len_t offset) noexcept {
+				const ui64 low = w.words[offset / 8];
+				return offset % 8 == 0 ? low :
+					(low >> (8 * (offset % 8))) | (w.words[offset / 8 + 1] << (64 - 8 * (offset % 8)));
+			};
+			if constexpr (N <= 32) return header::HashWords17to32(fetch, N);
+			else return header::HashWords33to64(fetch, N);
+		}
+		else {
+			if constexpr (std::endian::native == std::endian::big)
+				for (ui64& word : w.words) word = header::Bswap64(word);
+			return CityHash64Fixed<N>(w.words);
+		}
+	}
+}
+
+#pragma endregion
+} // namespace __internal__
+
+// Bytes a key of type T hashes: the size of its packed fields
+template<class T>
+__LL_VAR_INLINE__ constexpr len_t CITYHASH_FIELDS_SIZE = __internal__::PackedSize<std::remove_cv_t<T>>();
+
+// CityHash64 of the packed fields of a key (see above): equal fields give
+//	equal hashes whatever the padding or layout of the key
+template<class T>
+__LL_NODISCARD__ __LL_INLINE__ ui64 CityHash64Fields(const T& key) noexcept {
+	return __internal__::HashFields<std::remove_cv_t<T>>(key);
+}
+// Same as CityHash64WithSeed of the packed fields
+template<class T>
+__LL_NODISCARD__ __LL_INLINE__ ui64 CityHash64FieldsWithSeed(const T& key, const ui64 seed) noexcept {
+	return __internal__::header::HashLen16(city::CityHash64Fields(key) - __internal__::header::k2, seed);
+}
+
+// Hasher for CityFlatMap and CityFlatSet with composite keys:
+//	CityFlatSet<std::tuple<ui32, std::string>, CityFieldsHasher>
+struct CityFieldsHasher {
+	template<class T>
+	__LL_NODISCARD__ ui64 operator()(const T& key) const noexcept {
+		return city::CityHash64Fields(key);
+	}
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_FIELDS_HPP_
@@ -0,0 +1,497 @@
+//////////////////////////////////////////////
+//	city_flat_map.hpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Open-addressing hash map and set hashed with CityHash.  Keys and values
+// live in one flat array of slots, next to an array of one control byte per
+// slot: empty, deleted, or the low 7 bits of the hash of the key stored
+// there.  Lookups compare 16 control bytes at once (one SSE2 compare) and
+// only touch the slots whose 7 bits match, so a lookup is usually one
+// control group and one slot, with no node allocations or pointer chasing.
+
+#ifndef LLCPP_CITY_HASH_FLAT_MAP_HPP_
+#define LLCPP_CITY_HASH_FLAT_MAP_HPP_
+
+#include "city.hpp"
+
+#include <bit>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define LL_CITY_FLAT_SSE2
+#endif // SSE2
+
+namespace llcpp {
+namespace city {
+
+#pragma region Hasher
+namespace __internal__ {
+template<class T>
+__LL_VAR_INLINE__ constexpr ll_bool_t IS_STRING_KEY =
+	std::is_same_v<std::decay_t<T>, std::string> || std::is_same_v<std::decay_t<T>, std::string_view> ||
+	std::is_same_v<std::decay_t<T>, meta::StrPair> || std::is_same_v<std::decay_t<T>, meta::Str> ||
+	std::is_same_v<std::decay_t<T>, ll_string_t> || std::is_same_v<std::decay_t<T>, ll_char_t*> ||
+	std::is_same_v<std::decay_t<T>, CityHashedString>;
+
+template<class T>
+__LL_NODISCARD__ __LL_INLINE__ std::string_view ToStringView(const T& key) noexcept {
+	if constexpr (std::is_same_v<T, meta::StrPair> || std::is_same_v<T, meta::Str>)
+		return std::string_view(key.begin(), key.len());
+	else if constexpr (std::is_same_v<T, CityHashedString>) return key.view();
+	// A null C string is the empty string
+	else if constexpr (std::is_same_v<T, ll_string_t> || std::is_same_v<T, ll_char_t*>)
+		return key ? std::string_view(key) : std::string_view();
+	else return std::string_view(key);
+}
+
+} // namespace __internal__
+
+// Hash of CityFlatMap and CityFlatSet, with the values of
+// CITYHASH_FUNCTION_PACK.  Every kind of string (std::string, string_view,
+// meta::StrPair, meta::Str, C strings and CityHashedString, which brings its
+// hash) hashes its bytes, so any of them can look up keys stored as another.
+// Integers, enums and pointers go through CityHash64Key, hash::Hash64
+// through the recursive function of the pack, and other trivially copyable
+// keys hash their bytes.
+struct CityHasher {
+	using is_transparent = void;
+
+	template<class T>
+	__LL_NODISCARD__ ui64 operator()(const T& key) const noexcept {
+		using U = std::decay_t<T>;
+		if constexpr (std::is_same_v<U, CityHashedString>) return key.hash();
+		else if constexpr (__internal__::IS_STRING_KEY<U>) {
+			const std::string_view str = __internal__::ToStringView(key);
+			return CityHash64Unchecked(str.data(), str.size());
+		}
+		else if constexpr (__internal__::header::IS_REGISTER_KEY<U>) return CityHash64Key(key);
+		else if constexpr (std::is_same_v<U, hash::Hash64>) return city::CityHash64(key)->get();
+		else if constexpr (std::is_same_v<U, hash::Hash128>) return CityHash64Key(key);
+		else {
+			static_assert(std::is_trivially_copyable_v<U>, "CityHasher hashes strings, integers, hashes and trivially copyable keys");
+			return CityHash64Unchecked(reinterpret_cast<ll_string_t>(&key), sizeof(U));
+		}
+	}
+};
+
+// Equality of CityFlatMap and CityFlatSet: strings of every kind compare
+// their bytes, anything else uses operator==.
+struct CityKeyEqual {
+	using is_transparent = void;
+
+	template<class A, class B>
+	__LL_NODISCARD__ ll_bool_t operator()(const A& a, const B& b) const noexcept {
+		if constexpr (std::is_same_v<A, CityHashedString> && std::is_same_v<B, CityHashedString>) return a == b;
+		else if constexpr (__internal__::IS_STRING_KEY<A> && __internal__::IS_STRING_KEY<B>)
+			return __internal__::ToStringView(a) == __internal__::ToStringView(b);
+		else return a == b;
+	}
+};
+
+#pragma endregion
+#pragma region Table
+namespace __internal__ {
+// Control bytes: full slots hold the low 7 bits of their hash (0 to 127)
+using FlatCtrl = i8;
+__LL_VAR_INLINE__ constexpr FlatCtrl FLAT_EMPTY = -128;
+__LL_VAR_INLINE__ constexpr FlatCtrl FLAT_DELETED = -2;
+__LL_VAR_INLINE__ constexpr len_t FLAT_GROUP_WIDTH = 16;
+
+// Control bytes of a table with no slots: every lookup misses at once
+alignas(16) __LL_VAR_INLINE__ constexpr FlatCtrl FLAT_EMPTY_GROUP[FLAT_GROUP_WIDTH] = {
+	FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY,
+	FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY, FLAT_EMPTY
+};
+
+// 16 control bytes; every match returns one bit per byte, bit i for byte i
+class FlatGroup {
+	private:
+#if defined(LL_CITY_FLAT_SSE2)
+		__m128i ctrl;
+#else
+		FlatCtrl ctrl[FLAT_GROUP_WIDTH];
+#endif // LL_CITY_FLAT_SSE2
+
+	public:
+		explicit FlatGroup(const FlatCtrl* p) noexcept {
+#if defined(LL_CITY_FLAT_SSE2)
+			this->ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+#else
+			std::memcpy(this->ctrl, p, FLAT_GROUP_WIDTH);
+#endif // LL_CITY_FLAT_SSE2
+		}
+
+		__LL_NODISCARD__ ui32 match(const FlatCtrl h2) const noexcept {
+#if defined(LL_CITY_FLAT_SSE2)
+			return static_cast<ui32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->ctrl)));
+#else
+			ui32 mask = 0;
+			for (len_t i = 0; i < FLAT_GROUP_WIDTH; ++i)
+				mask |= static_cast<ui32>(this->ctrl[i] == h2) << i;
+			return mask;
+#endif // LL_CITY_FLAT_SSE2
+		}
+		__LL_NODISCARD__ ui32 matchEmpty() const noexcept { return this->match(FLAT_EMPTY); }
+		// Empty and deleted bytes are the negative ones
+		__LL_NODISCARD__ ui32 matchEmptyOrDeleted() const noexcept {
+#if defined(LL_CITY_FLAT_SSE2)
+			return static_cast<ui32>(_mm_movemask_epi8(this->ctrl));
+#else
+			ui32 mask = 0;
+			for (len_t i = 0; i < FLAT_GROUP_WIDTH; ++i)
+				mask |= static_cast<ui32>(this->ctrl[i] < 0) << i;
+			return mask;
+#endif // LL_CITY_FLAT_SSE2
+		}
+		__LL_NODISCARD__ ui32 matchFull() const noexcept {
+			return ~this->matchEmptyOrDeleted() & 0xffff;
+		}
+};
+
+struct FlatNoValue {};
+
+// Storage and probing shared by CityFlatMap and CityFlatSet.
+//	- capacity is 0 or a power of two >= 16, and at most 7/8 of the slots are
+//		used (full or deleted), so every probe ends at an empty byte,
+//	- ctrl has capacity + 15 bytes: the last 15 repeat the first 15, so a
+//		group can be read at any position without wrapping,
+//	- a key goes to the first free slot of the probe sequence that starts at
+//		hash >> 7 and moves 16, 32, 48, ... slots further on each step (it
+//		visits every group of a power of two table).
+template<class Key, class Value, class Hasher, class Equal>
+class FlatTable {
+	public:
+		struct Slot {
+			Key key;
+			[[no_unique_address]] Value value;
+
+			template<class K, class... Args>
+			Slot(K&& key, Args&&... args)
+				: key(FlatTable::makeKey(std::forward<K>(key)))
+				, value(std::forward<Args>(args)...)
+			{}
+		};
+
+	protected:
+		FlatCtrl* ctrl;
+		Slot* slots;
+		len_t capacity_;
+		len_t count;
+		len_t growth_left;	// Empty slots that can still be filled before a rehash
+		[[no_unique_address]] Hasher hasher;
+		[[no_unique_address]] Equal equal;
+
+	protected:
+		__LL_NODISCARD__ static constexpr len_t MaxLoad(const len_t capacity) noexcept {
+			return capacity - capacity / 8;
+		}
+		__LL_NODISCARD__ static constexpr ui64 H1(const ui64 h) noexcept { return h >> 7; }
+		__LL_NODISCARD__ static constexpr FlatCtrl H2(const ui64 h) noexcept { return static_cast<FlatCtrl>(h & 0x7f); }
+
+		// Strings of every kind build a string key; other keys are converted
+		template<class K>
+		__LL_NODISCARD__ static Key makeKey(K&& key) {
+			// Through ToStringView, so a null C string becomes an empty key
+			if constexpr ((std::is_same_v<std::decay_t<K>, ll_string_t> || std::is_same_v<std::decay_t<K>, ll_char_t*>) &&
+				std::is_constructible_v<Key, std::string_view>)
+				return Key(__internal__::ToStringView(key));
+			else if constexpr (std::is_constructible_v<Key, K&&>) return Key(std::forward<K>(key));
+			else return Key(__internal__::ToStringView(key));
+		}
+		// Lookups hash strings as they come; other keys as a Key, so 5 and
+		//	5ull find the same ui64
+		template<class K>
+		__LL_NODISCARD__ static decltype(auto) lookupKey(const K& key) {
+			if constexpr (std::is_same_v<std::decay_t<K>, Key> || (IS_STRING_KEY<Key> && IS_STRING_KEY<K>)) return (key);
+			else return Key(key);
+		}
+
+		__LL_NODISCARD__ len_t mask() const noexcept {
+			return this->capacity_ ? this->capacity_ - 1 : 0;
+		}
+		void setCtrl(const len_t i, const FlatCtrl c) noexcept {
+			this->ctrl[i] = c;
+			if (i < FLAT_GROUP_WIDTH - 1) this->ctrl[this->capacity_ + i] = c;
+		}
+
+		template<class K>
+		__LL_NODISCARD__ Slot* findSlot(const K& key, const ui64 h) const noexcept {
+			const len_t mask = this->mask();
+			len_t pos = static_cast<len_t>(H1(h)) & mask;
+			for (len_t step = FLAT_GROUP_WIDTH;; step += FLAT_GROUP_WIDTH) {
+				const FlatGroup group(this->ctrl + pos);
+				for (ui32 m = group.match(H2(h)); m; m &= m - 1) {
+					const len_t i = (pos + static_cast<len_t>(std::countr_zero(m))) & mask;
+					if (this->equal(this->slots[i].key, key)) return this->slots + i;
+				}
+				if (group.matchEmpty()) return nullptr;
+				pos = (pos + step) & mask;
+			}
+		}
+		// First empty or deleted slot of the probe sequence of h
+		__LL_NODISCARD__ len_t findFree(const ui64 h) const noexcept {
+			const len_t mask = this->mask();
+			len_t pos = static_cast<len_t>(H1(h)) & mask;
+			for (len_t step = FLAT_GROUP_WIDTH;; step += FLAT_GROUP_WIDTH) {
+				const ui32 m = FlatGroup(this->ctrl + pos).matchEmptyOrDeleted();
+				if (m) return (pos + static_cast<len_t>(std::countr_zero(m))) & mask;
+				pos = (pos + step) & mask;
+			}
+		}
+
+		// Moves every key to tables of "capacity" slots.  Returns false (and
+		//	changes nothing) if they cannot be allocated.
+		__LL_NODISCARD__ ll_bool_t rehash(const len_t capacity) noexcept {
+			FlatCtrl* new_ctrl = new (std::nothrow) FlatCtrl[capacity + FLAT_GROUP_WIDTH - 1];
+			if (!new_ctrl) return false;
+			Slot* new_slots = static_cast<Slot*>(::operator new(sizeof(Slot) * capacity, std::align_val_t(alignof(Slot)), std::nothrow));
+			if (!new_slots) {
+				delete[] new_ctrl;
+				return false;
+			}
+			std::memset(new_ctrl, FLAT_EMPTY, capacity + FLAT_GROUP_WIDTH - 1);
+
+			FlatCtrl* old_ctrl = this->ctrl;
+			Slot* old_slots = this->slots;
+			const len_t old_capacity = this->capacity_;
+			this->ctrl = new_ctrl;
+			this->slots = new_slots;
+			this->capacity_ = capacity;
+			this->growth_left = MaxLoad(capacity) - this->count;
+			for (len_t i = 0; i < old_capacity; ++i) {
+				if (old_ctrl[i] < 0) continue;
+				const ui64 h = this->hasher(old_slots[i].key);
+				const len_t j = this->findFree(h);
+				new (this->slots + j) Slot(std::move(old_slots[i]));
+				old_slots[i].~Slot();
+				this->setCtrl(j, H2(h));
+			}
+			this->release(old_ctrl, old_slots, old_capacity);
+			return true;
+		}
+		void release(FlatCtrl* ctrl, Slot* slots, const len_t capacity) noexcept {
+			if (!capacity) return;
+			delete[] ctrl;
+			::operator delete(slots, std::align_val_t(alignof(Slot)));
+		}
+		void destroySlots() noexcept {
+			if constexpr (!std::is_trivially_destructible_v<Slot>)
+				this->forEachSlot([](Slot& slot) { slot.~Slot(); });
+		}
+
+		// Inserts a slot built from key and args unless key is present.
+		//	Returns the slot of the key and whether it was inserted, or
+		//	(nullptr, false) if the table could not grow.
+		template<class K, class... Args>
+		std::pair<Slot*, ll_bool_t> emplaceSlot(K&& key, Args&&... args) {
+			decltype(auto) lookup = lookupKey(key);
+			const ui64 h = this->hasher(lookup);
+			if (Slot* found = this->findSlot(lookup, h)) return { found, false };
+			len_t i = this->findFree(h);
+			if (this->growth_left == 0 && this->ctrl[i] != FLAT_DELETED) {
+				// Mostly deleted slots: rehash at the same capacity
+				const len_t capacity = this->capacity_ && this->count < MaxLoad(this->capacity_) / 2 ?
+					this->capacity_ : (this->capacity_ ? 2 * this->capacity_ : FLAT_GROUP_WIDTH);
+				if (!this->rehash(capacity)) return { nullptr, false };
+				i = this->findFree(h);
+			}
+			new (this->slots + i) Slot(std::forward<K>(key), std::forward<Args>(args)...);
+			this->growth_left -= this->ctrl[i] == FLAT_EMPTY;
+			this->setCtrl(i, H2(h));
+			++this->count;
+			return { this->slots + i, true };
+		}
+
+		// Calls body(slot) for every full slot
+		template<class Body>
+		void forEachSlot(Body&& body) const {
+			for (len_t base = 0; base < this->capacity_; base += FLAT_GROUP_WIDTH)
+				for (ui32 m = FlatGroup(this->ctrl + base).matchFull(); m; m &= m - 1)
+					body(this->slots[base + static_cast<len_t>(std::countr_zero(m))]);
+		}
+
+	public:
+		FlatTable() noexcept
+			: ctrl(const_cast<FlatCtrl*>(FLAT_EMPTY_GROUP))
+			, slots(nullptr)
+			, capacity_(0)
+			, count(0)
+			, growth_left(0)
+			, hasher()
+			, equal()
+		{}
+		// Room for "size" keys without rehashing (if it can be allocated)
+		explicit FlatTable(const len_t size) noexcept : FlatTable() {
+			(void)this->reserve(size);
+		}
+		FlatTable(const FlatTable& other) : FlatTable() {
+			(void)this->reserve(other.count);
+			other.forEachSlot([&](const Slot& slot) { (void)this->emplaceSlot(slot.key, slot.value); });
+		}
+		FlatTable(FlatTable&& other) noexcept : FlatTable() {
+			this->swap(other);
+		}
+		FlatTable& operator=(FlatTable other) noexcept {
+			this->swap(other);
+			return *this;
+		}
+		~FlatTable() noexcept {
+			this->destroySlots();
+			this->release(this->ctrl, this->slots, this->capacity_);
+		}
+
+		void swap(FlatTable& other) noexcept {
+			std::swap(this->ctrl, other.ctrl);
+			std::swap(this->slots, other.slots);
+			std::swap(this->capacity_, other.capacity_);
+			std::swap(this->count, other.count);
+			std::swap(this->growth_left, other.growth_left);
+			std::swap(this->hasher, other.hasher);
+			std::swap(this->equal, other.equal);
+		}
+
+		__LL_NODISCARD__ len_t size() const noexcept { return this->count; }
+		__LL_NODISCARD__ ll_bool_t empty() const noexcept { return this->count == 0; }
+		__LL_NODISCARD__ len_t capacity() const noexcept { return this->capacity_; }
+
+		// Makes room for "size" keys.  Returns false if it cannot be allocated.
+		__LL_NODISCARD__ ll_bool_t reserve(const len_t size) noexcept {
+			if (size <= this->count + this->growth_left) return true;
+			len_t capacity = FLAT_GROUP_WIDTH;
+			while (MaxLoad(capacity) < size) capacity *= 2;
+			// A smaller capacity has room once its deleted slots are dropped
+			return this->rehash(capacity > this->capacity_ ? capacity : this->capacity_);
+		}
+		// Removes every key and keeps the capacity
+		void clear() noexcept {
+			if (!this->capacity_) return;
+			this->destroySlots();
+			std::memset(this->ctrl, FLAT_EMPTY, this->capacity_ + FLAT_GROUP_WIDTH - 1);
+			this->count = 0;
+			this->growth_left = MaxLoad(this->capacity_);
+		}
+
+		template<class K>
+		__LL_NODISCARD__ ll_bool_t contains(const K& key) const noexcept {
+			decltype(auto) lookup = lookupKey(key);
+			return this->findSlot(lookup, this->hasher(lookup)) != nullptr;
+		}
+
+		// Returns false if key was not present
+		template<class K>
+		ll_bool_t erase(const K& key) noexcept {
+			decltype(auto) lookup = lookupKey(key);
+			Slot* slot = this->findSlot(lookup, this->hasher(lookup));
+			if (!slot) return false;
+			const len_t i = static_cast<len_t>(slot - this->slots);
+			slot->~Slot();
+			--this->count;
+			// If the slot never was inside 16 consecutive used slots, no probe
+			//	went past it and it can be empty again; otherwise a probe
+			//	for another key may have to go on past it
+			const len_t before = (i - FLAT_GROUP_WIDTH) & this->mask();
+			const ui32 empty_after = FlatGroup(this->ctrl + i).matchEmpty();
+			const ui32 empty_before = FlatGroup(this->ctrl + before).matchEmpty();
+			if (empty_before && empty_after &&
+				std::countr_zero(empty_after) + std::countl_zero(static_cast<ui16>(empty_before)) < static_cast<i32>(FLAT_GROUP_WIDTH)) {
+				this->setCtrl(i, FLAT_EMPTY);
+				++this->growth_left;
+			}
+			else this->setCtrl(i, FLAT_DELETED);
+			return true;
+		}
+};
+
+} // namespace __internal__
+
+#pragma endregion
+#pragma region Containers
+// Hash map from Key to Value stored in place (see the top of this file).
+// Keys can be looked up, inserted and erased with any type CityHasher and
+// CityKeyEqual accept for them, e.g. a std::string_view or a meta::StrPair
+// for std::string keys.  Any insertion (or reserve) may rehash the table and
+// move every slot: to grow it, or at the same capacity to clear out erased
+// slots.  Pointers to values stay valid only until then, or until their key
+// is erased.
+template<class Key, class Value, class Hasher = CityHasher, class Equal = CityKeyEqual>
+class CityFlatMap : public __internal__::FlatTable<Key, Value, Hasher, Equal> {
+	private:
+		using Table = __internal__::FlatTable<Key, Value, Hasher, Equal>;
+
+	public:
+		using Table::Table;
+
+		// Inserts key with Value(args...) unless key is present.  Returns the
+		//	value of key and whether it was inserted, or (nullptr, false) if
+		//	the table could not grow.
+		template<class K, class... Args>
+		std::pair<Value*, ll_bool_t> emplace(K&& key, Args&&... args) {
+			const auto [slot, inserted] = this->emplaceSlot(std::forward<K>(key), std::forward<Args>(args)...);
+			return { slot ? &slot->value : nullptr, inserted };
+		}
+		// Value of key, or nullptr if key is not present
+		template<class K>
+		__LL_NODISCARD__ Value* find(const K& key) noexcept {
+			decltype(auto) lookup = Table::lookupKey(key);
+			typename Table::Slot* slot = this->findSlot(lookup, this->hasher(lookup));
+			return slot ? &slot->value : nullptr;
+		}
+		template<class K>
+		__LL_NODISCARD__ const Value* find(const K& key) const noexcept {
+			return const_cast<CityFlatMap*>(this)->find(key);
+		}
+		// Calls body(key, value) for every key, in no particular order
+		template<class Body>
+		void forEach(Body&& body) {
+			this->forEachSlot([&](typename Table::Slot& slot) { body(const_cast<const Key&>(slot.key), slot.value); });
+		}
+		template<class Body>
+		void forEach(Body&& body) const {
+			this->forEachSlot([&](const typename Table::Slot& slot) { body(slot.key, slot.value); });
+		}
+};
+
+// Hash set of Key stored in place, with the same lookups as CityFlatMap.
+template<class Key, class Hasher = CityHasher, class Equal = CityKeyEqual>
+class CityFlatSet : public __internal__::FlatTable<Key, __internal__::FlatNoValue, Hasher, Equal> {
+	private:
+		using Table = __internal__::FlatTable<Key, __internal__::FlatNoValue, Hasher, Equal>;
+
+	public:
+		using Table::Table;
+
+		// Inserts key unless it is present.  Returns the stored key and
+		//	whether it was inserted, or (nullptr, false) if the table could
+		//	not grow.
+		template<class K>
+		std::pair<const Key*, ll_bool_t> insert(K&& key) {
+			const auto [slot, inserted] = this->emplaceSlot(std::forward<K>(key));
+			return { slot ? &slot->key : nullptr, inserted };
+		}
+		// Stored key equal to key, or nullptr if key is not present
+		template<class K>
+		__LL_NODISCARD__ const Key* find(const K& key) const noexcept {
+			decltype(auto) lookup = Table::lookupKey(key);
+			const typename Table::Slot* slot = this->findSlot(lookup, this->hasher(lookup));
+			return slot ? &slot->key : nullptr;
+		}
+		// Calls body(key) for every key, in no particular order
+		template<class Body>
+		void forEach(Body&& body) const {
+			this->forEachSlot([&](const typename Table::Slot& slot) { body(slot.key); });
+		}
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_FLAT_MAP_HPP_
@@ -0,0 +1,460 @@
+//////////////////////////////////////////////
+//	city_hll.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_hll.hpp"
+#include "city_cpu.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+constexpr ui32 HLL_RANK_BITS = 6;
+constexpr ui32 HLL_RANK_MASK = (1u << HLL_RANK_BITS) - 1;
+constexpr len_t HLL_BATCH = 256;
+constexpr len_t HLL_HEADER_SIZE = 16;
+constexpr ui8 HLL_MAGIC[4] = { 'C', 'H', 'L', 'L' };
+constexpr ui8 HLL_FLAG_SEEDED = 1;
+constexpr ui8 HLL_FLAG_SPARSE = 2;
+
+// Register of a hash and the rank stored there: 1 + the leading zeros of
+//	the bits after the index, which stop at the index's own width
+__LL_NODISCARD__ __LL_INLINE__ ui32 HllIndex(const ui64 hash, const ui32 p) noexcept {
+	return static_cast<ui32>(hash >> (64 - p));
+}
+__LL_NODISCARD__ __LL_INLINE__ ui8 HllRank(const ui64 hash, const ui32 p) noexcept {
+	return static_cast<ui8>(std::countl_zero((hash << p) | (ui64(1) << (p - 1))) + 1);
+}
+__LL_NODISCARD__ __LL_INLINE__ ui32 HllSparseEntry(const ui64 hash) noexcept {
+	return (HllIndex(hash, CITYHASH_HLL_SPARSE_PRECISION) << HLL_RANK_BITS) | HllRank(hash, CITYHASH_HLL_SPARSE_PRECISION);
+}
+// Dense register and rank of a sparse entry: the same values the hash would
+//	have given, as the sparse index holds the first bits after the dense one
+__LL_INLINE__ void HllFromSparse(const ui32 entry, const ui32 p, ui32& index, ui8& rank) noexcept {
+	const ui32 sparse_index = entry >> HLL_RANK_BITS;
+	const ui32 extra = CITYHASH_HLL_SPARSE_PRECISION - p;
+	const ui32 low = sparse_index & ((1u << extra) - 1);
+	index = sparse_index >> extra;
+	rank = low != 0
+		? static_cast<ui8>(std::countl_zero(low) - (32 - extra) + 1)
+		: static_cast<ui8>(extra + (entry & HLL_RANK_MASK));
+}
+
+__LL_NODISCARD__ __LL_INLINE__ ui64 HllHash(ll_string_t s, const len_t len, const ll_bool_t seeded, const ui64 seed) noexcept {
+	return seeded ? city::CityHash64WithSeedUnchecked(s, len, seed) : city::CityHash64Unchecked(s, len);
+}
+
+#pragma region Estimate
+// sigma and tau of Ertl's paper, iterated until they stop changing
+__LL_NODISCARD__ f64 HllSigma(f64 x) noexcept {
+	if (x == 1.0) return std::numeric_limits<f64>::infinity();
+	f64 y = 1.0;
+	f64 z = x;
+	for (;;) {
+		x *= x;
+		const f64 previous = z;
+		z += x * y;
+		y += y;
+		if (z == previous) return z;
+	}
+}
+__LL_NODISCARD__ f64 HllTau(f64 x) noexcept {
+	if (x == 0.0 || x == 1.0) return 0.0;
+	f64 y = 1.0;
+	f64 z = 1.0 - x;
+	for (;;) {
+		x = std::sqrt(x);
+		const f64 previous = z;
+		y *= 0.5;
+		z -= (1.0 - x) * (1.0 - x) * y;
+		if (z == previous) return z / 3.0;
+	}
+}
+// Improved raw estimator from the histogram of 2^p registers holding
+//	ranks 0 to q + 1
+__LL_NODISCARD__ f64 HllEstimate(const ui64* histogram, const ui32 p) noexcept {
+	const ui32 q = 64 - p;
+	const f64 m = static_cast<f64>(ui64(1) << p);
+	f64 z = m * HllTau(1.0 - static_cast<f64>(histogram[q + 1]) / m);
+	for (ui32 k = q; k >= 1; --k) z = 0.5 * (z + static_cast<f64>(histogram[k]));
+	z += m * HllSigma(static_cast<f64>(histogram[0]) / m);
+	constexpr f64 ALPHA_INF = 0.7213475204444817;	// 1 / (2 ln 2)
+	return ALPHA_INF * m * m / z;
+}
+
+#pragma endregion
+#pragma region Merge
+__LL_INLINE__ void MergeRegistersScalar(ui8* dst, const ui8* src, const len_t begin, const len_t m) noexcept {
+	for (len_t i = begin; i < m; ++i) dst[i] = dst[i] < src[i] ? src[i] : dst[i];
+}
+
+#if defined(LL_CITY_X86_64)
+LL_CITY_TARGET_AVX2 void MergeRegistersAvx2(ui8* dst, const ui8* src, const len_t m) noexcept {
+	len_t i = 0;
+	for (; i + 32 <= m; i += 32) {
+		const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+		const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_max_epu8(a, b));
+	}
+	MergeRegistersScalar(dst, src, i, m);
+}
+// SSE2 is part of x86-64
+void MergeRegistersSse2(ui8* dst, const ui8* src, const len_t m) noexcept {
+	len_t i = 0;
+	for (; i + 16 <= m; i += 16) {
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_max_epu8(a, b));
+	}
+	MergeRegistersScalar(dst, src, i, m);
+}
+#endif // LL_CITY_X86_64
+
+void MergeRegisters(ui8* dst, const ui8* src, const len_t m) noexcept {
+#if defined(LL_CITY_X86_64)
+	if (GetCpuFeatures().avx2) MergeRegistersAvx2(dst, src, m);
+	else MergeRegistersSse2(dst, src, m);
+#else
+	MergeRegistersScalar(dst, src, 0, m);
+#endif // LL_CITY_X86_64
+}
+
+#pragma endregion
+#pragma region Serialization
+__LL_NODISCARD__ __LL_INLINE__ len_t VarintSize(ui32 value) noexcept {
+	len_t size = 1;
+	for (; value >= 0x80; value >>= 7) ++size;
+	return size;
+}
+__LL_INLINE__ ui8* PutVarint(ui8* out, ui32 value) noexcept {
+	for (; value >= 0x80; value >>= 7) *out++ = static_cast<ui8>(value | 0x80);
+	*out++ = static_cast<ui8>(value);
+	return out;
+}
+// Returns nullptr if the varint does not end before "end" or overflows
+__LL_NODISCARD__ __LL_INLINE__ const ui8* GetVarint(const ui8* in, const ui8* end, ui32& value) noexcept {
+	value = 0;
+	for (ui32 shift = 0; in < end && shift < 35; shift += 7) {
+		const ui8 byte = *in++;
+		value |= static_cast<ui32>(byte & 0x7f) << shift;
+		if (!(byte & 0x80)) return in;
+	}
+	return nullptr;
+}
+
+#pragma endregion
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+CityHyperLogLog::CityHyperLogLog(const ui32 precision, const std::optional<ui64> seed) noexcept
+	: sparse()
+	, pending()
+	, registers()
+	, seed(seed.value_or(0))
+	, precision(std::clamp(precision, CITYHASH_HLL_MIN_PRECISION, CITYHASH_HLL_MAX_PRECISION))
+	, seeded(seed.has_value())
+{}
+CityHyperLogLog::CityHyperLogLog(const CityHyperLogLog& other) noexcept
+	: CityHyperLogLog(other.precision, other.getSeed())
+{
+	*this = other;
+}
+CityHyperLogLog& CityHyperLogLog::operator=(const CityHyperLogLog& other) noexcept {
+	if (this == &other) return *this;
+	this->clear();
+	this->precision = other.precision;
+	this->seed = other.seed;
+	this->seeded = other.seeded;
+	// merge() only fails here if memory runs out, which leaves it empty
+	if (!this->merge(other)) this->clear();
+	return *this;
+}
+
+ll_bool_t CityHyperLogLog::mergedSparse(std::vector<ui32>& out) const noexcept {
+	try {
+		out.clear();
+		out.reserve(this->sparse.size() + this->pending.size());
+		out.insert(out.end(), this->sparse.begin(), this->sparse.end());
+		out.insert(out.end(), this->pending.begin(), this->pending.end());
+		const auto middle = out.begin() + static_cast<std::ptrdiff_t>(this->sparse.size());
+		std::sort(middle, out.end());
+		std::inplace_merge(out.begin(), middle, out.end());
+	}
+	catch (...) {
+		return false;
+	}
+	// Entries sort by index, then rank: keep the last one of every index
+	len_t kept = 0;
+	for (const ui32 entry : out) {
+		if (kept > 0 && (out[kept - 1] >> HLL_RANK_BITS) == (entry >> HLL_RANK_BITS)) out[kept - 1] = entry;
+		else out[kept++] = entry;
+	}
+	out.resize(kept);
+	return true;
+}
+ll_bool_t CityHyperLogLog::flush() noexcept {
+	std::vector<ui32> merged;
+	if (!this->mergedSparse(merged)) return false;
+	this->sparse.swap(merged);
+	this->pending.clear();
+	// Past m / 4 entries the sparse list is bigger than the registers
+	const len_t m = len_t(1) << this->precision;
+	return this->sparse.size() * sizeof(ui32) <= m || this->toDense();
+}
+ll_bool_t CityHyperLogLog::toDense() noexcept {
+	const len_t m = len_t(1) << this->precision;
+	std::unique_ptr<ui8[]> dense(new (std::nothrow) ui8[m]());
+	if (!dense) return false;
+	for (const std::vector<ui32>* list : { &this->sparse, &this->pending }) {
+		for (const ui32 entry : *list) {
+			ui32 index;
+			ui8 rank;
+			HllFromSparse(entry, this->precision, index, rank);
+			if (dense[index] < rank) dense[index] = rank;
+		}
+	}
+	this->registers = std::move(dense);
+	std::vector<ui32>().swap(this->sparse);
+	std::vector<ui32>().swap(this->pending);
+	return true;
+}
+ll_bool_t CityHyperLogLog::addSparse(const ui64 hash) noexcept {
+	try {
+		this->pending.push_back(HllSparseEntry(hash));
+	}
+	catch (...) {
+		return this->toDense() && this->addHash(hash);
+	}
+	// Sorting a small buffer now and then keeps adds cheap
+	const len_t limit = (len_t(1) << this->precision) / 16;
+	return this->pending.size() < (limit < 16 ? 16 : limit) || this->flush();
+}
+
+ll_bool_t CityHyperLogLog::add(ll_string_t s, const len_t len) noexcept {
+	if (!s) return false;
+	return this->addHash(HllHash(s, len, this->seeded, this->seed));
+}
+ll_bool_t CityHyperLogLog::addHash(const ui64 hash) noexcept {
+	if (!this->registers) return this->addSparse(hash);
+	ui8& reg = this->registers[HllIndex(hash, this->precision)];
+	const ui8 rank = HllRank(hash, this->precision);
+	if (reg < rank) reg = rank;
+	return true;
+}
+ll_bool_t CityHyperLogLog::addHashes(const ui64* hashes, const len_t n) noexcept {
+	if (!hashes) return false;
+	len_t i = 0;
+	for (; i < n && !this->registers; ++i)
+		if (!this->addSparse(hashes[i])) return false;
+	// Dense: no branch on the register, so consecutive updates overlap
+	const ui32 p = this->precision;
+	ui8* registers = this->registers.get();
+	for (; i < n; ++i) {
+		ui8& reg = registers[HllIndex(hashes[i], p)];
+		reg = std::max(reg, HllRank(hashes[i], p));
+	}
+	return true;
+}
+ll_bool_t CityHyperLogLog::addBatch(const ll_string_t* ptrs, const len_t* lens, const len_t n) noexcept {
+	if (!ptrs || !lens) return false;
+	ll_bool_t ok = true;
+	ui64 hashes[HLL_BATCH];
+	for (len_t base = 0; base < n; base += HLL_BATCH) {
+		len_t block = n - base < HLL_BATCH ? n - base : HLL_BATCH;
+		// Null keys hash to 0 and fail the batch: leave them out
+		if (!city::CityHash64Batch(ptrs + base, lens + base, hashes, block)) {
+			ok = false;
+			len_t kept = 0;
+			for (len_t i = 0; i < block; ++i)
+				if (ptrs[base + i]) hashes[kept++] = hashes[i];
+			block = kept;
+		}
+		// CityHash64WithSeed is CityHash64 mixed with the seed
+		if (this->seeded)
+			for (len_t i = 0; i < block; ++i) hashes[i] = header::HashLen16(hashes[i] - header::k2, this->seed);
+		if (!this->addHashes(hashes, block)) return false;
+	}
+	return ok;
+}
+
+ll_bool_t CityHyperLogLog::merge(const CityHyperLogLog& other) noexcept {
+	if (other.precision != this->precision || other.seeded != this->seeded || other.seed != this->seed) return false;
+	if (this == &other) return true;
+	const len_t m = len_t(1) << this->precision;
+	if (other.registers) {
+		if (!this->registers && !this->toDense()) return false;
+		MergeRegisters(this->registers.get(), other.registers.get(), m);
+		return true;
+	}
+	if (this->registers) {
+		for (const std::vector<ui32>* list : { &other.sparse, &other.pending }) {
+			for (const ui32 entry : *list) {
+				ui32 index;
+				ui8 rank;
+				HllFromSparse(entry, this->precision, index, rank);
+				if (this->registers[index] < rank) this->registers[index] = rank;
+			}
+		}
+		return true;
+	}
+	try {
+		this->pending.insert(this->pending.end(), other.sparse.begin(), other.sparse.end());
+		this->pending.insert(this->pending.end(), other.pending.begin(), other.pending.end());
+	}
+	catch (...) {
+		return false;
+	}
+	return this->flush();
+}
+
+f64 CityHyperLogLog::estimate() const noexcept {
+	ui64 histogram[65] = {};
+	if (this->registers) {
+		const len_t m = len_t(1) << this->precision;
+		for (len_t i = 0; i < m; ++i) ++histogram[this->registers[i]];
+		return HllEstimate(histogram, this->precision);
+	}
+	// A sparse sketch is a dense one with 2^25 registers, almost all empty
+	std::vector<ui32> entries;
+	if (!this->mergedSparse(entries)) return 0.0;
+	histogram[0] = (ui64(1) << CITYHASH_HLL_SPARSE_PRECISION) - entries.size();
+	for (const ui32 entry : entries) ++histogram[entry & HLL_RANK_MASK];
+	return HllEstimate(histogram, CITYHASH_HLL_SPARSE_PRECISION);
+}
+void CityHyperLogLog::clear() noexcept {
+	std::vector<ui32>().swap(this->sparse);
+	std::vector<ui32>().swap(this->pending);
+	this->registers.reset();
+}
+ll_bool_t CityHyperLogLog::isSparse() const noexcept { return !this->registers; }
+ui32 CityHyperLogLog::getPrecision() const noexcept { return this->precision; }
+std::optional<ui64> CityHyperLogLog::getSeed() const noexcept {
+	return this->seeded ? std::optional<ui64>(this->seed) : std::nullopt;
+}
+len_t CityHyperLogLog::bytes() const noexcept {
+	if (this->registers) return len_t(1) << this->precision;
+	return (this->sparse.capacity() + this->pending.capacity()) * sizeof(ui32);
+}
+
+len_t CityHyperLogLog::serializedSize() const noexcept {
+	if (this->registers) return HLL_HEADER_SIZE + (len_t(1) << this->precision) * 6 / 8;
+	std::vector<ui32> entries;
+	if (!this->mergedSparse(entries)) return 0;
+	len_t size = HLL_HEADER_SIZE + VarintSize(static_cast<ui32>(entries.size()));
+	ui32 previous = 0;
+	for (const ui32 entry : entries) {
+		size += VarintSize(entry - previous);
+		previous = entry;
+	}
+	return size;
+}
+ll_bool_t CityHyperLogLog::serialize(void* out, const len_t size) const noexcept {
+	const len_t needed = this->serializedSize();
+	if (!out || needed == 0 || size < needed) return false;
+	ui8* p = static_cast<ui8*>(out);
+	for (len_t i = 0; i < 4; ++i) *p++ = HLL_MAGIC[i];
+	*p++ = CITYHASH_HLL_VERSION;
+	*p++ = static_cast<ui8>(this->precision);
+	*p++ = static_cast<ui8>((this->seeded ? HLL_FLAG_SEEDED : 0) | (this->registers ? 0 : HLL_FLAG_SPARSE));
+	*p++ = 0;
+	for (len_t i = 0; i < 8; ++i) *p++ = static_cast<ui8>(this->seed >> (8 * i));
+
+	if (this->registers) {
+		// 6 bits per register, 4 registers in 3 bytes
+		const len_t m = len_t(1) << this->precision;
+		for (len_t i = 0; i < m; i += 4) {
+			const ui32 packed = this->registers[i] | (this->registers[i + 1] << 6) |
+				(this->registers[i + 2] << 12) | (this->registers[i + 3] << 18);
+			*p++ = static_cast<ui8>(packed);
+			*p++ = static_cast<ui8>(packed >> 8);
+			*p++ = static_cast<ui8>(packed >> 16);
+		}
+		return true;
+	}
+	std::vector<ui32> entries;
+	if (!this->mergedSparse(entries)) return false;
+	p = PutVarint(p, static_cast<ui32>(entries.size()));
+	ui32 previous = 0;
+	for (const ui32 entry : entries) {
+		p = PutVarint(p, entry - previous);
+		previous = entry;
+	}
+	return true;
+}
+std::optional<CityHyperLogLog> CityHyperLogLog::deserialize(const void* data, const len_t size) noexcept {
+	if (!data || size < HLL_HEADER_SIZE) return std::nullopt;
+	const ui8* p = static_cast<const ui8*>(data);
+	const ui8* end = p + size;
+	if (p[0] != HLL_MAGIC[0] || p[1] != HLL_MAGIC[1] || p[2] != HLL_MAGIC[2] || p[3] != HLL_MAGIC[3] ||
+		p[4] != CITYHASH_HLL_VERSION || p[5] < CITYHASH_HLL_MIN_PRECISION || p[5] > CITYHASH_HLL_MAX_PRECISION ||
+		(p[6] & ~(HLL_FLAG_SEEDED | HLL_FLAG_SPARSE)) != 0)
+		return std::nullopt;
+	const ui8 flags = p[6];
+	ui64 seed = 0;
+	for (len_t i = 0; i < 8; ++i) seed |= static_cast<ui64>(p[8 + i]) << (8 * i);
+	CityHyperLogLog sketch(p[5], (flags & HLL_FLAG_SEEDED) ? std::optional<ui64>(seed) : std::nullopt);
+	const len_t m = len_t(1) << sketch.precision;
+	p += HLL_HEADER_SIZE;
+
+	if (!(flags & HLL_FLAG_SPARSE)) {
+		if (static_cast<len_t>(end - p) < m * 6 / 8 || !sketch.toDense()) return std::nullopt;
+		for (len_t i = 0; i < m; i += 4, p += 3) {
+			const ui32 packed = p[0] | (p[1] << 8) | (p[2] << 16);
+			for (len_t r = 0; r < 4; ++r) {
+				const ui8 rank = static_cast<ui8>((packed >> (6 * r)) & HLL_RANK_MASK);
+				if (rank > 65 - sketch.precision) return std::nullopt;
+				sketch.registers[i + r] = rank;
+			}
+		}
+		return sketch;
+	}
+	ui32 count = 0;
+	if (!(p = GetVarint(p, end, count))) return std::nullopt;
+	// Every entry takes at least one byte
+	if (count > static_cast<len_t>(end - p)) return std::nullopt;
+	try {
+		sketch.sparse.reserve(count);
+	}
+	catch (...) {
+		return std::nullopt;
+	}
+	ui32 entry = 0;
+	for (ui32 i = 0; i < count; ++i) {
+		ui32 delta = 0;
+		if (!(p = GetVarint(p, end, delta))) return std::nullopt;
+		// Strictly increasing indexes, ranks the hash can produce
+		const ui32 next = entry + delta;
+		if (next < entry || (i > 0 && (next >> HLL_RANK_BITS) <= (entry >> HLL_RANK_BITS)) ||
+			(next >> HLL_RANK_BITS) >= (1u << CITYHASH_HLL_SPARSE_PRECISION) ||
+			(next & HLL_RANK_MASK) == 0 || (next & HLL_RANK_MASK) > 64 - CITYHASH_HLL_SPARSE_PRECISION + 1)
+			return std::nullopt;
+		entry = next;
+		sketch.sparse.push_back(entry);
+	}
+	if (sketch.sparse.size() * sizeof(ui32) > m && !sketch.toDense()) return std::nullopt;
+	return sketch;
+}
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
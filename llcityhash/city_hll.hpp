@@ -0,0 +1,105 @@
+//////////////////////////////////////////////
+//	city_hll.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// HyperLogLog++ cardinality sketch over 64-bit CityHash64 values.  Small
+// sketches are sparse: a sorted list of (25-bit index, rank) entries that
+// counts exactly up to a few thousand keys and only takes the memory it
+// needs.  Once the list would outgrow them it is turned into the 2^precision
+// dense registers, one byte each.  Estimates use Ertl's improved estimator
+// ("New cardinality estimation algorithms for HyperLogLog sketches", 2017),
+// which is as accurate as the bias tables of HyperLogLog++ at every
+// cardinality without storing them.
+
+#ifndef LLCPP_CITY_HASH_HLL_HPP_
+#define LLCPP_CITY_HASH_HLL_HPP_
+
+#include "city.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace llcpp {
+namespace city {
+
+#pragma region HyperLogLog
+constexpr ui32 CITYHASH_HLL_MIN_PRECISION = 4;
+constexpr ui32 CITYHASH_HLL_MAX_PRECISION = 18;
+constexpr ui32 CITYHASH_HLL_DEFAULT_PRECISION = 14;	// 16 KiB dense, ~0.81% standard error
+// Index bits of the sparse entries
+constexpr ui32 CITYHASH_HLL_SPARSE_PRECISION = 25;
+constexpr ui8 CITYHASH_HLL_VERSION = 1;
+
+class LL_SHARED_LIB CityHyperLogLog {
+	private:
+		std::vector<ui32> sparse;		// Sorted, one entry per index: index << 6 | rank
+		std::vector<ui32> pending;		// Unsorted entries not yet merged into sparse
+		std::unique_ptr<ui8[]> registers;	// Dense registers, null while sparse
+		ui64 seed;
+		ui32 precision;
+		ll_bool_t seeded;
+
+	private:
+		__LL_NODISCARD__ ll_bool_t flush() noexcept;
+		__LL_NODISCARD__ ll_bool_t toDense() noexcept;
+		__LL_NODISCARD__ ll_bool_t addSparse(const ui64 hash) noexcept;
+		__LL_NODISCARD__ ll_bool_t mergedSparse(std::vector<ui32>& out) const noexcept;
+
+	public:
+		// "precision" is clamped to [CITYHASH_HLL_MIN_PRECISION,
+		//	CITYHASH_HLL_MAX_PRECISION].  With a seed keys are hashed with
+		//	CityHash64WithSeed, otherwise with CityHash64; only sketches with the
+		//	same precision and seed can be merged.
+		explicit CityHyperLogLog(const ui32 precision = CITYHASH_HLL_DEFAULT_PRECISION, const std::optional<ui64> seed = std::nullopt) noexcept;
+		CityHyperLogLog(const CityHyperLogLog& other) noexcept;
+		CityHyperLogLog& operator=(const CityHyperLogLog& other) noexcept;
+		CityHyperLogLog(CityHyperLogLog&&) noexcept = default;
+		CityHyperLogLog& operator=(CityHyperLogLog&&) noexcept = default;
+		~CityHyperLogLog() noexcept = default;
+
+		// Counts a key.  Returns false if s is null or memory runs out.
+		ll_bool_t add(ll_string_t s, const len_t len) noexcept;
+		// Counts a key given by its hash (CityHash64 or CityHash64WithSeed, to
+		//	match the sketch's seed)
+		ll_bool_t addHash(const ui64 hash) noexcept;
+		ll_bool_t addHashes(const ui64* hashes, const len_t n) noexcept;
+		// Counts n keys: they are hashed in blocks with CityHash64Batch and the
+		//	registers of a block are updated in one pass.  Null keys are skipped
+		//	and make it return false.
+		ll_bool_t addBatch(const ll_string_t* ptrs, const len_t* lens, const len_t n) noexcept;
+
+		// Adds the keys counted by other (for example a per-thread sketch).
+		//	Dense registers are merged with a byte-wise max, 32 at a time with
+		//	AVX2.  Returns false if precisions or seeds differ, or memory runs out.
+		ll_bool_t merge(const CityHyperLogLog& other) noexcept;
+
+		// Estimated number of distinct keys counted
+		__LL_NODISCARD__ f64 estimate() const noexcept;
+		void clear() noexcept;
+		__LL_NODISCARD__ ll_bool_t isSparse() const noexcept;
+		__LL_NODISCARD__ ui32 getPrecision() const noexcept;
+		__LL_NODISCARD__ std::optional<ui64> getSeed() const noexcept;
+		// Bytes of memory held by the sketch
+		__LL_NODISCARD__ len_t bytes() const noexcept;
+
+		// Serialized form: a 16-byte header (magic "CHLL", version, precision,
+		//	flags, seed), then either the sparse entries as varint deltas or the
+		//	dense registers packed in 6 bits each.  Byte order independent.
+		//	Returns 0 if memory runs out.
+		__LL_NODISCARD__ len_t serializedSize() const noexcept;
+		// Returns false if out is null or smaller than serializedSize()
+		ll_bool_t serialize(void* out, const len_t size) const noexcept;
+		// Returns nullopt if data is not a valid serialized sketch
+		__LL_NODISCARD__ static std::optional<CityHyperLogLog> deserialize(const void* data, const len_t size) noexcept;
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_HLL_HPP_
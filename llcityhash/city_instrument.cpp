@@ -0,0 +1,280 @@
+//////////////////////////////////////////////
+//	city_instrument.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_instrument.hpp"
+#include "city_internal.hpp"
+
+#if defined(LL_CITY_INSTRUMENT)
+	#include <atomic>
+	#include <mutex>
+	#include <new>
+	#include <vector>
+#endif // LL_CITY_INSTRUMENT
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+#if defined(LL_CITY_INSTRUMENT)
+#pragma region Threads
+constexpr len_t INSTRUMENT_FIELDS = 3;	// calls, bytes, cycles
+
+// Counters of one thread.  Only that thread writes them (a relaxed load and
+//	store, no locked instruction) and snapshots read them from any thread.
+struct alignas(64) InstrumentBlock {
+	std::atomic<ui64> apis[CITY_INSTRUMENT_API_COUNT][INSTRUMENT_FIELDS];
+	std::atomic<ui64> buckets[CITY_INSTRUMENT_BUCKET_COUNT][INSTRUMENT_FIELDS];
+};
+
+// Plain sums of blocks
+struct InstrumentTotals {
+	ui64 apis[CITY_INSTRUMENT_API_COUNT][INSTRUMENT_FIELDS];
+	ui64 buckets[CITY_INSTRUMENT_BUCKET_COUNT][INSTRUMENT_FIELDS];
+};
+
+void AddBlock(InstrumentTotals& totals, const InstrumentBlock& block) noexcept {
+	for (len_t i = 0; i < CITY_INSTRUMENT_API_COUNT; ++i)
+		for (len_t f = 0; f < INSTRUMENT_FIELDS; ++f)
+			totals.apis[i][f] += block.apis[i][f].load(std::memory_order_relaxed);
+	for (len_t i = 0; i < CITY_INSTRUMENT_BUCKET_COUNT; ++i)
+		for (len_t f = 0; f < INSTRUMENT_FIELDS; ++f)
+			totals.buckets[i][f] += block.buckets[i][f].load(std::memory_order_relaxed);
+}
+
+// Blocks of the running threads, and what the threads that exited counted.
+//	A reset keeps the counts, and snapshots subtract the ones of the reset.
+struct InstrumentRegistry {
+	std::mutex mutex;
+	std::vector<InstrumentBlock*> blocks;
+	InstrumentTotals exited;
+	InstrumentTotals reset;
+	len_t threads;
+
+	// Every count since the program started; mutex held
+	__LL_NODISCARD__ InstrumentTotals sum() const noexcept {
+		InstrumentTotals totals = this->exited;
+		for (const InstrumentBlock* block : this->blocks) AddBlock(totals, *block);
+		return totals;
+	}
+};
+
+// Never destroyed: threads may exit after static destructors ran
+InstrumentRegistry& GetInstrumentRegistry() noexcept {
+	static InstrumentRegistry* registry = new InstrumentRegistry();
+	return *registry;
+}
+
+// Shared by the threads whose block could not be allocated; they may lose
+//	counts, as they write it concurrently
+InstrumentBlock FALLBACK_BLOCK{};
+
+// Registers the block of this thread on its first call and folds its
+//	counts into the registry when it exits
+class InstrumentThread {
+	private:
+		InstrumentBlock* block;
+
+	public:
+		InstrumentThread() noexcept
+			: block(new (std::nothrow) InstrumentBlock())
+		{
+			InstrumentRegistry& registry = GetInstrumentRegistry();
+			const std::lock_guard<std::mutex> lock(registry.mutex);
+			++registry.threads;
+			if (!this->block) return;
+			try {
+				registry.blocks.push_back(this->block);
+			}
+			catch (...) {
+				delete this->block;
+				this->block = nullptr;
+			}
+		}
+		InstrumentThread(const InstrumentThread&) = delete;
+		InstrumentThread& operator=(const InstrumentThread&) = delete;
+		~InstrumentThread() noexcept {
+			if (!this->block) return;
+			InstrumentRegistry& registry = GetInstrumentRegistry();
+			{
+				const std::lock_guard<std::mutex> lock(registry.mutex);
+				AddBlock(registry.exited, *this->block);
+				std::erase(registry.blocks, this->block);
+			}
+			delete this->block;
+		}
+
+		__LL_NODISCARD__ InstrumentBlock& get() noexcept {
+			return this->block ? *this->block : FALLBACK_BLOCK;
+		}
+};
+
+__LL_INLINE__ void Add(std::atomic<ui64>& counter, const ui64 value) noexcept {
+	counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+#pragma endregion
+
+void InstrumentRecord(const CityInstrumentApi api, const CityInstrumentBucket bucket, const len_t bytes, const ui64 cycles) noexcept {
+	thread_local InstrumentThread thread;
+	InstrumentBlock& block = thread.get();
+	std::atomic<ui64>* const api_counters = block.apis[static_cast<len_t>(api)];
+	std::atomic<ui64>* const bucket_counters = block.buckets[static_cast<len_t>(bucket)];
+	Add(api_counters[0], 1);
+	Add(api_counters[1], bytes);
+	Add(bucket_counters[0], 1);
+	Add(bucket_counters[1], bytes);
+#if defined(LL_CITY_INSTRUMENT_CYCLES)
+	Add(api_counters[2], cycles);
+	Add(bucket_counters[2], cycles);
+#else
+	(void)cycles;
+#endif // LL_CITY_INSTRUMENT_CYCLES
+}
+
+#endif // LL_CITY_INSTRUMENT
+
+constexpr ll_string_t INSTRUMENT_API_NAMES[CITY_INSTRUMENT_API_COUNT] = {
+	"CityHash32", "CityHash64", "CityHash128", "WideString"
+};
+constexpr ll_string_t INSTRUMENT_BUCKET_NAMES[CITY_INSTRUMENT_BUCKET_COUNT] = {
+	"Hash32Len0to4", "Hash32Len5to12", "Hash32Len13to24", "Hash32Loop",
+	"HashLen0to16", "HashLen17to32", "HashLen33to64", "Hash64Loop",
+	"CityMurmur", "Hash128Loop", "None"
+};
+
+// Appends "  name  calls  bytes  [cycles]  avg len  [cycles/byte]" or its JSON
+//	object for one counter
+void FormatCounter(std::string& out, ll_string_t name, const CityInstrumentCounter& counter, const ll_bool_t cycles, const CityInstrumentFormat format) {
+	char line[256];
+	const f64 calls = static_cast<f64>(counter.calls);
+	const f64 bytes = static_cast<f64>(counter.bytes);
+	if (format == CityInstrumentFormat::Json) {
+		std::snprintf(line, sizeof(line), "\"%s\":{\"calls\":%llu,\"bytes\":%llu,\"cycles\":%llu}", name,
+			static_cast<unsigned long long>(counter.calls), static_cast<unsigned long long>(counter.bytes),
+			static_cast<unsigned long long>(counter.cycles));
+	}
+	else if (cycles) {
+		std::snprintf(line, sizeof(line), "  %-16s %14llu %16llu %8.1f %12.1f %8.3f\n", name,
+			static_cast<unsigned long long>(counter.calls), static_cast<unsigned long long>(counter.bytes),
+			counter.calls ? bytes / calls : 0.0,
+			counter.calls ? static_cast<f64>(counter.cycles) / calls : 0.0,
+			counter.bytes ? static_cast<f64>(counter.cycles) / bytes : 0.0);
+	}
+	else {
+		std::snprintf(line, sizeof(line), "  %-16s %14llu %16llu %8.1f\n", name,
+			static_cast<unsigned long long>(counter.calls), static_cast<unsigned long long>(counter.bytes),
+			counter.calls ? bytes / calls : 0.0);
+	}
+	out += line;
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+CityInstrumentSnapshot CityInstrumentGetSnapshot() noexcept {
+	CityInstrumentSnapshot snapshot{};
+#if defined(LL_CITY_INSTRUMENT)
+	snapshot.enabled = true;
+	#if defined(LL_CITY_INSTRUMENT_CYCLES) && defined(LL_CITY_X86_64)
+	snapshot.cycles = true;
+	#endif // LL_CITY_INSTRUMENT_CYCLES
+	InstrumentRegistry& registry = GetInstrumentRegistry();
+	const std::lock_guard<std::mutex> lock(registry.mutex);
+	const InstrumentTotals totals = registry.sum();
+	const auto fill = [](CityInstrumentCounter& counter, const ui64* now, const ui64* reset) noexcept {
+		counter.calls = now[0] - reset[0];
+		counter.bytes = now[1] - reset[1];
+		counter.cycles = now[2] - reset[2];
+	};
+	for (len_t i = 0; i < CITY_INSTRUMENT_API_COUNT; ++i) fill(snapshot.apis[i], totals.apis[i], registry.reset.apis[i]);
+	for (len_t i = 0; i < CITY_INSTRUMENT_BUCKET_COUNT; ++i) fill(snapshot.buckets[i], totals.buckets[i], registry.reset.buckets[i]);
+	snapshot.threads = registry.threads;
+#endif // LL_CITY_INSTRUMENT
+	return snapshot;
+}
+
+void CityInstrumentReset() noexcept {
+#if defined(LL_CITY_INSTRUMENT)
+	InstrumentRegistry& registry = GetInstrumentRegistry();
+	const std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.reset = registry.sum();
+#endif // LL_CITY_INSTRUMENT
+}
+
+ll_string_t CityInstrumentApiName(const CityInstrumentApi api) noexcept {
+	const len_t i = static_cast<len_t>(api);
+	return i < CITY_INSTRUMENT_API_COUNT ? INSTRUMENT_API_NAMES[i] : "";
+}
+ll_string_t CityInstrumentBucketName(const CityInstrumentBucket bucket) noexcept {
+	const len_t i = static_cast<len_t>(bucket);
+	return i < CITY_INSTRUMENT_BUCKET_COUNT ? INSTRUMENT_BUCKET_NAMES[i] : "";
+}
+
+ll_bool_t CityInstrumentFormatSnapshot(const CityInstrumentSnapshot& snapshot, const CityInstrumentFormat format, std::string& out) noexcept {
+	try {
+		if (format == CityInstrumentFormat::Json) {
+			out += snapshot.enabled ? "{\"enabled\":true" : "{\"enabled\":false";
+			out += snapshot.cycles ? ",\"cycles\":true" : ",\"cycles\":false";
+			out += ",\"threads\":" + std::to_string(snapshot.threads) + ",\"apis\":{";
+			for (len_t i = 0; i < CITY_INSTRUMENT_API_COUNT; ++i) {
+				if (i) out += ',';
+				FormatCounter(out, INSTRUMENT_API_NAMES[i], snapshot.apis[i], snapshot.cycles, format);
+			}
+			out += "},\"buckets\":{";
+			for (len_t i = 0; i < CITY_INSTRUMENT_BUCKET_COUNT; ++i) {
+				if (i) out += ',';
+				FormatCounter(out, INSTRUMENT_BUCKET_NAMES[i], snapshot.buckets[i], snapshot.cycles, format);
+			}
+			out += "}}\n";
+			return true;
+		}
+
+		if (!snapshot.enabled) {
+			out += "llcityhash was built without LL_CITY_INSTRUMENT: nothing is counted\n";
+			return true;
+		}
+		ll_string_t header = snapshot.cycles ?
+			"  %-16s %14s %16s %8s %12s %8s\n" : "  %-16s %14s %16s %8s\n";
+		char line[256];
+		std::snprintf(line, sizeof(line), header, "", "calls", "bytes", "avg len", "cycles/call", "cyc/B");
+		out += "CityHash calls on " + std::to_string(snapshot.threads) + " threads\n";
+		out += line;
+		for (len_t i = 0; i < CITY_INSTRUMENT_API_COUNT; ++i)
+			if (snapshot.apis[i].calls)
+				FormatCounter(out, INSTRUMENT_API_NAMES[i], snapshot.apis[i], snapshot.cycles, format);
+		out += "By length bucket\n";
+		for (len_t i = 0; i < CITY_INSTRUMENT_BUCKET_COUNT; ++i)
+			if (snapshot.buckets[i].calls && i != static_cast<len_t>(CityInstrumentBucket::None))
+				FormatCounter(out, INSTRUMENT_BUCKET_NAMES[i], snapshot.buckets[i], snapshot.cycles, format);
+		return true;
+	}
+	catch (...) {
+		return false;
+	}
+}
+
+ll_bool_t CityInstrumentDump(const CityInstrumentSnapshot& snapshot, const CityInstrumentFormat format, std::FILE* file) noexcept {
+	if (!file) return false;
+	std::string out;
+	if (!CityInstrumentFormatSnapshot(snapshot, format, out)) return false;
+	return std::fwrite(out.data(), 1, out.size(), file) == out.size();
+}
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
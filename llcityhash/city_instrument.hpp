@@ -0,0 +1,101 @@
+//////////////////////////////////////////////
+//	city_instrument.hpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Opt-in counters of the CityHash entry points, to find out which length
+// buckets a workload hits before tuning their kernels.  Define
+// LL_CITY_INSTRUMENT when building llcityhash to enable them, and also
+// LL_CITY_INSTRUMENT_CYCLES to read the time stamp counter around every call
+// (x86 only, a few dozen cycles more per call).  Without LL_CITY_INSTRUMENT
+// the hooks expand to nothing, no per-thread state exists, and snapshots are
+// empty.
+//
+// Every thread counts calls, bytes and cycles in its own block, aligned to a
+// cache line so threads never share one, and a snapshot adds up the blocks
+// of every thread (those of threads that exited are kept).  Counted are the
+// exported one-shot functions: CityHash32, CityHash64 (and WithSeed(s)),
+// CityHash128 and CityHash128WithSeed (Unchecked included), and the
+// conversion of wide strings, which also counts the CityHash64 it calls.
+// The inlined Unchecked, Const and Fixed copies, the batch functions and the
+// streams are not counted.
+
+#ifndef LLCPP_CITY_HASH_INSTRUMENT_HPP_
+#define LLCPP_CITY_HASH_INSTRUMENT_HPP_
+
+#include "city.hpp"
+
+#include <cstdio>
+#include <string>
+
+namespace llcpp {
+namespace city {
+
+#pragma region Counters
+enum class CityInstrumentApi : ui8 {
+	Hash32,
+	Hash64,
+	Hash128,
+	WideString,		// CityHash64 of ll_wstring_t, std::wstring and meta::wStr(Pair)
+	Count
+};
+
+// Path each call took, by the length the kernel hashes
+enum class CityInstrumentBucket : ui8 {
+	Hash32Len0to4,
+	Hash32Len5to12,
+	Hash32Len13to24,
+	Hash32Loop,			// CityHash32 over 24 bytes
+	HashLen0to16,
+	HashLen17to32,
+	HashLen33to64,
+	Hash64Loop,			// CityHash64 over 64 bytes
+	CityMurmur,			// CityHash128 under 128 bytes (after its 16-byte seed prefix)
+	Hash128Loop,
+	None,				// Calls counted by API only (wide strings)
+	Count
+};
+
+constexpr len_t CITY_INSTRUMENT_API_COUNT = static_cast<len_t>(CityInstrumentApi::Count);
+constexpr len_t CITY_INSTRUMENT_BUCKET_COUNT = static_cast<len_t>(CityInstrumentBucket::Count);
+
+struct CityInstrumentCounter {
+	ui64 calls;
+	ui64 bytes;
+	ui64 cycles;	// 0 without LL_CITY_INSTRUMENT_CYCLES
+};
+
+struct CityInstrumentSnapshot {
+	CityInstrumentCounter apis[CITY_INSTRUMENT_API_COUNT];
+	CityInstrumentCounter buckets[CITY_INSTRUMENT_BUCKET_COUNT];
+	len_t threads;			// Threads that have counted something, exited ones included
+	ll_bool_t enabled;		// Built with LL_CITY_INSTRUMENT
+	ll_bool_t cycles;		// Built with LL_CITY_INSTRUMENT_CYCLES on x86
+};
+
+enum class CityInstrumentFormat : ui8 {
+	Text,	// A table, one row per API and bucket that was called
+	Json	// {"enabled":..,"apis":{"CityHash64":{"calls":..,..},..},"buckets":{..}}
+};
+
+// Counts since the last reset (or since the program started)
+__LL_NODISCARD__ LL_SHARED_LIB  CityInstrumentSnapshot CityInstrumentGetSnapshot() noexcept;
+// Starts counting from 0.  Calls running meanwhile may count before or after.
+LL_SHARED_LIB  void CityInstrumentReset() noexcept;
+
+__LL_NODISCARD__ LL_SHARED_LIB  ll_string_t CityInstrumentApiName(const CityInstrumentApi api) noexcept;
+__LL_NODISCARD__ LL_SHARED_LIB  ll_string_t CityInstrumentBucketName(const CityInstrumentBucket bucket) noexcept;
+
+// Appends the snapshot to "out"; false if memory runs out
+LL_SHARED_LIB  ll_bool_t CityInstrumentFormatSnapshot(const CityInstrumentSnapshot& snapshot, const CityInstrumentFormat format, std::string& out) noexcept;
+// Writes the snapshot to "file"; false if it is null or cannot be written
+LL_SHARED_LIB  ll_bool_t CityInstrumentDump(const CityInstrumentSnapshot& snapshot, const CityInstrumentFormat format, std::FILE* file) noexcept;
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_INSTRUMENT_HPP_
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////
+//	city_intern.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_intern.hpp"
+#include "city_flat_map.hpp"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+// Bump allocator for the interned bytes.  Blocks are never moved or freed
+//	before the arena, so the strings keep their address.
+class InternArena {
+	private:
+		static constexpr len_t BLOCK_SIZE = 64 * 1024;
+		std::vector<std::unique_ptr<ll_char_t[]>> blocks;
+		ll_char_t* next;
+		len_t left;
+		len_t total;
+
+	private:
+		__LL_NODISCARD__ ll_char_t* newBlock(const len_t size) noexcept {
+			try {
+				std::unique_ptr<ll_char_t[]> block(new ll_char_t[size]);
+				this->blocks.push_back(std::move(block));
+			}
+			catch (...) {
+				return nullptr;
+			}
+			this->total += size;
+			return this->blocks.back().get();
+		}
+
+	public:
+		InternArena() noexcept : blocks(), next(nullptr), left(0), total(0) {}
+
+		__LL_NODISCARD__ ll_char_t* allocate(const len_t size) noexcept {
+			if (size > this->left) {
+				// Long strings get a block of their own and keep the current one
+				if (size > BLOCK_SIZE / 4) return this->newBlock(size);
+				this->next = this->newBlock(BLOCK_SIZE);
+				if (!this->next) {
+					this->left = 0;
+					return nullptr;
+				}
+				this->left = BLOCK_SIZE;
+			}
+			ll_char_t* result = this->next;
+			this->next += size;
+			this->left -= size;
+			return result;
+		}
+		__LL_NODISCARD__ len_t bytes() const noexcept { return this->total; }
+};
+
+} // namespace __internal__
+
+// Aligned to a cache line so the locks of two shards never share one
+struct alignas(64) CityStringInterner::Shard {
+	mutable std::shared_mutex lock;
+	CityFlatSet<CityHashedString> strings;
+	__internal__::InternArena arena;
+};
+
+CityStringInterner::CityStringInterner(const len_t shards) noexcept
+	: shards(nullptr)
+	, shard_count(0)
+	, shard_shift(64)
+{
+	len_t wanted = shards;
+	if (wanted == 0) {
+		wanted = 4 * static_cast<len_t>(std::thread::hardware_concurrency());
+		if (wanted == 0) wanted = 4;
+	}
+	len_t count = 1;
+	ui32 bits = 0;
+	while (count < wanted && bits < 16) {
+		count *= 2;
+		++bits;
+	}
+	this->shards = new (std::nothrow) Shard[count];
+	if (!this->shards) return;
+	this->shard_count = count;
+	this->shard_shift = 64 - bits;
+}
+CityStringInterner::~CityStringInterner() noexcept {
+	delete[] this->shards;
+}
+
+CityStringInterner::Shard& CityStringInterner::shardOf(const ui64 hash) const noexcept {
+	// The top bits: the tables inside a shard index with the low ones
+	return this->shards[this->shard_shift == 64 ? 0 : hash >> this->shard_shift];
+}
+
+std::optional<CityHashedString> CityStringInterner::intern(const CityHashedString& str) noexcept {
+	if (!this->shards) return std::nullopt;
+	Shard& shard = this->shardOf(str.hash());
+	{
+		// Most strings are already there: readers share the lock
+		std::shared_lock<std::shared_mutex> guard(shard.lock);
+		if (const CityHashedString* found = shard.strings.find(str)) return *found;
+	}
+	std::unique_lock<std::shared_mutex> guard(shard.lock);
+	if (const CityHashedString* found = shard.strings.find(str)) return *found;
+	ll_char_t* copy = shard.arena.allocate(str.len() + 1);
+	if (!copy) return std::nullopt;
+	std::memcpy(copy, str.begin(), str.len());
+	copy[str.len()] = '\0';
+	const CityHashedString interned(copy, str.len(), str.hash());
+	if (!shard.strings.insert(interned).first) return std::nullopt;
+	return interned;
+}
+std::optional<CityHashedString> CityStringInterner::intern(ll_string_t s, const len_t len) noexcept {
+	if (!s) return std::nullopt;
+	return this->intern(CityHashedString(s, len));
+}
+std::optional<CityHashedString> CityStringInterner::find(const CityHashedString& str) const noexcept {
+	if (!this->shards) return std::nullopt;
+	Shard& shard = this->shardOf(str.hash());
+	std::shared_lock<std::shared_mutex> guard(shard.lock);
+	if (const CityHashedString* found = shard.strings.find(str)) return *found;
+	return std::nullopt;
+}
+
+len_t CityStringInterner::size() const noexcept {
+	len_t total = 0;
+	for (len_t i = 0; i < this->shard_count; ++i) {
+		std::shared_lock<std::shared_mutex> guard(this->shards[i].lock);
+		total += this->shards[i].strings.size();
+	}
+	return total;
+}
+len_t CityStringInterner::bytes() const noexcept {
+	len_t total = 0;
+	for (len_t i = 0; i < this->shard_count; ++i) {
+		std::shared_lock<std::shared_mutex> guard(this->shards[i].lock);
+		total += this->shards[i].arena.bytes();
+	}
+	return total;
+}
+len_t CityStringInterner::shardCount() const noexcept {
+	return this->shard_count;
+}
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
@@ -0,0 +1,62 @@
+//////////////////////////////////////////////
+//	city_intern.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Thread-safe string interner: every distinct string is copied once into
+// storage owned by the interner, and handed out as a CityHashedString.  The
+// strings are split in shards by their hash, each with its own lock, table
+// and storage, so threads interning different strings rarely meet.
+
+#ifndef LLCPP_CITY_HASH_INTERN_HPP_
+#define LLCPP_CITY_HASH_INTERN_HPP_
+
+#include "city.hpp"
+
+#include <optional>
+
+namespace llcpp {
+namespace city {
+
+class LL_SHARED_LIB CityStringInterner {
+	private:
+		struct Shard;
+		Shard* shards;
+		len_t shard_count;
+		ui32 shard_shift;	// Shard of a hash: hash >> shard_shift
+
+	private:
+		__LL_NODISCARD__ Shard& shardOf(const ui64 hash) const noexcept;
+
+	public:
+		// "shards" is rounded up to a power of two; 0 picks 4 per hardware
+		//	thread.  If the shards cannot be allocated the interner has none,
+		//	and every intern() fails.
+		explicit CityStringInterner(const len_t shards = 0) noexcept;
+		~CityStringInterner() noexcept;
+		CityStringInterner(const CityStringInterner&) = delete;
+		CityStringInterner& operator=(const CityStringInterner&) = delete;
+
+		// Interned copy of str: its bytes (followed by a '\0') stay valid and
+		//	unmoved until the interner is destroyed, and equal strings always
+		//	get the same pointer, so interned handles compare equal in O(1).
+		//	Returns nullopt if memory runs out.
+		__LL_NODISCARD__ std::optional<CityHashedString> intern(const CityHashedString& str) noexcept;
+		// Same for s[0] ... s[len - 1]; also returns nullopt if s is null
+		__LL_NODISCARD__ std::optional<CityHashedString> intern(ll_string_t s, const len_t len) noexcept;
+		// Interned copy of str if there is one, without adding it
+		__LL_NODISCARD__ std::optional<CityHashedString> find(const CityHashedString& str) const noexcept;
+
+		// Distinct strings interned
+		__LL_NODISCARD__ len_t size() const noexcept;
+		// Bytes of storage allocated for them
+		__LL_NODISCARD__ len_t bytes() const noexcept;
+		__LL_NODISCARD__ len_t shardCount() const noexcept;
+};
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_INTERN_HPP_
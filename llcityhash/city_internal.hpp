@@ -0,0 +1,252 @@
+//////////////////////////////////////////////
+//	city_internal.hpp						//
+//											//
+//	Author: Geoff Pike and Jyrki Alakuijala	//
+//	Edited: Francisco Julio Ruiz Fernandez	//
+//	Edited: llanyro							//
+//////////////////////////////////////////////
+
+// Private building blocks of CityHash shared by the translation units of
+// llcityhash.  This header is not part of the public interface.
+
+#ifndef LLCPP_CITY_HASH_INTERNAL_HPP_
+#define LLCPP_CITY_HASH_INTERNAL_HPP_
+
+#include "city.hpp"
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#pragma warning(disable:4365) // ignore conversion from long to ui32 (signed/unsigned mismatch)
+	#include <algorithm>
+	#pragma warning(pop)
+#else
+	#include <algorithm>
+#endif // WINDOWS_SYSTEM
+
+#include <cstring>  // for std::memcpy and std::memset
+
+#if defined(LL_CITY_INSTRUMENT)
+	#include "city_instrument.hpp"
+	#if defined(LL_CITY_INSTRUMENT_CYCLES)
+		#include "city_cpu.hpp"		// for __rdtsc
+	#endif // LL_CITY_INSTRUMENT_CYCLES
+#endif // LL_CITY_INSTRUMENT
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+#if !defined(LIKELY)
+#if (defined(HAVE_BUILTIN_EXPECT) && HAVE_BUILTIN_EXPECT) || defined(__GNUC__) || defined(__clang__)
+#define LIKELY(x) (__builtin_expect(!!(x), 1))
+#else
+#define LIKELY(x) (x)
+#endif
+#endif
+
+#pragma region Priv
+#undef PERMUTE3
+#define PERMUTE3(a, b, c) do { std::swap(a, b); std::swap(a, c); } while (0)
+
+// The CityHash32 / CityHash64 building blocks are the constexpr ones of
+//	city.hpp, so there is a single copy of them.
+using header::Fetch32;
+using header::Fetch64;
+using header::Rotate32;
+using header::Rotate;
+using header::ShiftMix;
+
+// Some primes between 2^63 and 2^64 for various uses.
+using header::k0;
+using header::k1;
+using header::k2;
+
+// Magic numbers for 32-bit hashing.  Copied from Murmur3.
+using header::c1;
+using header::c2;
+
+using header::fmix;
+using header::Mur;
+using header::Hash32Len0to4;
+using header::Hash32Len5to12;
+using header::Hash32Len13to24;
+
+// HashLen16(u, v) is the conversion of hash::Hash128(u, v) to 64 bits
+using header::HashLen16;
+using header::HashLen0to16;
+using header::HashLen17to32;
+using header::HashLen33to64;
+using header::WeakHashLen32WithSeeds;
+
+// A subroutine for CityHash128().  Returns a decent 128-bit hash for strings
+// of any length representable in signed long.  Based on City and Murmur.
+__LL_INLINE__ hash::Hash128 CityMurmur(ll_string_t s, len_t len, const hash::Hash128& seed) noexcept {
+	ui64 a = seed.getLow();
+	ui64 b = seed.getHigh();
+	ui64 c = 0;
+	ui64 d = 0;
+	if (len <= 16) {
+		a = ShiftMix(a * k1) * k1;
+		c = b * k1 + HashLen0to16(s, len);
+		d = ShiftMix(a + (len >= 8 ? Fetch64(s) : c));
+	}
+	else {
+		c = HashLen16(Fetch64(s + len - 8) + k1, a);
+		d = HashLen16(b + len, c + Fetch64(s + len - 16));
+		a += d;
+		// len > 16 here, so do...while is safe
+		do {
+			a ^= ShiftMix(Fetch64(s) * k1) * k1;
+			a *= k1;
+			b ^= a;
+			c ^= ShiftMix(Fetch64(s + 8) * k1) * k1;
+			c *= k1;
+			d ^= c;
+			s += 16;
+			len -= 16;
+		} while (len > 16);
+	}
+	a = HashLen16(a, c);
+	b = HashLen16(d, b);
+	return hash::Hash128(a ^ b, HashLen16(b, a));
+}
+
+#pragma endregion
+#pragma region Loops
+// Main loops of CityHash64 and CityHash128WithSeed, split in steps so the
+// streaming hashers can run them on data that arrives in chunks.  The
+// CityHash64 steps are the ones header::CityHash64 runs.
+
+using header::CityHash64Init;
+using header::CityHash64Round;
+using header::CityHash64Final;
+
+// CityHash128WithSeed, len >= 128: initial state from the seed and the first
+// 128 bytes.
+__LL_INLINE__ void CityHash128Init(CityHashLoopState& st, ll_string_t s, const len_t len, const hash::Hash128& seed) noexcept {
+	st.x = seed.getLow();
+	st.y = seed.getHigh();
+	st.z = len * k1;
+	st.v.low = Rotate(st.y ^ k1, 49) * k1 + Fetch64(s);
+	st.v.high = Rotate(st.v.low, 42) * k1 + Fetch64(s + 8);
+	st.w.low = Rotate(st.y + st.z, 35) * k1 + st.x;
+	st.w.high = Rotate(st.x + Fetch64(s + 88), 53) * k1;
+}
+
+// Hashes s[0] ... s[127].  This is the same inner loop as CityHash64(),
+// manually unrolled.
+__LL_INLINE__ void CityHash128Round(CityHashLoopState& st, ll_string_t s) noexcept {
+	CityHash64Round(st, s);
+	CityHash64Round(st, s + 64);
+}
+
+// Hashes the last len < 128 bytes, s[0] ... s[len - 1], and returns the
+// result.  Reads up to 31 bytes before s, which belong to the last round.
+__LL_INLINE__ hash::Hash128 CityHash128Final(CityHashLoopState& st, ll_string_t s, const len_t len) noexcept {
+	header::Pair& v = st.v;
+	header::Pair& w = st.w;
+	ui64& x = st.x;
+	ui64& y = st.y;
+	ui64& z = st.z;
+	x += Rotate(v.low + z, 49) * k0;
+	y = y * k0 + Rotate(w.high, 37);
+	z = z * k0 + Rotate(w.low, 27);
+	w.low *= 9;
+	v.low *= k0;
+	// If 0 < len < 128, hash up to 4 chunks of 32 bytes each from the end of s.
+	for (len_t tail_done = 0; tail_done < len; ) {
+		tail_done += 32;
+		y = Rotate(x + y, 42) * k0 + v.high;
+		w.low += Fetch64(s + len - tail_done + 16);
+		x = x * k0 + w.low;
+		z += w.high + Fetch64(s + len - tail_done);
+		w.high += v.low;
+		v = WeakHashLen32WithSeeds(s + len - tail_done, v.low + z, v.high);
+		v.low *= k0;
+	}
+	// At this point our 56 bytes of state should contain more than
+	// enough information for a strong 128-bit hash.  We use two
+	// different 56-byte-to-8-byte hashes to get a 16-byte final result.
+	x = HashLen16(x, v.low);
+	y = HashLen16(y + z, w.low);
+	return hash::Hash128(
+		HashLen16(x + v.high, w.high) + y,
+		HashLen16(x + w.high, y + v.high)
+	);
+}
+
+#pragma endregion
+#pragma region Wide
+// CityHash64 of a wide string through the block conversion of big-endian
+//	hosts: every code unit is written little-endian, byte swapped if "swap",
+//	and the blocks are fed to CityHash64Stream.  Little-endian hosts hash
+//	wide strings in place; the tests call this to run the conversion there.
+__LL_NODISCARD__ hash::OptionalHash64 CityHash64WideConverted(ll_wstring_t str, const len_t size, const ll_bool_t swap) noexcept;
+
+#pragma endregion
+#pragma region Instrument
+// LL_CITY_INSTRUMENT_CALL(api, bucket, len) at the top of an entry point
+//	counts the call in city_instrument.hpp when it returns; without
+//	LL_CITY_INSTRUMENT it expands to nothing and its arguments are not
+//	evaluated.
+#if defined(LL_CITY_INSTRUMENT)
+// Adds one call to the counters of the calling thread
+void InstrumentRecord(const CityInstrumentApi api, const CityInstrumentBucket bucket, const len_t bytes, const ui64 cycles) noexcept;
+
+__LL_NODISCARD__ __LL_INLINE__ ui64 InstrumentCycles() noexcept {
+#if defined(LL_CITY_INSTRUMENT_CYCLES) && defined(LL_CITY_X86_64)
+	return __rdtsc();
+#else
+	return 0;
+#endif // LL_CITY_INSTRUMENT_CYCLES
+}
+
+__LL_NODISCARD__ constexpr CityInstrumentBucket InstrumentBucket32(const len_t len) noexcept {
+	return len <= 4 ? CityInstrumentBucket::Hash32Len0to4 :
+		len <= 12 ? CityInstrumentBucket::Hash32Len5to12 :
+		len <= 24 ? CityInstrumentBucket::Hash32Len13to24 : CityInstrumentBucket::Hash32Loop;
+}
+__LL_NODISCARD__ constexpr CityInstrumentBucket InstrumentBucket64(const len_t len) noexcept {
+	return len <= 16 ? CityInstrumentBucket::HashLen0to16 :
+		len <= 32 ? CityInstrumentBucket::HashLen17to32 :
+		len <= 64 ? CityInstrumentBucket::HashLen33to64 : CityInstrumentBucket::Hash64Loop;
+}
+// "len" is what CityHash128WithSeed hashes, after the prefix CityHash128 takes as seed
+__LL_NODISCARD__ constexpr CityInstrumentBucket InstrumentBucket128(const len_t len) noexcept {
+	return len < 128 ? CityInstrumentBucket::CityMurmur : CityInstrumentBucket::Hash128Loop;
+}
+
+class InstrumentScope {
+	private:
+		ui64 start;
+		len_t bytes;
+		CityInstrumentApi api;
+		CityInstrumentBucket bucket;
+
+	public:
+		InstrumentScope(const CityInstrumentApi api, const CityInstrumentBucket bucket, const len_t bytes) noexcept
+			: start(InstrumentCycles())
+			, bytes(bytes)
+			, api(api)
+			, bucket(bucket)
+		{}
+		InstrumentScope(const InstrumentScope&) = delete;
+		InstrumentScope& operator=(const InstrumentScope&) = delete;
+		~InstrumentScope() noexcept {
+			InstrumentRecord(this->api, this->bucket, this->bytes, InstrumentCycles() - this->start);
+		}
+};
+
+	#define LL_CITY_INSTRUMENT_CALL(api, bucket, len) \
+		const ::llcpp::city::__internal__::InstrumentScope ll_city_instrument_scope(::llcpp::city::CityInstrumentApi::api, bucket, len)
+#else
+	#define LL_CITY_INSTRUMENT_CALL(api, bucket, len)
+#endif // LL_CITY_INSTRUMENT
+
+#pragma endregion
+
+} // namespace __internal__
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_INTERNAL_HPP_
@@ -0,0 +1,166 @@
+//////////////////////////////////////////////
+//	city_minhash.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_minhash.hpp"
+#include "city_simd.hpp"
+
+#include <cmath>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+// Shingles hashed with CityHash64Batch per pass
+constexpr len_t MINHASH_BLOCK = 256;
+
+// sig[i] = min(sig[i], CityHash64WithSeed of every hash with seeds[i])
+void MinHashBlock(const ui64* hashes, const len_t count, const ui64* seeds, ui64* sig, const len_t size) noexcept {
+	const SimdKernels64* simd = GetSeedKernels64(BatchKernel::Auto);
+	const len_t done = simd ? simd->min_seeds(hashes, count, nullptr, seeds, sig, size) : 0;
+	for (len_t i = done; i < size; ++i) {
+		ui64 m = sig[i];
+		for (len_t j = 0; j < count; ++j) {
+			const ui64 value = header::HashLen16(hashes[j] - header::k2, seeds[i]);
+			m = value < m ? value : m;
+		}
+		sig[i] = m;
+	}
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+#pragma region MinHash
+CityMinHash::CityMinHash(const ui32 size, const ui64 seed) noexcept : seeds() {
+	try {
+		this->seeds.resize(size);
+	}
+	catch (...) {
+		return;
+	}
+	for (ui32 i = 0; i < size; ++i) this->seeds[i] = city::CityHash64Key(seed + i);
+}
+
+ll_bool_t CityMinHash::signature(const ll_string_t* ptrs, const len_t* lens, const len_t n, ui64* out) const noexcept {
+	if (!ptrs || !lens || !out) return false;
+	for (len_t i = 0; i < this->seeds.size(); ++i) out[i] = ~ui64(0);
+	ll_bool_t ok = true;
+	ui64 hashes[MINHASH_BLOCK];
+	for (len_t base = 0; base < n; base += MINHASH_BLOCK) {
+		len_t block = n - base < MINHASH_BLOCK ? n - base : MINHASH_BLOCK;
+		// Null shingles fail the batch: leave them out
+		if (!city::CityHash64Batch(ptrs + base, lens + base, hashes, block)) {
+			ok = false;
+			len_t kept = 0;
+			for (len_t i = 0; i < block; ++i)
+				if (ptrs[base + i]) hashes[kept++] = hashes[i];
+			block = kept;
+		}
+		MinHashBlock(hashes, block, this->seeds.data(), out, this->seeds.size());
+	}
+	return ok;
+}
+ll_bool_t CityMinHash::signatureHashes(const ui64* hashes, const len_t n, ui64* out) const noexcept {
+	if (!hashes || !out) return false;
+	for (len_t i = 0; i < this->seeds.size(); ++i) out[i] = ~ui64(0);
+	// Blocks keep the hashes in L1 while every group of seeds reads them
+	for (len_t base = 0; base < n; base += MINHASH_BLOCK)
+		MinHashBlock(hashes + base, n - base < MINHASH_BLOCK ? n - base : MINHASH_BLOCK, this->seeds.data(), out, this->seeds.size());
+	return true;
+}
+ll_bool_t CityMinHash::signatureShingles(ll_string_t s, const len_t len, const len_t w, ui64* out) const noexcept {
+	if (!s || !out || w == 0) return false;
+	if (len <= w) {
+		const ui64 hash = city::CityHash64Unchecked(s, len);
+		return this->signatureHashes(&hash, 1, out);
+	}
+	for (len_t i = 0; i < this->seeds.size(); ++i) out[i] = ~ui64(0);
+	const len_t n = len - w + 1;
+	ll_string_t ptrs[MINHASH_BLOCK];
+	len_t lens[MINHASH_BLOCK];
+	ui64 hashes[MINHASH_BLOCK];
+	for (len_t i = 0; i < MINHASH_BLOCK; ++i) lens[i] = w;
+	for (len_t base = 0; base < n; base += MINHASH_BLOCK) {
+		const len_t block = n - base < MINHASH_BLOCK ? n - base : MINHASH_BLOCK;
+		for (len_t i = 0; i < block; ++i) ptrs[i] = s + base + i;
+		(void)city::CityHash64Batch(ptrs, lens, hashes, block);
+		MinHashBlock(hashes, block, this->seeds.data(), out, this->seeds.size());
+	}
+	return true;
+}
+
+ui32 CityMinHash::size() const noexcept { return static_cast<ui32>(this->seeds.size()); }
+const ui64* CityMinHash::getSeeds() const noexcept { return this->seeds.data(); }
+
+f64 CityMinHashSimilarity(const ui64* a, const ui64* b, const ui32 size) noexcept {
+	if (!a || !b || size == 0) return 0.0;
+	ui32 equal = 0;
+	for (ui32 i = 0; i < size; ++i) equal += a[i] == b[i];
+	return static_cast<f64>(equal) / static_cast<f64>(size);
+}
+
+ll_bool_t CityMinHashPack(const ui64* signature, const ui32 size, const ui32 b, ui64* packed) noexcept {
+	if (!signature || !packed || b == 0 || b > 64) return false;
+	const ui64 mask = b == 64 ? ~ui64(0) : (ui64(1) << b) - 1;
+	for (len_t i = 0; i < CityMinHashPackedWords(size, b); ++i) packed[i] = 0;
+	for (ui32 i = 0; i < size; ++i) {
+		const len_t bit = len_t(i) * b;
+		const ui64 value = signature[i] & mask;
+		packed[bit / 64] |= value << (bit % 64);
+		// Values that straddle two words
+		if (bit % 64 + b > 64) packed[bit / 64 + 1] |= value >> (64 - bit % 64);
+	}
+	return true;
+}
+f64 CityMinHashPackedSimilarity(const ui64* a, const ui64* b, const ui32 size, const ui32 bits) noexcept {
+	if (!a || !b || size == 0 || bits == 0 || bits > 64) return 0.0;
+	const ui64 mask = bits == 64 ? ~ui64(0) : (ui64(1) << bits) - 1;
+	ui32 equal = 0;
+	for (ui32 i = 0; i < size; ++i) {
+		const len_t bit = len_t(i) * bits;
+		ui64 x = a[bit / 64] >> (bit % 64);
+		ui64 y = b[bit / 64] >> (bit % 64);
+		if (bit % 64 + bits > 64) {
+			x |= a[bit / 64 + 1] << (64 - bit % 64);
+			y |= b[bit / 64 + 1] << (64 - bit % 64);
+		}
+		equal += ((x ^ y) & mask) == 0;
+	}
+	const f64 match = static_cast<f64>(equal) / static_cast<f64>(size);
+	const f64 chance = bits >= 64 ? 0.0 : std::ldexp(1.0, -static_cast<int>(bits));
+	const f64 similarity = (match - chance) / (1.0 - chance);
+	return similarity < 0.0 ? 0.0 : similarity;
+}
+
+#pragma endregion
+#pragma region Lsh
+ll_bool_t CityLshBands(const ui64* signature, const ui32 bands, const ui32 rows, ui64* out) noexcept {
+	if (!signature || !out) return false;
+	for (ui32 i = 0; i < bands; ++i)
+		out[i] = city::CityHash64WithSeedUnchecked(reinterpret_cast<ll_string_t>(signature + len_t(i) * rows), len_t(rows) * sizeof(ui64), i);
+	return true;
+}
+f64 CityLshProbability(const f64 similarity, const ui32 bands, const ui32 rows) noexcept {
+	return 1.0 - std::pow(1.0 - std::pow(similarity, static_cast<f64>(rows)), static_cast<f64>(bands));
+}
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
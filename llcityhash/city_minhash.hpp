@@ -0,0 +1,84 @@
+//////////////////////////////////////////////
+//	city_minhash.hpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// MinHash signatures, b-bit MinHash and LSH banding over CityHash64.
+// Signature value i of a set of shingles is the smallest
+// CityHash64WithSeed(shingle, seed i): every shingle is hashed once with
+// CityHash64Batch, and that hash is mixed with the k seeds 4 or 8 at a time,
+// as CityHash64WithSeedsMulti does.  The fraction of equal values in two
+// signatures estimates the Jaccard similarity of their sets.
+
+#ifndef LLCPP_CITY_HASH_MINHASH_HPP_
+#define LLCPP_CITY_HASH_MINHASH_HPP_
+
+#include "city.hpp"
+
+#include <vector>
+
+namespace llcpp {
+namespace city {
+
+#pragma region MinHash
+constexpr ui32 CITYHASH_MINHASH_DEFAULT_SIZE = 128;
+
+class LL_SHARED_LIB CityMinHash {
+	private:
+		std::vector<ui64> seeds;		// Seed of every signature value
+
+	public:
+		// Signatures of "size" values.  Seeds are CityHash64Key(seed + i), so
+		//	two CityMinHash built with the same size and seed give comparable
+		//	signatures.  If memory runs out the size is 0.
+		explicit CityMinHash(const ui32 size = CITYHASH_MINHASH_DEFAULT_SIZE, const ui64 seed = 0) noexcept;
+
+		// Signature of the set of n shingles ptrs[i] (size() values in out).
+		//	An empty set gives all ones.  Returns false if an array or a
+		//	shingle is null.
+		ll_bool_t signature(const ll_string_t* ptrs, const len_t* lens, const len_t n, ui64* out) const noexcept;
+		// Same, for shingles given by their CityHash64
+		ll_bool_t signatureHashes(const ui64* hashes, const len_t n, ui64* out) const noexcept;
+		// Signature of the overlapping w-byte shingles of a document (the whole
+		//	document if it is shorter than w).  Returns false if s or out is
+		//	null or w is 0.
+		ll_bool_t signatureShingles(ll_string_t s, const len_t len, const len_t w, ui64* out) const noexcept;
+
+		__LL_NODISCARD__ ui32 size() const noexcept;
+		__LL_NODISCARD__ const ui64* getSeeds() const noexcept;
+};
+
+// Fraction of equal values of two signatures of "size" values
+__LL_NODISCARD__ LL_SHARED_LIB  f64 CityMinHashSimilarity(const ui64* a, const ui64* b, const ui32 size) noexcept;
+
+// b-bit MinHash (Li and Konig): keeps the low b bits (1 to 64) of every value,
+//	packed into CityMinHashPackedWords(size, b) words.  Returns false if an
+//	array is null or b is out of range.
+__LL_NODISCARD__ __LL_INLINE__ constexpr len_t CityMinHashPackedWords(const ui32 size, const ui32 b) noexcept {
+	return (len_t(size) * b + 63) / 64;
+}
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityMinHashPack(const ui64* signature, const ui32 size, const ui32 b, ui64* packed) noexcept;
+// Jaccard similarity from two packed signatures: b-bit values also match by
+//	chance (1 / 2^b of the time), which is taken out of the match rate
+__LL_NODISCARD__ LL_SHARED_LIB  f64 CityMinHashPackedSimilarity(const ui64* a, const ui64* b, const ui32 size, const ui32 bits) noexcept;
+
+#pragma endregion
+#pragma region Lsh
+// Locality sensitive hashing of a signature of bands * rows values: out[i] is
+//	CityHash64WithSeed of the rows values of band i, seeded with i so that
+//	equal rows in different bands land in different buckets.  Two sets become
+//	candidates when any band matches, with probability
+//	CityLshProbability(similarity, bands, rows).  Returns false if an array
+//	is null.
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityLshBands(const ui64* signature, const ui32 bands, const ui32 rows, ui64* out) noexcept;
+// 1 - (1 - s^rows)^bands
+__LL_NODISCARD__ LL_SHARED_LIB  f64 CityLshProbability(const f64 similarity, const ui32 bands, const ui32 rows) noexcept;
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_MINHASH_HPP_
@@ -0,0 +1,114 @@
+//////////////////////////////////////////////
+//	city_parallel.hpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Small work-stealing loop for the parallel modes of llcityhash.  Not part
+// of the public interface.
+
+#ifndef LLCPP_CITY_HASH_PARALLEL_HPP_
+#define LLCPP_CITY_HASH_PARALLEL_HPP_
+
+#include "city.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+// Tasks not yet taken by one worker.  The owner takes tasks from the front;
+// idle workers steal the back half.
+struct alignas(64) TaskRange {
+	std::mutex lock;
+	len_t begin;
+	len_t end;
+};
+
+__LL_NODISCARD__ __LL_INLINE__ ll_bool_t PopTask(TaskRange& range, len_t& task) noexcept {
+	std::lock_guard<std::mutex> guard(range.lock);
+	if (range.begin == range.end) return false;
+	task = range.begin++;
+	return true;
+}
+
+__LL_NODISCARD__ __LL_INLINE__ ll_bool_t StealTasks(TaskRange& victim, TaskRange& thief) noexcept {
+	len_t begin = 0, end = 0;
+	{
+		std::lock_guard<std::mutex> guard(victim.lock);
+		const len_t left = victim.end - victim.begin;
+		if (left == 0) return false;
+		begin = victim.end - (left + 1) / 2;
+		end = victim.end;
+		victim.end = begin;
+	}
+	std::lock_guard<std::mutex> guard(thief.lock);
+	thief.begin = begin;
+	thief.end = end;
+	return true;
+}
+
+// Workers "threads" can use for "tasks" tasks; 0 threads means every core
+__LL_NODISCARD__ __LL_INLINE__ len_t WorkerCount(const len_t tasks, len_t threads) noexcept {
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	return threads < tasks ? threads : (tasks ? tasks : 1);
+}
+
+// Calls body(task) once for every task in [0, tasks) on up to "threads"
+// threads (the caller is one of them).  Every worker starts with an equal
+// slice and steals from the others when it runs out, so uneven tasks still
+// keep every thread busy.  If threads cannot be created, fewer are used
+// (down to the caller alone).
+template<class Body>
+void ParallelFor(const len_t tasks, const len_t threads, Body&& body) noexcept {
+	const len_t workers = WorkerCount(tasks, threads);
+	if (workers <= 1) {
+		for (len_t task = 0; task < tasks; ++task) body(task);
+		return;
+	}
+
+	std::vector<TaskRange> ranges;
+	try {
+		ranges = std::vector<TaskRange>(workers);
+	}
+	catch (...) {
+		for (len_t task = 0; task < tasks; ++task) body(task);
+		return;
+	}
+	for (len_t w = 0; w < workers; ++w) {
+		ranges[w].begin = tasks * w / workers;
+		ranges[w].end = tasks * (w + 1) / workers;
+	}
+	auto worker = [&](const len_t self) {
+		len_t task = 0;
+		for (;;) {
+			while (PopTask(ranges[self], task)) body(task);
+			ll_bool_t stolen = false;
+			for (len_t i = 1; i < workers && !stolen; ++i)
+				stolen = StealTasks(ranges[(self + i) % workers], ranges[self]);
+			if (!stolen) return;
+		}
+	};
+
+	std::vector<std::thread> pool;
+	try {
+		pool.reserve(workers - 1);
+		for (len_t w = 1; w < workers; ++w) pool.emplace_back(worker, w);
+	}
+	catch (...) {
+		// The slices of the missing threads are stolen by the others
+	}
+	worker(0);
+	for (std::thread& t : pool) t.join();
+}
+
+} // namespace __internal__
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_PARALLEL_HPP_
@@ -0,0 +1,139 @@
+//////////////////////////////////////////////
+//	city_pipeline.hpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Pipelined lookups of many keys in a table much bigger than the caches
+// (AMAC, asynchronous memory access chaining).  A lookup that hashes its
+// key and probes right away waits for DRAM on every bucket, one key after
+// another.  CityLookupPipeline instead keeps a window of lookups in flight:
+// each one prefetches the bucket it needs next and yields to the next
+// lookup of the window, and is resumed once every other lookup has had its
+// turn, when the line has had time to arrive.  The misses of the whole
+// window overlap.
+//
+// The table is addressed through two callbacks, so any layout works (open
+// addressing, buckets of several slots, chains):
+//	- locate(hash) returns the address of the first bucket of a key,
+//	- probe(i, hash, bucket) looks for key i in that bucket, which is
+//		probably cached by then, and returns nullptr if the lookup of key i
+//		is over (found or not; probe records it) or the address of the
+//		next bucket to look in.
+// A lookup is a small state machine (key, hash, next bucket), so nothing is
+// allocated and there are no coroutine frames.  Keys are hashed with
+// CityHash64Batch a block at a time, before their lookups start.
+
+#ifndef LLCPP_CITY_HASH_PIPELINE_HPP_
+#define LLCPP_CITY_HASH_PIPELINE_HPP_
+
+#include "city.hpp"
+
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <xmmintrin.h>
+#endif // _MSC_VER
+
+namespace llcpp {
+namespace city {
+
+// Lookups in flight by default: enough to cover a DRAM miss with a few
+// short probes each
+constexpr len_t CITYHASH_PIPELINE_DEFAULT_WINDOW = 16;
+constexpr len_t CITYHASH_PIPELINE_MAX_WINDOW = 64;
+
+#pragma region Pipeline
+namespace __internal__ {
+// Keys hashed per call to CityHash64Batch
+constexpr len_t PIPELINE_HASH_BLOCK = 64;
+
+__LL_INLINE__ void PipelinePrefetch(const void* p) noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(p);
+#else
+	(void)p;
+#endif
+}
+
+struct PipelineLookup {
+	len_t key;
+	ui64 hash;
+	const void* bucket;
+};
+
+} // namespace __internal__
+
+// Looks up the n keys ptrs[i] of lens[i] bytes (hashed with CityHash64)
+// through locate and probe (see the top of this file), with "window"
+// lookups in flight (1 to CITYHASH_PIPELINE_MAX_WINDOW).  probe is called
+// at least once for every non-null key; lookups finish in no particular
+// order.  A window of 1 is the plain loop: hash, locate, probe until done.
+// Returns false if ptrs or lens is null, or if any key is null (it is
+// skipped).
+template<class Locate, class Probe>
+ll_bool_t CityLookupPipeline(const ll_string_t* ptrs, const len_t* lens, const len_t n,
+	Locate&& locate, Probe&& probe, len_t window = CITYHASH_PIPELINE_DEFAULT_WINDOW) noexcept {
+	using __internal__::PipelineLookup;
+	using __internal__::PIPELINE_HASH_BLOCK;
+	if (!ptrs || !lens) return false;
+	if (window == 0) window = 1;
+	if (window > CITYHASH_PIPELINE_MAX_WINDOW) window = CITYHASH_PIPELINE_MAX_WINDOW;
+
+	ll_bool_t ok = true;
+	ui64 hashes[PIPELINE_HASH_BLOCK];
+	len_t block_base = 0;
+	len_t block_end = 0;
+	len_t next = 0;
+	// Starts the lookup of the next non-null key in "lookup", prefetching
+	//	its first bucket; false once every key has started
+	auto start = [&](PipelineLookup& lookup) noexcept {
+		for (; next < n; ++next) {
+			if (next == block_end) {
+				block_base = next;
+				block_end = n - next < PIPELINE_HASH_BLOCK ? n : next + PIPELINE_HASH_BLOCK;
+				(void)city::CityHash64Batch(ptrs + block_base, lens + block_base, hashes, block_end - block_base);
+			}
+			if (!ptrs[next]) {
+				ok = false;
+				continue;
+			}
+			const ui64 hash = hashes[next - block_base];
+			lookup = PipelineLookup{ next++, hash, locate(hash) };
+			__internal__::PipelinePrefetch(lookup.bucket);
+			return true;
+		}
+		return false;
+	};
+
+	PipelineLookup lookups[CITYHASH_PIPELINE_MAX_WINDOW];
+	len_t active = 0;
+	while (active < window && start(lookups[active])) ++active;
+	// Round robin over the window: a lookup that is over hands its place
+	//	to the next key, or to the last lookup of the window once no key is
+	//	left (which then runs in this same turn)
+	for (len_t i = 0; active; ) {
+		PipelineLookup& lookup = lookups[i];
+		const void* bucket = probe(lookup.key, lookup.hash, lookup.bucket);
+		if (bucket) {
+			lookup.bucket = bucket;
+			__internal__::PipelinePrefetch(bucket);
+		}
+		else if (!start(lookup)) {
+			lookup = lookups[--active];
+			if (i < active) continue;
+		}
+		if (++i >= active) i = 0;
+	}
+	return ok;
+}
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_PIPELINE_HPP_
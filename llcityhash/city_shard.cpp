@@ -0,0 +1,251 @@
+//////////////////////////////////////////////
+//	city_shard.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_shard.hpp"
+
+#include <cmath>
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+// Keys hashed with CityHash64Batch per pass of the batch functions
+constexpr len_t SHARD_BLOCK = 256;
+
+// Uniform double in (0, 1) from the top 53 bits of a hash
+__LL_NODISCARD__ __LL_INLINE__ f64 UnitInterval(const ui64 x) noexcept {
+	return (static_cast<f64>(x >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+__LL_NODISCARD__ ll_bool_t IsPrime(const ui64 n) noexcept {
+	if (n < 2) return false;
+	if (n % 2 == 0) return n == 2;
+	for (ui64 d = 3; d * d <= n; d += 2)
+		if (n % d == 0) return false;
+	return true;
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+#pragma region Jump
+ll_bool_t CityJumpHashBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n, const ui32 buckets) noexcept {
+	if (!ptrs || !lens || !out) return false;
+	ll_bool_t ok = true;
+	ui64 hashes[SHARD_BLOCK];
+	for (len_t base = 0; base < n; base += SHARD_BLOCK) {
+		const len_t block = n - base < SHARD_BLOCK ? n - base : SHARD_BLOCK;
+		ok &= city::CityHash64Batch(ptrs + base, lens + base, hashes, block);
+		for (len_t i = 0; i < block; ++i)
+			out[base + i] = ptrs[base + i] ? city::CityJumpHash(hashes[i], buckets) : 0;
+	}
+	return ok;
+}
+
+#pragma endregion
+#pragma region Rendezvous
+CityRendezvous::CityRendezvous(const ui64* ids, const ui32 count, const f64* weights) noexcept
+	: seeds()
+	, weights()
+{
+	if (!ids || count == 0) return;
+	ll_bool_t uniform = true;
+	for (ui32 i = 0; weights && i < count; ++i) {
+		if (!(weights[i] > 0.0) || std::isinf(weights[i])) return;
+		uniform = uniform && weights[i] == weights[0];
+	}
+	try {
+		this->seeds.resize(count);
+		if (!uniform) this->weights.assign(weights, weights + count);
+	}
+	catch (...) {
+		this->seeds.clear();
+		this->weights.clear();
+		return;
+	}
+	for (ui32 i = 0; i < count; ++i) this->seeds[i] = city::CityHash64Key(ids[i]);
+}
+
+ui32 CityRendezvous::pick(const ui64 hash) const noexcept {
+	const ui32 count = static_cast<ui32>(this->seeds.size());
+	if (count == 0) return CITYHASH_SHARD_NONE;
+	ui32 best = 0;
+	if (this->weights.empty()) {
+		ui64 best_score = header::HashLen16(hash, this->seeds[0]);
+		for (ui32 i = 1; i < count; ++i) {
+			const ui64 score = header::HashLen16(hash, this->seeds[i]);
+			if (score > best_score) {
+				best_score = score;
+				best = i;
+			}
+		}
+		return best;
+	}
+	// Weighted: the node with the highest -w / ln(u) wins, which gives node
+	//	i a share w_i / sum(w) of the keys (Schindelhauer and Schomaker)
+	f64 best_score = -this->weights[0] / std::log(UnitInterval(header::HashLen16(hash, this->seeds[0])));
+	for (ui32 i = 1; i < count; ++i) {
+		const f64 score = -this->weights[i] / std::log(UnitInterval(header::HashLen16(hash, this->seeds[i])));
+		if (score > best_score) {
+			best_score = score;
+			best = i;
+		}
+	}
+	return best;
+}
+std::optional<ui32> CityRendezvous::pick(ll_string_t s, const len_t len) const noexcept {
+	if (!s) return std::nullopt;
+	return this->pick(city::CityHash64Unchecked(s, len));
+}
+ll_bool_t CityRendezvous::pickBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n) const noexcept {
+	if (!ptrs || !lens || !out) return false;
+	ll_bool_t ok = true;
+	const ui32 count = static_cast<ui32>(this->seeds.size());
+	ui64 hashes[SHARD_BLOCK];
+	for (len_t base = 0; base < n; base += SHARD_BLOCK) {
+		const len_t block = n - base < SHARD_BLOCK ? n - base : SHARD_BLOCK;
+		ok &= city::CityHash64Batch(ptrs + base, lens + base, hashes, block);
+		ui32* best = out + base;
+		if (count == 0) {
+			for (len_t i = 0; i < block; ++i) best[i] = CITYHASH_SHARD_NONE;
+			continue;
+		}
+		// Four keys walk the nodes together: their scores are independent, so
+		//	the multiplications of HashLen16 overlap instead of waiting on each
+		//	other as they do in pick()
+		len_t i = 0;
+		if (this->weights.empty()) {
+			for (; i + 4 <= block; i += 4) {
+				ui64 s0 = header::HashLen16(hashes[i], this->seeds[0]);
+				ui64 s1 = header::HashLen16(hashes[i + 1], this->seeds[0]);
+				ui64 s2 = header::HashLen16(hashes[i + 2], this->seeds[0]);
+				ui64 s3 = header::HashLen16(hashes[i + 3], this->seeds[0]);
+				ui32 b0 = 0, b1 = 0, b2 = 0, b3 = 0;
+				for (ui32 node = 1; node < count; ++node) {
+					const ui64 seed = this->seeds[node];
+					const ui64 t0 = header::HashLen16(hashes[i], seed);
+					const ui64 t1 = header::HashLen16(hashes[i + 1], seed);
+					const ui64 t2 = header::HashLen16(hashes[i + 2], seed);
+					const ui64 t3 = header::HashLen16(hashes[i + 3], seed);
+					b0 = t0 > s0 ? node : b0;
+					s0 = t0 > s0 ? t0 : s0;
+					b1 = t1 > s1 ? node : b1;
+					s1 = t1 > s1 ? t1 : s1;
+					b2 = t2 > s2 ? node : b2;
+					s2 = t2 > s2 ? t2 : s2;
+					b3 = t3 > s3 ? node : b3;
+					s3 = t3 > s3 ? t3 : s3;
+				}
+				best[i] = b0;
+				best[i + 1] = b1;
+				best[i + 2] = b2;
+				best[i + 3] = b3;
+			}
+		}
+		for (; i < block; ++i) best[i] = this->pick(hashes[i]);
+		for (len_t i = 0; i < block; ++i)
+			if (!ptrs[base + i]) best[i] = CITYHASH_SHARD_NONE;
+	}
+	return ok;
+}
+ui32 CityRendezvous::nodeCount() const noexcept {
+	return static_cast<ui32>(this->seeds.size());
+}
+
+#pragma endregion
+#pragma region Maglev
+CityMaglev::CityMaglev(const ui64* ids, const ui32 count, const ui32 table_size) noexcept
+	: table()
+	, node_count(0)
+{
+	if (!ids || count == 0) return;
+	constexpr ui64 LARGEST_PRIME = 4294967291ull;	// Below 2^32
+	ui64 size = table_size;
+	if (size == 0) {
+		size = ui64(count) * 100;
+		if (size < 65537) size = 65537;
+	}
+	if (size < count) size = count;
+	while (size < LARGEST_PRIME && !IsPrime(size)) ++size;
+	if (size > LARGEST_PRIME) size = LARGEST_PRIME;
+	const ui32 m = static_cast<ui32>(size);
+
+	// Node i fills the entries offset, offset + skip, offset + 2 * skip, ...
+	//	(mod m) in turn with the other nodes, skipping taken ones
+	std::vector<ui32> position, skip;
+	try {
+		this->table.assign(m, CITYHASH_SHARD_NONE);
+		position.resize(count);
+		skip.resize(count);
+	}
+	catch (...) {
+		this->table.clear();
+		return;
+	}
+	for (ui32 i = 0; i < count; ++i) {
+		const ui64 seed = city::CityHash64Key(ids[i]);
+		position[i] = static_cast<ui32>(header::HashLen16(seed, header::k0) % m);
+		skip[i] = static_cast<ui32>(header::HashLen16(seed, header::k1) % (m - 1) + 1);
+	}
+	for (ui32 filled = 0; ;) {
+		for (ui32 i = 0; i < count; ++i) {
+			ui32 c = position[i];
+			while (this->table[c] != CITYHASH_SHARD_NONE) c = static_cast<ui32>((ui64(c) + skip[i]) % m);
+			this->table[c] = i;
+			position[i] = static_cast<ui32>((ui64(c) + skip[i]) % m);
+			if (++filled == m) {
+				this->node_count = count;
+				return;
+			}
+		}
+	}
+}
+
+ui32 CityMaglev::pick(const ui64 hash) const noexcept {
+	if (this->table.empty()) return CITYHASH_SHARD_NONE;
+	// Multiply and shift instead of a modulo
+	return this->table[static_cast<len_t>(((hash >> 32) * this->table.size()) >> 32)];
+}
+std::optional<ui32> CityMaglev::pick(ll_string_t s, const len_t len) const noexcept {
+	if (!s) return std::nullopt;
+	return this->pick(city::CityHash64Unchecked(s, len));
+}
+ll_bool_t CityMaglev::pickBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n) const noexcept {
+	if (!ptrs || !lens || !out) return false;
+	ll_bool_t ok = true;
+	ui64 hashes[SHARD_BLOCK];
+	for (len_t base = 0; base < n; base += SHARD_BLOCK) {
+		const len_t block = n - base < SHARD_BLOCK ? n - base : SHARD_BLOCK;
+		ok &= city::CityHash64Batch(ptrs + base, lens + base, hashes, block);
+		for (len_t i = 0; i < block; ++i)
+			out[base + i] = ptrs[base + i] ? this->pick(hashes[i]) : CITYHASH_SHARD_NONE;
+	}
+	return ok;
+}
+ui32 CityMaglev::nodeCount() const noexcept {
+	return this->node_count;
+}
+ui32 CityMaglev::tableSize() const noexcept {
+	return static_cast<ui32>(this->table.size());
+}
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
@@ -0,0 +1,110 @@
+//////////////////////////////////////////////
+//	city_shard.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Mapping keys to shards with CityHash.  Every key is hashed once with
+// CityHash64, and the node is picked from that value:
+//	- CityJumpHash: Lamping and Veach's jump consistent hash.  No memory and
+//		O(log buckets), but buckets can only be added or removed at the end.
+//	- CityRendezvous: highest random weight hashing, with weights.  Each node
+//		mixes the key's hash with its own seed through HashLen16, so a key
+//		costs one CityHash64 plus one HashLen16 per node.  Any node can leave
+//		and only its keys move.
+//	- CityMaglev: Google's Maglev lookup table.  O(1) per key after building
+//		a table of a prime number of entries; removing a node moves few other
+//		keys.
+
+#ifndef LLCPP_CITY_HASH_SHARD_HPP_
+#define LLCPP_CITY_HASH_SHARD_HPP_
+
+#include "city.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace llcpp {
+namespace city {
+
+#pragma region Jump
+// Returned by the pick functions of an object with no nodes
+constexpr ui32 CITYHASH_SHARD_NONE = ~ui32(0);
+
+// Bucket in [0, buckets) of a key hash; 0 if buckets is 0.  Going from n to
+//	n + 1 buckets moves only 1 / (n + 1) of the keys, all to the new bucket.
+__LL_NODISCARD__ __LL_INLINE__ constexpr ui32 CityJumpHash(ui64 hash, const ui32 buckets) noexcept {
+	i64 b = -1;
+	i64 j = 0;
+	while (j < static_cast<i64>(buckets)) {
+		b = j;
+		hash = hash * 2862933555777941757ull + 1;
+		j = static_cast<i64>(static_cast<f64>(b + 1) * (static_cast<f64>(i64(1) << 31) / static_cast<f64>((hash >> 33) + 1)));
+	}
+	return b < 0 ? 0 : static_cast<ui32>(b);
+}
+// Bucket of CityHash64(s, len), or nullopt if s is null
+__LL_NODISCARD__ __LL_INLINE__ std::optional<ui32> CityJumpHash(ll_string_t s, const len_t len, const ui32 buckets) noexcept {
+	if (!s) return std::nullopt;
+	return CityJumpHash(city::CityHash64Unchecked(s, len), buckets);
+}
+// out[i] = CityJumpHash(ptrs[i], lens[i], buckets), hashing with
+//	CityHash64Batch.  Returns false if any array or key is null (its output
+//	is 0).
+__LL_NODISCARD__ LL_SHARED_LIB  ll_bool_t CityJumpHashBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n, const ui32 buckets) noexcept;
+
+#pragma endregion
+#pragma region Rendezvous
+class LL_SHARED_LIB CityRendezvous {
+	private:
+		std::vector<ui64> seeds;		// Per node: CityHash64Key of its id
+		std::vector<f64> weights;		// Empty if every node weighs the same
+
+	public:
+		// Nodes are identified by ids (any stable value: an address, a name's
+		//	hash), optionally with positive weights; a node gets a share of the
+		//	keys proportional to its weight.  If weights has a value that is not
+		//	positive, or memory runs out, there are no nodes.
+		CityRendezvous(const ui64* ids, const ui32 count, const f64* weights = nullptr) noexcept;
+
+		// Index in [0, nodeCount()) of the node of a key hash (CityHash64),
+		//	or CITYHASH_SHARD_NONE if there are no nodes
+		__LL_NODISCARD__ ui32 pick(const ui64 hash) const noexcept;
+		__LL_NODISCARD__ std::optional<ui32> pick(ll_string_t s, const len_t len) const noexcept;
+		// out[i] = pick(ptrs[i], lens[i]).  Keys are hashed and routed in
+		//	blocks: every node's seed is loaded once per block instead of once per
+		//	key.  Returns false if any array or key is null (its output is
+		//	CITYHASH_SHARD_NONE).
+		__LL_NODISCARD__ ll_bool_t pickBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n) const noexcept;
+		__LL_NODISCARD__ ui32 nodeCount() const noexcept;
+};
+
+#pragma endregion
+#pragma region Maglev
+class LL_SHARED_LIB CityMaglev {
+	private:
+		std::vector<ui32> table;		// Node of every entry
+		ui32 node_count;
+
+	public:
+		// Builds the lookup table of nodes identified by ids.  table_size is
+		//	rounded up to a prime; 0 picks the first prime from 100 entries per
+		//	node (at least 65537), which keeps every node within about 1% of its
+		//	fair share.  If memory runs out there are no nodes.
+		CityMaglev(const ui64* ids, const ui32 count, const ui32 table_size = 0) noexcept;
+
+		__LL_NODISCARD__ ui32 pick(const ui64 hash) const noexcept;
+		__LL_NODISCARD__ std::optional<ui32> pick(ll_string_t s, const len_t len) const noexcept;
+		// Same contract as CityRendezvous::pickBatch
+		__LL_NODISCARD__ ll_bool_t pickBatch(const ll_string_t* ptrs, const len_t* lens, ui32* out, const len_t n) const noexcept;
+		__LL_NODISCARD__ ui32 nodeCount() const noexcept;
+		__LL_NODISCARD__ ui32 tableSize() const noexcept;
+};
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_SHARD_HPP_
@@ -0,0 +1,70 @@
+//////////////////////////////////////////////
+//	city_simd.hpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Multi-buffer CityHash64 and CityHash32 kernels for short keys, and the
+// seed mixing of CityHash64WithSeedsMulti and CityMinHash.  Not part of the
+// public interface: the batch functions pick them at runtime.
+
+#ifndef LLCPP_CITY_HASH_SIMD_HPP_
+#define LLCPP_CITY_HASH_SIMD_HPP_
+
+#include "city.hpp"
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+// Hashes "lanes" keys of the same length bucket: out[l] = CityHash64(s[l], len[l])
+using SimdKernel64 = void(*)(const ll_string_t* s, const len_t* len, ui64* out) noexcept;
+// Mixes one CityHash64 with many seed pairs: out[i] = HashLen16(hash -
+//	seeds0[i], seeds1[i]) (seeds0[i] is k2 if seeds0 is null).  Handles n
+//	rounded down to a multiple of lanes and returns that count.
+using SeedKernel64 = len_t(*)(const ui64 hash, const ui64* seeds0, const ui64* seeds1, ui64* out, const len_t n) noexcept;
+// MinHash over seed pairs: sig[i] = min(sig[i], HashLen16(hashes[j] -
+//	seeds0[i], seeds1[i])) for every j < count.  Same rounding as SeedKernel64.
+using MinSeedKernel64 = len_t(*)(const ui64* hashes, const len_t count, const ui64* seeds0, const ui64* seeds1, ui64* sig, const len_t n) noexcept;
+
+// A null kernel leaves its bucket to the scalar code
+struct SimdKernels64 {
+	len_t lanes;
+	SimdKernel64 len4to7;
+	SimdKernel64 len8to16;
+	SimdKernel64 len17to32;
+	SimdKernel64 len33to64;
+	SeedKernel64 seeds;
+	MinSeedKernel64 min_seeds;
+};
+
+// Kernels of the requested instruction set, or nullptr if this CPU (or this
+// build) cannot run them.  BatchKernel::Auto returns the AVX-512 kernels of
+// the buckets where they beat the scalar lanes, or nullptr, and
+// BatchKernel::Scalar always returns nullptr.
+__LL_NODISCARD__ const SimdKernels64* GetSimdKernels64(const BatchKernel kernel) noexcept;
+// Kernels for the seed kernels under BatchKernel::Auto: AVX-512 first, as
+// mixing seeds is nothing but multiplies, and one vpmullq beats the three
+// vpmuludq AVX2 needs for each
+__LL_NODISCARD__ const SimdKernels64* GetSeedKernels64(const BatchKernel kernel) noexcept;
+
+// Hashes "lanes" keys of the same length bucket: out[l] = CityHash32(s[l], len[l])
+using SimdKernel32 = void(*)(const ll_string_t* s, const len_t* len, ui32* out) noexcept;
+
+struct SimdKernels32 {
+	len_t lanes;
+	SimdKernel32 len0to4;
+	SimdKernel32 len5to12;
+	SimdKernel32 len13to24;
+};
+
+// Same as GetSimdKernels64 for CityHash32, which also has SSE4.1 kernels.
+//	Auto prefers AVX-512: 32-bit multiplies are as fast in 16 lanes as in 8.
+__LL_NODISCARD__ const SimdKernels32* GetSimdKernels32(const BatchKernel kernel) noexcept;
+
+} // namespace __internal__
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_HASH_SIMD_HPP_
@@ -0,0 +1,237 @@
+//////////////////////////////////////////////
+//	city_simd32.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// SSE4.1 (4 lanes), AVX2 (8 lanes) and AVX-512 (16 lanes) multi-buffer
+// kernels for CityHash32 of keys up to 24 bytes.  They compute exactly the
+// same values as the scalar Hash32Len* functions.  CityHash32 only
+// multiplies 32-bit words, which pmulld does natively in every lane, so
+// unlike the 64-bit kernels nothing is emulated.  Every function is compiled
+// for its own target, so the library still runs on any x86-64 CPU.
+
+#include "city_internal.hpp"
+#include "city_cpu.hpp"
+#include "city_simd.hpp"
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+#if defined(LL_CITY_X86_64)
+
+// The kernels of city_simd.cpp own the sse41/avx2/avx512 names
+namespace {
+
+// Bytes 0 to len - 1 of a key of up to 4 bytes, byte i in bits 8i to 8i + 7.
+//	The bytes above them repeat bytes of the key: nothing past it is read.
+__LL_NODISCARD__ __LL_INLINE__ ui32 Bytes0to4(ll_string_t s, const len_t len) noexcept {
+	if (len == 4) return Fetch32(s);
+	if (len == 0) return 0;
+	return static_cast<ui8>(s[0]) |
+		(static_cast<ui32>(static_cast<ui8>(s[len >> 1])) << 8) |
+		(static_cast<ui32>(static_cast<ui8>(s[len - 1])) << 16);
+}
+
+#pragma region Sse41
+namespace sse41 {
+
+struct Isa {
+	using V = __m128i;
+	using M = __m128i;
+	static constexpr len_t LANES = 4;
+
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V set1(const ui32 x) noexcept {
+		return _mm_set1_epi32(static_cast<int>(x));
+	}
+	// Low 32 bits of every length
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V loadLengths(const len_t* len) noexcept {
+		static_assert(sizeof(len_t) == sizeof(ui64), "lengths are loaded as 64-bit lanes");
+		const __m128 lo = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(len)));
+		const __m128 hi = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(len + 2)));
+		return _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+	// Lane l = f(l), built in registers
+	template<class F>
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V each(F&& f) noexcept {
+		return _mm_setr_epi32(static_cast<int>(f(0)), static_cast<int>(f(1)), static_cast<int>(f(2)), static_cast<int>(f(3)));
+	}
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ void store(ui32* out, const V v) noexcept {
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+	}
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V add(const V a, const V b) noexcept { return _mm_add_epi32(a, b); }
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V xor_(const V a, const V b) noexcept { return _mm_xor_si128(a, b); }
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V mul(const V a, const V b) noexcept { return _mm_mullo_epi32(a, b); }
+	template<int N>
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V shr(const V a) noexcept { return _mm_srli_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V shl(const V a) noexcept { return _mm_slli_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V srai(const V a) noexcept { return _mm_srai_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V rotr(const V a) noexcept {
+		return _mm_or_si128(_mm_srli_epi32(a, N), _mm_slli_epi32(a, 32 - N));
+	}
+	// Lengths are at most 24, so the signed compare is enough
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ M greater(const V a, const V b) noexcept { return _mm_cmpgt_epi32(a, b); }
+	LL_CITY_TARGET_SSE41 static __LL_INLINE__ V select(const M m, const V a, const V b) noexcept { return _mm_blendv_epi8(b, a, m); }
+};
+
+#define LL_CITY_SIMD_TARGET LL_CITY_TARGET_SSE41
+#include "city_simd32_kernels.inl"
+#undef LL_CITY_SIMD_TARGET
+
+} // namespace sse41
+
+#pragma endregion
+#pragma region Avx2
+namespace avx2 {
+
+struct Isa {
+	using V = __m256i;
+	using M = __m256i;
+	static constexpr len_t LANES = 8;
+
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V set1(const ui32 x) noexcept {
+		return _mm256_set1_epi32(static_cast<int>(x));
+	}
+	// Low 32 bits of every length: even words of each 128-bit half, then
+	//	the halves put back in order
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V loadLengths(const len_t* len) noexcept {
+		static_assert(sizeof(len_t) == sizeof(ui64), "lengths are loaded as 64-bit lanes");
+		const __m256 lo = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(len)));
+		const __m256 hi = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(len + 4)));
+		const __m256i even = _mm256_castps_si256(_mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+		return _mm256_permute4x64_epi64(even, _MM_SHUFFLE(3, 1, 2, 0));
+	}
+	// Lane l = f(l), built in registers
+	template<class F>
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V each(F&& f) noexcept {
+		return _mm256_setr_epi32(
+			static_cast<int>(f(0)), static_cast<int>(f(1)), static_cast<int>(f(2)), static_cast<int>(f(3)),
+			static_cast<int>(f(4)), static_cast<int>(f(5)), static_cast<int>(f(6)), static_cast<int>(f(7)));
+	}
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ void store(ui32* out, const V v) noexcept {
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+	}
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V add(const V a, const V b) noexcept { return _mm256_add_epi32(a, b); }
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V xor_(const V a, const V b) noexcept { return _mm256_xor_si256(a, b); }
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V mul(const V a, const V b) noexcept { return _mm256_mullo_epi32(a, b); }
+	template<int N>
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V shr(const V a) noexcept { return _mm256_srli_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V shl(const V a) noexcept { return _mm256_slli_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V srai(const V a) noexcept { return _mm256_srai_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V rotr(const V a) noexcept {
+		return _mm256_or_si256(_mm256_srli_epi32(a, N), _mm256_slli_epi32(a, 32 - N));
+	}
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ M greater(const V a, const V b) noexcept { return _mm256_cmpgt_epi32(a, b); }
+	LL_CITY_TARGET_AVX2 static __LL_INLINE__ V select(const M m, const V a, const V b) noexcept { return _mm256_blendv_epi8(b, a, m); }
+};
+
+#define LL_CITY_SIMD_TARGET LL_CITY_TARGET_AVX2
+#include "city_simd32_kernels.inl"
+#undef LL_CITY_SIMD_TARGET
+
+} // namespace avx2
+
+#pragma endregion
+#pragma region Avx512
+namespace avx512 {
+
+struct Isa {
+	using V = __m512i;
+	using M = __mmask16;
+	static constexpr len_t LANES = 16;
+
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V set1(const ui32 x) noexcept {
+		return _mm512_set1_epi32(static_cast<int>(x));
+	}
+	// Low 32 bits of every length: the even words of both vectors
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V loadLengths(const len_t* len) noexcept {
+		static_assert(sizeof(len_t) == sizeof(ui64), "lengths are loaded as 64-bit lanes");
+		const V even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+		return _mm512_permutex2var_epi32(_mm512_loadu_si512(len), even, _mm512_loadu_si512(len + 8));
+	}
+	// Lane l = f(l), built in registers
+	template<class F>
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V each(F&& f) noexcept {
+		return _mm512_setr_epi32(
+			static_cast<int>(f(0)), static_cast<int>(f(1)), static_cast<int>(f(2)), static_cast<int>(f(3)),
+			static_cast<int>(f(4)), static_cast<int>(f(5)), static_cast<int>(f(6)), static_cast<int>(f(7)),
+			static_cast<int>(f(8)), static_cast<int>(f(9)), static_cast<int>(f(10)), static_cast<int>(f(11)),
+			static_cast<int>(f(12)), static_cast<int>(f(13)), static_cast<int>(f(14)), static_cast<int>(f(15)));
+	}
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ void store(ui32* out, const V v) noexcept {
+		_mm512_storeu_si512(out, v);
+	}
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V add(const V a, const V b) noexcept { return _mm512_add_epi32(a, b); }
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V xor_(const V a, const V b) noexcept { return _mm512_xor_si512(a, b); }
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V mul(const V a, const V b) noexcept { return _mm512_mullo_epi32(a, b); }
+	template<int N>
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V shr(const V a) noexcept { return _mm512_srli_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V shl(const V a) noexcept { return _mm512_slli_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V srai(const V a) noexcept { return _mm512_srai_epi32(a, N); }
+	template<int N>
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V rotr(const V a) noexcept { return _mm512_ror_epi32(a, N); }
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ M greater(const V a, const V b) noexcept { return _mm512_cmpgt_epi32_mask(a, b); }
+	LL_CITY_TARGET_AVX512 static __LL_INLINE__ V select(const M m, const V a, const V b) noexcept { return _mm512_mask_blend_epi32(m, b, a); }
+};
+
+#define LL_CITY_SIMD_TARGET LL_CITY_TARGET_AVX512
+#include "city_simd32_kernels.inl"
+#undef LL_CITY_SIMD_TARGET
+
+} // namespace avx512
+
+#pragma endregion
+
+} // namespace
+
+const SimdKernels32* GetSimdKernels32(const BatchKernel kernel) noexcept {
+	const CpuFeatures& cpu = GetCpuFeatures();
+	switch (kernel) {
+		case BatchKernel::Auto:
+			if (cpu.avx512) return &avx512::KERNELS_32;
+			if (cpu.avx2) return &avx2::KERNELS_32;
+			return cpu.sse41 ? &sse41::KERNELS_32 : nullptr;
+		case BatchKernel::Sse41:
+			return cpu.sse41 ? &sse41::KERNELS_32 : nullptr;
+		case BatchKernel::Avx2:
+			return cpu.avx2 ? &avx2::KERNELS_32 : nullptr;
+		case BatchKernel::Avx512:
+			return cpu.avx512 ? &avx512::KERNELS_32 : nullptr;
+		case BatchKernel::Scalar:
+		default:
+			return nullptr;
+	}
+}
+
+#else
+
+const SimdKernels32* GetSimdKernels32(const BatchKernel) noexcept {
+	return nullptr;
+}
+
+#endif // LL_CITY_X86_64
+
+} // namespace __internal__
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
@@ -0,0 +1,98 @@
+//////////////////////////////////////////////
+//	city_simd32_kernels.inl					//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Multi-buffer versions of Hash32Len0to4, Hash32Len5to12 and
+// Hash32Len13to24: lane l of every vector holds the state of key l.
+// Included by city_simd32.cpp once per instruction set, with "Isa" naming
+// the 32-bit lane operations and LL_CITY_SIMD_TARGET the matching target
+// attribute.  Every kernel reads Isa::LANES keys s[l] of len[l] bytes (all
+// in the kernel's bucket) and writes CityHash32 of each key to out[l].
+
+using V = Isa::V;
+
+// Lane l = Fetch32(p[l])
+LL_CITY_SIMD_TARGET __LL_INLINE__ V Load32Simd(const ll_string_t* p) noexcept {
+	return Isa::each([=](const len_t l) noexcept { return Fetch32(p[l]); });
+}
+
+LL_CITY_SIMD_TARGET __LL_INLINE__ V FmixSimd(V h) noexcept {
+	h = Isa::xor_(h, Isa::template shr<16>(h));
+	h = Isa::mul(h, Isa::set1(0x85ebca6b));
+	h = Isa::xor_(h, Isa::template shr<13>(h));
+	h = Isa::mul(h, Isa::set1(0xc2b2ae35));
+	return Isa::xor_(h, Isa::template shr<16>(h));
+}
+
+LL_CITY_SIMD_TARGET __LL_INLINE__ V MurSimd(V a, V h) noexcept {
+	a = Isa::mul(a, Isa::set1(c1));
+	a = Isa::template rotr<17>(a);
+	a = Isa::mul(a, Isa::set1(c2));
+	h = Isa::template rotr<19>(Isa::xor_(h, a));
+	// h * 5 without a second multiply on the chain
+	return Isa::add(Isa::add(Isa::template shl<2>(h), h), Isa::set1(0xe6546b64));
+}
+
+// Step I of b = b * c1 + s[i], c ^= b; lanes whose key is shorter than I
+//	keep their state.  Byte I is sign extended, as the scalar code reads it
+//	through signed char.
+template<i32 I>
+LL_CITY_SIMD_TARGET __LL_INLINE__ void Hash32Len0to4Step(const V word, const V l32, V& b, V& c) noexcept {
+	const Isa::M active = Isa::greater(l32, Isa::set1(static_cast<ui32>(I)));
+	const V v = Isa::template srai<24>(Isa::template shl<24 - 8 * I>(word));
+	const V next_b = Isa::add(Isa::mul(b, Isa::set1(c1)), v);
+	b = Isa::select(active, next_b, b);
+	c = Isa::select(active, Isa::xor_(c, next_b), c);
+}
+
+LL_CITY_SIMD_TARGET void Hash32Len0to4Simd(const ll_string_t* s, const len_t* len, ui32* out) noexcept {
+	const V word = Isa::each([=](const len_t l) noexcept { return Bytes0to4(s[l], len[l]); });
+	const V l32 = Isa::loadLengths(len);
+	V b = Isa::set1(0);
+	V c = Isa::set1(9);
+	Hash32Len0to4Step<0>(word, l32, b, c);
+	Hash32Len0to4Step<1>(word, l32, b, c);
+	Hash32Len0to4Step<2>(word, l32, b, c);
+	Hash32Len0to4Step<3>(word, l32, b, c);
+	Isa::store(out, FmixSimd(MurSimd(b, MurSimd(l32, c))));
+}
+
+LL_CITY_SIMD_TARGET void Hash32Len5to12Simd(const ll_string_t* s, const len_t* len, ui32* out) noexcept {
+	ll_string_t tail[Isa::LANES];
+	ll_string_t middle[Isa::LANES];
+	for (len_t l = 0; l < Isa::LANES; ++l) {
+		tail[l] = s[l] + len[l] - 4;
+		middle[l] = s[l] + ((len[l] >> 1) & 4);
+	}
+	const V l32 = Isa::loadLengths(len);
+	const V d = Isa::add(Isa::template shl<2>(l32), l32);
+	const V a = Isa::add(l32, Load32Simd(s));
+	const V b = Isa::add(d, Load32Simd(tail));
+	const V c = Isa::add(Isa::set1(9), Load32Simd(middle));
+	Isa::store(out, FmixSimd(MurSimd(c, MurSimd(b, MurSimd(a, d)))));
+}
+
+LL_CITY_SIMD_TARGET void Hash32Len13to24Simd(const ll_string_t* s, const len_t* len, ui32* out) noexcept {
+	ll_string_t p[6][Isa::LANES];
+	for (len_t l = 0; l < Isa::LANES; ++l) {
+		p[0][l] = s[l] - 4 + (len[l] >> 1);
+		p[1][l] = s[l] + 4;
+		p[2][l] = s[l] + len[l] - 8;
+		p[3][l] = s[l] + (len[l] >> 1);
+		p[4][l] = s[l];
+		p[5][l] = s[l] + len[l] - 4;
+	}
+	V h = Isa::loadLengths(len);
+	for (len_t i = 0; i < 6; ++i) h = MurSimd(Load32Simd(p[i]), h);
+	Isa::store(out, FmixSimd(h));
+}
+
+constexpr SimdKernels32 KERNELS_32 = {
+	Isa::LANES,
+	Hash32Len0to4Simd,
+	Hash32Len5to12Simd,
+	Hash32Len13to24Simd
+};
@@ -0,0 +1,132 @@
+//////////////////////////////////////////////
+//	city_simd_kernels.inl					//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Multi-buffer versions of HashLen0to16 (4 to 7 and 8 to 16 bytes),
+// HashLen17to32 and HashLen33to64: lane l of every vector holds the state of
+// key l.  Included by city_simd.cpp once per instruction set, with "Isa"
+// naming the vector operations and LL_CITY_SIMD_TARGET the matching target
+// attribute.  Every kernel reads Isa::LANES keys s[l] of len[l] bytes (all in
+// the kernel's bucket) and writes CityHash64 of each key to out[l].  The seed
+// kernels at the end hold one seed pair per lane instead.
+
+using V = Isa::V;
+
+LL_CITY_SIMD_TARGET __LL_INLINE__ V HashLen16Simd(const V u, const V v, const V mul) noexcept {
+	V a = Isa::mul(Isa::xor_(u, v), mul);
+	a = Isa::xor_(a, Isa::template shr<47>(a));
+	V b = Isa::mul(Isa::xor_(v, a), mul);
+	b = Isa::xor_(b, Isa::template shr<47>(b));
+	return Isa::mul(b, mul);
+}
+
+// k2 + len * 2, straight from the lengths array
+LL_CITY_SIMD_TARGET __LL_INLINE__ V MulFromLengths(const len_t* len) noexcept {
+	const V l = Isa::loadLengths(len);
+	return Isa::add(Isa::add(l, l), Isa::set1(k2));
+}
+
+LL_CITY_SIMD_TARGET void HashLen4to7Simd(const ll_string_t* s, const len_t* len, ui64* out) noexcept {
+	ll_string_t tail[Isa::LANES];
+	for (len_t l = 0; l < Isa::LANES; ++l) tail[l] = s[l] + len[l] - 4;
+	const V u = Isa::add(Isa::loadLengths(len), Isa::template shl<3>(Isa::load32(s)));
+	const V v = Isa::load32(tail);
+	Isa::store(out, HashLen16Simd(u, v, MulFromLengths(len)));
+}
+
+LL_CITY_SIMD_TARGET void HashLen8to16Simd(const ll_string_t* s, const len_t* len, ui64* out) noexcept {
+	ll_string_t tail[Isa::LANES];
+	for (len_t l = 0; l < Isa::LANES; ++l) tail[l] = s[l] + len[l] - 8;
+	const V mul = MulFromLengths(len);
+	const V a = Isa::add(Isa::load(s, 0), Isa::set1(k2));
+	const V b = Isa::load(tail, 0);
+	const V c = Isa::add(Isa::mul(Isa::template rotr<37>(b), mul), a);
+	const V d = Isa::mul(Isa::add(Isa::template rotr<25>(a), b), mul);
+	Isa::store(out, HashLen16Simd(c, d, mul));
+}
+
+LL_CITY_SIMD_TARGET void HashLen17to32Simd(const ll_string_t* s, const len_t* len, ui64* out) noexcept {
+	ll_string_t tail[Isa::LANES];
+	for (len_t l = 0; l < Isa::LANES; ++l) tail[l] = s[l] + len[l] - 16;
+	const V mul = MulFromLengths(len);
+	const V a = Isa::mul(Isa::load(s, 0), Isa::set1(k1));
+	const V b = Isa::load(s, 8);
+	const V c = Isa::mul(Isa::load(tail, 8), mul);
+	const V d = Isa::mul(Isa::load(tail, 0), Isa::set1(k2));
+	const V u = Isa::add(Isa::add(Isa::template rotr<43>(Isa::add(a, b)), Isa::template rotr<30>(c)), d);
+	const V v = Isa::add(Isa::add(a, Isa::template rotr<18>(Isa::add(b, Isa::set1(k2)))), c);
+	Isa::store(out, HashLen16Simd(u, v, mul));
+}
+
+LL_CITY_SIMD_TARGET void HashLen33to64Simd(const ll_string_t* s, const len_t* len, ui64* out) noexcept {
+	ll_string_t tail[Isa::LANES];
+	for (len_t l = 0; l < Isa::LANES; ++l) tail[l] = s[l] + len[l] - 32;
+	const V mul = MulFromLengths(len);
+	const V nine = Isa::set1(9);
+	V a = Isa::mul(Isa::load(s, 0), Isa::set1(k2));
+	V b = Isa::load(s, 8);
+	const V c = Isa::load(tail, 8);
+	const V d = Isa::load(tail, 0);
+	const V e = Isa::mul(Isa::load(s, 16), Isa::set1(k2));
+	const V f = Isa::mul(Isa::load(s, 24), nine);
+	const V g = Isa::load(tail, 24);
+	const V h = Isa::mul(Isa::load(tail, 16), mul);
+	const V ag = Isa::add(a, g);
+	const V u = Isa::add(Isa::template rotr<43>(ag), Isa::mul(Isa::add(Isa::template rotr<30>(b), c), nine));
+	const V v = Isa::add(Isa::add(Isa::xor_(ag, d), f), Isa::set1(1));
+	const V w = Isa::add(Isa::bswap(Isa::mul(Isa::add(u, v), mul)), h);
+	const V ef = Isa::add(e, f);
+	const V x = Isa::add(Isa::template rotr<42>(ef), c);
+	const V y = Isa::mul(Isa::add(Isa::bswap(Isa::mul(Isa::add(v, w), mul)), g), mul);
+	const V z = Isa::add(ef, c);
+	a = Isa::add(Isa::bswap(Isa::add(Isa::mul(Isa::add(x, z), mul), y)), b);
+	V r = Isa::add(Isa::add(Isa::mul(Isa::add(z, a), mul), d), h);
+	r = Isa::xor_(r, Isa::template shr<47>(r));
+	b = Isa::mul(r, mul);
+	Isa::store(out, Isa::add(b, x));
+}
+
+// HashLen16's default multiplier, the one CityHash64WithSeeds mixes with
+constexpr ui64 SEED_MUL = 0x9ddfea08eb382d69ull;
+
+LL_CITY_SIMD_TARGET len_t HashSeedsSimd(const ui64 hash, const ui64* seeds0, const ui64* seeds1, ui64* out, const len_t n) noexcept {
+	const V h = Isa::set1(hash);
+	const V mul = Isa::set1(SEED_MUL);
+	const V fixed_seed0 = Isa::set1(k2);
+	len_t i = 0;
+	for (; i + Isa::LANES <= n; i += Isa::LANES) {
+		const V seed0 = seeds0 ? Isa::loadu(seeds0 + i) : fixed_seed0;
+		Isa::store(out + i, HashLen16Simd(Isa::sub(h, seed0), Isa::loadu(seeds1 + i), mul));
+	}
+	return i;
+}
+
+// Seeds stay in registers while every hash goes through them, so the only
+//	dependency between hashes is the running minimum
+LL_CITY_SIMD_TARGET len_t MinHashSeedsSimd(const ui64* hashes, const len_t count, const ui64* seeds0, const ui64* seeds1, ui64* sig, const len_t n) noexcept {
+	const V mul = Isa::set1(SEED_MUL);
+	const V fixed_seed0 = Isa::set1(k2);
+	len_t i = 0;
+	for (; i + Isa::LANES <= n; i += Isa::LANES) {
+		const V seed0 = seeds0 ? Isa::loadu(seeds0 + i) : fixed_seed0;
+		const V seed1 = Isa::loadu(seeds1 + i);
+		V m = Isa::loadu(sig + i);
+		for (len_t j = 0; j < count; ++j)
+			m = Isa::minu(m, HashLen16Simd(Isa::sub(Isa::set1(hashes[j]), seed0), seed1, mul));
+		Isa::store(sig + i, m);
+	}
+	return i;
+}
+
+constexpr SimdKernels64 KERNELS_64 = {
+	Isa::LANES,
+	HashLen4to7Simd,
+	HashLen8to16Simd,
+	HashLen17to32Simd,
+	HashLen33to64Simd,
+	HashSeedsSimd,
+	MinHashSeedsSimd
+};
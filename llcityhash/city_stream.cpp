@@ -0,0 +1,202 @@
+//////////////////////////////////////////////
+//	city_stream.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_internal.hpp"
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+
+using namespace __internal__;
+
+#pragma region CityHash128Stream
+CityHash128Stream::CityHash128Stream(const len_t total_len) noexcept
+	: state()
+	, seed(k0, k1)
+	, total_len(total_len)
+	, fed(0)
+	, seeded_len(total_len >= 16 ? total_len - 16 : total_len)
+	, rounds(seeded_len >= 128 ? seeded_len / 128 : 0)
+	, buffered(0)
+	, prefix(total_len >= 16 ? 16 : 0)
+	, started(false)
+	, failed(false)
+	, buffer()
+{}
+CityHash128Stream::CityHash128Stream(const len_t total_len, const hash::Hash128& seed) noexcept
+	: state()
+	, seed(seed)
+	, total_len(total_len)
+	, fed(0)
+	, seeded_len(total_len)
+	, rounds(total_len >= 128 ? total_len / 128 : 0)
+	, buffered(0)
+	, prefix(0)
+	, started(false)
+	, failed(false)
+	, buffer()
+{}
+
+void CityHash128Stream::hashRounds(ll_string_t s, const len_t count) noexcept {
+	if (!this->started) {
+		CityHash128Init(this->state, s, this->seeded_len, this->seed);
+		this->started = true;
+	}
+	// Local copy: stores through "this" would alias the input bytes
+	CityHashLoopState st = this->state;
+	for (len_t i = 0; i < count; ++i, s += 128)
+		CityHash128Round(st, s);
+	this->state = st;
+	this->rounds -= count;
+	// CityHash128Final reads back into the last round
+	if (this->rounds == 0)
+		std::memcpy(this->buffer, s - 32, 32);
+}
+
+ll_bool_t CityHash128Stream::update(ll_string_t s, len_t len) noexcept {
+	if (this->failed || !s || len > this->total_len - this->fed) {
+		this->failed = true;
+		return false;
+	}
+	this->fed += len;
+	ll_char_t* pending = this->buffer + 32;
+
+	// CityHash128 takes its seed from the first 16 bytes
+	if (this->prefix) {
+		len_t take = this->prefix - this->buffered;
+		if (take > len) take = len;
+		std::memcpy(pending + this->buffered, s, take);
+		this->buffered += take;
+		s += take;
+		len -= take;
+		if (this->buffered < this->prefix) return true;
+		this->seed = hash::Hash128(Fetch64(pending), Fetch64(pending + 8) + k0);
+		this->buffered = 0;
+		this->prefix = 0;
+	}
+
+	// Complete a round started by a previous chunk
+	if (this->rounds && this->buffered) {
+		len_t take = 128 - this->buffered;
+		if (take > len) take = len;
+		std::memcpy(pending + this->buffered, s, take);
+		this->buffered += take;
+		s += take;
+		len -= take;
+		if (this->buffered < 128) return true;
+		this->hashRounds(pending, 1);
+		this->buffered = 0;
+	}
+
+	// Whole rounds straight from the chunk
+	len_t count = len / 128;
+	if (count > this->rounds) count = this->rounds;
+	if (count) {
+		this->hashRounds(s, count);
+		s += count * 128;
+		len -= count * 128;
+	}
+
+	// Either a partial round or the last (< 128) bytes of the input
+	std::memcpy(pending + this->buffered, s, len);
+	this->buffered += len;
+	return true;
+}
+
+hash::OptionalHash128 CityHash128Stream::finalize() const noexcept {
+	if (this->failed || this->fed != this->total_len) return std::nullopt;
+	ll_string_t pending = this->buffer + 32;
+	if (this->seeded_len < 128) return CityMurmur(pending, this->seeded_len, this->seed);
+	CityHashLoopState st = this->state;
+	return CityHash128Final(st, pending, this->buffered);
+}
+
+#pragma endregion
+#pragma region CityHash64Stream
+CityHash64Stream::CityHash64Stream(const len_t total_len, ll_string_t tail) noexcept
+	: state()
+	, total_len(total_len)
+	, fed(0)
+	, blocks(total_len > 64 ? (total_len - 1) / 64 : 0)
+	, buffered(0)
+	, started(false)
+	, failed(!tail)
+	, tail()
+	, buffer()
+{
+	if (tail) std::memcpy(this->tail, tail, total_len < 64 ? total_len : 64);
+}
+
+void CityHash64Stream::hashBlocks(ll_string_t s, const len_t count) noexcept {
+	if (!this->started) {
+		CityHash64Init(this->state, this->tail + 64, this->total_len, Fetch64(s));
+		this->started = true;
+	}
+	// Local copy: stores through "this" would alias the input bytes
+	CityHashLoopState st = this->state;
+	for (len_t i = 0; i < count; ++i, s += 64)
+		CityHash64Round(st, s);
+	this->state = st;
+	this->blocks -= count;
+}
+
+ll_bool_t CityHash64Stream::update(ll_string_t s, len_t len) noexcept {
+	if (this->failed || !s || len > this->total_len - this->fed) {
+		this->failed = true;
+		return false;
+	}
+	this->fed += len;
+
+	// Complete a block started by a previous chunk
+	if (this->blocks && this->buffered) {
+		len_t take = 64 - this->buffered;
+		if (take > len) take = len;
+		std::memcpy(this->buffer + this->buffered, s, take);
+		this->buffered += take;
+		s += take;
+		len -= take;
+		if (this->buffered < 64) return true;
+		this->hashBlocks(this->buffer, 1);
+		this->buffered = 0;
+	}
+
+	len_t count = len / 64;
+	if (count > this->blocks) count = this->blocks;
+	if (count) {
+		this->hashBlocks(s, count);
+		s += count * 64;
+		len -= count * 64;
+	}
+
+	// The bytes after the last block are already in "tail"
+	if (this->blocks) {
+		std::memcpy(this->buffer + this->buffered, s, len);
+		this->buffered += len;
+	}
+	return true;
+}
+
+hash::OptionalHash64 CityHash64Stream::finalize() const noexcept {
+	if (this->failed || this->fed != this->total_len) return std::nullopt;
+	if (this->total_len <= 64) return CityHash64(this->tail, this->total_len);
+	return CityHash64Final(this->state);
+}
+
+#pragma endregion
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
@@ -0,0 +1,107 @@
+//////////////////////////////////////////////
+//	city_tree.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "city_internal.hpp"
+#include "city_parallel.hpp"
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(push)
+	#if defined(__LL_SPECTRE_FUNCTIONS__)
+		#pragma warning(disable:5045) // Security Spectre mitigation [SECURITY]
+	#endif // __LL_UNSECURE_FUNCTIONS__
+#endif // WINDOWS_SYSTEM
+
+namespace llcpp {
+namespace city {
+namespace __internal__ {
+
+__LL_INLINE__ void StoreLittleEndian64(ll_char_t* out, const ui64 value) noexcept {
+	for (len_t i = 0; i < 8; ++i)
+		out[i] = static_cast<ll_char_t>(value >> (8 * i));
+}
+
+__LL_NODISCARD__ __LL_INLINE__ hash::Hash128 CityHashTreeLeaf(ll_string_t s, const len_t len, const len_t leaf, const len_t leaf_size) noexcept {
+	const len_t begin = leaf * leaf_size;
+	const len_t size = len - begin < leaf_size ? len - begin : leaf_size;
+	return *CityHash128WithSeed(s + begin, size, hash::Hash128(leaf, leaf_size));
+}
+
+// Hashes leaves [first, last) into "leaves"
+void CityHashTreeLeaves(ll_string_t s, const len_t len, hash::Hash128* leaves, const len_t first, const len_t last, const len_t leaf_size, const len_t threads) noexcept {
+	ParallelFor(last - first, threads, [&](const len_t task) {
+		leaves[first + task] = CityHashTreeLeaf(s, len, first + task, leaf_size);
+	});
+}
+
+hash::Hash128 CityHashTreeRoot(const hash::Hash128* leaves, const len_t count, const len_t len) noexcept {
+	CityHash128Stream root(count * 16, hash::Hash128(len, CITYHASH_TREE_VERSION));
+	ll_char_t digest[16];
+	for (len_t i = 0; i < count; ++i) {
+		StoreLittleEndian64(digest, leaves[i].getLow());
+		StoreLittleEndian64(digest + 8, leaves[i].getHigh());
+		(void)root.update(digest, sizeof(digest));
+	}
+	return *root.finalize();
+}
+
+} // namespace __internal__
+
+using namespace __internal__;
+
+hash::OptionalHash128 CityHashTree(ll_string_t s, len_t len, const len_t leaf_size, const len_t threads) noexcept {
+	if (!s || !leaf_size) return std::nullopt;
+	const len_t count = CityHashTreeLeafCount(len, leaf_size);
+	// Kept on the stack for inputs up to 256 leaves (256 MiB with the
+	//	default leaf size)
+	constexpr len_t STACK_LEAVES = 256;
+	if (count <= STACK_LEAVES) {
+		hash::Hash128 leaves[STACK_LEAVES];
+		return CityHashTree(s, len, leaves, leaf_size, threads);
+	}
+	std::vector<hash::Hash128> leaves;
+	try {
+		leaves.resize(count);
+	}
+	catch (...) {
+		return std::nullopt;
+	}
+	return CityHashTree(s, len, leaves.data(), leaf_size, threads);
+}
+
+hash::OptionalHash128 CityHashTree(ll_string_t s, len_t len, hash::Hash128* leaves, const len_t leaf_size, const len_t threads) noexcept {
+	if (!s || !leaves || !leaf_size) return std::nullopt;
+	const len_t count = CityHashTreeLeafCount(len, leaf_size);
+	CityHashTreeLeaves(s, len, leaves, 0, count, leaf_size, threads);
+	return CityHashTreeRoot(leaves, count, len);
+}
+
+hash::OptionalHash128 CityHashTreeUpdate(ll_string_t s, len_t len, hash::Hash128* leaves, const len_t old_len, const len_t changed_begin, const len_t changed_end, const len_t leaf_size, const len_t threads) noexcept {
+	if (!s || !leaves || !leaf_size) return std::nullopt;
+	const len_t count = CityHashTreeLeafCount(len, leaf_size);
+	// Leaves of the changed bytes that are still there
+	len_t first = count;
+	len_t last = count;
+	if (changed_begin < changed_end && changed_begin < len) {
+		first = changed_begin / leaf_size;
+		last = CityHashTreeLeafCount(changed_end < len ? changed_end : len, leaf_size);
+	}
+	// If the length changed, the leaves from the shorter length on
+	const len_t tail = len == old_len ? count : (len < old_len ? len : old_len) / leaf_size;
+	if (last >= tail) CityHashTreeLeaves(s, len, leaves, first < tail ? first : tail, count, leaf_size, threads);
+	else {
+		CityHashTreeLeaves(s, len, leaves, first, last, leaf_size, threads);
+		CityHashTreeLeaves(s, len, leaves, tail, count, leaf_size, threads);
+	}
+	return CityHashTreeRoot(leaves, count, len);
+}
+
+} // namespace city
+} // namespace llcpp
+
+#if defined(WINDOWS_SYSTEM)
+	#pragma warning(pop)
+#endif // WINDOWS_SYSTEM
@@ -0,0 +1,105 @@
+//////////////////////////////////////////////
+//	cityhash_test.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+void fillTestData(std::vector<ll_char_t>& buffer) {
+	constexpr ui64 k0 = llcpp::meta::hash::city::CityHash::k0;
+	ui64 a = 9;
+	ui64 b = 777;
+	for (len_t i = 0; i < buffer.size(); ++i) {
+		a += b;
+		b += a;
+		a = (a ^ (a >> 41)) * k0;
+		b = (b ^ (b >> 41)) * k0 + i;
+		buffer[i] = static_cast<ll_char_t>(b >> 37);
+	}
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
+
+namespace {
+
+using llcpp::city::test::Options;
+
+struct Test {
+	ll_string_t name;
+	ll_string_t description;
+	bool (*run)(const Options&);
+};
+
+constexpr Test TESTS[] = {
+	{ "golden", "CityHash32/64/64WithSeed(s)/128/128WithSeed against golden vectors, lengths 0 to 1024", llcpp::city::test::runGoldenTests },
+	{ "differential", "Every other entry point and kernel against the scalar functions, at page boundaries", llcpp::city::test::runDifferentialTests },
+	{ "instrument", "Counters of city_instrument.hpp, or that none exist without LL_CITY_INSTRUMENT", llcpp::city::test::runInstrumentTests },
+	{ "map", "CityFlatMap and CityFlatSet against std::unordered_map, string lookups and null C strings", llcpp::city::test::runMapTests },
+	{ "hll", "CityHyperLogLog against exact distinct counts, add, addBatch, addHashes, merge and serialization", llcpp::city::test::runHllTests },
+	{ "tree", "CityHashTree against its layout, and CityHashTreeUpdate after changes, appends and truncations", llcpp::city::test::runTreeTests },
+	{ "intern", "CityStringInterner copies, hashes and deduplicates strings, also across threads", llcpp::city::test::runInternTests },
+	{ "bloom", "CityBloomFilter false negatives and positives, batch kernels and serialized copies", llcpp::city::test::runBloomTests },
+	{ "shard", "CityJumpHash, CityRendezvous and CityMaglev: batches, keys moved and balance", llcpp::city::test::runShardTests },
+	{ "count", "CityCountMinSketch bounds on a Zipf stream, merges, threads and CityHeavyHitters' top", llcpp::city::test::runCountMinTests },
+	{ "minhash", "CityHash64WithSeedsMulti kernels, CityMinHash signatures and similarity estimates", llcpp::city::test::runMinHashTests },
+	{ "cdc", "CityChunker against FastCDC for every kernel, threads, streams, files and dedup", llcpp::city::test::runCdcTests },
+	{ "fields", "CityHash64Fields against the packed fields, whatever the padding holds", llcpp::city::test::runFieldsTests },
+	{ "async", "CityAsyncHasher against CityHash128 of every file, for every backend, and missing files", llcpp::city::test::runAsyncTests },
+	{ "pipeline", "CityLookupPipeline against a window of 1: found values, null keys and empty batches", llcpp::city::test::runPipelineTests },
+};
+
+void usage(ll_string_t program) noexcept {
+	std::printf(
+		"usage: %s [--test=NAME] [--seed=N] [--iterations=N] [--verbose]\n"
+		"tests:\n", program);
+	for (const Test& test : TESTS)
+		std::printf("  %-14s %s\n", test.name, test.description);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	Options options{};
+	options.seed = 1;
+	options.iterations = 100000;
+	std::string only;
+
+	for (int i = 1; i < argc; ++i) {
+		ll_string_t arg = argv[i];
+		if (std::strncmp(arg, "--test=", 7) == 0) only = arg + 7;
+		else if (std::strncmp(arg, "--seed=", 7) == 0) options.seed = std::strtoull(arg + 7, nullptr, 10);
+		else if (std::strncmp(arg, "--iterations=", 13) == 0) options.iterations = std::strtoull(arg + 13, nullptr, 10);
+		else if (std::strcmp(arg, "--verbose") == 0) options.verbose = true;
+		else {
+			usage(argv[0]);
+			return std::strcmp(arg, "--help") == 0 ? 0 : 1;
+		}
+	}
+
+	std::printf("seed %llu, %zu random keys\n", static_cast<unsigned long long>(options.seed), options.iterations);
+	bool found = false;
+	bool ok = true;
+	for (const Test& test : TESTS) {
+		if (!only.empty() && only != test.name) continue;
+		found = true;
+		ok &= test.run(options);
+	}
+	if (!found) {
+		std::fprintf(stderr, "Unknown test: %s\n", only.c_str());
+		usage(argv[0]);
+		return 1;
+	}
+	std::printf(ok ? "PASSED\n" : "FAILED\n");
+	return ok ? 0 : 1;
+}
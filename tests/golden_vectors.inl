@@ -0,0 +1,1045 @@
+//////////////////////////////////////////////
+//	golden_vectors.inl						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Golden values of the CityHash functions over the buffer of fillTestData:
+// the key of length i starts at offset (i * i) % (TEST_DATA_SIZE - i), which
+// is i * i below 1024 as in the upstream city-test.cc, and the last row is
+// the whole buffer.  Seeds are TEST_SEED0, TEST_SEED1 and Hash128(TEST_SEED0,
+// TEST_SEED1).  Columns:
+//	offset, len, CityHash32, CityHash64, CityHash64WithSeed(TEST_SEED0),
+//	CityHash64WithSeeds(TEST_SEED0, TEST_SEED1), CityHash128 (low, high),
+//	CityHash128WithSeed (low, high).
+// The values were taken from the port before any kernel was optimized; its
+// first row matches the upstream table.  Do not regenerate this table from
+// the code it checks.
+
+	{       0,       0, 0xdc56d17a, 0x9ae16a3b2f90404full, 0x75106db890237a4aull, 0x3feac5f636039766ull, 0x3df09dfc64c09a2bull, 0x3cb540c392e51e29ull, 0x06b56343feac0663ull, 0x5b7bc50fd8e8ad92ull },
+	{       1,       1, 0x99929334, 0x541150e87f415e96ull, 0x1aef0d24b3148a1aull, 0xbacc300e1e82345aull, 0xc3cdc41e1df33513ull, 0x2c138ff2596d42f6ull, 0xf58e9082aed3055full, 0x162e192b2957163dull },
+	{       4,       2, 0x4252edb7, 0x0f3786a4b25827c1ull, 0x34ee1a2bf767bd1cull, 0x2f15ca2ebfb631f2ull, 0x3149ba1dac77270dull, 0x070e2e076e30703cull, 0x059bcc9659bc5296ull, 0x9ecbc8132ae2f1d7ull },
+	{       9,       3, 0xebc34f3c, 0xef923a7a1af78eabull, 0x79163b1e1e9a9b18ull, 0xdf3b2aca6e1e4a30ull, 0x2193fb7620cbf23bull, 0x8b6a8ff06cda8302ull, 0x1a44469afd3e091full, 0x08b0449376612506ull },
+	{      16,       4, 0x26f2b463, 0x11df592596f41d88ull, 0x843ec0bce9042f9cull, 0xcce2ea1e08b1eb30ull, 0x4d09e42f09cc3495ull, 0x666236631b9f253bull, 0xd28b3763cd02b6a3ull, 0x43b249e57c4d0c1bull },
+	{      25,       5, 0xb042c047, 0x831f448bdc5600b3ull, 0x62a24be3120a6919ull, 0x1b44098a41e010daull, 0x0dc07df53b949c6bull, 0xd2b11b2081aeb002ull, 0xd212b02c1b13f772ull, 0xc0bed297b4be1912ull },
+	{      36,       6, 0xe73bb0a8, 0x3eca803e70304894ull, 0x0d80de767e4a920aull, 0xa51cfbb292efd53dull, 0xd183dcda5f73edfaull, 0x3a93cbf40f30128cull, 0x1a92544d0b41dbdaull, 0xaec2c4bee81975e1ull },
+	{      49,       7, 0x91dfdd75, 0x1b5a063fb4c7f9f1ull, 0x318dbc24af66dee9ull, 0x10ef7b32d5c719afull, 0xb140a02ef5c97712ull, 0xb7d00ef065b51b33ull, 0x635121d532897d98ull, 0x532daf21b312a6d6ull },
+	{      64,       8, 0xc87f95de, 0xa0f10149a0e538d6ull, 0x69d008c20f87419full, 0x41b36376185b3e9eull, 0x26b6689960ccf81dull, 0x55f23b27bb9efd94ull, 0x3a17f6166dd765dbull, 0xc891a8a62931e782ull },
+	{      81,       9, 0x3f5538ef, 0xfb8d9c70660b910bull, 0xa45b0cc3476bff1bull, 0xb28d1996144f0207ull, 0x98ec31113e5e35d2ull, 0x5e4aeb853f1b9aa7ull, 0xbcf5c8fe4465b7c8ull, 0xb1ea3a8243996f15ull },
+	{     100,      10, 0x70eb1a1f, 0x236827beae282a46ull, 0xe43970221139c946ull, 0x4f3ac6faa837a3aaull, 0x71fec0f972248915ull, 0x2170ec2061f24574ull, 0x9eb346b6caa36e82ull, 0x2908f0fdbca48e73ull },
+	{     121,      11, 0xcfd63b83, 0xc385e435136ecf7cull, 0xd9d17368ff6c4a08ull, 0x1b31eed4e5251a67ull, 0xdf01a322c43a6200ull, 0x298b65a1714b5a7eull, 0x0933b83f0aedf23cull, 0x157bcb44d63f765aull },
+	{     144,      12, 0x894a52ef, 0xe3f6828b6017086dull, 0x21b4d1900554b3b0ull, 0xbef38be1809e24f1ull, 0xd93251758985ee6cull, 0x32a9e9f82ba2a932ull, 0x3822aacaa95f3329ull, 0xdb349b2f90a490d8ull },
+	{     169,      13, 0x9cde6a54, 0x851fff285561dca0ull, 0x4d1277d73cdf416full, 0x28ccffa61010ebe2ull, 0x77a4ccacd131d9eeull, 0xe1d08eeb2f0e29aaull, 0x70b9e3051383fa45ull, 0x0582d0120425cabaull },
+	{     196,      14, 0x6c4898d5, 0x61152a63595a96d9ull, 0xd1a3a91ef3a7ba45ull, 0x443b6bb4a493ad0cull, 0xa154296d11362d06ull, 0xd0f0bf1f1cb02fc1ull, 0xccb87e09309f90d1ull, 0xb24a8e4881911101ull },
+	{     225,      15, 0x13e1978e, 0x44473e03be306c88ull, 0x30097761f872472aull, 0x9fd1b669bfad82d7ull, 0x3bab18b164396783ull, 0x047e385ff9d4c06full, 0x018062081bf558dfull, 0x63416eb68f104a36ull },
+	{     256,      16, 0x051b4ba8, 0x03ead5f21d344056ull, 0xfb6420393cfb05c3ull, 0x407932394cbbd303ull, 0xac059617f5906673ull, 0x94d50d3dcd3069a7ull, 0x02b26c3b92dea0f0ull, 0x99b7374cc78fc3fbull },
+	{     289,      17, 0xb6b06e40, 0x6abbfde37ee03b5bull, 0x83febf188d2cc113ull, 0xcda7b62d94d5b8eeull, 0xa4375590b8ae7c82ull, 0x168fd42f9ecae4ffull, 0x23bbde43de2cb214ull, 0xa8c333112a243c8cull },
+	{     324,      18, 0x0240a2f2, 0x0943e7ed63b3c080ull, 0x1ef207e9444ef7f8ull, 0xef4a9f9f8c6f9b4aull, 0x6b54fc38d6a84108ull, 0x032f4212a47a4665ull, 0x6b5a9a8f64ee1da6ull, 0x9f74e86c6da69421ull },
+	{     361,      19, 0x5dcefc30, 0xd72ce05171ef8a1aull, 0xc6bd6bd869203894ull, 0xc760e6396455d23aull, 0x0f86af0b40dcce7bull, 0x8d3c15d613394d3cull, 0x491e400491cd4eceull, 0x7c19d3530ea3547full },
+	{     400,      20, 0x7a48b105, 0x4182832b52d63735ull, 0x337097e123eea414ull, 0xb5a72ca0456df910ull, 0x7ebc034235bc122full, 0xd9a7783d4edd8049ull, 0x5f8b04a15ae42361ull, 0xfc193363336453ddull },
+	{     441,      21, 0xfd55007b, 0xd6cdae892584a2cbull, 0x58de0fa4eca17dcdull, 0x43df30b8f5f1cb00ull, 0x9e4ea5a4941e097dull, 0x547e048d5a9daabaull, 0xeb6ecbb0b831d185ull, 0xe0168df5fad0c670ull },
+	{     484,      22, 0x6b95894c, 0x5c8e90bc267c5ee4ull, 0xe9ae044075d992d9ull, 0xf234cbfd1f0a1e59ull, 0xce2744521944f14cull, 0x104f8032f99dc152ull, 0x4e7f425bfac67ca7ull, 0x9461b911a1c6d589ull },
+	{     529,      23, 0x3360e827, 0xbbd7f30ac310a6f3ull, 0xb23b570d2666685full, 0xfb13fb08c9814fe7ull, 0x4ee107042e512374ull, 0x1e2c8c0d16097e13ull, 0x210c7500995aa0e6ull, 0x6c13190557106457ull },
+	{     576,      24, 0x45177e0b, 0x36a097aa49519d97ull, 0x08204380a73c4065ull, 0x77c2004bdd9e276aull, 0x6ee1f817ce0b7aeeull, 0xe9dcb3507f0596caull, 0x6bc63c666b5100e2ull, 0xe0b056f1821752afull },
+	{     625,      25, 0x7c6fffe4, 0x0dc78cb032c49217ull, 0x112464083f83e03aull, 0x96ae53e28170c0f5ull, 0x0d367ff54952a958ull, 0xcdad930657371147ull, 0xaa24dc2a9573d5feull, 0xeb136daa89da5110ull },
+	{     676,      26, 0xbbc78da4, 0x441593e0da922dfeull, 0x936ef46061469b32ull, 0x204a1921197ddd87ull, 0x50d8a70e7a8d8f56ull, 0x256d150ae75dab76ull, 0xe81f4c4a1989036aull, 0xd0f8db365f9d7e00ull },
+	{     729,      27, 0xc5c25d39, 0x2ba3883d71cc2133ull, 0x72f2bbb32bed1a3cull, 0x27e1bd96d4843251ull, 0xa90f761e8db1543aull, 0xc339e23c09703cd8ull, 0xf0c6624c4b098fd3ull, 0x1bae2053e41fa4d9ull },
+	{     784,      28, 0xb6e5d06e, 0xf2b6d2adf8423600ull, 0x7514e2f016a48722ull, 0x43045743a50396baull, 0x23dacb811652ad4full, 0xc982da480e0d4c7dull, 0x3a9c8ed5a399d0a9ull, 0x951b8d084691d4e4ull },
+	{     841,      29, 0x6178504e, 0x38fffe7f3680d63cull, 0xd513325255a7a6d1ull, 0x31ed47790f6ca62full, 0xc801faaa0a2e331full, 0x491dbc58279c7f88ull, 0x9c0178848321c97aull, 0x9d934f814f4d6a3cull },
+	{     900,      30, 0xbd4c3637, 0xb7477bf0b9ce37c6ull, 0x63b1c580a7fd02a4ull, 0x0f6433b9f10a5dacull, 0x68dd76db9d64eca7ull, 0x0036297682b64b67ull, 0x42b192d71f414b7aull, 0x79692cef44fa0206ull },
+	{     961,      31, 0x6e7ac474, 0x55bdb0e71e3edebdull, 0xc7ab562bcf0568bcull, 0x43166332f9ee684full, 0xb2e25964cd409117ull, 0xa010599d6287c412ull, 0xfa5d6461e768dda2ull, 0xcb3ce74e8ec4f906ull },
+	{    1024,      32, 0x1fb4b518, 0x0782fa1b08b475e7ull, 0xfb7138951c61b23bull, 0x9829105e234fb11eull, 0x9a8c431f500ef06eull, 0xd848581a580b6c12ull, 0xfecfe11e13a2bdb4ull, 0x6c4fa0273d7db08cull },
+	{    1089,      33, 0x31d13d6d, 0xc5dc19b876d37a80ull, 0x15ffcff666cfd710ull, 0xe8c30c72003103e2ull, 0x7870765b470b2c5dull, 0x078a9103ff960d82ull, 0x7bb50ffc9fac74b3ull, 0x477e70ab2b347db2ull },
+	{    1156,      34, 0x26fa72e3, 0x5e1141711d2d6706ull, 0xb537f6dee8de6933ull, 0x3af0a1fbbe027c54ull, 0xea349dbc16c2e441ull, 0x38a7455b6a877547ull, 0x5f97b9750e365411ull, 0x0e8cde7f93af49a3ull },
+	{    1225,      35, 0x6a7433bf, 0x782edf6da001234full, 0x0f48cbd5c66c48f3ull, 0x808754d1e64e2a32ull, 0x5d9dde77353b1a6dull, 0x11f58c54581fa8b1ull, 0xda90fa7c28c37478ull, 0x5e9a2eafc670a88aull },
+	{    1296,      36, 0x4e6df758, 0xd26285842ff04d44ull, 0x8f38d71341eacca9ull, 0x5ca436f4db7a883cull, 0xbf41e5376b9f0eecull, 0x2252d21eb7e1c0e9ull, 0xf4b70a971855e732ull, 0x40c7695aa3662afdull },
+	{    1369,      37, 0xd57f63ea, 0xc6ab830865a6bae6ull, 0x6aa8e8dd4b98815cull, 0xefe3846713c371e5ull, 0xa1924cbf0b5f9222ull, 0x7f4872369c2b4258ull, 0xcd6da30530f3ea89ull, 0xb7f8b9a704e6cea1ull },
+	{    1444,      38, 0x52ef73b3, 0x044b3a1929232892ull, 0x061dca0e914fc217ull, 0xa607cc142096b964ull, 0xf7dbc8433c89b274ull, 0x2f5f70581c9b7d32ull, 0x39bf5e5fec82dccaull, 0x8ade56388901a619ull },
+	{    1521,      39, 0x03cb36c3, 0x4b603d7932a8de4full, 0xfae64c464b8a8f45ull, 0x8fafab75661d602aull, 0x8ffe870ef4adc087ull, 0x65bea2be41f55b54ull, 0x082f3503f636aef1ull, 0x5f78a282378b6bb0ull },
+	{    1600,      40, 0x72c39bea, 0x4ec0b54cf1566affull, 0x30d2c7269b206bf4ull, 0x77c22e82295e1061ull, 0x3df9b04434771542ull, 0xfeddce785ccb661full, 0xa644aff716928297ull, 0xdd46aee73824b4edull },
+	{    1681,      41, 0xa65aa25c, 0xed8b7a4b34954ff7ull, 0x56432de31f4ee757ull, 0x85bd3abaa572b155ull, 0x7d2c38a926dc1b88ull, 0x5245b9eb4cd6791dull, 0xfb53ab03b9ad0855ull, 0x3664026c8fc669d7ull },
+	{    1764,      42, 0x74740539, 0x5d28b43694176c26ull, 0x714cc8bc12d060aeull, 0x3437726273a83fe6ull, 0x864b1b28ec16ea86ull, 0x6a78a5a4039ec2b9ull, 0x08e959533e35a766ull, 0x347b7c22b75ae65full },
+	{    1849,      43, 0xc3ae3c26, 0x6a1ef3639e1d202eull, 0x919bc1bd145ad928ull, 0x30f3f7e48c28a773ull, 0x2e8c49d7c7aaa527ull, 0x5e2328fc8701db7cull, 0x89ef1afca81f7de8ull, 0xb1857db11985d296ull },
+	{    1936,      44, 0xf29db8a2, 0x159f4d9e0307b111ull, 0x03e17914a5675a0cull, 0xaf849bd425047b51ull, 0x3b69edadf357432bull, 0x3a2e311c121e6bf2ull, 0x380fad1e288d57e5ull, 0xbf7c7e8ef0e3b83aull },
+	{    2025,      45, 0x1ef4cbf4, 0xcc0a840725a7e25bull, 0x57c69454396e193aull, 0x976eaf7eee0b4540ull, 0xcd7a46850b95e901ull, 0xc57f7d060dda246full, 0x6b9406ead64079bfull, 0x11b28e20a573b7bdull },
+	{    2116,      46, 0xa9be6c41, 0xa2b27ee22f63c3f1ull, 0x9ebde0ce1b3976b2ull, 0x2fe6a92a257af308ull, 0x8c1df927a930af59ull, 0xa462f4423c9e384eull, 0x236542255b2ad8d9ull, 0x595d201a2c19d5bcull },
+	{    2209,      47, 0x0fa31801, 0xd8f2f234899bcab3ull, 0xb10b037297c3a168ull, 0xdebea2c510ceda7full, 0x9498fefb890287ceull, 0xae68c2be5b1a69a6ull, 0x6189dfba34ed656cull, 0x91658f95836e5206ull },
+	{    2304,      48, 0x8331c5d8, 0x584f28543864844full, 0xd7cee9fc2d46f20dull, 0xa38dca5657387205ull, 0x7a0b6dbab9a14e69ull, 0xc6d0a9d6b0e31ac4ull, 0x0a674d85812c7cf6ull, 0x63538c0351049940ull },
+	{    2401,      49, 0xe9876db8, 0xa94be46dd9aa41afull, 0xa57e5b7723d3f9bdull, 0x0034bf845a52fd2full, 0x843b58463c8df0aeull, 0x74b258324e916045ull, 0xbdd7353230eb2b38ull, 0xfad31fced7abade5ull },
+	{    2500,      50, 0x27b0604e, 0x9a87bea227491d20ull, 0xa468657e2b9c43e7ull, 0xaf9ba60db8d89ef7ull, 0xcc76f429ea7a12bbull, 0x5f30eaf2bb14870aull, 0x434e824cb3e0cd11ull, 0x431a4d382e39d16eull },
+	{    2601,      51, 0xdcec07f2, 0x27688c24958d1a5cull, 0xe3b4a1c9429cf253ull, 0x48a95811f70d64bcull, 0x328063229db22884ull, 0x67e9c95f8ba96028ull, 0x7c6bf01c60436075ull, 0xfa55161e7d9030b2ull },
+	{    2704,      52, 0xcff0a82a, 0x5d1d37790a1873adull, 0xed9cd4bcc5fa1090ull, 0xce51cde05d8cd96aull, 0xf72c26e624407e66ull, 0xa0eb541bdbc6d409ull, 0xc3f40a2f40b3b213ull, 0x6a784de68794492dull },
+	{    2809,      53, 0xfec83621, 0x1f03fd18b711eea9ull, 0x566d89b1946d381aull, 0x6e96e83fc92563abull, 0x405f66cf8cae1a32ull, 0xd7261740d8f18ce6ull, 0xfea3af64a413d0b2ull, 0xd64d1810e83520feull },
+	{    2916,      54, 0x0743d8dc, 0xf0316f286cf527b6ull, 0xf84c29538de1aa5aull, 0x7612ed3c923d4a71ull, 0xd4eccebe9393ee8aull, 0x2eb7867c2318cc59ull, 0x1ce621fd700fe396ull, 0x686450d7a346878aull },
+	{    3025,      55, 0x64d41d26, 0x297008bcb3e3401dull, 0x61a8e407f82b0c69ull, 0xa4a35bff0524fa0eull, 0x7a61d8f552a53442ull, 0x821d1d8d8cfacf35ull, 0x7cc06361b86d0559ull, 0x119b617a8c2be199ull },
+	{    3136,      56, 0xacd90c81, 0x043c6252411ee3beull, 0xb4ca1b8077777168ull, 0x2746dc3f7da1737full, 0x2247a4b2058d1c50ull, 0x1b3fa184b1d7bcc0ull, 0xdeb85613995c06edull, 0xcbe1d957485a3ccdull },
+	{    3249,      57, 0x7c746a4b, 0xce38a9a54fad6599ull, 0x6d6f4a90b9e8755eull, 0xc3ecc79ff105de3full, 0x0e8b9ee96efa2d0eull, 0x90122905c4ab5358ull, 0x84f80c832d71979cull, 0x229310f3ffbbf4c6ull },
+	{    3364,      58, 0xb1047e99, 0x0270a9305fef70cfull, 0x600193999d884f3aull, 0x0f4d49eae09ed8a1ull, 0x2e091b85660f1298ull, 0xbfe37fae1cdd64c9ull, 0x8dddfbab930f6494ull, 0x02ccf4b08f5d417aull },
+	{    3481,      59, 0xd1fd1068, 0xe71be7c28e84d119ull, 0xeb6ace59932736e6ull, 0x70c4397807ba12c5ull, 0x7a9d77781ac53509ull, 0x4489c3ccfda3b39cull, 0xfa722d4f243b4964ull, 0x25f15800bffdd122ull },
+	{    3600,      60, 0x56486077, 0xb5b58c24b53aaa19ull, 0xd2a6ab0773dd897full, 0xef762fe01ecb5b97ull, 0x9deefbcfa4cab1f1ull, 0xb58f5943cd2492baull, 0xa96dcc4d1f4782a7ull, 0x102b62a82309dde5ull },
+	{    3721,      61, 0x6069be80, 0x44dd59bd301995cfull, 0x3ccabd76493ada1aull, 0x540db4c87d55ef23ull, 0x0cfc6d7adda35797ull, 0x14c7d1f32332cf03ull, 0x2d553ffbff3be99dull, 0xc91c4ee0cb563182ull },
+	{    3844,      62, 0x2078359b, 0xb4d4789eb6f2630bull, 0xbf6973263ce8ef0eull, 0x0d1c75c50844b9d3ull, 0xbce905900c1ec6eaull, 0xc30f304f4045487dull, 0xa5c550166b3a142bull, 0x2f482b4e35327287ull },
+	{    3969,      63, 0x9ea21004, 0x12807833c463737cull, 0x58e927ea3b3776b4ull, 0x72dd20ef1c2f8ad0ull, 0x910b610de7a967bfull, 0x801bc862120f6bf5ull, 0x9653efeed5897681ull, 0xf5367ff83e9ebbb3ull },
+	{    4096,      64, 0x9c9cfe88, 0xe88419922b87176full, 0xbcf32f41a7ddbf6full, 0xd6ebefd8085c1a0full, 0xd1d44fe99451ef72ull, 0xec951ba8e51e3545ull, 0xc0ca86b360746e96ull, 0xaa679cc066a8040bull },
+	{    4225,      65, 0xb70a6ddd, 0x105191e0ec8f7f60ull, 0x5918dbfcca971e79ull, 0x6b285c8a944767b9ull, 0xd3e86ac4f5eccfa4ull, 0x0e5399df2b106ca1ull, 0x814aadfacd217f1dull, 0x2754e3def1c405a9ull },
+	{    4356,      66, 0xdea37298, 0xa5b88bf7399a9f07ull, 0xfca3ddfd96461cc4ull, 0xebe738fdc0282fc6ull, 0x69afbc800606d0fbull, 0x6104b97a9db12df7ull, 0xfcc09198bb90bf9full, 0xc5e077e41a65ba91ull },
+	{    4489,      67, 0x8f480819, 0xd08c3f5747d84f50ull, 0x4e708b27d1b6f8acull, 0x70f70fd734888606ull, 0x909ae019d761d019ull, 0x368bf4aab1b86ef9ull, 0x308bd616d5460239ull, 0x4fd33269f76783eaull },
+	{    4624,      68, 0x030b3b16, 0x2f72d12a40044b4bull, 0x889689352fec53deull, 0x0f03e6ad87eb2f36ull, 0xef79f28d874b9e2dull, 0xb512089e8e63b76cull, 0x24dc06833bf193a9ull, 0x3c23308ba8e99d7eull },
+	{    4761,      69, 0xf31bc4e8, 0xaa1f61fdc5c2e11eull, 0xc2c56cd11277ab27ull, 0xa1e73069fdf1f94full, 0x8184bab36bb79df0ull, 0xc81929ce8655b940ull, 0x301b11bf8a4d8ce8ull, 0x73126fd45ab75de9ull },
+	{    4900,      70, 0x419f953b, 0x9489b36fe2246244ull, 0x3355367033be74b8ull, 0x5f57c2277cbce516ull, 0xbc61414f9802ecafull, 0x8edd1e7a50562924ull, 0x48f4ab74a35e95f2ull, 0xcc1afcfd99a180e7ull },
+	{    5041,      71, 0x20e9e76d, 0x358d7c0476a044cdull, 0xe0b7b47bcbd8854full, 0xffb42ec696705519ull, 0xd45e44c263e95c38ull, 0xdf61db53923ae3b1ull, 0xf2bc948cc4fc027cull, 0x8a8000c6066772a3ull },
+	{    5184,      72, 0x646f0ff8, 0xb0c48df14275265aull, 0x9da4448975905efaull, 0xd716618e414ceb6dull, 0x30e888af70df1e56ull, 0x4bee54bd47274f69ull, 0x178b4059e1a0afe5ull, 0x6e2c96b7f58e5178ull },
+	{    5329,      73, 0xeeb7eca8, 0xdaa70bb300956588ull, 0x410ea6883a240c6dull, 0xf5c8239fb5673eb3ull, 0x8b1d7bb4903c105full, 0xcfb1c322b73891d4ull, 0x5f3b792b22f07297ull, 0xfd64061f8be86811ull },
+	{    5476,      74, 0x08112bb9, 0x4ec97a20b6c4c7c2ull, 0x5913b1cd454f29fdull, 0xa9629f9daf06d685ull, 0x0852c9499156a8f3ull, 0x3a180a6abfb79016ull, 0x9fc3c4764037c3c9ull, 0x2890c42fc0d972cfull },
+	{    5625,      75, 0x85a6d477, 0x5c3323628435a2e8ull, 0x1bea45ce9e72a6e3ull, 0x904f0a7027ddb52eull, 0x939f31de14dcdc7bull, 0x0a68fdf4379df068ull, 0xf169e1f0b835279dull, 0x7498e432f9619b27ull },
+	{    5776,      76, 0x56f76c84, 0xc1ef26bea260abdbull, 0x6ee423f2137f9280ull, 0xdf2118b946ed0b43ull, 0x11b87fb1b900cc39ull, 0xe33e59b90dd815b1ull, 0xaa6cb5c4bafae741ull, 0x739699951ca8c713ull },
+	{    5929,      77, 0x9af45d55, 0x6be7381b115d653aull, 0xed046190758ea511ull, 0xde6a45ffc3ed1159ull, 0xa64760e4041447d0ull, 0xe3eac49f3e0c5109ull, 0xdd86c4d4cb6258e2ull, 0xefa9857afd046c7full },
+	{    6084,      78, 0xd1c33760, 0xae3eece1711b2105ull, 0x14fd3f4027f81a4aull, 0xabb7e45177d151dbull, 0x501f3e9b18861e44ull, 0x465201170074e7d8ull, 0x96d5c91970f2cb12ull, 0x40fd28c43506c95dull },
+	{    6241,      79, 0xc56bbf69, 0x376c28588b8fb389ull, 0x6b045e84d8491ed2ull, 0x4e857effb7d4e7dcull, 0x154dd79fd2f984b4ull, 0xf11171775622c1c3ull, 0x1fbe30982e78e6f0ull, 0xa460a15dcf327e44ull },
+	{    6400,      80, 0xabecfb9b, 0x58d943503bb6748full, 0x419c6c8e88ac70f6ull, 0x586760cbf3d3d368ull, 0xb7e164979d5ccfc1ull, 0x12cb4230d26bf286ull, 0xf1bf910d44bd84cbull, 0x00b32c24c6a40272ull },
+	{    6561,      81, 0x8de13255, 0xdfff5989f5cfd9a1ull, 0xbcee2e7ea3a96f83ull, 0x681c7874adb29017ull, 0x3ff6c8ac7c36b63aull, 0x48bc8831d849e326ull, 0x30b078e76b0214e2ull, 0x42954e6ad721b920ull },
+	{    6724,      82, 0xa98ee299, 0x7fb19eb1a496e8f5ull, 0xd49e5dfdb5c0833full, 0xc0d5d7b2f7c48dc7ull, 0x1a57313a32f22ddeull, 0x30af46e49850bf8bull, 0xaa0fe8d12f808f83ull, 0x443e31d70873bb6bull },
+	{    6889,      83, 0x3015f556, 0x5dba5b0dadccdbaaull, 0x4ba8da8ded87fcdcull, 0xf693fdd25badf2f0ull, 0xe9029e6364286587ull, 0xae69f49ecb46726cull, 0x18e002679217c405ull, 0xbd6d66e85332ae9full },
+	{    7056,      84, 0x5a430e29, 0x688bef4b135a6829ull, 0x8d31d82abcd54e8eull, 0xf95f8a30d55036d7ull, 0x3d8c90e27aa2e147ull, 0x2ec937ce0aa236b4ull, 0x89b563996d3a0b78ull, 0x39b02413b23c3f08ull },
+	{    7225,      85, 0x2797add0, 0xd8323be05433a412ull, 0x8d48fa2b2b76141dull, 0x3d346f23978336a5ull, 0x4d50c7537562033full, 0x57dc7625b61dfe89ull, 0x9723a9f4c08ad93aull, 0x5309596f48ab456bull },
+	{    7396,      86, 0x27d55016, 0x3b5404278a55a7fcull, 0x23ca0b327c2d0a81ull, 0xa6d65329571c892cull, 0x45504801e0e6066bull, 0x86e6c6d6152a3d04ull, 0x4f3db1c53eca2952ull, 0xd24d69b3e9ef10f3ull },
+	{    7569,      87, 0x84945a82, 0x2a96a3f96c5e9bbcull, 0x8caf8566e212dda8ull, 0x904de559ca16e45eull, 0xf13bc2d9c2fe222eull, 0xbe4ccec9a6cdccfdull, 0x37b2cbdd973a3ac9ull, 0x7b3223cd9c9497beull },
+	{    7744,      88, 0x3ef7e224, 0x22bebfdcc26d18ffull, 0x4b4d8dcb10807ba1ull, 0x40265eee30c6b896ull, 0x3752b423073b119aull, 0x377dc5eb7c662bdbull, 0x2b9f07f93a6c25b9ull, 0x96f24ede2bdc0718ull },
+	{    7921,      89, 0x35ed8dc8, 0x627a2249ec6bbcc2ull, 0xc0578b462a46735aull, 0x4974b8ee1c2d4f1full, 0xebdbb918eb6d837full, 0x8fb5f218dd84147cull, 0xc77dd1f881df2c54ull, 0x62eac298ec226dc3ull },
+	{    8100,      90, 0x6a75e43d, 0x3abaf1667ba2f3e0ull, 0x0ee78476b5eeadc1ull, 0x7e56ac0a6ca4f3f4ull, 0xf1b9b413df9d79edull, 0xa7621b6fd02db503ull, 0xd92f7ba9928a4ffeull, 0x53f56babdcae96a6ull },
+	{    8281,      91, 0x235d9805, 0x3931ac68c5f1b2c9ull, 0xefe3892363ab0fb0ull, 0x40b707268337cd36ull, 0xa53a6b64b1ac85c9ull, 0xd50e7f86ee1b832bull, 0x7bab08fdd26ba0a4ull, 0x7587743c18fe2475ull },
+	{    8464,      92, 0xf7d69572, 0xb98fb0606f416754ull, 0x46a6e5547ba99c1eull, 0x0c909d82112a8ed2ull, 0xdbfaae9642b3205aull, 0xf676a1339402bcb9ull, 0xf4f12a5b1ac11f29ull, 0x7db8bad81249dee4ull },
+	{    8649,      93, 0xbacd0199, 0x7f7729a33e58fcc4ull, 0x2e4bc1e7a023ead4ull, 0xe707008ea7ca6222ull, 0x47418a71800334a0ull, 0xd10395d8fc64d8a4ull, 0x08257a30062cb66full, 0x6786f9b2dc1ff18aull },
+	{    8836,      94, 0xe428f50e, 0x42a0aa9ce82848b3ull, 0x57232730e6bee175ull, 0xf89bb3f370782031ull, 0xcaa33cf9b4f6619cull, 0xb2c8648ad49c209full, 0x9e89ece0712db1c0ull, 0x101d8274a711a54bull },
+	{    9025,      95, 0x81eaaad3, 0x6b2c6d38408a4889ull, 0xde3ef6f68fb25885ull, 0x20754f456c203361ull, 0x941f5023c0c943f9ull, 0xdfdeb9564fd66f24ull, 0x2140cec706b9d406ull, 0x7b22429b131e9c72ull },
+	{    9216,      96, 0xaddbd3e3, 0x930380a3741e862aull, 0x348d28638dc71658ull, 0x89dedcfd1654ea0dull, 0x07e7f61684080106ull, 0x837ace9794582976ull, 0x5ac8ca76a357eb1bull, 0x32b58308625661fbull },
+	{    9409,      97, 0xe66dbca0, 0x94808b5d2aa25f9aull, 0xcec72968128195e0ull, 0xd9f4da2bdc1e130full, 0x272d8dd74f3006ccull, 0xec6c2ad1ec03f554ull, 0x4ad276b249a5d5ddull, 0x549a22a17c0cde12ull },
+	{    9604,      98, 0xafe11fd5, 0xb31abb08ae6e3d38ull, 0x9eb9a95cbd9e8223ull, 0x8019e79b7ee94ea9ull, 0x7b2271a7a3248e22ull, 0x3b4f700e5a0ba523ull, 0x8ebc520c227206feull, 0xda3f861490f5d291ull },
+	{    9801,      99, 0xa71a406f, 0xdccb5534a893ea1aull, 0xce71c398708c6131ull, 0xfe2396315457c164ull, 0x3f1229f4d0fd96fbull, 0x33130aa5fa9d43f2ull, 0xe42693d5b34e63abull, 0x2f4ef2be67f62104ull },
+	{   10000,     100, 0x9d90eaf5, 0x6369163565814de6ull, 0x8feb86fb38d08c2full, 0x4976933485cc9a20ull, 0x7d3e82d5ba29a90dull, 0xd5983cc93a9d126aull, 0x37e9dfd950e7b692ull, 0x80673be6a7888b87ull },
+	{   10201,     101, 0x6665db10, 0xedee4ff253d9f9b3ull, 0x96ef76fb279ef0adull, 0xa4d204d179db2460ull, 0x1f3dcdfa513512d6ull, 0x4dc7ec07283117e4ull, 0x4438bae88ae28bf9ull, 0xaa7eae72c9244a0dull },
+	{   10404,     102, 0x9c977cbf, 0x941993df6e633214ull, 0x929bc1beca5b72c6ull, 0x141fc52b8d55572dull, 0xb3b782ad308f21edull, 0x4f2676485041dee0ull, 0xbfe279aed5cb4bc8ull, 0x2a62508a467a22ffull },
+	{   10609,     103, 0xee83ddd4, 0x859838293f64cd4cull, 0x484403b39d44ad79ull, 0xbf674e64d64b9339ull, 0x44d68afda9568f08ull, 0x478568ed51ca1d65ull, 0x679c204ad3d9e766ull, 0xb28e788878488dc1ull },
+	{   10816,     104, 0x026519cc, 0xc19b5648e0d9f555ull, 0x328e47b2b7562993ull, 0xe756b92ba4bd6a51ull, 0xc3314e362764ddb8ull, 0x6481c084ee9ec6b5ull, 0x0ede23fb9a251771ull, 0xbd617f2643324590ull },
+	{   11025,     105, 0xa485a53f, 0xf963b63b9006c248ull, 0x9e9bf727ffaa00bcull, 0xc73bacc75b917e3aull, 0x2c6aa706129cc54cull, 0x17a706f59a49f086ull, 0xc7c1eec455217145ull, 0x6adfdc6e07602d42ull },
+	{   11236,     106, 0xf62bc412, 0x6a8aa0852a8c1f3bull, 0xc8f1e5e206a21016ull, 0x2aa554aed1ebb524ull, 0xfc3e3c322cd5d89bull, 0xb7e3911dc2bd4ebbull, 0xfcd6da5e5fae833aull, 0x51ed3c41f87f9118ull },
+	{   11449,     107, 0x8975a436, 0x740428b4d45e5fb8ull, 0x4c95a4ce922cb0a5ull, 0xe99c3ba78feae796ull, 0x914f1ea2fdcebf5cull, 0x9566453c07cd0601ull, 0x09841bf66d0462cdull, 0x79140c1c18536aebull },
+	{   11664,     108, 0x94ff7f41, 0x658b883b3a872b86ull, 0x2f0e303f0f64827aull, 0x0975337e23dc45e1ull, 0x99468a917986162bull, 0x7b31434aac6e0af0ull, 0xf6915c1562c7d82full, 0xe4071d82a6dd71dbull },
+	{   11881,     109, 0x760aa031, 0x6df0a977da5d27d4ull, 0x0891dd0e7cb19508ull, 0xfd65434a0b71e680ull, 0x8799e4740e573c50ull, 0x9e739b52d0f341e8ull, 0xcdfd34ba7d7b03ebull, 0x5061812ce6c88499ull },
+	{   12100,     110, 0x3bda76df, 0xa900275464ae07efull, 0x11f2cfda34beb4a3ull, 0x09abf91e5a1c38e4ull, 0x8063d80ab26f3d6dull, 0x4177b4b9b4f0393full, 0x6de42ba8672b9640ull, 0x0d0bccdb72c51c18ull },
+	{   12321,     111, 0x498e2e65, 0x810bc8aa0c40bcb0ull, 0x448a019568d01441ull, 0xf60ec52f60d3aeaeull, 0x52c44837aa6dfc77ull, 0x15d8d8fccdd6dc5bull, 0x345b793ccfa93055ull, 0x932160fe802ca975ull },
+	{   12544,     112, 0xd38deb48, 0x22036327deb59ed7ull, 0xadc05ceb97026a02ull, 0x48bff0654262672bull, 0xc791b313aba3f258ull, 0x443c7757a4727beeull, 0xe30e4b2372171bdfull, 0xf3db986c4156f3cbull },
+	{   12769,     113, 0x82b3fb6b, 0x7d14dfa9772b00c8ull, 0x595735efc7eeaed7ull, 0x29872854f94c3507ull, 0xbc241579d8348401ull, 0x16dc832804d728f0ull, 0xe9cc71ae64e3f09eull, 0xbef634bc978bac31ull },
+	{   12996,     114, 0xe500e25f, 0x2d777cddb912675dull, 0x278d7b10722a13f9ull, 0xf5c02bfb7cc078afull, 0x4283001239888836ull, 0xf44ca39a6f79db89ull, 0xed186122d71bcc9full, 0x8620017ab5f3ba3bull },
+	{   13225,     115, 0xbd2bb07c, 0xf2ec98824e8aa613ull, 0x5eb7e3fb53fe3bedull, 0x12c22860466e1dd4ull, 0x374dd4288e0b72e5ull, 0xff8916db706c0df4ull, 0xcb1a9e85de5e4b8dull, 0xd4d12afb67a27659ull },
+	{   13456,     116, 0x3a2b431d, 0x5e763988e21f487full, 0x24189de8065d8dc5ull, 0xd1519d2403b62aa0ull, 0x9136456740119815ull, 0x4d8ff7733b27eb83ull, 0xea3040bc0c717ef8ull, 0x07617ab400dfadbcull },
+	{   13689,     117, 0x7322a83d, 0x48949dc327bb96adull, 0xe1fd21636c5c50b4ull, 0x3f6eb7f13a8712b4ull, 0x14cf7f02dab0eee8ull, 0x6d01750605e89445ull, 0x4f1cf4006e613b78ull, 0x57c40c4db32bec3bull },
+	{   13924,     118, 0xa645ca1c, 0xb7c4209fb24a85c5ull, 0xb35feb319c79ce10ull, 0xf0d3de191833b922ull, 0x570d62758ddf6397ull, 0x5e0204fb68a7b800ull, 0x4383a9236f8b5a2bull, 0x7bc1a64641d803a4ull },
+	{   14161,     119, 0x8909a45a, 0x9c9e5be0943d4b05ull, 0xb73dc69e45201cbbull, 0xaab17180bfe5083dull, 0xc738a77a9a55f0e2ull, 0x705221addedd81dfull, 0xfd9bd8d397abcfa3ull, 0x8ccf0004aa86b795ull },
+	{   14400,     120, 0xbd30074c, 0x3898bca4dfd6638dull, 0xf911ff35efef0167ull, 0x24bdf69e5091fc88ull, 0x9b82567ab6560796ull, 0x891b69462b41c224ull, 0x8eccc7e4f3af3b51ull, 0x381e54c3c8f1c7d0ull },
+	{   14641,     121, 0xc17cf001, 0x5b5d2557400e68e7ull, 0x098d610033574ceeull, 0xdfd08772ce385debull, 0x3c13e894365dc6c2ull, 0x026fc7bbcda3f0efull, 0xdbb71106cdbfea36ull, 0x785239a742c6d26dull },
+	{   14884,     122, 0x26ffd25a, 0xa927ed8b2bf09bb6ull, 0x606e52f10ae94ecaull, 0x71c2203feb35a9eeull, 0x06e65ec14a8fb565ull, 0x34bff6f2ee5a7f79ull, 0x02e329a5be2c011bull, 0x73161c93331b14f9ull },
+	{   15129,     123, 0xf1d8ce3c, 0x8d25746414aedf28ull, 0x34b1629d28b33d3aull, 0x4d5394aea5f82d7bull, 0x379f76458a3c8957ull, 0x79dd080f9843af77ull, 0xc46f0a7847f60c1dull, 0xaf1579c5797703ccull },
+	{   15376,     124, 0x3ee8fb17, 0xb5bbdb73458712f2ull, 0x1ff887b3c2a35137ull, 0x7f7231f702d0ace9ull, 0x1e6f0910c3d25bd8ull, 0xad9e250862102467ull, 0x1c842a07abab30cdull, 0xcd8124176bac01acull },
+	{   15625,     125, 0xa77acc2a, 0x3d32a26e3ab9d254ull, 0xfc4070574dc30d3aull, 0xf02629579c2b27c9ull, 0xb1cf09b0184a4834ull, 0x5c03db48eb6cc159ull, 0xf18c7fcf34d1df47ull, 0xdfb043419ecf1fa9ull },
+	{   15876,     126, 0xf4556dee, 0x9371d3c35fa5e9a5ull, 0x0042967cf4d01f30ull, 0x652d1eeae704145cull, 0xceaf1a0d15234f15ull, 0x01450a54e45ba9b9ull, 0x65e9c1fd885aa932ull, 0x354d4bc034ba8cbeull },
+	{   16129,     127, 0xde287a64, 0xcbaa3cb8f64f54e0ull, 0x76c3b48ee5c08417ull, 0x09f7d24e87e61ce9ull, 0x85b8e53f22e19507ull, 0xbb57137739ca486bull, 0xc77f131cca38f761ull, 0xc56ac3cf275be121ull },
+	{   16384,     128, 0x878e55b9, 0xb2e23e8116c2ba9full, 0x7e4d9c0060101151ull, 0x3310da5e5028f367ull, 0xadc52dddb76f6e5eull, 0x4aad4e925a962b68ull, 0x204b79b7f7168e64ull, 0xdf29ed6671c36952ull },
+	{   16641,     129, 0x07648486, 0x8aa77f52d7868eb9ull, 0x4d55bd587584e6e2ull, 0x0d2db37041f495f5ull, 0x0ce030d15b5fe2f4ull, 0x86b4a7a0780c2431ull, 0xee070a9ae5b51db7ull, 0xedc293d9595be5d8ull },
+	{   16900,     130, 0x57ac0fb1, 0x858fea922c7fe0c3ull, 0xcfe8326bf733bc6full, 0x4e5e2018cf8f7dfcull, 0x64fd1bc011e5bab7ull, 0x5c9e858728015568ull, 0x97ac42c2b00b29b1ull, 0x7f89caf08c109aeeull },
+	{   17161,     131, 0xd01967ca, 0x46ef25fdec8392b1ull, 0xe48d7b6d42a5cd35ull, 0x56a6fe1c175299caull, 0xfdfa836b41dcef62ull, 0x2f8db8030e847e1bull, 0x5ba0a49ac4f9b0f8ull, 0xdae897ed3e3fce44ull },
+	{   17424,     132, 0x96ecdf74, 0x8d078f726b2df464ull, 0xb50ee71cdcabb299ull, 0xf4af300106f9c7baull, 0x7d222caae025158aull, 0xcc028d5fd40241b9ull, 0xdd42515b639e6f97ull, 0xe08e86531a58f87full },
+	{   17689,     133, 0x779f5506, 0x35ea86e6960ca950ull, 0x34fe1fe234fc5c76ull, 0xa00207a3dc2a72b7ull, 0x80395e48739e1a67ull, 0x74a67d8f7f43c3d7ull, 0xdd2bdd1d62246c6eull, 0xa1f44298ba80acf6ull },
+	{   17956,     134, 0x3c94c2de, 0x8aee9edbc15dd011ull, 0x51f5839dc8462695ull, 0xb2213e17c37dca2dull, 0x133b299a939745c5ull, 0x796e2aac053f52b3ull, 0xe8d9fe1521a4a222ull, 0x819a8863e5d1c290ull },
+	{   18225,     135, 0x39f98faf, 0xc3e142ba98432ddaull, 0x911d060cab126188ull, 0xb753fbfa8365b844ull, 0xfd1a9ba5e71b08a2ull, 0x7ac0dc2ed7778533ull, 0xb543161ff177188aull, 0x492fc08a6186f3f4ull },
+	{   18496,     136, 0x7af31199, 0x123ba6b99c8cd8dbull, 0x448e582672ee07c4ull, 0xcebe379292db9e65ull, 0x938f5bbab544d3d6ull, 0xd2a95f9f2d376d73ull, 0x68b2f16149e81aa3ull, 0xad7e32f82d86c79dull },
+	{   18769,     137, 0xe341a9d6, 0xba87acef79d14f53ull, 0xb3e0fcae63a11558ull, 0xd5ac313a593a9f45ull, 0xeea5f5a9f74af591ull, 0x578710bcc36fbea2ull, 0x7a8393432188931dull, 0x0705cfc5ec7cc172ull },
+	{   19044,     138, 0xca24aeeb, 0x0bcd3957d5717dc3ull, 0x2da746741b03a007ull, 0x873816f4b1ece472ull, 0x2b826f1a2c08c289ull, 0xda50f56863b55e74ull, 0xb18712f6b3eed83bull, 0xbdc7cc05ab4c685full },
+	{   19321,     139, 0xb2252b57, 0x61442ff55609168eull, 0x6447c5fc76e8c9cfull, 0x6a846de83ae15728ull, 0xeffc2663cffc777full, 0x93214f8f463afbedull, 0xa156ef06066f4e4eull, 0xa407b6ed8769d51eull },
+	{   19600,     140, 0x72c81da1, 0xdbe4b1b2d174757full, 0x506512da18712656ull, 0x06857f3e0b8dd95full, 0x5a4fc2728a9bb671ull, 0xebb971522ec38759ull, 0x1a5a093e6cf1f72bull, 0x729b057fe784f504ull },
+	{   19881,     141, 0x6b9fce95, 0x531e8e77b363161cull, 0xeece0b43e2dae030ull, 0x8294b82c78f34ed1ull, 0xe777b1fd580582f2ull, 0x7b880f58da112699ull, 0x562c6b189a6333f4ull, 0x0139d64f88a611d4ull },
+	{   20164,     142, 0x19399857, 0xf71e9c926d711e2bull, 0xd77af2853a4ceaa1ull, 0x9aa0d6d76a36fae7ull, 0x0dd16cd0fbc08393ull, 0x29a414a5d8c58962ull, 0x72793d8d1022b5b2ull, 0x2e8e69cf7cbffdf0ull },
+	{   20449,     143, 0x3c57a994, 0xcb20ac28f52df368ull, 0xe6705ee7880996deull, 0x9b665cc3ec6972f2ull, 0x4260e8c254e9924bull, 0xf197a6eb4591572dull, 0x8e867ff0fb7ab27cull, 0xf95502fb503efaf3ull },
+	{   20736,     144, 0xc053e729, 0xe4a794b4acb94b55ull, 0x89795358057b661bull, 0x9c4cdcec176d7a70ull, 0x4890a83ee435bc8bull, 0xd8c1c00fceb00914ull, 0x9e7111ba234f900full, 0xeb8dbab364d8b604ull },
+	{   21025,     145, 0x51cbbba7, 0xcb942e91443e7208ull, 0xe335de8125567c2aull, 0xd4d74d268b86df1full, 0x8ba0fdd2ffc8b239ull, 0xf413b366c1ffe02full, 0xc05b2717c59a8a28ull, 0x981188eab4fcc8fbull },
+	{   21316,     146, 0x1acde79a, 0xecca7563c203f7baull, 0x177ae2423ef34bb2ull, 0xf60b7243400c5731ull, 0xcf1edbfe7330e94eull, 0x881945906bcb3cc6ull, 0x4acf0293244855daull, 0x65ae042c1c2a28c2ull },
+	{   21609,     147, 0x2d160d13, 0x1652cb940177c8b5ull, 0x8c4fe7d85d2a6d6dull, 0xf6216ad097e54e72ull, 0xf6521b912b368ae6ull, 0xa9fe4eff81d03e73ull, 0xd6f623629f80d1a3ull, 0x2b9604f32cb7dc34ull },
+	{   21904,     148, 0x787f5801, 0x31fed0fc04c13ce8ull, 0x3d5d03dbf7ff240aull, 0x727c5c9b51581203ull, 0x6b5ffc1f54fecb29ull, 0xa8e8e7ad5b9a21d9ull, 0xc4d5a32cd6aac22dull, 0xd7e274ad22d4a79aull },
+	{   22201,     149, 0xc9629828, 0xe7b668947590b9b3ull, 0xbaa41ad32938d3faull, 0xabcbc8d4ca4b39e4ull, 0x381ee1b7ea534f4eull, 0xda3759828e3de429ull, 0x3e015d76729f9955ull, 0xcbbec51a6485fbdeull },
+	{   22500,     150, 0xbe139231, 0x1de2119923e8ef3cull, 0x6ab27c096cf2fe14ull, 0x8c3658edca958891ull, 0x04cc8ed3ada5f0f2ull, 0x4a496b77c1f1c04eull, 0x9085b0a862084201ull, 0xa1894bde9e3dee21ull },
+	{   22801,     151, 0x7df699ef, 0x1269df1e69e14fa7ull, 0x992f9d58ac5041b7ull, 0xe97fcf695a7cbbb4ull, 0xe5d0549802d15008ull, 0x424c134ecd0db834ull, 0x6fc44fd91be15c6cull, 0xa1a5ef95d50e537dull },
+	{   23104,     152, 0x8ce6b96d, 0x820826d7aba567ffull, 0x1f73d28e036a52f3ull, 0x41c4c5a73f3b0893ull, 0xaa0d74d4a98db89bull, 0x36fd486d07c56e1dull, 0xd0ad23cbb6660d8aull, 0x1264a84665b35e19ull },
+	{   23409,     153, 0x6f9ed99c, 0xffe0547e4923cef9ull, 0x3534ed49b9da5b02ull, 0x548a273700fba03dull, 0x28ac84ca70958f7eull, 0xd8ae575a68faa731ull, 0x2aaaee9b9dcffd4cull, 0x6c7faab5c285c6daull },
+	{   23716,     154, 0xe0244796, 0x72da8d1b11d8bc8bull, 0xba94b56b91b681c6ull, 0x4e8cc51bd9b0fc8cull, 0x43505ed133be672aull, 0xe8f2f9d973c2774eull, 0x677b9b9c7cad6d97ull, 0x4e1f5d56ef17b906ull },
+	{   24025,     155, 0x4ccf7e75, 0xd62ab4e3f88fc797ull, 0xea86c7aeb6283ae4ull, 0x0b5b93e09a7fe465ull, 0x04344a1a0134afe2ull, 0xff5c17f02b62341dull, 0x3214c6a587ce4644ull, 0xa905e7ed0629d05cull },
+	{   24336,     156, 0x915cef86, 0xd0f06c28c7b36823ull, 0x1008cb0874de4bb8ull, 0xd6c7ff816c7a737bull, 0x489b697fe30aa65full, 0x4da0fb621fdc7817ull, 0xdc43583b82c58107ull, 0x4b0261debdec3cd6ull },
+	{   24649,     157, 0x5cb59482, 0x99b7042460d72ec6ull, 0x2a53e5e2b8e795c2ull, 0x53a78132d9e1b3e3ull, 0xc043e67e6fc64118ull, 0xff0abfe926d844d3ull, 0xf2a9fe5db2e910feull, 0xce352cdc84a964ddull },
+	{   24964,     158, 0x6ca3f532, 0x4f4dfcfc0ec2bae5ull, 0x841233148268a1b8ull, 0x09248a76ab8be0d3ull, 0x334c5a25b5903a8cull, 0x4c94fef443122128ull, 0x743e7d8454655c40ull, 0x1ab1e6d1452ae2cdull },
+	{   25281,     159, 0xe24f3859, 0xfe86bf9d4422b9aeull, 0xebce89c90641ef9cull, 0x1c84e2292c0b5659ull, 0x8bde625a10a8c50dull, 0xeb8271ded1f79a0bull, 0x14dc6844f0de7a3cull, 0xf85b2f9541e7e6daull },
+	{   25600,     160, 0xadf5a9c7, 0xa90d81060932dbb0ull, 0x8acfaa88c5fbe92bull, 0x7c6f3447e90f7f3full, 0xdd52fc14c8dd3143ull, 0x1bc7508516e40628ull, 0x3059730266ade626ull, 0x0ffa526822f391c2ull },
+	{   25921,     161, 0x32264b75, 0x17938a1b0e7f5952ull, 0x22cadd2f56f8a4beull, 0x84b0d1183d5ed7c1ull, 0xc1336b92fef91bf6ull, 0x80332a3945f33fa9ull, 0xa0f68b86f726ff92ull, 0xa3db5282cf5f4c0bull },
+	{   26244,     162, 0xa64b3376, 0xde9e0cb0e16f6e6dull, 0x238e6283aa4f6594ull, 0x4fb9c914c2f0a13bull, 0x0497cb912b670f3bull, 0xd963a3f02ff4a5b6ull, 0x4fccefae11b50391ull, 0x042ba47db3f7672full },
+	{   26569,     163, 0x0d33890e, 0x6d4b876d9b146d1aull, 0xaab2d64ce8f26739ull, 0xd315f93600e83fe5ull, 0x02fe9fabdbe7fdd4ull, 0x755db249a2d81a69ull, 0xf27929f360446d71ull, 0x79a1bf957c0c1b92ull },
+	{   26896,     164, 0x926d4b63, 0xe698fa3f54e6ea22ull, 0xbd28e20e7455358cull, 0x9ace161f6ea76e66ull, 0x0d53fb7e3c93a9e4ull, 0x737ae71b051bf108ull, 0x7ac71feb84c2df42ull, 0x3d8075cd293a15b4ull },
+	{   27225,     165, 0xd51ba539, 0x7bc0deed4fb349f7ull, 0x1771aff25dc722faull, 0x19ff0644d9681917ull, 0xcf7d7f25bd70cd2cull, 0x9464ed9baeb41b4full, 0xb9064f5c3cb11b71ull, 0x237e39229b012b20ull },
+	{   27556,     166, 0x7f37636d, 0xdb4b15e88533f622ull, 0x256d6d2419b41ce9ull, 0x9d7c5378396765d5ull, 0x9040e5b936b8661bull, 0x276e08fa53ac27fdull, 0x8c944d39c2bdd2ccull, 0xe2514c9802a5743cull },
+	{   27889,     167, 0xb98026c0, 0x922834735e86ecb2ull, 0x363382685b88328eull, 0xe9c92960d7144630ull, 0x8431b1bfd0a2379cull, 0x90383913aea283f9ull, 0xa6163831eb4924d2ull, 0x5f3921b4f9084aeeull },
+	{   28224,     168, 0xb877767e, 0x30f1d72c812f1eb8ull, 0xb567cd4a69cd8989ull, 0x820b6c992a51f0bcull, 0xc54677a80367125eull, 0x3204fbdba462e606ull, 0x8563278afc9eae69ull, 0x262147dd4bf7e566ull },
+	{   28561,     169, 0x0aefae77, 0x168884267f3817e9ull, 0x5b376e050f637645ull, 0x1c18314abd34497aull, 0x9598f6ab0683fcc2ull, 0x1c805abf7b80e1eeull, 0xdec9ac42ee0d0f32ull, 0x8cd72e3912d24663ull },
+	{   28900,     170, 0x0f686911, 0x82e78596ee3e56a7ull, 0x25697d9c87f30d98ull, 0x7600a8342834924dull, 0x6ba372f4b7ab268bull, 0x8c3237cf1fe243dfull, 0x3833fc51012903dfull, 0x8e31310108c5683full },
+	{   29241,     171, 0x3deadf12, 0xaa2d6cf22e3cc252ull, 0x9b4dec4f5e179f16ull, 0x76fb0fba1d99a99aull, 0x9a62af3dbba140daull, 0x27857ea044e9dfc1ull, 0x33abce9da2272647ull, 0xb22a7993aaf32556ull },
+	{   29584,     172, 0xccf02a4e, 0x7bf5ffd7f69385c7ull, 0xfc077b1d8bc82879ull, 0x9c04e36f9ed83a24ull, 0x82065c62e6582188ull, 0x8ef787fd356f5e43ull, 0x2922e53e36e17dfaull, 0x9805f223d385010bull },
+	{   29929,     173, 0x176c1722, 0xe89c8ff9f9c6e34bull, 0xf54c0f669a49f6c4ull, 0xfc3e46f5d846adefull, 0x022f2aa3df2221ccull, 0xf66fea90f5d62174ull, 0xb75defaeaa1dd2a7ull, 0x9b994cd9a7214fd5ull },
+	{   30276,     174, 0x026f82ad, 0xa18fbcdccd11e1f4ull, 0x8248216751dfd65eull, 0x40c089f208d89d7cull, 0x0229b79ab69ae97dull, 0xa87aabc2ec26e582ull, 0xbe2b053721eb26d2ull, 0x10febd7f0c3d6fcbull },
+	{   30625,     175, 0xb5244f42, 0x2d54f40cc4088b17ull, 0x59d15633b0cd1399ull, 0xa8cc04bb1bffd15bull, 0xd332cdb073d8dc46ull, 0x272c56466868cb46ull, 0x7e7fcbe35ca6c3f3ull, 0xee8f51e5a70399d4ull },
+	{   30976,     176, 0x49a689e5, 0x69276946cb4e87c7ull, 0x62bdbe6183be6fa9ull, 0x3ba9773dac442a1aull, 0x702e2afc7f5a1825ull, 0x8c49b11ea8151fdcull, 0xcaf3fef61f5a86faull, 0xef0b2ee8649d7272ull },
+	{   31329,     177, 0x059fcdd3, 0x668174a3f443df1dull, 0x407299392da1ce86ull, 0xc2a3f7d7f2c5be28ull, 0xa590b202a7a5807bull, 0x968d2593f7ccb54eull, 0x9dd8d669e3e95decull, 0xee0cc5dd58b6e93aull },
+	{   31684,     178, 0x4f4b04e9, 0x05e29be847bd5046ull, 0xb561c7f19c8f80c3ull, 0x5e5abd5021ccaeafull, 0x7432d63888e0c306ull, 0x74bbceeed479cb71ull, 0x6471586599575fdfull, 0x6a859ad23365cba2ull },
+	{   32041,     179, 0x8b00f891, 0xcd0d79f2164da014ull, 0x4c386bb5c5d6ca0cull, 0x8e771b03647c3b63ull, 0x69db23875cb0b715ull, 0xada8dd91504ae37full, 0x46bf18dbf045ed6aull, 0xe1b5f67b0645ab63ull },
+	{   32400,     180, 0x16e114f3, 0xe0e6fc0b1628af1dull, 0x29be5fb4c27a2949ull, 0x1c3f781a604d3630ull, 0xc4af7faf883033aaull, 0x9bd296c4e9453cacull, 0xca45426c1f7e33f9ull, 0xa6bbdcf7074d40c5ull },
+	{   32761,     181, 0xd6b6dadc, 0x2058927664adfd93ull, 0x6e8f968c7963baa5ull, 0xaf3dced6fff7c394ull, 0x42e34cf3d53c7876ull, 0x09cddbb26424dc5eull, 0x64f6340a6d8eddadull, 0x2196e488eb2a3a4bull },
+	{   33124,     182, 0x897e20ac, 0xdc107285fd8e1af7ull, 0xa8641a0609321f3full, 0xdb06e89ffdc54466ull, 0xbcc7a81ed5432429ull, 0xb6d7bdc6ad2e81f1ull, 0x93605ec471aa37dbull, 0xa2a73f8a85a8e397ull },
+	{   33489,     183, 0xf996e05d, 0xfbba1afe2e3280f1ull, 0x0755a5f392f07fceull, 0x9e44a9a15402809aull, 0x6226a32e25099848ull, 0xea895661ecf53004ull, 0x4d7e0158db2228b9ull, 0xe5a7d82922f69842ull },
+	{   33856,     184, 0xc4306af6, 0xbfa10785ddc1011bull, 0xb6e1c4d2f670f7deull, 0x517d95604e4fcc1full, 0xca6552a0dfb82c73ull, 0xb024cdf09e34ba07ull, 0x66cd8c5a95d7393bull, 0xe3939acf790d4a74ull },
+	{   34225,     185, 0x6dcad433, 0x534cc35f0ee1eb4eull, 0xb703820f1f3b3dceull, 0x0884aa164cf22363ull, 0xf14ef7f47d8a57a3ull, 0x80d1f86f2e061d7cull, 0x401d6c2f151b5a62ull, 0xe988460224108944ull },
+	{   34596,     186, 0x3c07374d, 0x07ca6e3933995dacull, 0x0fd118c77daa8188ull, 0x3aceb7b5e7da6545ull, 0xc8389799445480dbull, 0x5389f5df8aacd50dull, 0x0d136581f22fab5full, 0xc2f31f85991da417ull },
+	{   34969,     187, 0xf0f4602c, 0xf0d6044f6efd7598ull, 0xe044d6ba4369856eull, 0x91968e4f8c8a1a4cull, 0x70bd1968996bffc2ull, 0x4c613de5d8ab32acull, 0xfe1f4f97206f79d8ull, 0xac0434f2c4e213a9ull },
+	{   35344,     188, 0x3e1ea071, 0x3d69e52049879d61ull, 0x76610636ea9f74feull, 0xe9bf5602f89310c0ull, 0x8eeb177a86053c11ull, 0xe390122c345f34a2ull, 0x1e30e47afbaaf8d6ull, 0x7b892f68e5f91732ull },
+	{   35721,     189, 0x67580f0c, 0x79da242a16acae31ull, 0x0183c5f438e29d40ull, 0x6d351710ae92f3deull, 0x27233b28b5b11e9bull, 0xc7dfe8988a942700ull, 0x570ed11c4abad984ull, 0x4b4c04632f48311aull },
+	{   36100,     190, 0x4e109454, 0x461c82656a74fb57ull, 0xd84b491b275aa0f7ull, 0x8f262cb29a6eb8b2ull, 0x49fa3070bc7b06d0ull, 0xf12ed446bd0c0539ull, 0x6d43ac5d1dd4b240ull, 0x7609524fe90bec93ull },
+	{   36481,     191, 0x88a474a7, 0x053c1a66d0b13003ull, 0x731f060e6fe797fcull, 0xdaa56811791371e3ull, 0x57466046cf6896edull, 0x8ac37e0e8b25b0c6ull, 0x3e6074b52ad3cf18ull, 0xaa491ce7b45db297ull },
+	{   36864,     192, 0x05b5bedd, 0x0d3a2efec0f047e9ull, 0x1cabce58853e58eaull, 0x7a17b2eae3256be4ull, 0xc2dcc9758c910171ull, 0xcb5cddaeff4ddb40ull, 0x5d7cc5869baefef1ull, 0x9644c5853af9cfebull },
+	{   37249,     193, 0x1aaddfa7, 0x43c64d7484f7f9b2ull, 0x5da002b64aafaeb7ull, 0xb576c1e45800a716ull, 0x3ee84d3d5b4ca00bull, 0x5cbc6d701894c3f9ull, 0x0d9e946f5ae1ca95ull, 0x24ca06e67f0b1833ull },
+	{   37636,     194, 0x5be07fd8, 0xa7dec6ad81cf7fa1ull, 0x180c1ab708683063ull, 0x95e0fd7008d67cffull, 0x06b11c5073687208ull, 0x07e0a57de0d453f3ull, 0xe48c267d4f646867ull, 0x2168e9136375f9cbull },
+	{   38025,     195, 0xcbca8606, 0x05408a1df99d4affull, 0xb9565e588740f6bdull, 0xabf241813b08006eull, 0x7da9e81d89fda7adull, 0x274157cabe71440dull, 0x2c22d9a480b331f7ull, 0xe835c8ac746472d5ull },
+	{   38416,     196, 0xbde64d01, 0xa8b27a6bcaeeed4bull, 0xaec1eeded6a87e39ull, 0x9daf246d6fed8326ull, 0xd45a938b79f54e8full, 0x366b219d6d133e48ull, 0x5b14be3c25c49405ull, 0xfdd791d48811a572ull },
+	{   38809,     197, 0xee90cf33, 0x9a952a8246fdc269ull, 0xd0dcfcac74ef278cull, 0x250f7139836f0f1full, 0xc83d3c5f4e5f0320ull, 0x694e7adeb2bf32e5ull, 0x7ad09538a3da27f5ull, 0x2b5c18f934aa5303ull },
+	{   39204,     198, 0x4305c3ce, 0xc930841d1d88684full, 0x5eb66eb18b7f9672ull, 0xe455d413008a2546ull, 0xbc271bc0df14d647ull, 0xb071100a9ff2edbbull, 0x2b1a4c1cc31a119aull, 0xb5d7caa1bd946cefull },
+	{   39601,     199, 0x4b3a1d76, 0x94dc6971e3cf071aull, 0x994c7003b73b2b34ull, 0x0ea16e85978694e5ull, 0x336c1b59a1fc19f6ull, 0xc173acaecc471305ull, 0xdb1267d24f3f3f36ull, 0xe9a5ee98627a6e78ull },
+	{   40000,     200, 0xa8bb6d80, 0x07fc98006e25cac9ull, 0x77fee0484cda86a7ull, 0x376ec3d447060456ull, 0x84064a6dcf916340ull, 0xfbf55a26790e0ebbull, 0x2e7f84151c31a5c2ull, 0x9f7f6d76b950f9bfull },
+	{   40401,     201, 0x1f9fa607, 0x0bd781c4454103f6ull, 0x612197322f49c931ull, 0xb9cf17fd7e5462d5ull, 0xe38e526cd3324364ull, 0x85f2b63a5b5e840aull, 0x485d7cef5aaadd87ull, 0xd2b837a462f6db6dull },
+	{   40804,     202, 0x8d0e4ed2, 0xda60e6b14479f9dfull, 0x3bdccf69ece16792ull, 0x18ebf45c4fecfdc9ull, 0x16818ee9d38c6664ull, 0x5519fa9a1e35a329ull, 0x0cbd0001e4b08ed8ull, 0x41a965e37a0c731bull },
+	{   41209,     203, 0x1bf31347, 0x04ca56a348b6c4d3ull, 0x60618537c3872514ull, 0x2fbb9f0e65871b09ull, 0x30278016830ddd43ull, 0xf046646d9012e074ull, 0xc62a5804f6e7c9daull, 0x98d51f5830e2bc1eull },
+	{   41616,     204, 0x1ae3fc5b, 0xebd22d4b70946401ull, 0x6863602bf7139017ull, 0xc0b1ac4e11b00666ull, 0x7d2782b82bd494b6ull, 0x97159ba1c26b304bull, 0x42b3b0fd431b2ac2ull, 0xfaa81f82691c830cull },
+	{   42025,     205, 0x459c3930, 0x03cc4693d6cbcb0cull, 0x0501689ea1c70ffaull, 0x10a4353e9c89e364ull, 0x58c8aba7475e2d95ull, 0x3e2f291698c9427aull, 0xe8710d19c9de9e41ull, 0x65dda22eb04cf953ull },
+	{   42436,     206, 0xe00c4184, 0x38908e43f7ba5ef0ull, 0x1ab035d4e7781e76ull, 0x41d133e8c0a68ff7ull, 0xd1090893afaab8bcull, 0x96c4fe6922772807ull, 0x4522426c2b4205ebull, 0xefad99a1262e7e0dull },
+	{   42849,     207, 0xffc7a781, 0x34983ccc6aa40205ull, 0x21802cad34e72bc4ull, 0x01943e8fb3c17bb8ull, 0xfc947167f69c0da5ull, 0xae79cfdb91b6f6c1ull, 0x7b251d04c26cbda3ull, 0x128a33a79060d25eull },
+	{   43264,     208, 0x6a125480, 0x86215c45dcac9905ull, 0xea546afe851cae4bull, 0xd85b6457e489e374ull, 0xb7609c8e70386d66ull, 0x36e6ccc278d1636dull, 0x2f873307c08e6a1cull, 0x10f252a758505289ull },
+	{   43681,     209, 0x88a1512b, 0x420fc255c38db175ull, 0xd503cd0f3c1208d1ull, 0xd4684e74c825a0bcull, 0x4c10537443152f3dull, 0x720451d3c895e25dull, 0xaff60c4d11f513fdull, 0x881e8d6d2d5fb953ull },
+	{   44100,     210, 0x549bbbe5, 0x1d7a31f5bc8fe2f9ull, 0x4763991092dcf836ull, 0xed695f55b97416f4ull, 0xf265edb0c1c411d7ull, 0x30e1e9ec5262b7e6ull, 0xc2c3ba061ce7957aull, 0xd975f93b89a16409ull },
+	{   44521,     211, 0xc133d38c, 0x94129a84c376a26eull, 0xc245e859dc231933ull, 0x1b8f74fecf917453ull, 0xe9369d2e9007e74bull, 0xb1375915d1136052ull, 0x926c2021fe1d2351ull, 0x1d943addaaa2e7e6ull },
+	{   44944,     212, 0xfcace348, 0x1d3a9809dab05c8dull, 0x0adddeb4f71c93e8ull, 0x0ef342eb36631edbull, 0x301d7a61c4b3dbcaull, 0x861336c3f0552d61ull, 0x12c6db947471300full, 0xa679ef0ed761deb9ull },
+	{   45369,     213, 0xed7b6f9a, 0x90fa3ccbd60848daull, 0xdfa6e0595b569e11ull, 0xe585d067a1f5135dull, 0x6cef866ec295abeaull, 0xc486c0d9214beb2dull, 0xd6e490944d5fe100ull, 0x59df3175d72c9f38ull },
+	{   45796,     214, 0x6d907dda, 0x2dbb4fc71b554514ull, 0x9650e04b86be0f82ull, 0x60f2304fba9274d3ull, 0x0fcfb9443e997cabull, 0xf13310d96dec2772ull, 0x709cad2045251af2ull, 0xafd0d30cc6376dadull },
+	{   46225,     215, 0x7a4d48d5, 0xb98bf4274d18374aull, 0x1b669fd4c7f9a19aull, 0xb1f5972b88ba2b7aull, 0x73119c99e6d508beull, 0x5d4036a187735385ull, 0x8fa66e192fd83831ull, 0x2abf64b6b592ed57ull },
+	{   46656,     216, 0xe686f3db, 0xd6781d0b5e18eb68ull, 0xb992913cae09b533ull, 0x58f6021caaee3a40ull, 0xaafcb77497b5a20bull, 0x411819e5e79b77a3ull, 0xbd779579c51c77ceull, 0x58d11f5dcf5d075dull },
+	{   47089,     217, 0x0cce7c55, 0x226651cf18f4884cull, 0x595052a874f0f51cull, 0xc9b75162b23bab42ull, 0x3f44f873be4812ecull, 0x427662c1dbfaa7b2ull, 0xa207ff9638fb6558ull, 0xa738d919e45f550full },
+	{   47524,     218, 0x0f58b96b, 0xa734fb047d3162d6ull, 0xe523170d240ba3a5ull, 0x125a6972809730e8ull, 0xd396a297799c24a1ull, 0x8fee992e3069bad5ull, 0x2e3a01b0697ccf57ull, 0xee9c7390bd901cfaull },
+	{   47961,     219, 0x1bbf6f60, 0xc6df6364a24f75a3ull, 0xc294e2c84c4f5df8ull, 0xa88df65c6a89313bull, 0x895fe8443183da74ull, 0xc7f2f6f895a67334ull, 0xa0d6b6a506691d31ull, 0x24f51712b459a9f0ull },
+	{   48400,     220, 0xce5e0cc2, 0x0d8d1364c1fbcd10ull, 0x2d7cc7f54832deaaull, 0x4e22c876a7c57625ull, 0xa3d5d1137d30c4bdull, 0x1e7d706a49bdfb9eull, 0xc63282b20ad86db2ull, 0xaec97fa07916bfd6ull },
+	{   48841,     221, 0x584cfd6f, 0xaae06f9146db885full, 0x3598736441e280d9ull, 0xfba339b117083e55ull, 0xb22bf08d9f8aecf7ull, 0xc182730de337b922ull, 0x2b9adc87a0450a46ull, 0x192c29a9cfc00aadull },
+	{   49284,     222, 0x8f9bbc33, 0x8955ef07631e3bccull, 0x7d70965ea3926f83ull, 0x39aed4134f8b2db6ull, 0x882efc2561715a9cull, 0xef8132a18a540221ull, 0xb20a3c87a8c257c1ull, 0xf541b8628fad6c23ull },
+	{   49729,     223, 0xd7640d95, 0xad611c609cfbe412ull, 0xd3c00b18bf253877ull, 0x90b2172e1f3d0bfdull, 0x371a98b2cb084883ull, 0x33a2886ee9f00663ull, 0xbe9568818ed6e6bdull, 0xf244a0fa2673469aull },
+	{   50176,     224, 0x03d12a2b, 0xd5339adc295d5d69ull, 0xb633cc1dcb8b586aull, 0xee84184cf5b1aeafull, 0x89f3aab99afbd636ull, 0xf420e004f8148b9aull, 0x6818073faa797c7cull, 0xdd3b4e21cbbf42caull },
+	{   50625,     225, 0xaaeafed0, 0x40d0aeff521375a8ull, 0x77ba1ad7ecebd506ull, 0x547c6f1a7d9df427ull, 0x21c2be098327f49bull, 0x7e035065ac7bbef5ull, 0x6d7348e63023fb35ull, 0x9d427dc1b67c3830ull },
+	{   51076,     226, 0x95b9b814, 0x8b2d54ae1a3df769ull, 0x11e7adaee3216679ull, 0x3483781efc563e03ull, 0x9d097dd3152ab107ull, 0x51e21d24126e8563ull, 0xcba56cac884a1354ull, 0x39abb1b595f0a977ull },
+	{   51529,     227, 0x45fbe66e, 0x99c175819b4eae28ull, 0x932e8ff9f7a40043ull, 0xec78dcab07ca9f7cull, 0xc1a78b82ba815b74ull, 0x458cbdfc82eb322aull, 0x17f4a192376ed8d7ull, 0x6f9e92968bc8ccefull },
+	{   51984,     228, 0xb4baa7a8, 0x2a418335779b82fcull, 0xaf0295987849a76bull, 0xc12bc5ff0213f46eull, 0x5aeead8d6cb25bb9ull, 0x739315f7743ec3ffull, 0x9ab48d27111d2dccull, 0x5b87bd35a975929bull },
+	{   52441,     229, 0x83e962fe, 0x3b1fc6a3d279e67dull, 0x070ea1e49c226396ull, 0x25505adcf104697cull, 0xba1ffba29f0367aaull, 0xa20bec1dd15a8b6cull, 0xe9bf61d2dab0f774ull, 0xf4f35bf5870a049cull },
+	{   52900,     230, 0xaac3531c, 0xd97eacdf10f1c3c9ull, 0xb54f4654043a36e0ull, 0x0b128f6eb09d1234ull, 0xd8ad7ec84a9c9aa2ull, 0xe256cffed11f69e6ull, 0x2cf65e4958ad5bdaull, 0xcfbf9b03245989a7ull },
+	{   53361,     231, 0x2b1db7cc, 0x293a5c1c4e203cd4ull, 0x6b3329f1c130cefeull, 0xf2e32f8ec76aac91ull, 0x361e0a62c8187bffull, 0x6089971bb84d7133ull, 0x93df7741588dd50bull, 0xc2a9b6abcd1d80b1ull },
+	{   53824,     232, 0xcf00cd31, 0x4290e018ffaedde7ull, 0xa14948545418eb5eull, 0x72d851b202284636ull, 0x4ec02f3d2f2b23f2ull, 0xab3580708aa7c339ull, 0x0cdce066fbab3f65ull, 0xd8ed3ecf3c7647b9ull },
+	{   54289,     233, 0x7d3c43b8, 0xf919a59cbde8bf2full, 0xa56d04203b2dc5a5ull, 0x38b06753ac871e48ull, 0xc2c9fc637dbdfcfaull, 0x292ab8306d149d75ull, 0x7f436b874b9ffc07ull, 0xa5b56b0129218b80ull },
+	{   54756,     234, 0xcbd5fac6, 0x1d70a3f5521d7fa4ull, 0xfb97b3fdc5891965ull, 0x299d49bbbe3535afull, 0xe1a8286a7d67946eull, 0x052bd956f047b298ull, 0xcbd74332dd4204acull, 0x12b5be7752721976ull },
+	{   55225,     235, 0x76d0fec4, 0x6af98d7b656d0d7cull, 0xd2e99ae96d6b5c0cull, 0xf63bd1603ef80627ull, 0xbde51033ac0413f8ull, 0xbc0272f691aec629ull, 0x6204332651bebc44ull, 0x1cbf00de026ea9bdull },
+	{   55696,     236, 0x405e3402, 0x395b7a8adb96ab75ull, 0x0582df7165b20f4aull, 0xe52bd30e9ff657f9ull, 0x6c71064996cbec8bull, 0x352c535edeefcb89ull, 0xac7f0aba15cd5ecdull, 0x3aba1ca8353e5c60ull },
+	{   56169,     237, 0xc732c481, 0x3822dd82c7df012full, 0xb9029b40bd9f122bull, 0xfd25b988468266c4ull, 0x43e47bd5bab1e0efull, 0x4a71f363421f282full, 0x880b2f32a2b4e289ull, 0x1299d4eda9d3eadfull },
+	{   56644,     238, 0xa8d123c9, 0x79f7efe4a80b951aull, 0xdd3a3fddfc6c9c41ull, 0xab4c812f9e27aa40ull, 0x832954ec9d0de333ull, 0x94c390aa9bcb6b8aull, 0xf3b32afdc1f04f82ull, 0xd229c3b72e4b9a74ull },
+	{   57121,     239, 0x1e80ad7d, 0xae6e59f5f055921aull, 0x000e9d9b7bf68e82ull, 0x5ce4e4a5b269cc59ull, 0x4960111789727567ull, 0x149b8a37c7125ab6ull, 0x78c7a13ab9749382ull, 0x1c61131260ca151aull },
+	{   57600,     240, 0x52aeb863, 0x8959dbbf07387d36ull, 0xb4658afce48ea35dull, 0x8f3f82437d8cb8d6ull, 0x6566d74954986ba5ull, 0x99d5235cc82519a7ull, 0x0257a23805c2d825ull, 0xad75ccb968e93403ull },
+	{   58081,     241, 0xef7c0c18, 0x4739613234278a49ull, 0x99ea5bcd340bf663ull, 0x258640912e712b12ull, 0xc8a2827404991402ull, 0x7ee5e78550f02675ull, 0x2ec53952db5ac662ull, 0x1526405a9df6794bull },
+	{   58564,     242, 0xb6ad4b68, 0x420e6c926bc54841ull, 0x96dbbf6f4e7c75cdull, 0xd8d40fa70c3c67bbull, 0x3edbc10e4bfee91bull, 0xf0d681304c28ef68ull, 0x77ea602029aaaf9cull, 0x90f070bd24c8483cull },
+	{   59049,     243, 0xc1e46b17, 0xc8601bab561bc1b7ull, 0x72b26272a0ff869aull, 0x56fdfc986d6bc3c4ull, 0x83707730cad725d4ull, 0xc9ca88c3a779674aull, 0xe1c696fbbd9aa933ull, 0x723f3baab1c17a45ull },
+	{   59536,     244, 0x57b8df25, 0xb2d294931a0e20ebull, 0x284ffd9a0815bc38ull, 0x01f8a103aac9bbe6ull, 0x1ef8e98e1ea57269ull, 0x5971116272f45a8bull, 0x187ad68ce95d8eacull, 0xe94e93ee4e8ecaa6ull },
+	{   60025,     245, 0xe9fa36d6, 0x7966f53c37b6c6d7ull, 0x8e6abcfb3aa2b88full, 0x7f2e5e0724e5f345ull, 0x3eeb60c3f5f8143dull, 0xa25aec05c422a24full, 0xb026b03ad3cca4dbull, 0xe6e030028cc02a02ull },
+	{   60516,     246, 0x8f8daefc, 0xbe9bb0abd03b7368ull, 0x13bca93a3031be55ull, 0xe864f4f52b55b472ull, 0x36a8d13a2cbb0939ull, 0x254ac73907413230ull, 0x73520d1522315a70ull, 0x8c9fdb5cf1e1a507ull },
+	{   61009,     247, 0x06e1bb7e, 0xa08d128c5f1649beull, 0xa8166c3dbbe19aadull, 0xcb9f914f829ec62cull, 0x5b2b7ca856fad1c3ull, 0x8093022d682e375dull, 0xea5d163ba7ea231full, 0xd6181d012c0de641ull },
+	{   61504,     248, 0xfd0076f0, 0x7c386f0ffe0465acull, 0x530419c9d843dbf3ull, 0x7450e3a4f72b8d8cull, 0x48b218e3b721810dull, 0xd3757ac8609bc7fcull, 0x0111ba02a88aefc8ull, 0xe86343137d3bfc2aull },
+	{   62001,     249, 0x899b17b6, 0x0bb362094e7ef4f8ull, 0xff3c2a48966f9725ull, 0x55152803acd4a7feull, 0x15747d8c505ffd00ull, 0x438a15f391312cd6ull, 0xe46ca62c26d821f5ull, 0xbe78d74c9f79cb44ull },
+	{   62500,     250, 0xe3e84e31, 0xcd80dea24321eea4ull, 0x52b4fdc8130c2b15ull, 0xf3ea100b154bfb82ull, 0xd9ccef1d4be46988ull, 0x5ede0c4e383a5e66ull, 0xda69683716a54d1eull, 0xbfc3fdf02d242d24ull },
+	{   63001,     251, 0xeef79b6b, 0xd599a04125372c3aull, 0x313136c56a56f363ull, 0x1e993c3677625832ull, 0x2870a99c76a587a4ull, 0x99f74cc0b182dda4ull, 0x8a5e895b2f0ca7b6ull, 0x3d78882d5e0bb1dcull },
+	{   63504,     252, 0x868e3315, 0x0dbbf541e9dfda0aull, 0x1479fceb6db4f844ull, 0x31ab576b59062534ull, 0xa3335c417687cf3aull, 0x92ff114ac45cda75ull, 0xc3b8a627384f13b5ull, 0xc4f25de33de8b3f7ull },
+	{   64009,     253, 0x4639a426, 0xc2ee3288be4fe2bfull, 0x0c65d2f5ddf32b92ull, 0xaf6ecdf121ba5485ull, 0xc7cd48f7abf1fe59ull, 0xce600656ace6f53aull, 0x8a94a4381b108b34ull, 0xf9d1276c64bf59fbull },
+	{   64516,     254, 0xf3213646, 0xd86603ced1ed4730ull, 0xf9de718aaada7709ull, 0xdb8b9755194c6535ull, 0xd803e1eead47604cull, 0xad00f7611970a71bull, 0xbc50036b16ce71f5ull, 0xafba96210a2ca7d6ull },
+	{   65025,     255, 0x17f148e9, 0x915263c671b28809ull, 0xa815378e7ad762fdull, 0xabec6dc9b669f559ull, 0xd17c928c5342477full, 0x745130b795254ad5ull, 0x8c5db926fe88f8baull, 0x742a95c953e6d974ull },
+	{   65536,     256, 0xbfd94880, 0x2b67cdd38c307a5eull, 0x0cb1d45bb5c9fe1cull, 0x800baf2a02ec18adull, 0x6531c1fe32bcb417ull, 0x8c970d8df8cdbeb4ull, 0x917ba5fc67e72b40ull, 0x4b65e4e263e0a426ull },
+	{   66049,     257, 0xbb1fa7f3, 0x2d107419073b9cd0ull, 0xa96db0740cef8f54ull, 0xec41ee91b3ecdc1bull, 0xffe319654c8e7ebcull, 0x6a67b8f13ead5a72ull, 0x6dd10a34f80d532full, 0x06e9cfaece9fbca4ull },
+	{   66564,     258, 0x088816b1, 0xf3e9487ec0e26dfcull, 0x1ab1f63224e837faull, 0x119983bb5a8125d8ull, 0x8950cfcf4bdf622cull, 0x8847dca82efeef2full, 0x646b75b026708169ull, 0x021cab4b1687bd8bull },
+	{   67081,     259, 0x5c2faeb3, 0x1160987c8fe86f7dull, 0x879e6db1481eb91bull, 0xd7dcb802bfe6885dull, 0x14453b5cc3d82396ull, 0x4ef700c33ed278bcull, 0x1639c72ffc00d12eull, 0xfb140ee6155f700dull },
+	{   67600,     260, 0x51b5fc6f, 0xeab8112c560b967bull, 0x97f550b58e89dbaeull, 0x846ed506d304051full, 0x276aa37744b5a028ull, 0x8c10800ee90ea573ull, 0xe6e57d2b33a1e0b7ull, 0x91f83563cd3b9ddaull },
+	{   68121,     261, 0x33d94752, 0x1addcf0386d35351ull, 0xb5f436561f8f1484ull, 0x85d38e22181c9bb1ull, 0xff5c03f003c1fefeull, 0x0e1098670afe7ff6ull, 0xea445030cf86de19ull, 0xf155c68b5c2967f8ull },
+	{   68644,     262, 0xb0c92948, 0xd445ba84bf803e09ull, 0x1216c2497038f804ull, 0x2293216ea2237207ull, 0xe2164451c651adfbull, 0xb2534e65477f9823ull, 0x4d70691a69671e34ull, 0x15be4963dbde8143ull },
+	{   69169,     263, 0xc7171590, 0x37235a096a8be435ull, 0xd9b73130493589c2ull, 0x3b1024f59378d3beull, 0xad159f542d81f04eull, 0x049626a97a946096ull, 0xd8d3998bf09fd304ull, 0xd127a411eae69459ull },
+	{   69696,     264, 0x240a67fb, 0x763ad6ea2fe1c99dull, 0xcf7af5368ac1e26bull, 0x4d5e451b3bb8d3d4ull, 0x3712eb913d04e2f2ull, 0x2f9500d319c84d89ull, 0x4ac6eb21a8cf06f9ull, 0x7d1917afcde42744ull },
+	{   70225,     265, 0xe1843cd5, 0xea627fc84cd1b857ull, 0x85e372494520071full, 0x69ec61800845780bull, 0x00a3c1c5ca1b0367ull, 0xeb6933997272bb3dull, 0x76a72cb62692a655ull, 0x140bb5531edf756eull },
+	{   70756,     266, 0xfda1452b, 0x1f2ffd79f2cdc0c8ull, 0x726a1bc31b337aaaull, 0x678b7f275ef96434ull, 0x5aa82bfaa99d3978ull, 0xc18f96cade5ce18dull, 0x38404491f9e34c03ull, 0x891fb8926ba0418cull },
+	{   71289,     267, 0xa2cad330, 0x39a9e146ec4b3210ull, 0xf63f75802a78b1acull, 0xe2e22539c94741c3ull, 0x8b305d532e61226eull, 0x00caeae80da2ea2eull, 0x88a6289a76ac684eull, 0x8ce5b5f9df1cbd85ull },
+	{   71824,     268, 0x53467e16, 0x74cba303e2dd9d6dull, 0x692699b83289fad1ull, 0xdfb9aa7874678480ull, 0x751390a8a5c41bdcull, 0x06ee5fbf87605d34ull, 0x6ca73f610f3a8f7cull, 0x0e898b3c996570adull },
+	{   72361,     269, 0xda14a8d0, 0x4cbc2b73a43071e0ull, 0x56c5db4c4ca4e0b7ull, 0x1b275a162f46bd3dull, 0xb87a326e413604bfull, 0xd8f9a5fa214b03abull, 0x8a8bb8265771cf88ull, 0xa655319054f6e70full },
+	{   72900,     270, 0x67333551, 0x875638b9715d2221ull, 0xd9ba0615c0c58740ull, 0x616d4be2dfe825aaull, 0x5df25f13ea7bc284ull, 0x165edfaafd2598fbull, 0xaf7215c5c718c696ull, 0x0e9f2f9ca655e769ull },
+	{   73441,     271, 0xa0ebd66e, 0xfb686b2782994a8dull, 0xedee60693756bb48ull, 0xe6bc3cae0ded2ef5ull, 0x58eb4d03b2c3ddf5ull, 0x6d2542995f9189f1ull, 0xc0beec58a5f5fea2ull, 0xed67436f42e2a78bull },
+	{   73984,     272, 0x4b769593, 0xab21d81a911e6723ull, 0x4c31b07354852f59ull, 0x835da384c9384744ull, 0x7f759dddc6e8549aull, 0x616dd0ca022c8735ull, 0x94717ad4bc15ceb3ull, 0x0f66c7be808ab36eull },
+	{   74529,     273, 0x6aa75624, 0x33d013cc0cd46ecfull, 0x3de726423aea122cull, 0x116af51117fe21a9ull, 0xf271ba474edc562dull, 0xe6596e67f9dd3ebdull, 0xc0a288edf808f383ull, 0xb3def70681c6babcull },
+	{   75076,     274, 0x602a3f96, 0x8ca92c7cd39fae5dull, 0x0317e620e1bf20f1ull, 0x4f0b33bf2194b97full, 0x45744afcf131dbeeull, 0x97222392c2559350ull, 0x498a19b280c6d6edull, 0x83ac2c36acdb8d49ull },
+	{   75625,     275, 0xcd183c4d, 0xfdde3b03f018f43eull, 0x038f932946c78660ull, 0xc84084ce946851eeull, 0xb6dd09ba7851c7afull, 0x570de4e1bb13b133ull, 0xc4e784eb97211642ull, 0x8285a7fcdcc7c58dull },
+	{   76176,     276, 0x960a4d07, 0x9c8502050e9c9458ull, 0xd6d2a1a69964beb9ull, 0x1675766f480229b5ull, 0x216e1d6c86cb524cull, 0xd01cf6fd4f4065c0ull, 0xfffa4ec5b482ea0full, 0xa0e20ee6a5404ac1ull },
+	{   76729,     277, 0x9ae998c4, 0x348176ca2fa2fdd2ull, 0x3a89c514cc360c2dull, 0x9f90b8afb318d6d0ull, 0xbceee07c11a9ac30ull, 0x2e2d47dff8e77eb7ull, 0x11a394cd7b6d614aull, 0x1d7c41d54e15cb4aull },
+	{   77284,     278, 0x74e2179d, 0x4a3d3dfbbaea130bull, 0x4e221c920f61ed01ull, 0x553fd6cd1304531full, 0xbd2b31b5608143feull, 0xab717a10f2554853ull, 0x293857f04d194d22ull, 0xd51be8fa86f254f0ull },
+	{   77841,     279, 0xee9bae25, 0xb371f768cdf4edb9ull, 0xbdef2ace6d2de0f0ull, 0xe05b4100f7f1baecull, 0xb9e0d415b4ebd534ull, 0xc97c2a27efaa33d7ull, 0x591cdb35f84ef9daull, 0xa57d02d0e8e3756cull },
+	{   78400,     280, 0xb66edf10, 0x07a1d2e96934f61full, 0xeb1760ae6af7d961ull, 0x887eb0da063005dfull, 0x2228d6725e31b8abull, 0x9b98f7e4d0142e70ull, 0xb6a8c2115b8e0fe7ull, 0xb591e2f5ab9b94b1ull },
+	{   78961,     281, 0xd6209737, 0x8be53d466d4728f2ull, 0x86a5ac8e0d416640ull, 0x984aa464cdb5c8bbull, 0x87049e68f5d38e59ull, 0x7d8ce44ec6bd7751ull, 0xcc28d08ab414839cull, 0x6c8f0bd34fe843e3ull },
+	{   79524,     282, 0x0b994a88, 0x829677eb03abf042ull, 0x043cad004b6bc2c0ull, 0xf2f224756803971aull, 0x98d0dbf796480187ull, 0xfbcb5f3e1bef5742ull, 0x5af2a0463bf6e921ull, 0xad9555bf0120b3a3ull },
+	{   80089,     283, 0xa05d43c0, 0x0754435bae3496fcull, 0x5707fc006f094dcfull, 0x8951c86ab19d8e40ull, 0x57c5208e8f021a77ull, 0xf7653fbb69cd9276ull, 0xa484410af21d75cbull, 0xf19b6844b3d627e8ull },
+	{   80656,     284, 0xc79f73a8, 0xfda9877ea8e3805full, 0x31e868b6ffd521b7ull, 0xb08c90681fb6a0fdull, 0x68110a7f83f5d3ffull, 0x6d77e045901b85a8ull, 0x84ef681113036d8bull, 0x3b9f8e3928f56160ull },
+	{   81225,     285, 0xa490aff5, 0x2e36f523ca8f5eb5ull, 0x8b22932f89b27513ull, 0x331cd6ecbfadc1bbull, 0xd1bfe4df12b04cbfull, 0xf58c17243fd63842ull, 0x3a453cdba80a60afull, 0x5737b2ca7470ea95ull },
+	{   81796,     286, 0xdfad65b4, 0x21a378ef76828208ull, 0xa5c13037fa841da2ull, 0x506d22a53fbe9812ull, 0x61c9c95d91017da5ull, 0x16f7c83ba68f5279ull, 0x9c0619b0808d05f7ull, 0x83c117ce4e6b70a3ull },
+	{   82369,     287, 0x01d07dfb, 0xccdd5600054b16caull, 0xf78846e84204cb7bull, 0x1f9faec82c24eac9ull, 0x58634004c7b2d19aull, 0x24bb5f51ed3b9073ull, 0x46409de018033d00ull, 0x4a9805eed5ac802eull },
+	{   82944,     288, 0x416df9a0, 0x7854468f4e0cabd0ull, 0x3a3f6b4f098d0692ull, 0xae2423ec7799d30dull, 0x29c3529eb165eebaull, 0x443de3703b657c35ull, 0x66acbce31ae1bc8dull, 0x1acc99effe1d547eull },
+	{   83521,     289, 0x1f8fb9cc, 0x7f88db5346d8f997ull, 0x88eac9aacc653798ull, 0x68a4d0295f8eefa1ull, 0xae59ca86f4c3323dull, 0x25906c09906d5c4cull, 0x8dd2aa0c0a6584aeull, 0x232a7d96b38f40e9ull },
+	{   84100,     290, 0x7abf48e3, 0xbb3fb5fb01d60fcfull, 0x1b7cc0847a215eb6ull, 0x1246c994437990a1ull, 0xd4edc954c07cd8f3ull, 0x224f47e7c00a30abull, 0xd5ad7ad7f41ef0c6ull, 0x59e089281d869fd7ull },
+	{   84681,     291, 0xdea4e3dd, 0x2e783e1761acd84dull, 0x39158042bac975a0ull, 0x1cd21c5a8071188dull, 0xb1b7ec44f9302176ull, 0x5cb476450dc0c297ull, 0xdc5ef652521ef6a2ull, 0x3cc79a9e334e1f84ull },
+	{   85264,     292, 0xc6064f22, 0x392058251cf22accull, 0x944ec4475ead4620ull, 0xb330a10b5cb94166ull, 0x54bc9bee7cbe1767ull, 0x485820bdbe442431ull, 0x54d6120ea2972e90ull, 0xf437a0341f29b72aull },
+	{   85849,     293, 0x743bed9c, 0xadf5c1e5d6419947ull, 0x2a9747bc659d28aaull, 0x095c5b8cb1f5d62cull, 0x80973ea532b0f310ull, 0xa471829aa9c17dd9ull, 0xc2ff3479394804abull, 0x6bf44f8606753636ull },
+	{   86436,     294, 0xfce254d5, 0x6bc1db2c2bee5abaull, 0xe63b0ed635307398ull, 0x7b2eca111f30dbbcull, 0x230d2b3e47f09830ull, 0xec8624a821c1caf4ull, 0xea6ec411cdbf1cb1ull, 0x5f38ae82af364e27ull },
+	{   87025,     295, 0xe47ec9d1, 0xb00f898229efa508ull, 0x83b7590ad7f6985cull, 0x2780e70a0592e41dull, 0x7122413bdbc94035ull, 0xe7f90fae33bf7763ull, 0x4b6bd0fb30b12387ull, 0x557359c0c44f48caull },
+	{   87616,     296, 0x334a145c, 0xb56eb769ce0d9a8cull, 0xce196117bfbcaf04ull, 0xb26c3c3797d66165ull, 0x5ed12338f630ab76ull, 0x0fab19fcb319116dull, 0x167f5f42b521724bull, 0xc4aa56c409568d74ull },
+	{   88209,     297, 0xadec1e3c, 0x70c0637675b94150ull, 0x259e1669305b0a15ull, 0x46e1dd9fd387a58dull, 0xfca4e5bc9292788eull, 0xcd509dc1facce41cull, 0x0bbba575a59d82feull, 0x4e2e71c15b45d4d3ull },
+	{   88804,     298, 0xf6a9fbf8, 0x74c0b8a6821faafeull, 0xabac39d7491370e7ull, 0xfaf0b2a48a4e6aedull, 0x967e970df9673d2aull, 0xd465247cffa415c0ull, 0x33a1df0ca1107722ull, 0x49fc2a10adce4a32ull },
+	{   89401,     299, 0x48c31271, 0x76a01ca05ae918b5ull, 0x9a03c93b32748b96ull, 0x99edaea216fbbd94ull, 0xef53cfdf3de8eb1cull, 0xdd85e6a14a44c6a7ull, 0x08102004027fa25dull, 0x7ed6ad671fb0fc24ull },
+	{   90000,     300, 0x8897aef1, 0x23a24c72439c0e80ull, 0xe8c541e469a2d5b6ull, 0x97c4d8dc43a40eb1ull, 0xfa17713a232929f3ull, 0xe589977b75dac915ull, 0x021d440d00579769ull, 0x7bddc9bbc643f9c9ull },
+	{   90601,     301, 0x7b8d65b9, 0xd910b57606451ddaull, 0x257b497ccbbe47ccull, 0xe6c71d01f78dfc7cull, 0x3b7f12f587092010ull, 0x01db15102ee02c55ull, 0xf462d13c4400ceb2ull, 0x7d77b1dba7305010ull },
+	{   91204,     302, 0xb36226c5, 0xb0524f463f255c50ull, 0x2355f3c8e49a4fa0ull, 0x2f73b977063376eaull, 0x7c9e2ce749b1fe70ull, 0xf463a239974afea4ull, 0xb4103fdb4490a42dull, 0xca8f9e94e5c35034ull },
+	{   91809,     303, 0xdc63ec32, 0xdfef880866d2e113ull, 0xbc215830e6c3e6baull, 0x563910eb403616b0ull, 0x08a8630419b03c5aull, 0x3180c82b131f198dull, 0xd044d444b3600cf2ull, 0x9185326a3ea4f924ull },
+	{   92416,     304, 0x182cf7f0, 0x05445342dff57d4eull, 0xb6992257449e7353ull, 0x0cac2eeb3b0edf65ull, 0xb20baa9f4520c558ull, 0xfd513914e32fc10dull, 0x41cdfdc02835d118ull, 0x83d315e8e69a8485ull },
+	{   93025,     305, 0x483580fa, 0x1d02b9ace3367454ull, 0x1c720ef64e1091f5ull, 0x05259f86e6c163c1ull, 0x17d2d5d7e96f898eull, 0x17062f46fb7cc8cbull, 0x84b1aab57b88038eull, 0xa29b76ae5bbe9d54ull },
+	{   93636,     306, 0x70cf4828, 0x1fc5f6eb30074c63ull, 0x28fe75709adc32aaull, 0x47e92fd3d8074c22ull, 0x20a84a9b0a2a6da7ull, 0x953be64c676d80d8ull, 0xe3ddc7903e6af5a6ull, 0x60b6f8b3683eaa16ull },
+	{   94249,     307, 0x11c1909a, 0xd6f7d64a4e628224ull, 0xf4b3388707e0b393ull, 0x606337706ec09784ull, 0x978ef135d0b630cbull, 0x8b6c315f2ae036f3ull, 0xd76dd14307cebf5full, 0x80dfe4c47da051f4ull },
+	{   94864,     308, 0x69dc016b, 0x299dc17b990b44f3ull, 0x74795b67074003d8ull, 0xd8d4b0cd073e0fa9ull, 0xec298944fb9fa0b9ull, 0x16cc48f7c3549980ull, 0x8889ed7db51760e2ull, 0x63af6ba80415353bull },
+	{   95481,     309, 0x889e450e, 0x47eb210142efa10eull, 0x85d23da70d170bb1ull, 0xb8bbdbd5574843a4ull, 0x0abf58ac71fbed03ull, 0x928fdaf54f756c3bull, 0x4247f6f41c7e0e5eull, 0x497bafc18d396b42ull },
+	{   96100,     310, 0x7480b24f, 0x3cab8cb70561031cull, 0xe543de1bf7693368ull, 0x9144fdfa1b1becb6ull, 0xef01e229af0b134cull, 0x84c0274996a52a0aull, 0xed5bfe06be6a9f75ull, 0x84a1e3e79918a196ull },
+	{   96721,     311, 0x9084904a, 0x0c7b72faa92f4e99ull, 0x5ffbc7747ae969dfull, 0x68a72cf95770aca1ull, 0x6b2d9d0f68e856f1ull, 0xdd599d6f41eed1ebull, 0x1a9251d31109e45dull, 0x5d6bdaf6c57179e7ull },
+	{   97344,     312, 0x24efacd0, 0xcaf148a370d831a7ull, 0x77dab8f25e8d5bb6ull, 0x0233bf9bbb452da1ull, 0xd30ad8bb2676079bull, 0x23c2d0bee5164319ull, 0x6740cdc4d4d502f9ull, 0x325819f33fc1d4ffull },
+	{   97969,     313, 0x0616e603, 0x9c70b2243bda78d5ull, 0xd60a9e0a9fcbb331ull, 0xb8433aa1edcd8457ull, 0x9ffba5c0e32827a1ull, 0xc0ddeff72a52ad7bull, 0x2edc3d8383f2effbull, 0xc4eeebbbb38ee454ull },
+	{   98596,     314, 0x2309d3b1, 0x2f57cc00d923cbf8ull, 0x5efeca62f5210c89ull, 0xbd790d9b11d9d33eull, 0x8cd74db0f98dc0efull, 0x2f99dd546a6256c7ull, 0x3cb2f9aa890904eaull, 0x5b36be557578130full },
+	{   99225,     315, 0x82d7eb85, 0xa11b3b2b0d16ca6bull, 0x957885fe229e4a3aull, 0x2c9d82de14d750fdull, 0x757a1f3652fbec6eull, 0x0683c1b44e2eda3dull, 0xb466afef9b4382a8ull, 0xd23b92f9625e7cd4ull },
+	{   99856,     316, 0xaa97b114, 0xef2e7a4107f99fa3ull, 0x323b6ae75a12516bull, 0xb9b096071963d786ull, 0x0693e65346b5bdf2ull, 0xb92e977cc04ae916ull, 0x387ad3019148e715ull, 0x04adabe8467fb4efull },
+	{  100489,     317, 0x09e2a75e, 0x2e93c3f6f0b65b42ull, 0x988f13343d5bac17ull, 0x95dd77cbdac4dc8bull, 0x9d5464c64df06ba4ull, 0xbbff5b4602738fd8ull, 0x90fd5d4fa4f978fbull, 0x178ec8fc3b4ee5ceull },
+	{  101124,     318, 0x852aba91, 0x4a82cf28fb6aff65ull, 0x2396dbbb826e4e39ull, 0x80aa4b1d4fedffc1ull, 0x20d37a243932866aull, 0x3a28aa5331eefe48ull, 0xacac96314bee7992ull, 0xfc2f9739b16ee5f0ull },
+	{  101761,     319, 0x6610a80f, 0x1b56392e647ee2f0ull, 0xabc4b2e55279cc78ull, 0xd877d70fe8f8031bull, 0xd728821b7616825bull, 0xb1bd49601ca99d0dull, 0xde6e570fa8a8f8bcull, 0xdcbbdd5678f0b68aull },
+	{  102400,     320, 0x40dcc9b3, 0xd1144c865019e595ull, 0x056e7a1e7710902full, 0xc5dd3fd876546838ull, 0xdcdf36e3d6d24dc8ull, 0x9d55df17df60ce44ull, 0x7a5e5e36dad22cbfull, 0x0d294cd003892cbcull },
+	{  103041,     321, 0xd8f6ac0b, 0x2924c733ca177993ull, 0x3bb8aa8f017ef16cull, 0xb1fcbcb8ef2624bfull, 0xe4cb8ce9a4e28a29ull, 0x6b9dc7b04ef2d24aull, 0xed9353850ca40d7eull, 0xa6764d5a429931b4ull },
+	{  103684,     322, 0x90ce4fa8, 0x6fc9d6a5bad9a790ull, 0x62fa2bcc216c8969ull, 0xc802aa37ffe88bdcull, 0x67072699159a5879ull, 0x1a7842f1dcf94216ull, 0xeb67641e1d222255ull, 0x64933386aec781ffull },
+	{  104329,     323, 0xb9509d43, 0x92f9070fd180f34dull, 0xd17b4f57480f38edull, 0x9a97f0a051683e6dull, 0x48d9a4e6c02cde1bull, 0x9c45a257b1f117f8ull, 0xad3d2d11d984c982ull, 0x7f043c4f44b1a60bull },
+	{  104976,     324, 0x1b292ba1, 0x7c5005c835527a8eull, 0x565241600b77d9a0ull, 0xc7bf9c47d1b0d2eeull, 0xf273fb5b844aafe6ull, 0x372b4e24839572aeull, 0xa4174984ec20eb8bull, 0x504b5198684baae3ull },
+	{  105625,     325, 0x43658b62, 0x99e0f69fb960547full, 0x3f888cabeb7debd7ull, 0xd4819d34ec500ed5ull, 0x2f6f23f7dc793a48ull, 0x667a60f0a8598448ull, 0x2f324b8eb59c680bull, 0x5a0c2daf784d956full },
+	{  106276,     326, 0x43e93adf, 0xf2897e7ec7004e23ull, 0xe1a455898ad06badull, 0xb148da4d67a94f4eull, 0x0dac76b58601e170ull, 0xb1705071cf8dd076ull, 0xff8abefd10c8475full, 0x50f826fa87ee92daull },
+	{  106929,     327, 0x7c3351e3, 0xf3359a8da92ba27eull, 0xdb53f4723c0d3637ull, 0xfa3b732a06feb2edull, 0xf128dad491b91112ull, 0xf90e79bda868430full, 0xfaa88db6373850c7ull, 0xb2221c86719132a0ull },
+	{  107584,     328, 0x37fe7500, 0x85c08e738de75aafull, 0x60929d9dafd49e0cull, 0x19665f415e81b2e2ull, 0x0d62ee0a688d8de1ull, 0xcce8628e33e06847ull, 0x9a4463d103c718ddull, 0x8aab87ce6823f34full },
+	{  108241,     329, 0xa18b6fd9, 0x8639876588b949d7ull, 0x976352aad2927d3aull, 0xbb24b4cc07eccc97ull, 0xf71c96e2580f95f5ull, 0x1b961b788b70a019ull, 0x6cadaf02861011a4ull, 0x5a79194bcd31a041ull },
+	{  108900,     330, 0x7a7ab5c8, 0xccb0638cb9f8bc3aull, 0xd01cd2a7c0ef4762ull, 0x27cf39bc1a3f7b08ull, 0xaa4aeccd67e598b1ull, 0x9f72a8c0e1b05456ull, 0x570a3a8f8fd5fb8cull, 0x30f707fc0ad517c4ull },
+	{  109561,     331, 0xf3f137dc, 0x3972525bf66b6378ull, 0x7c3515d66a990767ull, 0x5a62a5e9e885be17ull, 0xe705e47cd4fa779full, 0xb2d0d3bcf7520c90ull, 0x157acd52ef25ee18ull, 0xfb98ad59aebcf72aull },
+	{  110224,     332, 0x77579b6b, 0x719c2d41895fb692ull, 0x2261d99e0ce01686ull, 0xe21b2fec40caff16ull, 0x30beac56580285b2ull, 0xb0a33049766a6b71ull, 0xa77582c1be74bfdcull, 0x7000aad42ad9b0d9ull },
+	{  110889,     333, 0xff44fbd9, 0xf9eb1690838a34d5ull, 0x9d5af6431d3dbe54ull, 0x7a941e4099fbb601ull, 0x3b4298b653b51a8aull, 0x84617eda828f005dull, 0xb4d692af51594374ull, 0xfb9ec77dcde43711ull },
+	{  111556,     334, 0x6cff2ecd, 0xa3423f568d176baeull, 0x6edd4e0c890611b6ull, 0x90314c2e01bd4652ull, 0xee5302fe2efc70a0ull, 0x111859108a5840e8ull, 0xfbffff48be400f03ull, 0x65d521e38e2ebb94ull },
+	{  112225,     335, 0x175017c3, 0x0f3921eb926c360bull, 0x4c63d31791396314ull, 0x4c05ea46590db573ull, 0x201a3a3e53967074ull, 0xf055e66a4fa8c76cull, 0xf5f54ce1695241d8ull, 0xb82d100e57f50e7dull },
+	{  112896,     336, 0x3deec5fb, 0x4ee538f724268750ull, 0x307e3b47d06b170cull, 0xcc5bf035d8fcc97eull, 0xb37e35ecd06322ccull, 0xa6dfde393d98ade7ull, 0xfee2768bd55f0280ull, 0x059a17d5b1754e65ull },
+	{  113569,     337, 0x62355df9, 0x9ec8a51015f90f89ull, 0x1fb0936286a89466ull, 0x3ce3141a4a1fa8ddull, 0xabc0088a20aabea7ull, 0x5aa5cd54356a79a6ull, 0x46232de61e47dd8eull, 0x5c321936fb8e2c03ull },
+	{  114244,     338, 0xa904a4bf, 0xb637eb148e185155ull, 0x384925141df422a1ull, 0x32cfa5baabc805daull, 0x4bf0732cc716a24eull, 0xd4cda7fe0cd3a387ull, 0x2dfad366ee05a5daull, 0x2f418dc7dd057c66ull },
+	{  114921,     339, 0x46b406f0, 0x839ab9b6cd16de1full, 0xa0939916e0d36897ull, 0x80b15d9a2f3cc4dbull, 0x2f793a69a9eee124ull, 0x0cfa08e8137ecd87ull, 0xca8f2bc0f81b3e7dull, 0xabb590ec40d021edull },
+	{  115600,     340, 0x18ced05d, 0xb1302d7e9189b6e1ull, 0xeba8c84189939956ull, 0x314dd7f3b9450294ull, 0xc35d76bd902c43ebull, 0xe6910e46eee43d8bull, 0x187bc81e676bf889ull, 0xc1fd1e75ee76683dull },
+	{  116281,     341, 0x92b2a842, 0x78237a09e8986b24ull, 0x3ea42ea11d4bd859ull, 0xefdcb6050638b0bfull, 0x46b3d3b543926ba3ull, 0xd267a1798e286616ull, 0x1b726bfd8db70a82ull, 0xa32d1ac749d1a081ull },
+	{  116964,     342, 0x7be9d38d, 0x761a2d8364183960ull, 0xfaea91b2d5d7f1a0ull, 0xe1ce025555e6d851ull, 0x0202e8d30dcc3753ull, 0xe3471f755b611093ull, 0xa216ad56b96c4f01ull, 0x15b63b752d0b9e92ull },
+	{  117649,     343, 0x33aa886b, 0x5f00fc0d1432726full, 0x4f1c2e2dda51fc4dull, 0x1c09cb65c13ee1dbull, 0xab6c22bf9335f89cull, 0x600470818944a0b4ull, 0xe5bcfd64ba03f3beull, 0x5593c2cee982c44eull },
+	{  118336,     344, 0x5ccdfe48, 0x91a768311edba5f9ull, 0x2f078dfa4a8188ceull, 0xee076e46c0ad4e16ull, 0x6438e34a6b3afd6eull, 0x9f0ccb0b1830fdefull, 0x698b34d0c3f6ea9eull, 0xd2adea699fb0ee28ull },
+	{  119025,     345, 0x9b28582f, 0xa125de7e5a71d2d2ull, 0x04c79d3b1c57ae1dull, 0x83684fb7a39accd4ull, 0x2003af10650f508dull, 0xa45ae5f6c6044a18ull, 0x9895eb05d72897f7ull, 0xdec03171d16bb74aull },
+	{  119716,     346, 0x75e58510, 0xeb9b418697486c2bull, 0x919bbad5e9f2cc94ull, 0xd3363d98b715a9b2ull, 0xae1c592cfc5874b6ull, 0x21456501fa75f278ull, 0xc9dcc4a9b0b3d80full, 0xa203f3920ed7495eull },
+	{  120409,     347, 0x2e0dda55, 0x16c34c1eb0695edaull, 0x8841589d95f03c1full, 0x0c176e09f8367a0bull, 0xf99fda9616b77d44ull, 0xbd256855e56b10faull, 0x54ebf641835aa054ull, 0xeec4b270fd4b3e8cull },
+	{  121104,     348, 0xbda1d192, 0x411e1c6bf2e20417ull, 0x4502f6cacbd510adull, 0xf2e1a5aea6f288e3ull, 0xc9b40282932e7b28ull, 0x32365309dd8f87cfull, 0xa727653233d5c662ull, 0x02338ec2cfe5cf6aull },
+	{  121801,     349, 0xe7f3946e, 0x5b8a1a973dbbf246ull, 0x9a4ca901ebb2af51ull, 0xa9731443a87fa0fbull, 0x4a490abfd09508eaull, 0xa7d7e4cd6ae0225aull, 0xdfd5dfd264d0544bull, 0x68111cc1ae3ed12cull },
+	{  122500,     350, 0x738039bb, 0x76d038b755e927d4ull, 0x2afc8a8bfd7efbaaull, 0xc090d54b198a2b63ull, 0x4ac35a00ba188288ull, 0x6ab8d0baa3052dacull, 0xba786bb8994f51d1ull, 0xaf60f63262f4b4e2ull },
+	{  123201,     351, 0xfbb25eb0, 0x1e213f4b3e5e1aedull, 0xfc245014d99c274bull, 0x0de02e38dc12befcull, 0x3a24320832938f46ull, 0xe0ff8792bc3bf93eull, 0xe2731ca0db623b66ull, 0xc9f88b0bb4ffbfefull },
+	{  123904,     352, 0x3b71202d, 0x37754f8a539611cbull, 0x962523cffede26cdull, 0xca3578f51492bd40ull, 0x440de7098d4eace0ull, 0xeef434553c482eadull, 0xf9601e4d2348735aull, 0xf85eb9c655281d7full },
+	{  124609,     353, 0x397e38b0, 0xc16c916c57e3ace2ull, 0xcda48b18534b3d75ull, 0x10dba2e5f920f23aull, 0x73dc79e293d7ab83ull, 0x40e6f268d1c59d8cull, 0xa4e235d3180d668dull, 0xc509a355a82028b4ull },
+	{  125316,     354, 0x4d796d5e, 0x7da001822a0ae87full, 0x8cfbc906a6a90a2dull, 0x6c14e1f2fb27c5b9ull, 0xfe117987e3553876ull, 0x8a1e76291322c948ull, 0x1157ed5824167ebcull, 0xbe361b4d096f8743ull },
+	{  126025,     355, 0xabd3ed57, 0xb71c5c2f88947e74ull, 0x95f4c11c7256e5faull, 0xa0ddf49c6b71db2dull, 0x1832c26247b20481ull, 0x4ddb87e35d025cacull, 0x89cafc2203ac6ed2ull, 0xdb0f3fccce406662ull },
+	{  126736,     356, 0x833e9150, 0x6cb2dcb89994bac4ull, 0x965c52aad5cec63bull, 0xbcc905f8d61f29c2ull, 0x158aee79f226309aull, 0xdd6c145b1b321cffull, 0xedbb8c99ab0f99edull, 0x25bfe874c2cef533ull },
+	{  127449,     357, 0xa8e6afcd, 0x1db2f55f94a3933bull, 0x73c8b6b51c3991cbull, 0xad3defbed0531bc4ull, 0xb4070c4406616819ull, 0x259e81002f110c16ull, 0x47c35966dbfb2e2eull, 0x9f6878e8fc7feaceull },
+	{  128164,     358, 0x21355881, 0x96250501f736806bull, 0xf34c6a2d28bf2506ull, 0x9c0d481de4c4f416ull, 0x5caef13d8a3f27aeull, 0x50cfa5a5a2e3026dull, 0x63bd4aa6f0411242ull, 0xd9c5020ee083a697ull },
+	{  128881,     359, 0x0bb97860, 0x0720aba4f5734904ull, 0x8cfd655ff01a90bdull, 0xdc3ca636f7bdabb5ull, 0x87acb4d30e0c1ac4ull, 0x10b1b57034a66d86ull, 0x4afc62777cd4cfbcull, 0x6a42deabd50b6f5dull },
+	{  129600,     360, 0x5dcc904f, 0x53deb5fb09237adbull, 0xdb383e4734f1470full, 0x5e0e783ce7c22b09ull, 0x2281fb8bc3cb8842ull, 0x76594069e1061630ull, 0xf9a7d99236d21f97ull, 0x15927f280191e590ull },
+	{  130321,     361, 0x334f8352, 0x264b0fc915c28f28ull, 0x46f3aec068dc6a66ull, 0x93a1ead8056f30d1ull, 0x87297d954d70c536ull, 0x0093c634cd1683f9ull, 0x8a48b2ea0da143d1ull, 0xd02ee4f2decca210ull },
+	{  131044,     362, 0x8a4f5e99, 0x1a35a78e5d468b82ull, 0x1633bc76f3c27456ull, 0x76943091ed19b414ull, 0x09123426dc7500b4ull, 0x8f79eeeaa36a71b6ull, 0x14d773dfb22b5f62ull, 0xb8f287af6ad89ed5ull },
+	{  131769,     363, 0xc020f8dc, 0x80cab1f7940e793eull, 0xc7f24c85e4bf4853ull, 0x22fdfd706c8424faull, 0x38b435986ffecc91ull, 0x8c6c44ddc6a2ee2full, 0x73de3eb12f412997ull, 0x04fb690b3105b4a9ull },
+	{  132496,     364, 0xc023438c, 0x154394bd88996dbeull, 0x8b4c40fa3c923e59ull, 0x9d8d84f1fbb3abdcull, 0xb425705fd3399e8full, 0x2b42c51490186bb0ull, 0x6eaebe41a2fc902full, 0xa89c1f621db727d3ull },
+	{  133225,     365, 0x0273d2d3, 0x9753c3f169e3caf2ull, 0xdadb6adfc6a899c8ull, 0x889477dd0ad71666ull, 0x64c226d15c33ff1aull, 0xe32f3c8fab08e86aull, 0x583b484a4bf6cdf0ull, 0x1e63deb28671e400ull },
+	{  133956,     366, 0xc4d64ed0, 0xe12a8049393c9e85ull, 0x097f26c3e598d704ull, 0x18ece6a43b608b04ull, 0xb758c406d3737af7ull, 0x749fd0fe78c16b06ull, 0xf0276a4af544156eull, 0xfed7e24ad768e236ull },
+	{  134689,     367, 0x7594b34f, 0xdf2ff6d0ab8feba0ull, 0xe640d383236e7a3cull, 0xdb8df20035497549ull, 0x7a86365985e34a57ull, 0xb421dc8d276f9389ull, 0xc40ac5ba2f99d6d3ull, 0xd6f187b3ec7c93fbull },
+	{  135424,     368, 0xb8e7225e, 0x5d89d4515da64802ull, 0x67f0a762528db6e3ull, 0x4d72ba0fa1f75ec0ull, 0x28d05ea286c07d15ull, 0x18cd3f5d0fbafc66ull, 0xed1fec75fef51511ull, 0x37302543f81350e4ull },
+	{  136161,     369, 0xfea69987, 0x38f9a1609f730d9aull, 0x7c142ddc84e479efull, 0xaef67f68d3158955ull, 0x4aff1f610b110902ull, 0x6f5e919cc0e67d41ull, 0x5c5b4b7ba252600bull, 0x3f17266d9d775567ull },
+	{  136900,     370, 0x88a44de8, 0x556fc14187027533ull, 0x0a1798f2c4687490ull, 0x5489c9a80a0ba904ull, 0x47c1eacc1899acb8ull, 0x41234bab48e08600ull, 0xf2554250781bba27ull, 0xb1cd792bebfbcee7ull },
+	{  137641,     371, 0x740ba30e, 0x57aa61faed2dfeffull, 0xc90ac29978213222ull, 0x27f89265e0d81543ull, 0x617db45ffac6a44full, 0x75f1847220b18b41ull, 0xa195ee56738da3b4ull, 0xc5c250e46b2eb0f2ull },
+	{  138384,     372, 0xf4b0e2ad, 0x1f098d1e1a761685ull, 0x488ed304175fb419ull, 0x6ab60d941bdff5aaull, 0x3c9b7c5af03071b1ull, 0x628fbcf030b12c8eull, 0xa7ce885937d976eeull, 0x8347424229c25cc9ull },
+	{  139129,     373, 0xb1949eab, 0xa403e263fb809194ull, 0x7948e7b3f8fb4cd9ull, 0x7e13ed3ccd136e79ull, 0x4c72c22af9420539ull, 0x45f394a614fe74b3ull, 0x74e8e2944f865e70ull, 0x80d98c28e370f0edull },
+	{  139876,     374, 0xf9b6360c, 0x4e6dff092b47d151ull, 0x0348284dbc2703e2ull, 0xb042ef4fa2878193ull, 0xb4ca73e228b9051aull, 0xaaab243a10eb22caull, 0x504bab06ff31fb22ull, 0xd5b330abc94de951ull },
+	{  140625,     375, 0x6a337df2, 0x3d00c59d2130e8a0ull, 0xe4e852c128ea8ee6ull, 0x16594f8063ede1eaull, 0xb809f2fc957b30fdull, 0x1630ae29f3797bfbull, 0x77d196da83cbab51ull, 0xc49115deeb7139efull },
+	{  141376,     376, 0xcce7acf4, 0xbf7ba537d08fa132ull, 0x9eec01d278d0fb73ull, 0xc3e13fa87e474977ull, 0x1f29d4e65584ef66ull, 0xebe061cdb9f4c26cull, 0x95620bad031c141bull, 0x51cc6cc14be2df77ull },
+	{  142129,     377, 0x745f177e, 0xb90f073966ef49e5ull, 0x6e73cd4a3e3d3696ull, 0x4059cf6a8792cdc9ull, 0xa7fd397c6c5dff0aull, 0xef479768df44f8a7ull, 0x5e61102fa8067821ull, 0x9a5405206f8ee189ull },
+	{  142884,     378, 0xf06fc42c, 0x7795d1624e9c308eull, 0x3fa9bf7ab3a86bdeull, 0xfa231291de0aa2c1ull, 0x33157ffe94cd01bcull, 0xcbeaea28b6b41d66ull, 0x598816849eb55195ull, 0x96f4bbdfb2f0314eull },
+	{  143641,     379, 0xd348b2de, 0x3936a9d6b536163bull, 0x5adb1e96da60ebb0ull, 0xa8722cbbe33f5561ull, 0x8d570869236e578full, 0xad1fdadb51327b37ull, 0x10fdb328012da38bull, 0x9866bbde09565e6eull },
+	{  144400,     380, 0x7e8c9786, 0x2b3274813709209cull, 0xcb84b6f972acfa4bull, 0x3e5930928bfeb7bbull, 0xe1baabcd05d18b79ull, 0x32039b35472cd6dbull, 0x34aff243435a3926ull, 0x9dbbbe67b14631d5ull },
+	{  145161,     381, 0xe7423ed0, 0x69f6292fbebc3f54ull, 0x541ae86046c61309ull, 0x560e0c55cf311880ull, 0x1a8985eb05dcd404ull, 0xb0b7a49651cce932ull, 0x6e30d12c5d5d7db7ull, 0x2f81e0caddfa8e71ull },
+	{  145924,     382, 0x72ac82df, 0x1f55a55bbd27938full, 0xc7d524c13888efd0ull, 0xb49835b9ee8f4927ull, 0xaced6e4980d0166bull, 0x554a6ba69f9d4f53ull, 0x005d12c52bddbc11ull, 0x0a8fc457c768a21cull },
+	{  146689,     383, 0x2eb3b3fb, 0xc4358722d6bc2dcdull, 0x6a79b875a994eb6full, 0x7f3a85ab70341cccull, 0xe2b628df0481d708ull, 0x4d622fd1c9725729ull, 0x90411ffa6ad63665ull, 0x7a9bbad6a8f50248ull },
+	{  147456,     384, 0x9423e275, 0x7d506ca9a4b4cae4ull, 0x45bd6b362c91fb5full, 0xbb303f5b70784d95ull, 0xb21e8a314fc6647bull, 0xd56e30b00da87594ull, 0x5026c010ed05b701ull, 0x1265eb731ef88d59ull },
+	{  148225,     385, 0x95ccf65e, 0x9446c599e86f3d79ull, 0xfccbf12c88ce88d5ull, 0xec3f11b69fd8fb5aull, 0x98521468cfd9a351ull, 0x5a62d9e42cc67805ull, 0x4d846d9641a750c2ull, 0x560fb51815b256deull },
+	{  148996,     386, 0x7e4e2213, 0x6de50da015f48df8ull, 0x58e11ff92f1e6642ull, 0x7b92299211eea845ull, 0xd408f795936016c8ull, 0x5cffc4f58bb4be17ull, 0xfdf767b070c6a801ull, 0xf1035e68c6088773ull },
+	{  149769,     387, 0x6ac4cff3, 0x2de3ba178e97de58ull, 0x91d9fe5b5f86b41dull, 0xbf547e9f1a89850bull, 0x6517263762c3f4f1ull, 0xd9dee365899f88f5ull, 0x3c972e6dfd35c555ull, 0xf6b11c2d65e9c8faull },
+	{  150544,     388, 0xd5ad8006, 0xa536ae90fa51af04ull, 0x96f1e5b8264074feull, 0xe7f680491d65050aull, 0x79599474da425a8cull, 0x389d050568479f58ull, 0xe3e73b82d1ce6b7dull, 0x2476dbce516f9271ull },
+	{  151321,     389, 0x4b5dc581, 0xcc842dd55bf93891ull, 0x058183b130b2968aull, 0x6f80fcd73750c5eaull, 0xb19f88073db1c815ull, 0x804031273cc5fb0bull, 0xbfd5781f2d04bd9dull, 0x1d6bc61eacc79c51ull },
+	{  152100,     390, 0xc79c45dc, 0x0e4ed21c76b6a7fbull, 0x3a6f954b0062c663ull, 0x6142b7441f346e47ull, 0x4f7fc0b756c9c8beull, 0x52a2d9bc4b2a59b6ull, 0x06ce4824e4f70218ull, 0x4b4a27ded9376810ull },
+	{  152881,     391, 0xebf4bfd0, 0x32975ca0bd3c8112ull, 0x3f626f1e285a47bdull, 0x65a84e236c39a3bbull, 0x991db370fc85b5afull, 0xed56f659e12daa88ull, 0x18f1c610d387db6cull, 0x1a0547d456e5bbf4ull },
+	{  153664,     392, 0x70914f76, 0x6b6d1e176aade1dfull, 0x1ffa82ee3e8895c4ull, 0xbe6bfca33aaab5b4ull, 0xc3cba23fcba4c8b3ull, 0xc168491a7275955eull, 0x75eafe346b769fd9ull, 0x9de6d2e9b6234b21ull },
+	{  154449,     393, 0x33fc9ee6, 0xd1fb3f00390ac24dull, 0x414a25c0201af5c9ull, 0x6d8c5928085e4232ull, 0xaddfd499be9ed994ull, 0x383568e5b910420full, 0xff5eb8a4dcf5c43dull, 0xbcab3b341be4f5a1ull },
+	{  155236,     394, 0x7dd15275, 0x3d4cc6397c246ab0ull, 0x05985985625eb060ull, 0xb8b57f6102e80d0full, 0x59b0d5b9ad21d438ull, 0x8385be0db09f78feull, 0xb2da62c5f303bfabull, 0x66d5801f48291550ull },
+	{  156025,     395, 0xc29531bd, 0xb113fe33f8926e5full, 0xc914f4bd9d293b92ull, 0x7132ce1ae50baa21ull, 0x58ef38024699fd54ull, 0x0ca61939936f8d53ull, 0x4e141e2b189c18aaull, 0xb451ecb36e3ffa96ull },
+	{  156816,     396, 0x459a6628, 0xcb395d200044bc1full, 0x9b781c8d321db12full, 0x25dbe63ef7b0943eull, 0xc1303cec55543864ull, 0x5451de719efcbda4ull, 0x349854b440886a7aull, 0x96a9cd9a92d3135eull },
+	{  157609,     397, 0xb6f469d7, 0xaa4867e00b9eb6f7ull, 0x711209014698d2e7ull, 0xabb4d3ef1ce1886eull, 0x8b742866a8d63145ull, 0x6a0b08a5b373e833ull, 0x51c822cd96b87eaeull, 0xf531070029062466ull },
+	{  158404,     398, 0x0dcc7294, 0xc6882c3f7d521144ull, 0x04c59badc4d8d31dull, 0x16bad40bffbbd959ull, 0x4798f25623b715acull, 0xee62b7c0e3f29895ull, 0x211069b860a19efaull, 0x9b0fc8b57c88e14full },
+	{  159201,     399, 0xf119b0da, 0xc88d63a9aee3afccull, 0x67e19ff97db9c5e9ull, 0x6a16417bf3e488aeull, 0xac377d7090725810ull, 0x78ea41c4005a2472ull, 0x838249b1940f79c4ull, 0x82c3066616aad01dull },
+	{  160000,     400, 0x1c845e56, 0x3c538982cb52aefcull, 0xfbf8d9da51bb20fbull, 0xe02566c0083541c0ull, 0x1c7bf9016c97bb57ull, 0xd45f182a2f80a5a9ull, 0xb86aa1d8b6dc33eeull, 0xd995291e3d11deafull },
+	{  160801,     401, 0x9b1442ed, 0x664d6662e2e99b1eull, 0x7b8455cad0533e14ull, 0xb2c73ef0616a4510ull, 0xb90d1ac8ac8bd135ull, 0xe8570e31ca75cdb7ull, 0x1392ba8762b15d58ull, 0xa10a86cf1bff75b4ull },
+	{  161604,     402, 0xf77eec9f, 0xaff6dcd657f8a14eull, 0x1376fd4401f73ca8ull, 0x644a65f94ba662c2ull, 0xd496d9c47dded277ull, 0x22dda9a05d8c5886ull, 0x784e988b822bc68bull, 0x81ce11f798cbdfadull },
+	{  162409,     403, 0x914cc322, 0xba3dff57587c39a9ull, 0x513f4d6ab24dc5bfull, 0xc51e0f5da2e9a377ull, 0x98146e30a150a428ull, 0x3bc20b7e549f44ddull, 0x12690a147d1095dbull, 0x3c0fea07cb9675cbull },
+	{  163216,     404, 0x1064a4a3, 0xf2be72b68f2fee94ull, 0x0b8c401cd9d5fa18ull, 0x95cf1b78c4ab72dfull, 0x9cdc3b1de630c556ull, 0x184df7802f48641aull, 0xa729d0f048f6cc23ull, 0x51efe529d17832e9ull },
+	{  164025,     405, 0x717d4d1b, 0xb27b6dc6718d2ed1ull, 0x32967df53488d1faull, 0x2b2e3d6a50ddb260ull, 0x83b50fa1ca435659ull, 0xc513b5c53350f830ull, 0xfcd53995b7c83e74ull, 0xd27d39cf9520ab15ull },
+	{  164836,     406, 0x4ab212ba, 0x5379aea4a5ae6dc9ull, 0xcd63c3166020ae38ull, 0xbfd5c31060c2a7fdull, 0x3751db6252601ffdull, 0xaf4136b5e49c5174ull, 0xd49aa0a851ce06f7ull, 0xebbd7eb4934af12bull },
+	{  165649,     407, 0x448280a7, 0xf75ec7cc27a4a820ull, 0xb5785fe1f9d1f158ull, 0x6992f7736bf92e8aull, 0xba594640af9ab1b9ull, 0x31b9ce63b876740aull, 0x194f6ec22f96fc4full, 0x908b8c5e491bb329ull },
+	{  166464,     408, 0x3f94e83f, 0xb0dd524252f78b90ull, 0x20cf57629707532bull, 0xded2f4af675ee3fdull, 0xb9fecd627183f7f7ull, 0x209ad92e2d99b224ull, 0x92b75a459be0baa2ull, 0xa1f685ba91c69d84ull },
+	{  167281,     409, 0x0d5dfa09, 0x2520a8773b8cca3aull, 0x49e0856dcb00b706ull, 0x79947c8f8efb8247ull, 0xb186b2f28a96de4bull, 0x1c8be09a0c5c9290ull, 0xede480f2eee7ab65ull, 0x4d0b5f24a64b991dull },
+	{  168100,     410, 0xb9425950, 0xcaab7250d25ef954ull, 0x687bf9f351188cefull, 0xaf9a59884db784deull, 0x1ded142baad11da1ull, 0xb9ccda97e9071c8full, 0x7ce4afa70ddde36full, 0x963fe401cdbb4a60ull },
+	{  168921,     411, 0x7dd1e4a2, 0x0d78a92c939f1602ull, 0x2e3d1b4067c5699bull, 0x8610e7693503e247ull, 0x817dc6f7ec177f44ull, 0x0c97be98178800ffull, 0xe9f367d522888240ull, 0x783be7d42cb51438ull },
+	{  169744,     412, 0x36898b02, 0xa3227b6d925e1c6eull, 0x6982a44d44e5a49aull, 0x7b3c1e9276de9a89ull, 0xcc6dcd00524844beull, 0x73fedf4bfecfc26aull, 0x74e84cac37f8b254ull, 0x6ff2940943aa03a1ull },
+	{  170569,     413, 0x6bd15857, 0x8d4d693802904a1cull, 0x6224d28acc947626ull, 0x334c3e4cc9afeb92ull, 0xdc1e6471bbb71cf8ull, 0xf9ce8238ce0f6d54ull, 0xa9aadafa18ae7a7full, 0x03e24adc933892deull },
+	{  171396,     414, 0x304e52c6, 0x04c1ec2b9eb61980ull, 0x4c9f473b9caecae8ull, 0xafbf04839196852bull, 0xe7b6edaebdf889bcull, 0x86db58862478b4b2ull, 0x52995a445eadb510ull, 0x9623c145c419a2cfull },
+	{  172225,     415, 0xcb45878f, 0x219d311c8f0a0cc3ull, 0xfdfc1b52fbc986ddull, 0xf4472927baaa4642ull, 0x13fb56baaead11f9ull, 0xe56a40829179c4feull, 0xb953efd471539980ull, 0xeb67118fac2de0e1ull },
+	{  173056,     416, 0xc86f46b3, 0xf86cc36b9489c435ull, 0xa23065edbc954b1dull, 0xbd9df30a0fbb0437ull, 0xe0cabd10d2f7c9efull, 0x3f14bb6199548edaull, 0x17a2daf0750d2abfull, 0x7263dd21521a6404ull },
+	{  173889,     417, 0x7ae3b750, 0x3228a1badc88065cull, 0xaa8ede59c76d3295ull, 0x22ac435369138e0bull, 0x947a6a182b5b06b4ull, 0x828dc0c67c99a703ull, 0x109c1805e677a1efull, 0x994f12c0c85d0cfbull },
+	{  174724,     418, 0x10dd0e93, 0x1c97369b48ee9000ull, 0x540700a8bc67d6c2ull, 0xcbddb97fad667ca7ull, 0x66c8c625c6be4f8cull, 0xc63071885aad5393ull, 0xed54d179a935bbdeull, 0x87bcf3c3922f55ebull },
+	{  175561,     419, 0x0671a1c6, 0xf2f0a7fec2e2afc0ull, 0xe2e0bf4d2b58804bull, 0x75c3dd3ff3f66c78ull, 0x327aadb66ca43d29ull, 0xffdd03ac24998b52ull, 0x5259da7b6b198a93ull, 0x857b2494395d5ea9ull },
+	{  176400,     420, 0x44d4bf7b, 0x44fb20effa426627ull, 0xf7bbf92ba5b2d673ull, 0xb4b80da868bfd927ull, 0x15b6de0f23a8d865ull, 0x8015aba32df2a048ull, 0x1d39467fd47c0527ull, 0xec1a297f8365a36cull },
+	{  177241,     421, 0x8288a3a0, 0x474b7eb72d16dee7ull, 0x15c05fcb97b15d5bull, 0x7076b0c6e079678eull, 0x77bff6862aba22ccull, 0x0fd66bae0bfb5659ull, 0x47646b9e5324d3beull, 0x806ab863628e8f20ull },
+	{  178084,     422, 0xdcc7cc0a, 0xecee039f39e9028eull, 0x4270f91b545acb97ull, 0x140800be8ad23717ull, 0x1d43be325236c439ull, 0x02edef716f4d3865ull, 0x3a8b7f24f49ddd6eull, 0x1726969afe90f8edull },
+	{  178929,     423, 0x3cf12a0e, 0xdf6d548c7c9979deull, 0x1ac7de0e8d7bc344ull, 0xe6b55df7c437ea9cull, 0x51d5ffc3d413ff94ull, 0xa74186b65979a41eull, 0xaf69e65614e0a9a5ull, 0x9ed945d2a6ec7c10ull },
+	{  179776,     424, 0xf31f5288, 0x39ba33e00e0eee65ull, 0x4524a1c8eab7b8b1ull, 0xb9936dfa8617d53aull, 0x6a1866b2e1cddf6dull, 0x57b07da79721dcbcull, 0xb1a170f7e6346287ull, 0xf1d24e6d04a09548ull },
+	{  180625,     425, 0x8281399b, 0xeffff31dde157f20ull, 0x7971734f658d12ddull, 0x4c9d9814f380d64bull, 0xc0ea52934dbf861full, 0x0dca1ed381bc232eull, 0x04476f31c598ccbfull, 0xf827e9ca8d212c9full },
+	{  181476,     426, 0xc40a6c11, 0xe0af00378e94bfb8ull, 0xc6882194cfd61ebbull, 0x1edeebd9066d63dcull, 0xd2177df685aaee37ull, 0x155b03f6516fe482ull, 0xe1620415e5c2bce8ull, 0x36ebd122ecb489dfull },
+	{  182329,     427, 0xceb7d387, 0x082500c3d4d2feb2ull, 0xf21fe2de33ab377aull, 0xc538b7b65f320e2aull, 0x9cea69bcab6171beull, 0xc314871f89f8f495ull, 0x01c7592bd726989eull, 0x65b24bcebe8e1396ull },
+	{  183184,     428, 0x683df9e4, 0x9eca178a403dd76cull, 0x6380d1e159d68bc5ull, 0xfa681839c0c3fee2ull, 0x6d655d770b51748dull, 0x7efc84a946ff7066ull, 0x24d71ebaa7adf56cull, 0x7f88bbf57cf4d757ull },
+	{  184041,     429, 0x595378e6, 0xc146b3d8bb61f405ull, 0xa0a5a58e9ac0c71full, 0xc2b71e88624f8fb2ull, 0x3929b272c328ff98ull, 0x49ff27d2f57e33bbull, 0x45cfb7345b5c6a49ull, 0xb05de90ffdd3b254ull },
+	{  184900,     430, 0x91a7880b, 0xdb08304cda0c0145ull, 0xd06829d2d14790feull, 0xf944b152ce4f4905ull, 0xe1a16f4d5e0c8706ull, 0x65b5d73777961674ull, 0x311c95ddbf8e3722ull, 0x0d4f8f34036c4a09ull },
+	{  185761,     431, 0x10f99a45, 0x6b7e2ae5b94c3f30ull, 0x4aef2899fa76e32eull, 0x04cd18280ffc08a8ull, 0x24ee4ba887bbcacdull, 0xa73c9e7cae1d62ebull, 0x0eb0d99a44a0f097ull, 0x154209764a3b2143ull },
+	{  186624,     432, 0x54b594da, 0x0c64a77a5ecd93a0ull, 0xf2529cf56ed458aeull, 0x9a23cfeb88a677b4ull, 0x370e9654bb0b04a5ull, 0x6e04461cfd0df4ceull, 0xf781d45d3fa4c526ull, 0x92ac58da7674f097ull },
+	{  187489,     433, 0xb3da390e, 0x0fbb54e98bcee9cfull, 0xce11da84221b3f5bull, 0x1c41140d6be5cb5bull, 0x336b24d7ecc2ef38ull, 0x70d63a43809b4747ull, 0xff18bff9cba79070ull, 0x50127488dfebba0bull },
+	{  188356,     434, 0xab44448d, 0xa7103569e67a38ddull, 0x56dc5639840e47ebull, 0xe696edf908ad5cafull, 0x2bb7151ecfde28faull, 0x170a4b59916e7262ull, 0x8ea4f89e0362c8dcull, 0x34e597f8f649b5eeull },
+	{  189225,     435, 0x95c29554, 0x32ba35ab69346d05ull, 0xf8b8dad0bafa3d6aull, 0xa35ef7a0925826d8ull, 0x7e7d2391221abc98ull, 0xaae35a725a6db0e9ull, 0xd0ac919148980f04ull, 0x8746ce51b807da4cull },
+	{  190096,     436, 0x8074d865, 0x71850dfd21ceafe3ull, 0xbe4dbd4dc4a36c34ull, 0xb16041a38cf68a9eull, 0xed065a9d34c4e965ull, 0x63b5bea3ab3fd9e7ull, 0xc4dc702946ae95c6ull, 0xbd61250c4411b3e5ull },
+	{  190969,     437, 0x66b4e8b4, 0xc960c84409e3a22cull, 0xea1300ade1a17fcfull, 0x2c187a1dae5e3e99ull, 0xc61aba19204a1d46ull, 0x9132b8116016d7e5ull, 0x667b692e7fe10420ull, 0x615e331fadd93074ull },
+	{  191844,     438, 0xcd14262a, 0xb1d91628cd0fbe03ull, 0xa316ef9e7b0acc8eull, 0x712c99f38460fdb7ull, 0x3551840fdb7834d2ull, 0x54825357871601ddull, 0x7a82d8c4c1856d84ull, 0xb3128993004a9b1cull },
+	{  192721,     439, 0xde27ea22, 0x888cb8bcf78514e5ull, 0x369bface1807c83bull, 0x58590e079fa962fdull, 0x5ea18966329dc682ull, 0x14a441ec346e4c8bull, 0xe7b3922c8d0316e8ull, 0x6e2a6b25d6a4c0ffull },
+	{  193600,     440, 0xe26fd654, 0x0631ed32cc13baa7ull, 0x26782bea272b752full, 0x2d1e1538a20c92abull, 0xa16beb2165460ec2ull, 0x7b75bd3a4124bc50ull, 0x3fcdc8339be33d52ull, 0x822694991f6dc098ull },
+	{  194481,     441, 0x0c1f483a, 0x6e1828de4a9d9e56ull, 0xc505d1baeccd0929ull, 0x37f9a67eaf33f29bull, 0x2e3b8dad933db32dull, 0xee8d4d78a7448220ull, 0x8a0c0384e30af4b2ull, 0x3080593bff84dce3ull },
+	{  195364,     442, 0x3b9613ee, 0x487835f99c7fcd34ull, 0x81d06447136a0b78ull, 0xcf62076a5ebf8097ull, 0xddb210fc81844491ull, 0xf4bedb25f40a3617ull, 0xae051ca189adeca7ull, 0x3d58bb45865f00a0ull },
+	{  196249,     443, 0xe3201e46, 0xe03fbf742f1b7983ull, 0xe97b3066cfd29edaull, 0xf03eb69bfcf7bfdbull, 0x774b97bb4fff668dull, 0xd0bfab472c5c80a3ull, 0xdc8701f9e3ec2350ull, 0x3b9bb9f332db3fdeull },
+	{  197136,     444, 0xd6718d57, 0xfabf39a3c17e607full, 0xeff350a604d4fbc7ull, 0xd87cc0d2538926ecull, 0x6ac7125778002a10ull, 0x8b94233773fcb3f2ull, 0xb2fbb99ff26eebb3ull, 0xb1646b0851fb4dc0ull },
+	{  198025,     445, 0x78aaff69, 0xf1c5c13e6959eb03ull, 0xcb84ce6327bcf93eull, 0xaf17868233afb594ull, 0x11a65adc76b1e24bull, 0x476b1f9ef78a4cc2ull, 0x3f800fe1b978c8e0ull, 0xdc4d181b8f91ab9bull },
+	{  198916,     446, 0xe45d4b1b, 0xe73e65f8b674d71aull, 0x842ce5ed2b1ad86aull, 0x0e621e677bf96da1ull, 0xb2c25b3eea4572deull, 0xecd54b0c075a4e65ull, 0xba31f11cbac9457eull, 0x9400eaff757bd9ffull },
+	{  199809,     447, 0x6f9299b5, 0xf5fb0d3847a5b46eull, 0x6ab762da9c513cb8ull, 0xdc21b919da8fdd3dull, 0xe34e10d669437b80ull, 0x9a7e84657c38ff88ull, 0x75d6bdf6dc5e33a5ull, 0xeff04d757c61dd5dull },
+	{  200704,     448, 0x3c4a0eff, 0x744a3695bcd44ca4ull, 0xc64d64dece9eba1eull, 0xd88bc159c90cd99full, 0xd83108e58038ad7dull, 0x6691ab0e0639c1edull, 0x35695e9f44a3a838ull, 0xf2ba33a045041360ull },
+	{  201601,     449, 0xe82881a6, 0x64005d93ca976fb3ull, 0x702407bcb2c0f871ull, 0x4aa7e844cb00dff4ull, 0xc04bd85f4deb9411ull, 0x9f4eb81075f41a51ull, 0xdee00c68a3e0283aull, 0x8568a5914bc94e28ull },
+	{  202500,     450, 0x8e02e501, 0x7415fa883ef2d800ull, 0x3988bc27beb38cb7ull, 0x2165ac176fb063aaull, 0x61f40b54fee8af68ull, 0x7f02e2650f00929cull, 0x9321db95e5e2965aull, 0x4b38d2a80d78c46cull },
+	{  203401,     451, 0x04710caf, 0xf961e3341e0e65c0ull, 0xd4caa1bf7d2860ebull, 0xab7ff0c59d357475ull, 0xa2be561edf4d97fdull, 0x09d2386da012565cull, 0x56d4016e801e6719ull, 0x4f22d3dab63ca52aull },
+	{  204304,     452, 0xd429d1e2, 0x8754685c891a7ca9ull, 0xdf756e960b283204ull, 0xb4e0b6251e9b9926ull, 0xf3c7bea32f228fe6ull, 0xd4a4335eb15bd72bull, 0x4edb64ad6ec4c24bull, 0xf8122c5221e3d5d6ull },
+	{  205209,     453, 0x4ee9f324, 0x4989e68734057263ull, 0x9a7c882c71c67991ull, 0x49b91695e6919339ull, 0xd3dd1c7ab9731043ull, 0xa3503ba24cd3c58dull, 0xac1303b728fca510ull, 0x4424c09cd752f1a0ull },
+	{  206116,     454, 0xd014f5b2, 0xff8a2cadce6fc2d6ull, 0x641a732c53a53e6cull, 0xb611650687028201ull, 0xeab93de2a37ddac3ull, 0xde1b70f6642f3e36ull, 0xee7225585d50a5a3ull, 0x77faa6da2c457ab0ull },
+	{  207025,     455, 0xffb9dd51, 0x470d4bf4eaaf32c5ull, 0x11182f181856dc74ull, 0x478e12ffdb7f4aaeull, 0xe32002ca29d9e811ull, 0xc5ef83dd6924d4eaull, 0xf8a610d12f0d1edaull, 0x648423f5a7f67e5aull },
+	{  207936,     456, 0x655a1ee3, 0x6c3c698c339e8984ull, 0x2acaa1aadae99d97ull, 0xa387244fedb8d9e4ull, 0x3162cc6414b251a2ull, 0xba732748b194f27bull, 0xaa2a5de663d05eb7ull, 0x34a9b9cc5418fcfdull },
+	{  208849,     457, 0x2c9c5cbb, 0xabc2d309f9ed6143ull, 0xe26a3172e3adbcb9ull, 0x13456b14ea7981b5ull, 0xc089f67194bae0d4ull, 0x1ac1d07869e0ace4ull, 0x9d1581e60f723325ull, 0xda33d6583056d6acull },
+	{  209764,     458, 0xf30bf9fb, 0x7fbf66c707d49d25ull, 0x9b3ce2e682c627ecull, 0x7d9ce5a0502bcbf6ull, 0x0d026b62ec9b90c1ull, 0x7cd8a1dab7c2e59eull, 0xd575b72786f1ca86ull, 0x0bdc86f5a475f448ull },
+	{  210681,     459, 0x8b67bba6, 0xc30e33da845ee362ull, 0x61788aa9cbb95759ull, 0x99cd345783e39f8cull, 0xa90a3cfcbe22acbcull, 0x8282abacee9c3c1bull, 0x3f93914a4782b880ull, 0x6d97ee1e3f07bd79ull },
+	{  211600,     460, 0x73d92704, 0x91b1a9349e0541beull, 0x72e3e6eb36390f39ull, 0xc8e5e6a611d0722full, 0x086d8c3e5a3c6e0cull, 0xdaf045b21a4eec9cull, 0x8a85b4458ac9774eull, 0xe52aa69a8c5f4b41ull },
+	{  212521,     461, 0x7ba62302, 0xd963a66465a1c45eull, 0x1d69e3757d0c56b2ull, 0xbb8a573f10cdeecfull, 0x188eeaf455573434ull, 0x6695634018c12699ull, 0xebd647a75485a8cdull, 0xd817f40ae693b3c1ull },
+	{  213444,     462, 0xda440feb, 0xb24d38f433223743ull, 0x19567b557e111f9full, 0x83b7941cff9cc35full, 0x85d2b795b90e99ffull, 0xcaff5b999f417480ull, 0xfd1d2dd468358f86ull, 0x69293cf3e4473b09ull },
+	{  214369,     463, 0x69114a8b, 0x58213c1d24724ebbull, 0x17a900bc93d6eaf8ull, 0x031bf3f465ba80fdull, 0x48e92edbe2d128f6ull, 0x3f339bf871b5b582ull, 0xe76751012679ac31ull, 0xcbe93af07ee52c74ull },
+	{  215296,     464, 0x043d6597, 0xf0fd5d778ad8d1d5ull, 0xf11351dec6269b3eull, 0xd08f653772167760ull, 0xc64abcd1f742a364ull, 0xf86d05de5883f1dfull, 0xe2a253d4b150d326ull, 0x5d5249792acf6cc8ull },
+	{  216225,     465, 0xf173c293, 0x5bef9891464e8381ull, 0x60944ad3861d337dull, 0x409dfe02df8161e1ull, 0x0c4fa52e0e125256ull, 0xaf2620d27c63cdd0ull, 0xf3ee2441a9d02e06ull, 0x2cd454c7dd4f2fe9ull },
+	{  217156,     466, 0xc5b02604, 0x5be6ecdbea9b95d7ull, 0x9de82d0892d75004ull, 0xf342d68701e91e63ull, 0xbc33b1ec1047ba5aull, 0x079531e8be2a1d44ull, 0x583c4ef87abb890aull, 0xf0dfa696dc79309aull },
+	{  218089,     467, 0xf250de41, 0x5d5c3d046d15457aull, 0xef786926b73a67eaull, 0xd843ed636d415f29ull, 0xbe5f0f864c2ad16aull, 0xde0ecba7f7a91d87ull, 0x1cffe380825272cbull, 0x93bfb0210090e8a8ull },
+	{  219024,     468, 0x0a466ff4, 0x7474fe02c8607600ull, 0x08fa1c60e32b1469ull, 0x69515a73d5b496abull, 0x306408d5ce5aa2d5ull, 0x682522e0aa892c85ull, 0xfde82edbd1a72a59ull, 0x59f53e9afb338cbfull },
+	{  219961,     469, 0x3b8fc1a7, 0xdc6c62b83cf8900eull, 0xab07662f16e3384cull, 0x060293f84db45023ull, 0xaa8adeca6c44cdeaull, 0xc164a40cd5399e88ull, 0xabacb97e9949fdcbull, 0x8efb261abc8100ecull },
+	{  220900,     470, 0x1578407b, 0xe72ba6ace9623cd3ull, 0xe37974fb80dbacc3ull, 0xb2ec601ce5786851ull, 0xde030aeb700de810ull, 0x5752fa3d07ed557full, 0x1a517d8b85477b0cull, 0x82480e9e0b8605e8ull },
+	{  221841,     471, 0x3cc7f639, 0x78a338e2de2b18d7ull, 0x996e057c4aaa1976ull, 0xf1f1488c25c887ddull, 0xcd99e039b311b8e2ull, 0xf9debd3e3031e903ull, 0x97d3ce5a5986db69ull, 0xf971896ae6bb8880ull },
+	{  222784,     472, 0x8449c754, 0x9276af9a17a5ef4eull, 0x5ff886f450f7d58full, 0x5a478c2128964227ull, 0x776f925c13ea0fceull, 0x5afde90f0c49c990ull, 0xd080f6aef7cd7e74ull, 0xb6e928c4362ae25cull },
+	{  223729,     473, 0x8fdff4c0, 0x8b7a87b5eeccead6ull, 0x575865ff1a5ff1deull, 0x8db41d418f550f71ull, 0x794bbe9135762dd2ull, 0x93cdf8b74619805full, 0x9d9415f678464955ull, 0xf54835e9e632b1eeull },
+	{  224676,     474, 0xf6f36857, 0xa57a43db700a76f6ull, 0xf336e075593e2f3full, 0xf6050ee5b4163f85ull, 0x5dd4ffa16749f721ull, 0xf619075fbf28724cull, 0xa29d5392592a2923ull, 0xd6a37d1cbef5419bull },
+	{  225625,     475, 0x6ce491a0, 0x0ae21f10cf15878cull, 0x49c4f7040525f768ull, 0xf2e5b811745d2554ull, 0xb1fc16b5b98e8c71ull, 0xc7d38fd98a8f817eull, 0x2a8a34f39a3bc9c4ull, 0xdb11b229e182460full },
+	{  226576,     476, 0x182836d1, 0xd9399a186246f0c2ull, 0xc2f4060f3d9f5f4bull, 0xba0b7e356084865eull, 0xd364ed76e9d60ab9ull, 0xa3e7ac929d9b1620ull, 0xeb93e2455d1c905eull, 0xee9e3c4cd23303a6ull },
+	{  227529,     477, 0x8be54907, 0x79dee38128f15443ull, 0xd8e1605818c7750dull, 0x03811d632915f37full, 0x703040281608470bull, 0x4be2f9570506aeb2ull, 0x458011bdae455ceaull, 0x3dae388c5b2074c8ull },
+	{  228484,     478, 0xda061f6e, 0x6f4e8cfc936e17e0ull, 0xeaa8423f0ff436e5ull, 0xde450a7de191d268ull, 0xb6d25c4e3cb3c34dull, 0xf63f731a0c458291ull, 0x9cf60467835fdb82ull, 0xc2988eb02fe1eb26ull },
+	{  229441,     479, 0x8c3357a9, 0xbf51d2829af3cc44ull, 0x6dfda3ba14b80474ull, 0x07f7a6306a2415d9ull, 0x56e3dc8c21c59202ull, 0xf4e5a8ddefb4a63eull, 0x36e8656e7ec7a5fdull, 0xb953992eff08499dull },
+	{  230400,     480, 0xa3cdc13e, 0xadb21f83285cf2beull, 0x8d3401dbb10838ebull, 0x56c5c321129f3fefull, 0x67bda1462cc02603ull, 0x0fbf9949cad6ddf9ull, 0x9836927311c94f97ull, 0x28c36cce1d92eb0cull },
+	{  231361,     481, 0x0d51e605, 0xa488c90357c22e38ull, 0x56525e4152d4e6daull, 0x1de99ff5cfa5e7c1ull, 0xca41ebcf08c625e8ull, 0x69cada22baf9f70cull, 0xdd4178fb306f2608ull, 0x244452cb0cbd8325ull },
+	{  232324,     482, 0x10c7bfe4, 0x9b42005afce637a6ull, 0xe43f87f8ca834139ull, 0x6242bbc6a03efc89ull, 0xceb100ab248451cfull, 0x45126895466eef29ull, 0x77eeb2ab08da5a40ull, 0xc2b85fccdc3119e2ull },
+	{  233289,     483, 0xd59359e4, 0x62ac3b464495922full, 0x42d7be28ac68bda2ull, 0xe63288bacd0f8fc4ull, 0xd74e301ad4245093ull, 0xc918515f0acf0a70ull, 0xf42aef4d8f480803ull, 0xe91a1045cdf27f62ull },
+	{  234256,     484, 0x9a24c12f, 0x5d1ba60bf6b4fb91ull, 0x9872e4f6c67083a0ull, 0xed58c8d5619b3dafull, 0x053d2fa6973e4621ull, 0x3e609b6b039c588eull, 0x00ee936c55dc14cfull, 0x589612685e9b98bcull },
+	{  235225,     485, 0xf26d018a, 0x078c332afda9dccaull, 0x5c3298768ee82aa0ull, 0x285623a4fac9b4f2ull, 0x51917f7536f800dfull, 0x170f6833f5e96e8eull, 0x3e22ca69fcf132f9ull, 0x8dc08fd4fd72c9eeull },
+	{  236196,     486, 0xbbe35b69, 0x8f77c3557ca5ed91ull, 0x66a739ca0ea1bc2full, 0xb2ab30f736520b41ull, 0xaf1dee73913b5bdbull, 0x521651e013de501full, 0x9f2c911000eed2b7ull, 0xd93f862d3df049caull },
+	{  237169,     487, 0x3cf2f799, 0x6263dca5608787d6ull, 0x439374b7d0068cd6ull, 0x3a1565865b132328ull, 0xeed3649cd1a3d4e6ull, 0x8936f7b0f47b9408ull, 0x32b77e8637b1816dull, 0x7d8687c9dd4da546ull },
+	{  238144,     488, 0x0b2e82f4, 0x5122605d5d63feb3ull, 0x23256d1ed8d224f5ull, 0xb7e559f67c12f870ull, 0x57cededc8b21b562ull, 0x8772649ecd76944dull, 0x7478c2e34d920d9aull, 0x731e20a873f3976eull },
+	{  239121,     489, 0xb0e33660, 0x946e17cf245462edull, 0xa3b6cb66923935f2ull, 0x8b2039f7abd0ddceull, 0x80463e4a70413cb1ull, 0x8abf8c2c4f2473a4ull, 0x63de8258e1f34d75ull, 0x01ab4466e816481aull },
+	{  240100,     490, 0x2c479d8b, 0xb3cf0709b6b6ca3bull, 0xf15f62bf294b5fe9ull, 0xc594e8936a13940aull, 0xa8f4806f21a5bffaull, 0x1a7225287082cef9ull, 0x59f8a992001c2f3eull, 0xf305141f72f310baull },
+	{  241081,     491, 0xe5f8ae90, 0xcca7d9d3221769e2ull, 0xbf95af310e90240bull, 0x7a8930d1b6f163c8ull, 0x44536ac19e1fcc24ull, 0x8f353fbed09841f2ull, 0xb95a2a42adaddc21ull, 0x182337a3a9de8038ull },
+	{  242064,     492, 0x19d5b2ef, 0xdba116b86cba09c3ull, 0x70692799496ce114ull, 0xd4f2720fbfff18e4ull, 0xb645e1b3b09e5d46ull, 0xd18c6e0cafa26097ull, 0xdb993811cd4db5d7ull, 0x8403f2d42383fbf4ull },
+	{  243049,     493, 0xc71bba0c, 0xe5389d17c4882787ull, 0x6a5c1f07c1081564ull, 0xa91421a771b4bb7bull, 0x135f973addb599e1ull, 0xfceae813d6b1bac2ull, 0x6ed58df0391ef83aull, 0xf329a4b7502e3addull },
+	{  244036,     494, 0x15246ee3, 0x268e5d9feabdf568ull, 0xa040be56b7772bd1ull, 0xba3ef495ec22b5efull, 0x774906b816ce73beull, 0xe6ec936c6e795252ull, 0xf3d293b3559987e5ull, 0xf46aade8bb0898fbull },
+	{  245025,     495, 0x02e9669f, 0x06c61fbc3d903e86ull, 0x5985f071128c05deull, 0x70c996e351f3afdeull, 0xa55313016b98f1b3ull, 0x1e6083a142845378ull, 0x6ebc7a54ae3d324bull, 0x5035b7cecd39adeeull },
+	{  246016,     496, 0xbe0fa84f, 0xb50454cbc2fe13e0ull, 0x81753120f9666bebull, 0xe6a959b69665ccb5ull, 0x69174cc71f4bad31ull, 0x270e8c871b5cdfbeull, 0x6c2030d03154e762ull, 0xe5dc33ff5fcb40f2ull },
+	{  247009,     497, 0xf304ecb0, 0xb61e1949d9c3b67cull, 0xdbc45c06819ef935ull, 0xf29b79603abc411cull, 0x2f8ff98a59231f7full, 0x01e5bb08877f6097ull, 0x7c91cbe4b7687e81ull, 0x57f2fbaacdcf90cfull },
+	{  248004,     498, 0xba684714, 0x164f639ebfac1a0aull, 0x31822dd45cd09c01ull, 0xdc4ca1d0d8858186ull, 0x5f9a01f06bc418d5ull, 0xd469c2b381b3646eull, 0x4e2706ce1e9b64a4ull, 0x6154d5fceb515d23ull },
+	{  249001,     499, 0x384cfc7c, 0x852d8e126e2cbf06ull, 0xa070f904c85438cdull, 0x120067b2c7bf33d0ull, 0x92d90b04a06206d4ull, 0xdaf1dde0707029d2ull, 0x9c9251a2c7f94333ull, 0x37a227795a397d48ull },
+	{  250000,     500, 0xf4cf4972, 0x84f20548011cf37full, 0x6a60dc703bb02c39ull, 0x31b379d500ac27c7ull, 0xff742b05b7ce6444ull, 0xccf9b904dbf5d07eull, 0xb22bed9275ede57full, 0xa654daee7183468full },
+	{  251001,     501, 0x7bb9cce9, 0xf0db75a183ece998ull, 0xe36fdc8eef85d448ull, 0x080683e7d3ce96e5ull, 0x8ac703b60983807dull, 0x299ff18a43c963b4ull, 0x17226ada4ea4dd0dull, 0xb3bae28340daa1d8ull },
+	{  252004,     502, 0x4c7fcd1e, 0xe28f205ac0b364b1ull, 0xcdb31ab5a65c6c81ull, 0x7b247ef505731555ull, 0x0bc2bd13ec45a05eull, 0x251efe2278364896ull, 0xb075a67085ae6e0aull, 0x218cdfa96d71c968ull },
+	{  253009,     503, 0x5cc552c9, 0x9d2ba4eb77214031ull, 0x846399e612f36a88ull, 0x20bb1238c36cb404ull, 0x0f174f7eb9513c34ull, 0xa46e2e8cda412112ull, 0xf0b73975510812cfull, 0x47bbde9798950c71ull },
+	{  254016,     504, 0x52ac03e3, 0x41127f553406f1e2ull, 0xdd2563c7cfd6ad4full, 0x61e75701a007ab05ull, 0xe8b53896be987bddull, 0x1bcf1443ff1acc9full, 0x18f23f56d9ad3fd6ull, 0x219f5c17320de7faull },
+	{  255025,     505, 0xff651d13, 0x2da6ba02486f976bull, 0xa051e09507381b0aull, 0x11bb40dddc7ac303ull, 0xe415a61248f50f25ull, 0x127f9a5887c86eddull, 0x84ffafa36783be03ull, 0x1101f66f7b0fbc31ull },
+	{  256036,     506, 0xfd35861a, 0x2c13ace712ef33d1ull, 0xe0f214a3bec4f54aull, 0x83d329ca28d805e9ull, 0xb4bd57f23b637309ull, 0x624c0a1a6d3edb82ull, 0x30e90932d45162fdull, 0x9cdf79c49e5a3d39ull },
+	{  257049,     507, 0xc114ff09, 0xe5d372444d51b1b4ull, 0x5d62cf8844d9d738ull, 0xd1a264bf894236d5ull, 0x048549c8886954d2ull, 0xd717b1a07d15cd2cull, 0xa56b4075f845fb0eull, 0xad5b4cb8a8679bf6ull },
+	{  258064,     508, 0x1292305b, 0x6ce98a172aef81cdull, 0xf86201d3610fecc7ull, 0xe39f7ca94888caa5ull, 0x6faf73e590fe4553ull, 0xa622b3f25a808c63ull, 0xd35a924865b7b373ull, 0x3bd25ce8e0cb6164ull },
+	{  259081,     509, 0x6af4886c, 0x7ed0080474771bb4ull, 0x3d341e1b2ab706fdull, 0x771a5ae77293b046ull, 0xb4c021f28f6c8cfcull, 0xd8a381bd9db8110bull, 0xf1bef2170d4110cdull, 0x39ae137b50f7e9b6ull },
+	{  260100,     510, 0x59d3ad0f, 0xae592712c8d67857ull, 0x06aba0d8ed0a7013ull, 0x3b19e2346406469bull, 0x66f7ddd02fdadeb7ull, 0xdbbbb1d58b790b78ull, 0x1a32a6c2e392bad2ull, 0x12e5153c7cce034full },
+	{  261121,     511, 0x485e1a47, 0xe9207a2c1d753ae3ull, 0x88cfd74c5615341eull, 0xa62943b064d41188ull, 0x645b2ed21b1c6554ull, 0xb2e871153b78f289ull, 0xf334c61e9c906606ull, 0x98c58503807d75d3ull },
+	{  262144,     512, 0x20391a25, 0xc4f9fafbde668b20ull, 0xc3ac1b3f2a2f8278ull, 0x6bc8c71236564e47ull, 0x0807851378b7e0c9ull, 0x69b1264c5b01d016ull, 0xf6485be97bf4c841ull, 0x8523e5c7a1b90472ull },
+	{  263169,     513, 0xae940c98, 0x18179390e55fe367ull, 0x79389270e9a517acull, 0xedc11ed78161926dull, 0x373f70dde1fba973ull, 0x776f194d3a5c99b5ull, 0x1bbd8feaea19c504ull, 0x01cd3d12c42d2cc4ull },
+	{  264196,     514, 0x97058721, 0x2db3821dfc540415ull, 0x6cc729877ca17176ull, 0x0fe878e3076818c7ull, 0xc41dc1ba4c98df01ull, 0x975478998a0e04a9ull, 0x6d5c34f11656405aull, 0x4bd3ed62e9b02857ull },
+	{  265225,     515, 0x220b4ad5, 0x550dd3e3b59176a7ull, 0x13156c2e2312ad6full, 0x203c52c9363ce057ull, 0x6c13364a31e0c5f1ull, 0xe07d12c5985a14c5ull, 0x207a727a7b5921d6ull, 0xfeac96f7c59d48ddull },
+	{  266256,     516, 0xadb1c73e, 0xca2d55677bd5df85ull, 0x97d246ce21399589ull, 0x92812dea76030142ull, 0x8d55ac6c1822888full, 0xd458bc9571dc1432ull, 0x8cdf9bff97026d6aull, 0x0a80566fdd2ddc63ull },
+	{  267289,     517, 0xff428a9a, 0x2ec4b8a0cf729e40ull, 0x45e53b90a96cdc46ull, 0xd07bcf994c93f33full, 0x9c9009d0f53cb78aull, 0x90770e689ab708ebull, 0x85d92bbd8bda8e63ull, 0xd0deae917bbf77baull },
+	{  268324,     518, 0x926aa8cf, 0x15ef5ad304cee86aull, 0xbedf17b7cb5df55aull, 0x0e88d78c0b5df10bull, 0x9e14f1610c06a856ull, 0x2f4b20d6453ec6bcull, 0x02281424947dae26ull, 0x1d9651314860cc8full },
+	{  269361,     519, 0x1d020de6, 0x12143ad7d824299dull, 0xa762d151503ba79eull, 0x5ebd682269485a5eull, 0x1c2a3dcf4cf3f584ull, 0x79a904be08532eb6ull, 0xde0380a3f0624454ull, 0xc07148e1bd67638cull },
+	{  270400,     520, 0x2a2206a2, 0x8e538230e531d999ull, 0x9f077d725ac81c0full, 0x6b4d642bb372ae3eull, 0xdf4d9eb87eb7d3cdull, 0xdaafec60e0fdfa9cull, 0x4d28582c0bdf5162ull, 0xf61396e6f1464e04ull },
+	{  271441,     521, 0x299a36f8, 0xff6f084721b0afc4ull, 0x43169d91d37314f5ull, 0xe516417fe23468f1ull, 0xaa357990e7f10077ull, 0x6423cbe1872af537ull, 0x8c91f317c9c13207ull, 0x6ac1d7d1c74db342ull },
+	{  272484,     522, 0x28f9d223, 0x475906cfa736d0a7ull, 0x1f2123775eb75f08ull, 0x512bfb8958656b32ull, 0x63361fa87e6157bdull, 0x45f041d4441a3b1full, 0x2919d54428d6f899ull, 0xf0e4d4feb0c9141full },
+	{  273529,     523, 0xff381ad6, 0xd7cb701cc36122a0ull, 0xec38d31df0b8f41cull, 0x19c45e7b7d4e26b8ull, 0xf93af3eeb1ae1bb7ull, 0xab80ee038f2bed77ull, 0x241984ad3f3bb7e7ull, 0x084a0eafb78ffcdbull },
+	{  274576,     524, 0x28af70b0, 0xe5a45124ee7fa85full, 0x9e7f4646da887511ull, 0xd080cd0584ce0d0eull, 0xf4a262d194db403full, 0x9ec29e5967e13875ull, 0xea0fca1ac594325dull, 0xf60a942c344a9cc7ull },
+	{  275625,     525, 0x246c65fc, 0xb80a642368c678f9ull, 0xc30dc1dec7ed1ccbull, 0xd667bca11261178bull, 0xc172d609233f07c1ull, 0xe2282677a8da1cb0ull, 0x0e3bc0aa92e8a57eull, 0x60c64d3d71a153f0ull },
+	{  276676,     526, 0x2c78d725, 0x4505766879b47ff8ull, 0x3e8c6f0aa6b676c1ull, 0xa352eec104c58f9full, 0x9dbe027e7dc3b4f6ull, 0xf9c81810709587c5ull, 0xc3d2641da6c82d07ull, 0x6df6e08ce9ee6df7ull },
+	{  277729,     527, 0xa49c0bb8, 0xcb008bb73f40336aull, 0x4d2319d06bb647f2ull, 0xb5f68ba425e39eb4ull, 0x50b107f2805d1f78ull, 0xa28851c0498e345bull, 0xd108297a52fe7251ull, 0xd0ec636c80d62096ull },
+	{  278784,     528, 0xa6f3619a, 0x8555e87a088c234dull, 0x1c08cc560a32383bull, 0x6927d99dc9611736ull, 0x246600cde6284e61ull, 0xbb7e0398aa5cb4d2ull, 0x5628788e2c0bce1eull, 0x90a5bdaf64f9ea71ull },
+	{  279841,     529, 0x383bccc6, 0x6f1045e9203cccacull, 0xa28dfe556e56b269ull, 0x19b5df59f450f1f0ull, 0xe637c69a151922e0ull, 0x0a2861ad8bfc5b23ull, 0xa41874dff2a67bf6ull, 0x6312a73fe3cce4b7ull },
+	{  280900,     530, 0x18e8586f, 0x0ff6e8743729374full, 0xa5850aa95a9dfc54ull, 0xbb79b0a56140ea50ull, 0x313b97c6b78385d6ull, 0xf72c4da7dc04a581ull, 0x16268f649d9eac73ull, 0x1b63f9d085c26922ull },
+	{  281961,     531, 0xfce5c7e9, 0x760ca3ab84b96d95ull, 0x569af9d5517a857cull, 0xc50e75a5839cbd5full, 0xb35ee8550a60bff3ull, 0x4ba1748a798c7857ull, 0x91fbe9893a2f8b40ull, 0x42a8926f0f7574bfull },
+	{  283024,     532, 0x04d2ae9e, 0x66d4921ab7f2cd7full, 0x18a91bff8aef5046ull, 0x98e22af6ee5e4ca6ull, 0x9639c08b77ecb5faull, 0x886f94e4d034358full, 0xfc22878cd4453d05ull, 0x3217f93a998ca6c6ull },
+	{  284089,     533, 0x5b28abd8, 0x10ed58a4b916e902ull, 0x1199c321617c595cull, 0x4927142bd406f03dull, 0xb1f0dab7aa18ce89ull, 0x5c93304e1eb9e118ull, 0xa5f46846d18abf68ull, 0xd7e388a84699362eull },
+	{  285156,     534, 0x2e6b65b5, 0xc9a5385ca206ceceull, 0x0a60d65284d77b3cull, 0x2347f681bfca3803ull, 0xc629143f0540ff3cull, 0xa864efbcf8750dd7ull, 0x44cd939898e24ef3ull, 0x97524abc914ee53eull },
+	{  286225,     535, 0xe4b87746, 0xcbaa1a6de4413da9ull, 0x2331be2f478bdc97ull, 0x1721dc9e1d874f36ull, 0x68a1b887eeb166eaull, 0xe421adaacef032feull, 0x926e8b2bf6de875cull, 0xdf4c66edb818d8b1ull },
+	{  287296,     536, 0xf016c304, 0xbbb4eb59b87de1daull, 0x8e27afc09b0f2d19ull, 0xe02b00bb9f394ed5ull, 0x085db18a8a767e8bull, 0x9d00cc865b191f1bull, 0xe80f96274b9b7e56ull, 0x4f4d985436f0286bull },
+	{  288369,     537, 0xfe9a51c6, 0xdd3a139d031a1236ull, 0xb774ce4ea7fd42d7ull, 0xe3a63b76ea140de6ull, 0xf4c2580d52318688ull, 0x058f4eac3e665989ull, 0x95b981a8d1b84686ull, 0xefa55466cff28195ull },
+	{  289444,     538, 0x39ac4f72, 0x74a45a00b24d5c0cull, 0xf46970fa48705ff7ull, 0x33641591dd791450ull, 0xfcc7b90d8a038511ull, 0xff2fb678a7f9fa1eull, 0xd41ea8166dd5b8deull, 0xf2d8524ee4fea64full },
+	{  290521,     539, 0x12393c17, 0xa3fd3df09060247eull, 0x667b85fd88f2d455ull, 0xb70a71ca3954725aull, 0x79dfb8fc7f28efe9ull, 0x3dbaae76b1cfdb70ull, 0xc83f056ad74fe884ull, 0x2e455e16fde8b7acull },
+	{  291600,     540, 0xab3dc3fb, 0x086252b170efb94eull, 0x58d0f6417ad512fbull, 0x88e4cf9b077d3b7full, 0x3c645a6fabdd384eull, 0x905969d5b6eacdbeull, 0x88f200a0a0890672ull, 0x131d62ee72111691ull },
+	{  292681,     541, 0xd972d636, 0xbd77b0530e661257ull, 0x42e3c0518eebd4d3ull, 0xa924764787d5b2d7ull, 0xa7f96bd03fba8672ull, 0x7e558a5659c7049full, 0x429e6f412d8fdebaull, 0x5805b918955366f3ull },
+	{  293764,     542, 0xf0b2ee67, 0x421b2daca39993a8ull, 0x87e550ee6fe3b998ull, 0xab6ca5058d7514cdull, 0xb50323ca7823ceb0ull, 0x142c2f2f9eb8808eull, 0x61e485e3b3618882ull, 0xd43f1fb1b14186d8ull },
+	{  294849,     543, 0xbd5aaa07, 0xf1174b5a928fae35ull, 0x76a93f9cd391dc90ull, 0xc218f6e2633aec8dull, 0xa0b5704243681d2eull, 0xbb3d9acc0085f1fdull, 0xba7253d3f1e90c68ull, 0x2600912e2e503e5cull },
+	{  295936,     544, 0xbdc814f2, 0xe5440fee5447cf76ull, 0x47e115d87f6d1810ull, 0xd2e28c349c05c7afull, 0xb42d740515643662ull, 0x5cf24a7b9bb2abcdull, 0x81b108f9fbaf8e39ull, 0x020a2b3fdfca669dull },
+	{  297025,     545, 0x60c1d856, 0x6f319552d8d3dca0ull, 0x70e9559632bde285ull, 0xd24e7c7be78eeaa1ull, 0xb1c052834daeb6d7ull, 0x6d5825787bff0cbbull, 0xcfc54ec1901fcf8dull, 0x74f1d4a7cfec8d61ull },
+	{  298116,     546, 0xc78e2b02, 0x37bb59ceae20b9e2ull, 0x671b36be8282634cull, 0xb9e97cb85ced7f9aull, 0x1a4c2d2ecee3fb63ull, 0x4bbbc80ba71cbaa1ull, 0xc3f4bd8049e388ddull, 0x9e2b06886879acc0ull },
+	{  299209,     547, 0xc949a58a, 0x64224b1d2b4a9a1cull, 0x86899e8840d2d70bull, 0xf9a7b132d2cd2e69ull, 0x213078dc31a79e16ull, 0x0810f0a79678ddc8ull, 0xe5ce8c6e748f4504ull, 0x7ebba6cab6bb7cf7ull },
+	{  300304,     548, 0x646a3e87, 0x77ada6813377eca9ull, 0x6a5a794374ab06f8ull, 0x6fd9157df2b138ccull, 0x4f994aa1cc5d9ce8ull, 0xe50a43b43343b016ull, 0x70de6cc469b8f52dull, 0x0bb6723fddcd5c7aull },
+	{  301401,     549, 0xe0834f3d, 0xcc090240d17b07a6ull, 0xcd413d597e8f9508ull, 0x435e25c94427edc7ull, 0xe3e7894da2b37d09ull, 0x33800c02d7f630baull, 0xed2cecab98ae2019ull, 0x9bab4c03d06ca2c9ull },
+	{  302500,     550, 0xaddd929d, 0xa0205672ee951b1dull, 0x084883411c9a0608ull, 0x6985f91f74793a75ull, 0xe3fbb726c29319abull, 0x9e06d5ce7643213bull, 0xe9bd6107d124973cull, 0xb902795b74624f3aull },
+	{  303601,     551, 0xdc3a6afc, 0xe91dbccd1c044988ull, 0x828e41b2e097ebe5ull, 0x3e58400eb881e84dull, 0x42687f19b04a73e9ull, 0xa9444140cc730110ull, 0x7b668555a75910beull, 0x55c66d768c39ef42ull },
+	{  304704,     552, 0x5e54e6a1, 0x57f9b8f542b9b895ull, 0x6ecb9cd051d3a10full, 0xb9d8f75ca00105f0ull, 0x1998f40da1935c4bull, 0x489c53fd59130641ull, 0x2a9fad43bcd19940ull, 0x0c5a1f29a08c7284ull },
+	{  305809,     553, 0x68bc57f6, 0x10dddeced195fbd4ull, 0x11b1ff2af67741b7ull, 0x1065b966699d81dbull, 0xfce10a843498ebfeull, 0xd1b2e03ab77d893eull, 0x628bf72b14806d32ull, 0x22a84c852b9c776full },
+	{  306916,     554, 0x5169db75, 0xd99ae337d8fdc318ull, 0xe4ca36f4403b1414ull, 0xac076e10b7c73212ull, 0x1815b9b4e0c79b62ull, 0xa0e83168b72ff999ull, 0x90b68733bb5fb0f4ull, 0xbd6ec11a33ac65aeull },
+	{  308025,     555, 0x11b4956a, 0x713963fcba1b3635ull, 0x57f2f8d57cadf563ull, 0xa548dd4beee80300ull, 0x3653a7a2ad73aed9ull, 0xa7c13de3be26982eull, 0x57d39db85cca1d14ull, 0x3f00e3b22c399f5aull },
+	{  309136,     556, 0x38bdf643, 0x3d72eaad4ab82ff5ull, 0xab1deedeb7c0e12bull, 0xed605a5e30f58e78ull, 0xa6756df776e5f531ull, 0x280371944e4fff4eull, 0x048716cbfa50d858ull, 0xdd88d77b31dedfcaull },
+	{  310249,     557, 0xcf6b1a6a, 0x38c7712290b85c30ull, 0x8b7b81755ca3071bull, 0xe3e408890dd0918aull, 0x3973c0b0181cbcadull, 0x50c40d6e7729a044ull, 0xffdf3ccd2046319eull, 0xe53f300f3163256cull },
+	{  311364,     558, 0x95b2cbd5, 0xc456f6e72e9f5cf9ull, 0xe48d32a6188fac42ull, 0x6c5b540376b505e4ull, 0x6a39dd6417d104b5ull, 0x5832852a6899d8d8ull, 0x926c46cd33daeeabull, 0x74472ff663a412bcull },
+	{  312481,     559, 0xd059e5f9, 0xea5baa0a671cd6cbull, 0x6113123b13951966ull, 0xaaacae230caa4399ull, 0x46b5653713ffda98ull, 0xd1adda624a8b5cb9ull, 0x481b611d2219de4aull, 0xaa404018b413da74ull },
+	{  313600,     560, 0x43fbcfb0, 0xe5bc363a2b0642c1ull, 0x5159e9a04c12c7d3ull, 0xd1d08a9507a96971ull, 0xb60f6a95de0af50full, 0x5f4e4b2c81cb01caull, 0x2e8f118e508077d3ull, 0xe351a7178b0992daull },
+	{  314721,     561, 0x1353ae1c, 0xbe656e11aa59fa8cull, 0xbe0d6d37e9865934ull, 0x5f80b332e1497202ull, 0xc2604ced24e4c427ull, 0x1cdfcfcd57716600ull, 0xcd1e77a9a6ef9e2eull, 0xd55ccdbe3c494126ull },
+	{  315844,     562, 0x232d1df0, 0xf2e6ddd35929915full, 0xd5ec76b301f82038ull, 0x41b0c8e6895bf5e6ull, 0xa5cb8c42806e8dfcull, 0x58272f339551bd41ull, 0xd68b94c7f7eb03e3ull, 0xc130c197143d7ab7ull },
+	{  316969,     563, 0x069f99ca, 0xbb4b8cb7dd5bb5dfull, 0x239cc34d8e2cd33full, 0xd3e6e9d788f0f130ull, 0x8d9a404e6e26f001ull, 0xc7b055522e592186ull, 0xfbc379d7cf8b968full, 0x9e02f13c4b9bb717ull },
+	{  318096,     564, 0xb9788916, 0xbc20c80cc3b3e1aeull, 0x319a51d8fe5e1e7dull, 0xf92773e67a697be9ull, 0x120a5565162bf38bull, 0x3b00531ae2a34b58ull, 0x98580a993a22e876ull, 0xc95c36e584a1dd0eull },
+	{  319225,     565, 0xe438c4cb, 0x0839be1945c03e8bull, 0x1a65216774af1e4eull, 0x58e738a4a4b74377ull, 0x78561e8aa70891b5ull, 0x44e6319d0fa44d14ull, 0xc445e86c3fe4e310ull, 0xcb9e4b41f57dac3eull },
+	{  320356,     566, 0x733279f5, 0x680dce43831c8ac3ull, 0x556e961183e13b2cull, 0x75b0197fbb37255bull, 0x5a8485003b518f4bull, 0x803df52d7d84b59cull, 0x9aa9f49fcdad65adull, 0x0839214e5a2efaf3ull },
+	{  321489,     567, 0x49756b72, 0x6076fe168cd714f2ull, 0xd3d98dcfe9500cecull, 0x210e1a2903ae17faull, 0xf6d7ea8e1cea8e00ull, 0x8550cfc51ff1e56cull, 0x3251e439a9a7acc7ull, 0x255dd1158b92b30aull },
+	{  322624,     568, 0x0cf3a265, 0x60d67f78eb657722ull, 0x04d4c83616893b59ull, 0x34c7a4b004d910b0ull, 0x0509f8a068bc443eull, 0x559ae02efa294bd1ull, 0x4d134acd3ee4b19eull, 0xf377515b76874ed6ull },
+	{  323761,     569, 0x0eaba3df, 0x308b11604de4fcefull, 0xef29538768d3e614ull, 0x17c50cffd26ecd98ull, 0xa90a3ac1c5afeddfull, 0x709d9a7a00f8abdcull, 0xbf33ab8ae3f7c65cull, 0xb3c447644cfee603ull },
+	{  324900,     570, 0x908c6e6e, 0x4159df956e69d8c6ull, 0xba57c82c5d2499e2ull, 0xebf2b1dd2f6f0ba8ull, 0x9e17da64be73ec3full, 0xca0a6e681174bf18ull, 0x36fa45b591252824ull, 0xa690cbc35fefc6daull },
+	{  326041,     571, 0x39509740, 0x6c83b9d89e9932c6ull, 0x05e6b0e16af1604dull, 0xb96f15b15916b1bcull, 0xa600587eaedc26c8ull, 0xcb65ecccc6093b14ull, 0xde26972463255d53ull, 0xfa80650842ccb909ull },
+	{  327184,     572, 0xcfab4376, 0x24307ae2b34ec04bull, 0x42f7fb0c686fdd3eull, 0xebc4f344d3507aa6ull, 0x00a53220e27a1131ull, 0x9c81742a6fdc728aull, 0x8b03de84ae907ed2ull, 0xac704d094b2116b2ull },
+	{  328329,     573, 0x17302b3e, 0x1e10723bb0d7e330ull, 0x61ed3035d2d16049ull, 0x844f53c208fc0073ull, 0x03599c47272e55bbull, 0xb5d0a12772cb7eccull, 0xb7954a9dd79177eeull, 0x56c8aafba38def9cull },
+	{  329476,     574, 0x0b230483, 0x1b05a4562011ba51ull, 0x0c18c7bc14d611e2ull, 0x56dc19295c5073f5ull, 0x8b23fd6545bc93c3ull, 0xa818a02033ab7834ull, 0x791edef93c2af1b4ull, 0x224e9e3066f0edb3ull },
+	{  330625,     575, 0x3c907dde, 0xe2b1c44754fcf726ull, 0x7e2833f8d703738aull, 0x5f60c04af72e6327ull, 0x2e1cadc476f20e7full, 0xae8ea0718292758aull, 0xded6b523a2a0f0b4ull, 0x9f8b80d9e2786097ull },
+	{  331776,     576, 0x421c0650, 0x67d84d3ddfe2314bull, 0xd36cc708998df338ull, 0xeadfdac4cffcce5bull, 0x4f45058b984b253aull, 0xb178001b0d536db5ull, 0x9bc8afc786140a46ull, 0x32d0c445bd8531d5ull },
+	{  332929,     577, 0x187c98ca, 0xc8b058c461756d35ull, 0xaec5c182c9779f1aull, 0xc5ac8551d25c8580ull, 0xb77d5b74ffd13e2eull, 0x51b489d15f087dddull, 0x393b1eb38d269122ull, 0x3c60fb932725785full },
+	{  334084,     578, 0xcde2c504, 0xb59ce60c2341130aull, 0x8f51c602086e93dbull, 0x15af4a9f0f0d4ee7ull, 0x809faf0d740da3dbull, 0xf246799df8e643dcull, 0x0c9397ce4de11e83ull, 0xab6202615d6635d2ull },
+	{  335241,     579, 0x54c40bc4, 0x2dbe66c52d55f6d5ull, 0x1c3331fe8cb3b1f1ull, 0xbd2e37ed9380dfe7ull, 0x1f703bd501e70773ull, 0x849600ea695c00e5ull, 0x4ce18a7f032208fbull, 0x0aed8777605c3882ull },
+	{  336400,     580, 0xba58d720, 0xab3e543393a5aeb4ull, 0xed6ee76e6354caf3ull, 0x2df0350a7032a31aull, 0x25ef7307496cb479ull, 0xc863bad24aa651daull, 0xde7d85196bf92ee5ull, 0x1e4572c732fd1444ull },
+	{  337561,     581, 0xc4b02ba7, 0x720f6aa0247cc241ull, 0xafb90e854658f522ull, 0x9f22baee4eb129a0ull, 0x8400ee187460b6e7ull, 0xc16d9e6b030f8938ull, 0xb8ea585d6fac2f76ull, 0x371dd5074df409c4ull },
+	{  338724,     582, 0x65fe6c4f, 0xd629ff33d185987cull, 0x9a43acc83941b5e1ull, 0x7635e3eb23df3552ull, 0xd16c5d6342284e86ull, 0x50262cc63208284cull, 0x44c2dac56436e68cull, 0xf33738bb126737e6ull },
+	{  339889,     583, 0xdf03ee21, 0x792e5ed3334dffc6ull, 0x7a8dc78729b7c4e5ull, 0x33f4ab578b2a722cull, 0xbfd216947d6c2e3dull, 0x4e0d3b6da0b1456full, 0x8a5f5cb10a19a604ull, 0x3f1abd222009426aull },
+	{  341056,     584, 0x9aa78911, 0x558ebc6357ddf68bull, 0xea393f3fc6dea5f1ull, 0xf767e4052952ede1ull, 0xf4081b68a504719aull, 0x828b1ea04adb16c2ull, 0x1e6f0795f0993450ull, 0xf0cb278582778e00ull },
+	{  342225,     585, 0x02f82d9c, 0x00967894993fb9fcull, 0x267d9126efed3108ull, 0x06ac32b235a15ea9ull, 0x8d3961dcb3f46a14ull, 0xc43034af7e06a21cull, 0xaef2d0bf643b70d2ull, 0x966d987a590f35bfull },
+	{  343396,     586, 0xa3b25f33, 0x47a4888048ed9efcull, 0x855a743df08bfafeull, 0x15ccce4cc71b7ab5ull, 0xebe02bd6e090c2e9ull, 0x65eed2f4e973f0ddull, 0xec019468e7f451ecull, 0xc7959adce05b1931ull },
+	{  344569,     587, 0x8669a26f, 0xa58265291a8656d4ull, 0x50aaaef710bfca0aull, 0x11ed64dc992b9a9bull, 0x3f5d37e2e2c6a2dbull, 0x9b3e6a7b69048068ull, 0x02acd64fe4275f89ull, 0xa222296ce047cf54ull },
+	{  345744,     588, 0x08aa8d71, 0x23abf62b5a3689e9ull, 0x15c83a7858843998ull, 0x1406ee4dfdc986baull, 0x79bccb720dd8426full, 0x589b07678cb5113cull, 0xa9fd0ffd029dc9d5ull, 0x651ba644d7302e22ull },
+	{  346921,     589, 0xad731ad2, 0x8cd58935f8801b91ull, 0xedf3ce6ef4469dceull, 0xa30f75447f90e78dull, 0xf25f232729938b27ull, 0x9e338c685ed2eb11ull, 0xc20504e74c39751aull, 0xe5914543293650efull },
+	{  348100,     590, 0x9c7134ea, 0x2c5ddedd3c8ecc7eull, 0x46774ae5d2014ae5ull, 0xd17f7f1fd30c3194ull, 0x27e3762beda54864ull, 0x0eb9df306f46c96eull, 0x557e6d03f76109e3ull, 0x72cdd301c85dd6fbull },
+	{  349281,     591, 0x64771ac3, 0xa3b3136dc0dbf18bull, 0x180385903beb6c04ull, 0x55ba98c16953e4a8ull, 0xca431e9fea93e6feull, 0xa46d05b180b98698ull, 0x3e8fbcfd4fe16656ull, 0xd280a04d44007e08ull },
+	{  350464,     592, 0xb195d561, 0x7feb3060110b4cabull, 0xb2946fdce290258cull, 0x84f76c485a3a8621ull, 0x4d6c1afd6f80257aull, 0x8295ec66c2b704e0ull, 0x783c33fd6fe8ec49ull, 0x488ff1e6a622ae91ull },
+	{  351649,     593, 0x492360fd, 0xdee164d485cdd73bull, 0x85d4f0c4c7fb64cfull, 0xaa8832a50f201e98ull, 0x07468d71efa604e7ull, 0x058ad458989ff2d1ull, 0x3d4f1dd1a56d5c63ull, 0xc2b0becfe1bbbfbfull },
+	{  352836,     594, 0x1b8b62d0, 0x796e97376673fdd2ull, 0x127d9552969e96b7ull, 0x7e86ed0e366ed2f2ull, 0xe7b79e62a0aac55full, 0x1d27e87019f3561cull, 0x042d8fc34052cd5cull, 0x52be413d4425eddeull },
+	{  354025,     595, 0x892c7050, 0xd69124e13f66dcd3ull, 0xdd1062b3f5743a19ull, 0xe59784b9c3e5d46eull, 0x4948b7e8e732167eull, 0x20a258de12c8794cull, 0xe5b4170ec59ea3bcull, 0x0d288223cd18b541ull },
+	{  355216,     596, 0xe36cec6e, 0xc05e5842f0e8d125ull, 0x842686a5d8a226b8ull, 0xba161c2684bbe689ull, 0x79cd9523dbf156efull, 0x599d1f2e76cf477cull, 0x471294f6f67d21e1ull, 0x86f677131ca2413cull },
+	{  356409,     597, 0x148c57f7, 0xf2b26f153eba238aull, 0x0052640f97fe021bull, 0xa161734a24de93b0ull, 0x18227b65b68c07c5ull, 0x0ad74e1326ad38f3ull, 0x79abafc84ac0cfc5ull, 0x95e2c1077f1c5803ull },
+	{  357604,     598, 0xfd967384, 0x1961ac5fae3b2859ull, 0x6d2d5564cfee3d85ull, 0xc32d8761c34a48d6ull, 0x9540ac16bd3f6ff1ull, 0x54ee1d90da439267ull, 0x7b9fa0c868116d4bull, 0x6740945e74cb2d4full },
+	{  358801,     599, 0xbc67910c, 0xc512bd94377626c1ull, 0x2fc5ad205112d27eull, 0x069ee38b38a7e941ull, 0x2741b80bb33ac2cdull, 0x6af72fb2901c8d73ull, 0xc41261380d6e11ebull, 0xe843b2ba5ccadc74ull },
+	{  360000,     600, 0xc4c32246, 0x7d894c42e0c3308dull, 0x38c37ebc4ef24b6full, 0xf591863bf26ab68aull, 0xa6dae466028002acull, 0x740e6a08fc25ccf3ull, 0xf34ab376848ff7c9ull, 0x950d5671c7513c4dull },
+	{  361201,     601, 0x87dd8a34, 0xb51c0dabb4bfe9c9ull, 0x4293d147c7d90806ull, 0xe8ef3585e7ae1023ull, 0xfd41809dd618f19aull, 0xf548e7e7dfd56b71ull, 0xbf9705cf30c0ece1ull, 0x46de0a06940cb6c3ull },
+	{  362404,     602, 0x55279dfe, 0xdd69f877d9066ebeull, 0x41175806b2ae8dcdull, 0x746dbfa93f6ecd34ull, 0x6b987807dc27c5ffull, 0x0ec234d8e7177eb7ull, 0x8ea0130e12da1919ull, 0x1bed54e8aa443101ull },
+	{  363609,     603, 0x75ed508f, 0x58d1a73c9f8e0c6aull, 0x38e60c43500256d3ull, 0xfc9567db1df7088aull, 0xb588c80198f8717eull, 0xa485e02755b59773ull, 0xce88ac1043b65613ull, 0x840f4f9e499b173dull },
+	{  364816,     604, 0x6eb00765, 0xc88f5374f73d645full, 0xc24d452b79541218ull, 0xa4b0419a20c38bdcull, 0x6a4f580fb474ffa6ull, 0xdd2456d960b18851ull, 0xd30ac82058540712ull, 0x3657680534579669ull },
+	{  366025,     605, 0x930b6ef5, 0xdda1fae3021a18e4ull, 0x98314573c39adb66ull, 0x006af6429ec4c7a8ull, 0x675d919f57a5d647ull, 0xdef6e0fa9a70230eull, 0x928c20d0cbcdd9a0ull, 0x2174c81bf483bbc0ull },
+	{  367236,     606, 0x7d836074, 0x04ceeac8c4973401ull, 0x9429a10dffcc808eull, 0x52ff97ef2f0597a8ull, 0x283707d07886828cull, 0xa7a60ef1250ac190ull, 0xc31bc38a58188690ull, 0xa68d1738ecc8b0b7ull },
+	{  368449,     607, 0x988ea073, 0xaa9cddd96edf0154ull, 0xdf81356cb3070d7aull, 0x8443fddfc97c04fdull, 0xc46c6e3f8fd6568dull, 0x3a769b0c84e7aa97ull, 0xdeae46082357e227ull, 0x3ac14072b839e892ull },
+	{  369664,     608, 0xd00fbfdc, 0x1cbd7d5f5e36c446ull, 0x88eb75c44c700d4full, 0xf1a92a2b2a73b5f6ull, 0xca2ccfef64063523ull, 0xae3aa23aba951ad1ull, 0xe5b722c13540fb5cull, 0xdb04e0b5952056b5ull },
+	{  370881,     609, 0x47f37395, 0x41bb4643f51ade31ull, 0xaaa97925b87d159aull, 0x05be9947e47b241full, 0x63aa07c659fac252ull, 0xfc577fa1dacf9c82ull, 0xffa79214ed72b859ull, 0xdbd7ca3aaefce2b2ull },
+	{  372100,     610, 0x1d7e4c5c, 0x8bf5714d8bbdfa4eull, 0xe64f1116d910c90aull, 0x71146973f0a37435ull, 0x9797671fbcc687eeull, 0x9baf19c150d3545eull, 0xd767d204e5d8ecdaull, 0x1caa37327cb440aeull },
+	{  373321,     611, 0xd6d90944, 0xfe1da6b298e0a5dbull, 0xd08a355e5a23326eull, 0x5553fe12c43342e9ull, 0x7b6192b076522cd3ull, 0x492c8191688a4ba2ull, 0xa96e9a6b056e9489ull, 0xee9dc262b6127125ull },
+	{  374544,     612, 0x58eb21f8, 0xfc937b3081ed1f2aull, 0xe644a8b97e979cfaull, 0xd25c0a577b392ec5ull, 0xa2a9fae496998895ull, 0x91cb4bb6df81e201ull, 0x2958a157f789e994ull, 0xaf530b0b6d2211eeull },
+	{  375769,     613, 0x2c2be18d, 0xe6581b5dc75b60b5ull, 0x0a36b1256aa29941ull, 0xe1542dad1eaded38ull, 0x1269ba4bae7666dfull, 0x0feb81e2c32f952eull, 0x0a2b651b7413cbe8ull, 0xbc72349441478d23ull },
+	{  376996,     614, 0x8478d232, 0xd7bfbe18aa04c6f2ull, 0x215c1dd3c10a4ca1ull, 0xbea08f795fe6634aull, 0xf4af9e0aa42f524full, 0x56418308b78ee037ull, 0xb2eeff1c812b747aull, 0xe0de4a416a97b83dull },
+	{  378225,     615, 0x157da167, 0x49258c1859a4e5d1ull, 0x087c51f9db7ec6f3ull, 0xde3f20bbde92408cull, 0xc6da9c43815295f0ull, 0x1694158e9cd25e38ull, 0x7119ab763851d185ull, 0xfeb6cd4f80cf9e62ull },
+	{  379456,     616, 0x6e2607ab, 0x4c168a03b74252e6ull, 0x4b4fdf01669bbbb2ull, 0xd2fb3aac9ba27915ull, 0x5c3c62c885730b41ull, 0x18f0c55948a783ccull, 0xa68c963489ff430full, 0x6446b0366b50f9e4ull },
+	{  380689,     617, 0xfa66e703, 0xc7c33a80a129c833ull, 0x99146bdfdfeac902ull, 0xbc59b716ff36620eull, 0xc65e23ce79cde8f0ull, 0x1d1d92422cc2b24aull, 0xcab9503781837fc3ull, 0x32b81cbee8b0fa06ull },
+	{  381924,     618, 0xe32ad412, 0x37a0008aefd7ebbcull, 0x83d861c60eaf3399ull, 0x256d383101b5ed9cull, 0x73d727a53f428d51ull, 0x76e917121fe8ab50ull, 0x8821a30cc8811e05ull, 0x8f37d1a7c7134be8ull },
+	{  383161,     619, 0xf6d52e38, 0x77ca0ff701be2058ull, 0xd865c5acc38652b9ull, 0x3a726df7358ce3c4ull, 0x3be6a129c94cc49dull, 0x50aaf486b40de835ull, 0xfa164ae2883f3733ull, 0x97c25acf34b19c77ull },
+	{  384400,     620, 0xc32ae7cc, 0x0664f05320dc3538ull, 0xd8363704fd3679a0ull, 0x36d3fc4f04a84b2full, 0xb9ba37945e2c9f7full, 0xd023bf40550a0333ull, 0xed17fa6970600ce9ull, 0xc88eb39ce718cf1cull },
+	{  385641,     621, 0xaeb73c00, 0x3cdcf59bc35ae94dull, 0xcef926782ee537c2ull, 0xf84d99af606f33e9ull, 0x300cb741d4e0ddfeull, 0xa73c554383f67c95ull, 0x4a8aaf841b489e91ull, 0x1bb67452fb23b627ull },
+	{  386884,     622, 0x4f615dd4, 0x57630465d2516d08ull, 0x4e857a8e6845c56cull, 0x3b1afb42e28817c6ull, 0x288f37250d82d2a6ull, 0x684daa7e2e0fa925ull, 0x4132d9a3c35fddebull, 0xe55c021784573606ull },
+	{  388129,     623, 0xd8a618de, 0xa7dd33ca207d2ee4ull, 0xe804c569c4211ff5ull, 0x4ecd941d1e03e558ull, 0xad2392c1eb1f2496ull, 0xa625c4e1857905baull, 0x9498de5d88066e38ull, 0x5c4f4a808aa0f4deull },
+	{  389376,     624, 0x97f29ff4, 0x7fb1841f85a13093ull, 0xc176a07c995557e8ull, 0x6a6151ea3b7575a8ull, 0x4c2740ebc31003e4ull, 0x99c7dc001e8ccba4ull, 0x67edcdad74c3b117ull, 0xb1a5fec16a8a43e4ull },
+	{  390625,     625, 0xa0db94e6, 0x57083db7f93b2ee4ull, 0x581adb2c2a4dfd56ull, 0x490a96f1e292bf02ull, 0x177e8c70feb7b4d7ull, 0x5c647e44d9bdbc34ull, 0x716dcad4bebf2d72ull, 0xc9cd782b8509be7full },
+	{  391876,     626, 0x60d1963d, 0x677f14784b8ad160ull, 0xb0ac582a55128615ull, 0xc36a7f17665a8c4eull, 0x7bbd5b11321bc0d4ull, 0x4db057a3808c8ef0ull, 0x44b492388efceb8aull, 0x3621f2ec295306ebull },
+	{  393129,     627, 0x8482d448, 0x6048c657cbf8aab9ull, 0xde9aec3eea015341ull, 0x365f9a294238e46aull, 0x6db287a6aaa90f7aull, 0x3e4cd5103a4126ddull, 0x7a8ffed8469fd5a4ull, 0xb951057986364d16ull },
+	{  394384,     628, 0x738023fe, 0x3996ae29ab7b767eull, 0x854954d338c313d7ull, 0x3cadcfdd1aeb7606ull, 0xb37876d3544a0644ull, 0x4339a510e0fece42ull, 0x610fa1d52fbc7e79ull, 0xe1e104c565aec667ull },
+	{  395641,     629, 0x51c7e6f9, 0xf4cb6e25149ff20full, 0xee887a4957161382ull, 0x23f34fc672e72712ull, 0xe158757c515db08aull, 0xd44fffc92ca8fd5dull, 0x52d12c549391c41bull, 0x70b40e27252ab08full },
+	{  396900,     630, 0x6aa747ee, 0xb7e94d91bb204f18ull, 0x72c4bb104d0d5ce8ull, 0x64c9d04d5796cfa9ull, 0x556cd897a16857acull, 0xfbe93efa3d7c5864ull, 0xc05bf7460fcc22e8ull, 0x76e3f2a27dc54777ull },
+	{  398161,     631, 0x1fb7ef60, 0xe3f8376dc1511064ull, 0xa65a96988421bd6cull, 0x0bbd3029a5e8f174ull, 0x8a5eb9ad5d8fff6full, 0xd380cef6e8765780ull, 0xb5c31c6ebe68e279ull, 0x753e9926fb5e6b68ull },
+	{  399424,     632, 0x5ed11a77, 0x6698277a886563e8ull, 0x2dd249e7f9746acfull, 0xfce8152649a43afaull, 0xeacbba35453399abull, 0x8a55628dbe63079full, 0xf9492d6120708fffull, 0x37a1cdbb4c315dcaull },
+	{  400689,     633, 0x51c78ce5, 0x9fc1389c991581e8ull, 0x745619044d1d526bull, 0x1cb851b00704d5aaull, 0x8e165cc1aea5c1fbull, 0xd5da8e71593b6557ull, 0xc892a90dcb36ebaaull, 0xe201194c372e6639ull },
+	{  401956,     634, 0x77a4342c, 0xa8e627c8a8d6487eull, 0xe0a308c00493a923ull, 0x08fedd37d49ac5ceull, 0x1c21ee513b74d1aeull, 0xd4f8e1493ad9f254ull, 0xf91394474cc011c0ull, 0x35aa7f14aa64209aull },
+	{  403225,     635, 0x7f43c6be, 0xe773fa478b50c0a7ull, 0xc42ed8f94f55d705ull, 0x08572795064de13eull, 0x9d01bbbdd35e6dadull, 0xc8f82d15ae3557dcull, 0x606742ed2c4ce4bbull, 0x5fa1cbc0f4743d0aull },
+	{  404496,     636, 0x3e6d4e70, 0xad14bd5bf1641dbcull, 0x34c8e79ca5f5c4e5ull, 0x0fe5dc05e7eef372ull, 0x9aa066d6a916cd3aull, 0xfe037497391073c1ull, 0x8369fe9370013918ull, 0xf1a67943962a2e58ull },
+	{  405769,     637, 0x66b6d385, 0x7afd1f4af58330ffull, 0x7e9265bfdc88f51eull, 0xdc6e6a5df1725078ull, 0xf14a69b961707712ull, 0x339f6ef8338b0699ull, 0x93089b6a7c0df327ull, 0xfab739380892c129ull },
+	{  407044,     638, 0x13691e4b, 0xcd37abd9dea4ae0full, 0xaa1cf0d8fd04fd9bull, 0x26cc1000230540b6ull, 0x0529f1a8dbf94f78ull, 0xde7a2f0786e1eef0ull, 0x892792cc7a48b085ull, 0x0dbc985fb2dc6b33ull },
+	{  408321,     639, 0xd499d8e0, 0xd2de0b93340e88fdull, 0xe78709a62b4483cdull, 0xc45627e2a8eafe92ull, 0x39e05d0781a231cdull, 0xcf5cb0e0573e6028ull, 0x27db6a308816253bull, 0x061f28a3d958c24eull },
+	{  409600,     640, 0x794a93c9, 0x583b73ddf3a7ec25ull, 0x1fcfcd477fd12fa8ull, 0x27ad5b1ac4379b95ull, 0xc4e614c59b52bf41ull, 0x8ca58fba846b08b1ull, 0x46034afcb73b9077ull, 0x657b944cf812eb51ull },
+	{  410881,     641, 0xb38b7985, 0xfb75377c5365173dull, 0x3a262c50c652da65ull, 0x44de6bb4244bf3e2ull, 0xa5b29e18150a7d72ull, 0x99452281bd5c77e0ull, 0xf47d0969caaedd44ull, 0xbd5214741e35d40bull },
+	{  412164,     642, 0xcadb43e7, 0x8b75400f176d57e6ull, 0xc863f9dd0508f654ull, 0x590d0c2f1d44ccceull, 0xf5e7645d17e8836dull, 0xa0ec3dc0149ac633ull, 0x6431dacb61e54f17ull, 0x868de4fd9ff34296ull },
+	{  413449,     643, 0x6b6746d0, 0x27febc8d4c516cbdull, 0xd6b676c79188f9a4ull, 0x1ac18db0be1b8dbeull, 0x0e9802de19f60c33ull, 0x186c70a97409e17eull, 0xac3a6b6060fa1f7full, 0xbb252898f263dee3ull },
+	{  414736,     644, 0xedfbcc85, 0x6e1360f81911c055ull, 0x2c6b54420cb682faull, 0x5338797c44bedb8eull, 0x7fe9036b57a715e1ull, 0x0f4cd00690c41c58ull, 0x399b04c92a90765full, 0xfb6d94bc78548fb3ull },
+	{  416025,     645, 0x6e9177a0, 0x94cc95a7d11af9f8ull, 0x0848ed6d3a86b72eull, 0xd4f8a7cf8a6b5b48ull, 0xfa2b17aae7d65aa4ull, 0x7a622e53318778a6ull, 0x3f562a115e47e67bull, 0xeb406642df730a20ull },
+	{  417316,     646, 0xeefc8dd3, 0xb9dd880f1b809a71ull, 0x1031162c9971757full, 0x8fd3a7ae443afb7cull, 0x92522efd581ec240ull, 0x2e5fc555b4336e3cull, 0x03b4f3ac18f2b067ull, 0xfbc6a5fd211d9be2ull },
+	{  418609,     647, 0xf7191e04, 0xd514ff7397ca63c2ull, 0x843a03383e220de7ull, 0xcbf8293bbb238da8ull, 0xfd85c93bbfccfe07ull, 0x71b4332157cfba51ull, 0x1bdef57f396f30eaull, 0x5d86c802b4c758a7ull },
+	{  419904,     648, 0x6ef6505d, 0x1075344746cef598ull, 0xe993e68f2b064d63ull, 0x9ab81673a461df2bull, 0x9f2a0d908270e5fdull, 0xd503aba9108ce4f2ull, 0x4521467b3d60c5e8ull, 0xecbc130e688f672dull },
+	{  421201,     649, 0x7c36007a, 0xd2a7c410f105f10eull, 0xfaa0443d19934683ull, 0xcaa2b0c97dc6b6e5ull, 0x9802283064f70d3full, 0x95b846e412eae621ull, 0xad5f907c8202f7c1ull, 0xa3a74c72e88384a3ull },
+	{  422500,     650, 0xc87f18bd, 0xdc0811654cf90c21ull, 0x76bff4468116584full, 0x241b11093a99821full, 0x19a69ee5fc1ffa2dull, 0xfbb43db753615c69ull, 0xf871a65224d959ebull, 0x623a88b93ce70442ull },
+	{  423801,     651, 0x1f450daf, 0x298cf8884ddfc421ull, 0x4a8a65b7b0c612d5ull, 0xcb0c244b8c40a5a6ull, 0xad443ea046ab4c69ull, 0x232348c22990a72aull, 0x4498c8c3e1234c05ull, 0x640e7a3e9c977590ull },
+	{  425104,     652, 0xdeca219c, 0x79a108b82b1a1d4aull, 0x65e7077c74d60f0full, 0xbd66da98342f4a8bull, 0x40f475ab1f4dcb5bull, 0x96f2b5eb89394746ull, 0x11bfdcf071bfcd1aull, 0x3c6cb385f3c65910ull },
+	{  426409,     653, 0x0a6fb7b1, 0xf58d7be1f8392f9aull, 0xae94aa707c4ae06aull, 0x166c50ec12cc08fcull, 0x6a0bf448ac2c077bull, 0x94d6ed5d3a58af7dull, 0xbaffc15c01102b81ull, 0x7ab239726424270bull },
+	{  427716,     654, 0x75fb5dc9, 0x8d596b08db7b3e2full, 0xcfa17f2c49dc5efeull, 0x85e7e20a808fd23bull, 0x303c466aec79e480ull, 0xab15709ef3b3f710ull, 0x6f1d1778727eaa84ull, 0x82d69155e6f9e937ull },
+	{  429025,     655, 0x27a45315, 0xefea1ee722d08cf1ull, 0x118910791a037c24ull, 0xbcad007be6cfc92aull, 0x98ed52b5d4eeccc0ull, 0x5c0f218f7baeee99ull, 0x84c666af2ed01ca9ull, 0x030f7c46096dc6bdull },
+	{  430336,     656, 0xa136367f, 0x64dc8b11f83d61fdull, 0x27f01b7136354328ull, 0x4ae1e195b53b9f12ull, 0x75d8745390af294dull, 0xacdaab2e376a1634ull, 0xdd784314b5458d1full, 0x789277e28c3f4b03ull },
+	{  431649,     657, 0x1fd9829c, 0x3c959f52e21899abull, 0xd52e5d326d11cc46ull, 0x484d73366deb3c53ull, 0x98602c673f8829ebull, 0x0e6432d50c663dc3ull, 0x932885d4a1b97f08ull, 0x9339bb154b1f4eb7ull },
+	{  432964,     658, 0x19f69cea, 0x209c474ff1db261full, 0xdb8d3a7e961526b0ull, 0xf652bead2bf8da3dull, 0x236db435a40089f8ull, 0x9420ce6b21e3dd1eull, 0x30f1917e110c9994ull, 0xd1e48b9f0ff60041ull },
+	{  434281,     659, 0x41c0cec5, 0xa4a08dd846b533b9ull, 0xb36038da913a6b30ull, 0x2af833ac4e7b14a7ull, 0x90eed3c138ad7a40ull, 0x5ce3cd957eed4156ull, 0xc41ac8aaebc800d5ull, 0xab44422dbec4c7ecull },
+	{  435600,     660, 0x391a34cc, 0x042a0df04437a19dull, 0x507c93bbdd8b211eull, 0x19ceb943260e6224ull, 0x5f68f4bd749c6028ull, 0x6c35f6239a0aa607ull, 0x069061f2e959232aull, 0x4a093c02ae2ae6b8ull },
+	{  436921,     661, 0x7867ded1, 0x2843a8ad433e930aull, 0x2a4f2aa6df3ef6b7ull, 0x03f972e2432bf24dull, 0x985b715ca90f6197ull, 0xfd77c9af40d023f0ull, 0x31f248767975bbe2ull, 0x1e46875abfcc21f2ull },
+	{  438244,     662, 0x2cff1dde, 0xeac50184bfc47cfcull, 0xc159cd906a36e220ull, 0x3411eb66c8f2d212ull, 0x5f02dd24471f53dcull, 0x874731b91e2384b2ull, 0xa7d452cbd2c57c20ull, 0x4bbfb5cecc4d5af9ull },
+	{  439569,     663, 0xd3cc950b, 0x34e63c3adecbcc0bull, 0x9541098ef7f4094eull, 0x7a7c7dc38ce341e7ull, 0xc185503603c4ccbfull, 0x218310d128d986a1ull, 0x4b5d37b465d04205ull, 0xd55debab8341139cull },
+	{  440896,     664, 0x742e126e, 0x8fd95f12d2cc0844ull, 0x644e2978d872bb1full, 0x0ea664ea65ab0087ull, 0xd5f9a22587e0c7c3ull, 0x209131f304bc8a4eull, 0x6f27ed6ee00c0027ull, 0xff8896b8ccf53db4ull },
+	{  442225,     665, 0xb263d535, 0x7a2087f3933067d7ull, 0x8ec1f9a44c842dfeull, 0x0e5e6718138e5489ull, 0x843f2c4550da2b94ull, 0x80770b17ca163f17ull, 0x457baecb46616d42ull, 0x02cf35248eb99afcull },
+	{  443556,     666, 0x084ac9a3, 0x1efc63515b00cddbull, 0xea5433c85e17a64dull, 0xc186b7f62711db01ull, 0xc0bca544b2187284ull, 0xcada87ae121c7f11ull, 0xa86bf706a3e20b15ull, 0x4c6fee4f25124c73ull },
+	{  444889,     667, 0x86a0ad47, 0xad877b8e036e34a4ull, 0x3088dca1e3328186ull, 0xadb6f6212af91dc8ull, 0xe6f146179e103375ull, 0xadaf31a03f8d2d27ull, 0x22bfb3952321a819ull, 0x9ec4c077450ec4d9ull },
+	{  446224,     668, 0x197fa8b3, 0xe9a799bb86db6789ull, 0xe218c3200e57ecd6ull, 0x74422619e72b76c6ull, 0x21f799f9997b3b4dull, 0x1e99c20a0973a9f9ull, 0x1c29bd3fd3f5f5f0ull, 0x2fe31ef36380a7bdull },
+	{  447561,     669, 0x8b217953, 0xb3121934ce58211dull, 0x0c707a5b7cf77e09ull, 0x4daa74932af621dcull, 0x72834d6d71dc904dull, 0x6a456a101550d909ull, 0x5686d96fed5226b7ull, 0x958fbda5ea12fb0dull },
+	{  448900,     670, 0x6ca976de, 0x9520482e6ae32ad9ull, 0xa9d6722c36e4e070ull, 0xd4da57a1bcd8529cull, 0x1cce72690f3d306dull, 0x9fc5c05ab7484db7ull, 0xf257884096d1af41ull, 0x8050a2e356466c10ull },
+	{  450241,     671, 0xd2324a6c, 0x569bd429990a0d3eull, 0x9a5ef0ae23eb92a3ull, 0x5cc22eeac4dd13deull, 0x3b54bcd7a46c934full, 0xe5f44fcefaae42ffull, 0xc6c43a509734b79dull, 0xb67ca8191085fe82ull },
+	{  451584,     672, 0xf3188b4c, 0x0fa0c3d4fbaec92bull, 0x8d543cad5671cd3aull, 0xa3e378025032d6ccull, 0xa3f2253113678976ull, 0x175cfdca1387a946ull, 0xcd3befbd094fa230ull, 0xa11f281b175b823full },
+	{  452929,     673, 0xb26825f6, 0x7e7aa890c63a2dc6ull, 0xe289e0e701c9cc78ull, 0x86facf5b407ab2d2ull, 0x23091c998fde33d4ull, 0x0fec35de35933587ull, 0x06186dc394bbfb4aull, 0x10a71ef00aba91e7ull },
+	{  454276,     674, 0xb6d54659, 0x7b061b3066035c2aull, 0xd22493f4b031d12eull, 0xce23f24b66f22a39ull, 0x49d330f610e7810cull, 0x186c593586591074ull, 0x6d2f0b100063e694ull, 0xea5e1e466067267cull },
+	{  455625,     675, 0x7fc31e76, 0x74e758ae8d972433ull, 0x3be30eb7562dae00ull, 0x2d9fd7dbadb744abull, 0xa44a1fe032a27a94ull, 0x72e18ce031cd8e3eull, 0xd14fbe934822dbccull, 0xac36aca3d28abbe3ull },
+	{  456976,     676, 0xf1379fb5, 0xc41a98778251f316ull, 0x5fa73b659ba78442ull, 0xa4aee1f4d9be34b5ull, 0x5de40301e2b89b56ull, 0x3ebfa1cf6734b6b2ull, 0xfa0c681138d1b000ull, 0x490eba379a4c9b92ull },
+	{  458329,     677, 0x4b25401d, 0x4c37e0b72fdb83d1ull, 0x68cfa372ae880ddeull, 0xd8a2751ed20ddd52ull, 0x900ac81c091bb8d5ull, 0x3aeaaab77b80651full, 0x9e5bbbb75163c39eull, 0x04a7e8f763121306ull },
+	{  459684,     678, 0x5889dcff, 0x1fcfec6074874b0cull, 0x561f02e3b54746c5ull, 0x18f061e558a9755full, 0x6fa684e12bcbd53eull, 0xac3a5d7ae8a453f5ull, 0xa4a0c73bb847e1eaull, 0x15e7cf0dd7e9acadull },
+	{  461041,     679, 0x22288157, 0x6d26525abd93b370ull, 0x97833fa995dbb959ull, 0x0a2d654beb8b8938ull, 0xe09d26c3d302165eull, 0x3ecd82cb39c7f967ull, 0x0200b1c6906a6b56ull, 0x7c304c52164941b0ull },
+	{  462400,     680, 0xe33e70c4, 0xa8a24976ab09c77aull, 0x81605a0a878bf1a9ull, 0xa74b77f9e95f0307ull, 0x2a4cdcfaf8835513ull, 0xa88893dc2280965aull, 0x9e1a0b7ef5ccdf51ull, 0x20bc9f92cb555af0ull },
+	{  463761,     681, 0x020eeb6e, 0x29d7ed52a5777a4dull, 0xa71bc2071ec6a23full, 0xcdf2dc936e1ddf69ull, 0x50bbad7192073f5cull, 0x3637ded5a6033beaull, 0x7af9fdb2502632c2ull, 0xa4338fb515f1fff5ull },
+	{  465124,     682, 0x05030f20, 0x331a06326732be8full, 0x1a47aaec7f51f91cull, 0x0fd8bbd1df982e24ull, 0xa1647f88ac2ea19eull, 0x349d08eb0ee85a51ull, 0xdb7f8801fc43817cull, 0x0062536207d4f312ull },
+	{  466489,     683, 0x0df0f077, 0x7300b879b92a50b0ull, 0x86a4389d44d9a5a0ull, 0xe4cf6e3b103d0bfaull, 0xf43f975c58b80b22ull, 0x58bff2419d27186cull, 0x5c5891c5968aa521ull, 0x96bfe3661f809471ull },
+	{  467856,     684, 0x0dbf26a5, 0x05f7924589a52dadull, 0xe8c1a4d7c7ac5195ull, 0xa4d0363c95f873a4ull, 0x91e37ec64e0c63f5ull, 0x395efb766e20bf4cull, 0x2f7e01fd99e912ebull, 0x6fc1012edad68770ull },
+	{  469225,     685, 0xf23972ea, 0x2b12976e5368ec39ull, 0xc3ea83c49cdc632eull, 0xf93bbce246ec5f73ull, 0x20747336580f00e3ull, 0xd199b9a5b76d8f1full, 0x970da265ba5cdac5ull, 0x1bc06ed0e0dd3f07ull },
+	{  470596,     686, 0x7b96c3ad, 0x6a26ff975696c967ull, 0x5eee91f3616c2142ull, 0x4c603e8e9de7cc45ull, 0x8102d5f2e31a097bull, 0x0818d635e87dc856ull, 0x40cd1ca6c42b8b1eull, 0x56a4b76bd4e9ec48ull },
+	{  471969,     687, 0x097cbe44, 0x041db80c12667f52ull, 0x66611991e47764a2ull, 0x4009ade5035fe328ull, 0xe8d8309e4434ab33ull, 0x9a3878268d0aa6ecull, 0x6a96a11881d7c0ceull, 0xc38bd0a7147feb51ull },
+	{  473344,     688, 0x5eb07510, 0x87ed34b72b8d4fccull, 0xab38d0848a7c4927ull, 0x8a3ef2d469b5aa77ull, 0x440345258e26ea0dull, 0xd8e36bc107a54910ull, 0x1f1316315697c2afull, 0xe9a058f88a9e9579ull },
+	{  474721,     689, 0xcf50634b, 0x09d0de7bc9cc012dull, 0xc9cc26c581523211ull, 0x14f66d9c5403acebull, 0xb919a2c64e48044eull, 0xacfaaf0e2d87cb48ull, 0xb8799b877809698cull, 0xda38442332edbe2aull },
+	{  476100,     690, 0xf3193aaf, 0x45ec37847bfc5174ull, 0xc6d196ba779760cbull, 0x7bd19d27285f01bcull, 0x053885ba7c998385ull, 0xdd2a5296c96ec6d1ull, 0x0b63d3f8bfda344aull, 0x8c202efd5a62c99full },
+	{  477481,     691, 0x900d0518, 0x9e815a321d536defull, 0xed9ddafb281b14f0ull, 0x2190a02dfde6d196ull, 0x1fac121405428f8full, 0x5c442e6b4e752172ull, 0x686711e4d3250d0dull, 0x8536a5283eb0e57bull },
+	{  478864,     692, 0x695cef01, 0x1c8b98aacca15c3dull, 0x75d607bf81cffbabull, 0xb26647b861cea872ull, 0x00220a3b0c2e0406ull, 0x63be268465e5e816ull, 0xe299d0c66379ba19ull, 0xcd1c08fea047f350ull },
+	{  480249,     693, 0xb437deec, 0x210dc4fee772782dull, 0x4ad2674454e4a13bull, 0x2984da882db59a81ull, 0x13ca892cf3f0121cull, 0x5a3a4a97072e04f3ull, 0xf04ca64c3d7c823aull, 0x6fac4d6fab4aaad8ull },
+	{  481636,     694, 0xf5b1acdb, 0xf497b7b97c712f80ull, 0x417b86902a9b7e10ull, 0x75f71390536c2a7eull, 0x4a5c465bb304420full, 0xdf2becb04311557full, 0xaa481a455159a14full, 0x9b8bd93d0cef1349ull },
+	{  483025,     695, 0x377b9896, 0xccb1b01c217ef894ull, 0x650915c9c31cdb9eull, 0xb1553aa5c5d49961ull, 0x6fef2739e8b9ffdbull, 0xad6e80e8b79a817bull, 0x0c1532899ad3ddb1ull, 0x7ce5e1d6295f2a90ull },
+	{  484416,     696, 0x1cbef5d2, 0xe51e3cad3adc7305ull, 0x50ec034c852297baull, 0xb9260ce222d9d819ull, 0xefab0755ed78cc93ull, 0xa3ada6c7699369a4ull, 0xdc0bd70218de125aull, 0x4ec80289559c180aull },
+	{  485809,     697, 0xae5cb567, 0x23e23c32dacbd92bull, 0x75eac5104a58cd73ull, 0xf21d820cb3dd6616ull, 0xb9984581f90db487ull, 0xad111cc4a84df6dbull, 0x1ab5eea2386f646eull, 0x3ab9645f6fe9e285ull },
+	{  487204,     698, 0xe378b176, 0x186d09415b627c51ull, 0xcc506ee5b2e627aeull, 0xeaaad008ef7bc1d1ull, 0xd9c01818f24adea1ull, 0x4f41a575499c3405ull, 0x91f3a87dc8921e82ull, 0xb0a17a9f2d3902ccull },
+	{  488601,     699, 0xcb1c70ae, 0x02f0e9af20935e67ull, 0x24833f17a47fc470ull, 0x3af5a6008abf8e17ull, 0x5842363c9e93cc80ull, 0x09ce000af4ea57e0ull, 0x74a2af0a02e3b8bcull, 0x8f1b4897bcfb75afull },
+	{  490000,     700, 0x6b319f20, 0xf7092020c14d1832ull, 0x53797945b5fc5d62ull, 0x42e1e7065aaaafebull, 0xc756404dc9559b14ull, 0x886a9b37de7fdc9aull, 0xb49b450dcd00a77dull, 0xaf916331d828a328ull },
+	{  491401,     701, 0x3905e9b8, 0xbcefa850e63dcd4eull, 0xde741cb9ceaca3a4ull, 0x4e493f5dc67b3b5eull, 0xe4284939022a6b3cull, 0xe330e819a57f84e8ull, 0xdb75315a774064d6ull, 0xbf91687cd3762476ull },
+	{  492804,     702, 0x9e6d7095, 0xb0be5f38dc50e111ull, 0x41a8317c61740fd8ull, 0x304246f1e54795c9ull, 0xcce5d5ba2b709d5dull, 0xf53bbd404b2a8be3ull, 0x54caa445b3637ae3ull, 0xe736e7aeb6ba6957ull },
+	{  494209,     703, 0x7e12eb4e, 0x29a428a595cce3d7ull, 0xa6f14d3a3d14222cull, 0x97a42e6d7f2f238eull, 0xd1681a85c4462809ull, 0x4e1ea5359fe94c13ull, 0xa223d3e76d0faa0aull, 0x0daba363aee02348ull },
+	{  495616,     704, 0x25cebfba, 0xc62cdf28ff400ac0ull, 0xa5bafeea6132753aull, 0xd4b2e25cea0d5bceull, 0x6b4436204c92ae34ull, 0xc8baf7d91a09ff5aull, 0x96fce8a876ab775cull, 0xdd317c7b4de5e860ull },
+	{  497025,     705, 0x55852538, 0x931b0dfe639b0074ull, 0x2b7b20309626a41bull, 0xe54ac4182b12c3d5ull, 0x97dc0df59986c009ull, 0xb55e544670b590beull, 0x078df6848b15e2c5ull, 0x5d0c0561e2211779ull },
+	{  498436,     706, 0x38bb3c90, 0x0e4da94f88bd7066ull, 0xfc0fdb52d835c57full, 0x1b71a71048ad0312ull, 0xadff0d425f5408c7ull, 0xff23ae65f0b8881aull, 0xedd6b3177f5a01cbull, 0xc3808a8d75740c95ull },
+	{  499849,     707, 0x377fc969, 0x358bdb7382f3d579ull, 0xa82ef2eaf81e6382ull, 0x4bcf7549828ec7cfull, 0xc780d2efef33707cull, 0xc2bb1afcda1eae77ull, 0xffa9ed32a2ca5af7ull, 0x06583ec4ad00fa98ull },
+	{  501264,     708, 0x115a48ab, 0xead4678dae10ad35ull, 0xed43a6491c5dc8d6ull, 0xa2435fe13b0d4056ull, 0x082c4e157c566710ull, 0x77aba4d2952867b6ull, 0x5e554a562600f3e9ull, 0xcbdeef9459af30e2ull },
+	{  502681,     709, 0x7b26a777, 0x663ee8ee73ba16efull, 0x873bf09d573936f4ull, 0x90d647476685bf05ull, 0x8f2599300f36376full, 0x12cb546f6ed0d2beull, 0xe98300b84d9f8420ull, 0xbacf956cc745010cull },
+	{  504100,     710, 0x085f463d, 0x5dfca341f0007e7full, 0xef26a97c027466c6ull, 0x0c3357621978eccbull, 0x2ae2dca44b2b2d46ull, 0xcdcb5116f53c8601ull, 0x366d16c4594e0ff4ull, 0xfe3a0eb15eeffda5ull },
+	{  505521,     711, 0xad89baec, 0xff47c197b36e7a0full, 0x60a228a494a59620ull, 0xebb66191f846b3feull, 0x030ecb03abc5a9d3ull, 0xabf0d46b4eb21135ull, 0xb5a4e86fc5f66a1cull, 0xb216362d70e211b0ull },
+	{  506944,     712, 0x0b8647e6, 0xa9f4dc894dcae5d1ull, 0x45ca724b43b795e5ull, 0xfdfe2bdeb3bcde22ull, 0x5fb308225003873aull, 0x157cb5bc8521410dull, 0x01bee81ddf36ad96ull, 0x9f9e60f9fa4c21ceull },
+	{  508369,     713, 0x4bf37b1d, 0xefbc3ad68e7d3e2aull, 0xd984d1305d53bf9bull, 0x9e216dacf06d7b79ull, 0x4cc43d9f8a2acd33ull, 0x0da801f172749167ull, 0xb1db99c376aa2813ull, 0x6f127d5b7f62e74bull },
+	{  509796,     714, 0x0b6eecda, 0x4092abe0621de6b0ull, 0xc425554c719b93e6ull, 0x84ba00da3db613b4ull, 0x4dffd511c662ff78ull, 0x656c0593c363ba05ull, 0x86e4ef8d0afefc5cull, 0x923b5a2c6b45b1d1ull },
+	{  511225,     715, 0x6a849cc6, 0x87c5d2216f7d3067ull, 0xd12aa2809b63827full, 0xd1504e44f0e977e3ull, 0x28f9fa0b4bfe472bull, 0x9d24d54d06b27a87ull, 0xdab3cbbea9a94a72ull, 0x8043dee92bd67135ull },
+	{  512656,     716, 0x03deed2c, 0xdbefc2b62a9fe679ull, 0xef713789fb39c0b8ull, 0xee4fe824b351e12eull, 0xc8514a61a6f173bbull, 0xebcda25e2db23249ull, 0x23ef7a495438b7fcull, 0xc26a58f0dcfdaeaaull },
+	{  514089,     717, 0xf033f078, 0x70b273ac19c85111ull, 0xd5418d9b3f6774b7ull, 0xd811186017c9ef83ull, 0xe1f94b158d0d2340ull, 0x6f239b5fdf4269e7ull, 0x503e6bcc633f75eaull, 0x623b39c58062ff88ull },
+	{  515524,     718, 0x1d182530, 0xad3e75cfd38ccabdull, 0x0979836b9ba4323dull, 0xb873fad9225bbfd8ull, 0x0078828c6a5bbda3ull, 0xb0dbfebcaf34a981ull, 0x943605cbefc78dddull, 0x1f0c5d8382d05b5bull },
+	{  516961,     719, 0xce766a8a, 0xb39bf6843cd5f748ull, 0x316a751c5a016643ull, 0xac0ad5cacc1e1a4bull, 0xd07c38e311012900ull, 0x7fea4b1cf1e59f11ull, 0x7f36e0585f9ea6ccull, 0x8060ddadd1c67a60ull },
+	{  518400,     720, 0xa920110e, 0x924a936db001b949ull, 0x5a3188ea1d64736full, 0xedeeff8ecb38db9eull, 0x390fdda96ed8f776ull, 0xbaf5e45d5b9dc7f9ull, 0xfd1268a1836dbfe6ull, 0xc1cdddf9e898bfb7ull },
+	{  519841,     721, 0xfb048622, 0x0f555c880f223e4eull, 0xdf659949237bcaefull, 0x54ff0b2c09f74e09ull, 0x84b14dbc5d712e21ull, 0xc9b619f697282a64ull, 0xd15eade0d9d3616cull, 0x6d782b19cc7073cdull },
+	{  521284,     722, 0x34e7d549, 0x571c8147c4ed56c6ull, 0xff75586faddf72d4ull, 0x1fd3874ee3ff11b8ull, 0xdb3b000bc6d35722ull, 0x23bc9580baf9d7faull, 0xc70ab1498cda13d7ull, 0x170c3eb17c3a04a4ull },
+	{  522729,     723, 0x414c6f2e, 0x98f935c2d2c41a42ull, 0xf60ab54aa4c41495ull, 0x6562447e0d163209ull, 0x49c60f19ee59ffc0ull, 0xb7d8279395b7133eull, 0x84d8ce80a3451638ull, 0x27dfb0ab6a8df61cull },
+	{  524176,     724, 0x60eaafeb, 0xdacc9e3d66ef3cdeull, 0xe3085dafe2957d29ull, 0x3004d4e5af42960eull, 0xa56f832aff222fbfull, 0xe90a9bed053fca3bull, 0x6391941fe2e9c356ull, 0x975db7521fbb34caull },
+	{  525625,     725, 0xfa07ec8a, 0xe889da808a4ef456ull, 0xbc6dfa5d8232bf5full, 0x0cf10cccb465779eull, 0xbe26f7460abf0b12ull, 0xc0e0051dc5b11098ull, 0x9f0937a65c5d6fb1ull, 0xcbc6504efde9b191ull },
+	{  527076,     726, 0x0d55bfab, 0x1655c4f77e97b93aull, 0x7793b0d786ad280aull, 0x40324c031172530aull, 0x0878a363fb68d528ull, 0xfa3663a425f9ca1full, 0x82ecb22124e98fdfull, 0x69f4c28c354a2749ull },
+	{  528529,     727, 0xa88b6a15, 0x8a8e3c4e04927aa0ull, 0xfc38fd52b5e516f7ull, 0x07d23a489c864c1aull, 0xb15edd5b3c32261aull, 0x9c1c772774e912f2ull, 0xc7294c8174d13184ull, 0x201268c914f2f68bull },
+	{  529984,     728, 0xeca3c634, 0x5ce7cc2b89a9276full, 0x8dd66187b859d7a1ull, 0xb968e8e7776922f7ull, 0xdfba915bfd633e39ull, 0x55f876775ed5a251ull, 0x8d6fa074ec7bc3c5ull, 0x2f289e4b6c7b24b3ull },
+	{  531441,     729, 0x2b0520d4, 0x1bc8a255e49ab1d0ull, 0xc9937d37ce3c7444ull, 0x8f006cf14d4f385aull, 0x193b2e3c1bf705bfull, 0xbfbf674eafe8b5d2ull, 0x8b168d76df0e8df6ull, 0x88381a7a1b03fa15ull },
+	{  532900,     730, 0xb96611a9, 0xe5e4409d5044a316ull, 0x8ae952963ec7146aull, 0xa66a2899d9ea791aull, 0x9db194db45aafaf5ull, 0x025e7f5cef87dacaull, 0x7ef94800d7e81a01ull, 0xaa0094736cde697cull },
+	{  534361,     731, 0x61863a85, 0x8610110844bb158eull, 0xfce78340851226cbull, 0x09d45a920645c804ull, 0xaa8a5ae48c8a990cull, 0x5a68b6cb9e2f75a5ull, 0xf6d96b63f6da4a4dull, 0xee2f7336b6546652ull },
+	{  535824,     732, 0xd175de20, 0xc248c2ce970fe6c1ull, 0x220ce65edbc69c3full, 0xbe71b2040cd702daull, 0x238502f3247a54e1ull, 0x41e2fc168d0ba2ccull, 0xbb7a2b11eac34adcull, 0x6e2e07efcae00d44ull },
+	{  537289,     733, 0x8d7dd18b, 0x92e8cf4b56721d39ull, 0x73f87a6fa0f2a427ull, 0xe0b010b1b0add673ull, 0xd0eadb88bad64d25ull, 0xeb77524e3fa6aab2ull, 0x4a1e26fa38fbf281ull, 0xb3e8b7170fb8f087ull },
+	{  538756,     734, 0xa4446d26, 0xd23d1606ab38beb8ull, 0x6509e43f70e7469aull, 0x3fe24398dbbbefc3ull, 0x599d5f82c229c969ull, 0x1635662414eb87daull, 0x76d35a1a44535959ull, 0x9653678520dea1c3ull },
+	{  540225,     735, 0x9e8a7e3a, 0x39e0eb74805b5e5eull, 0x2c87cead0df2b782ull, 0x16afe95cd8a5e4a1ull, 0x21dc7410aaab0d2aull, 0x0bce00b4b17967c4ull, 0x4d0a90d40b37b475ull, 0x9809320c2cf0a9f6ull },
+	{  541696,     736, 0x77a542df, 0xfb0fb3407183fe5eull, 0xa1dc0a714ca58ab3ull, 0x3af7ccd29b89bcd9ull, 0x264b43db13fbbd3eull, 0x27b04c6809cef345ull, 0x48ea0bc091a79626ull, 0x70c5cd7aca592573ull },
+	{  543169,     737, 0x708ee2f4, 0xec7053e1636a8c93ull, 0x4cea7bef2bb673cbull, 0x5e1f101cf87a4057ull, 0xf900d07207cd683eull, 0xe9c1e55d41b2aad6ull, 0x5dcc66737f4be823ull, 0xf4404bd461fd1762ull },
+	{  544644,     738, 0x7102e86b, 0xfd9f4d746a825c1eull, 0x1d5237c5916ea44bull, 0x82511b7ee88b975cull, 0x53e36c62f73f5932ull, 0x19df995d1a10f2c4ull, 0x9cb0d0c4578573c1ull, 0xfbe67a944871bc81ull },
+	{  546121,     739, 0xb8c7c7bb, 0x94b35a1d54d815a1ull, 0x0bdb8a531bdd76c9ull, 0xa6a44ac66649a532ull, 0xf0d4cc3958a8c3b6ull, 0xe50b82b2addbbacdull, 0xe07997c492101a35ull, 0x8ebdaa1355c56e6full },
+	{  547600,     740, 0x4b41cab7, 0xb698100f39916a46ull, 0x4d0fcf284cb86456ull, 0x7af7fdccc01a9033ull, 0xdea1057d70879a15ull, 0xa10b2afdaff74e13ull, 0x1421b21e8db5168full, 0x5fa2716528909049ull },
+	{  549081,     741, 0x39ddedfd, 0x8fcf7aac7d255debull, 0x875850cedabb4864ull, 0x3982ff6c2e6672d9ull, 0x6c4a49a7482f488aull, 0x1077366e7b798e79ull, 0x9bf696510a5070ccull, 0xb0210eef623b8b72ull },
+	{  550564,     742, 0xb4f90a8d, 0x3776211d4ae386edull, 0x42e33529659aa7d9ull, 0xcbedbff54ef40c3full, 0x3281f2b5198b09a5ull, 0xb18e31752b8e8417ull, 0xb72c0c42e8e3a334ull, 0xa18dc5094616b5a3ull },
+	{  552049,     743, 0xbcb9f5e8, 0x6eb99be1fc5aa549ull, 0xe1caa1d86f07118full, 0x7ebdb3e8bc88024aull, 0x36404d85a2b3a425ull, 0x79cf5cbf4c6b8b1cull, 0xb01a5cef56713f08ull, 0x4fb44d31f6748a07ull },
+	{  553536,     744, 0x27c3d5d0, 0x75288fc17f83bb4bull, 0xe6d57d44f746bd09ull, 0xc08f201a21315aa9ull, 0x4c12ea9113f6b472ull, 0xb90d86c9dd1eb629ull, 0x81a329226b261088ull, 0x9f65b061682401f9ull },
+	{  555025,     745, 0x69b54971, 0x726ba587deca8316ull, 0x156e25cb04d64da7ull, 0x8c6e3fd061eec9afull, 0xf8380fad7e1e53b7ull, 0x541a00173b7b7ca9ull, 0x314f3e6984dc57eaull, 0x80644296b5b96289ull },
+	{  556516,     746, 0x4205af30, 0x508dfcbc6e16a946ull, 0x7970138a43c5de84ull, 0x1d7826b3c8a3ecc1ull, 0x8d722643c763de59ull, 0xe663408eb6b2bd01ull, 0xcff27965618a761full, 0xc1a1ab17b023c0c7ull },
+	{  558009,     747, 0xb74dcf1e, 0xb662344f11b5fc26ull, 0xce45330469712a05ull, 0xb0521705062190a5ull, 0x9dc660cc966f8aabull, 0xe38726835ef3d91full, 0x2472bb7b12de2232ull, 0x3b969c16fc452d83ull },
+	{  559504,     748, 0xc3eeba8f, 0xf6443a71e17cba63ull, 0x423fc8f13d87fca7ull, 0xd5dd424a3d6683dcull, 0xc989f36c6c033e11ull, 0x19294ad0268db061ull, 0xbcdac0bf6929a217ull, 0x14e351a87e817259ull },
+	{  561001,     749, 0xa25b1044, 0x30dd477ba40a888dull, 0xa36d89871f18312aull, 0x0993b53bff59b00eull, 0xbd1a541a30485828ull, 0xf4361fc37ff7bb41ull, 0x71babc085e355e96ull, 0x79c663c66b4b3747ull },
+	{  562500,     750, 0xb2efea3c, 0xa6cf0db90f6a38bfull, 0x31a5330b594cadb9ull, 0x2291e20fcb95dc32ull, 0x4b0894fe3d480b2dull, 0xcceee83864322fa1ull, 0x7cd191706ff7fa79ull, 0xf35180b877e04239ull },
+	{  564001,     751, 0x3f004e93, 0xbf1311d83c28b2adull, 0x62a8e617a5953aefull, 0x626393ed14978fd0ull, 0x52bca522cc417cdcull, 0xb37fbf92d20fdbaaull, 0x295fd53511556e6full, 0x491884eb9007f79dull },
+	{  565504,     752, 0xeda7c475, 0xa58f987841548f93ull, 0x875d0a45a27b929bull, 0x5c1af21f8cee5ba0ull, 0x91bd8f03fafbff51ull, 0xbbc0d43007a57dd2ull, 0x73fa2de0d4a0daefull, 0x184c11b82814bf56ull },
+	{  567009,     753, 0x430624c5, 0x9ec74525717fc621ull, 0x8b0b5b9753cdca83ull, 0x0e5a0b33e527d3bdull, 0x38d9afbf16f16d9bull, 0x4379abd605380a94ull, 0x26c57ccc89a2f6f4ull, 0x8899bc3b587ff59aull },
+	{  568516,     754, 0x0e574e10, 0x4cd65f803c5ae706ull, 0x816ddf4b3da7f6d9ull, 0xd213b49c3b00c7eaull, 0xbe178a844918c107ull, 0xdd839d9c3644a978ull, 0xf297cba00d000ffdull, 0x2ee8c77c5a81cffbull },
+	{  570025,     755, 0xcf4403af, 0x3af35896d6283223ull, 0x5c793539a6a6f311ull, 0xf58af4c5015816a8ull, 0x88da4100d3875f02ull, 0x19fded61b04f2853ull, 0x2f1a2c1345a9f411ull, 0x7e149bbe6d683584ull },
+	{  571536,     756, 0x90a0d7bc, 0xa3119e8f939a9505ull, 0xccb925b0e08afac5ull, 0x727c7d550f12540bull, 0xa405da921e9c1b3bull, 0xfffdfc2ebd52f7b1ull, 0xc6a82c7e65564582ull, 0xfc2889f8e1155dcbull },
+	{  573049,     757, 0x5db17fcc, 0x3f14f7ddb9d7c1b1ull, 0xa48357bba4130f5dull, 0x9f5d88721408e7c4ull, 0x415a32923802c962ull, 0xcb02ef9b2369bbabull, 0xa6c6b8f6a717151eull, 0x104565e430dc562full },
+	{  574564,     758, 0x84daf81a, 0x28fe6b8555e49e64ull, 0x85a63006ad125430ull, 0x4d03042697bf567eull, 0x3a945f310e85555aull, 0x125998f584992ce9ull, 0x0c7dcd8c4b77b497ull, 0x084b4ab1494c8cd8ull },
+	{  576081,     759, 0x4dd3ab95, 0x73a027c972435f7bull, 0x2b369c4f4d112950ull, 0xdf3c14c14f63a4beull, 0x32c1d02ab48c571full, 0xd78d60feed3bf0a0ull, 0x478c879bc7c060ecull, 0xc465038e0c5b6379ull },
+	{  577600,     760, 0x8f89aa41, 0x36608af619273092ull, 0xfe3d2457ff2296a4ull, 0x5d8c2cb6726a27b1ull, 0x5bd8e28a4eef47e9ull, 0x5929e6449ca0c516ull, 0xa82b526490748ef2ull, 0x2b15453d8f5d4493ull },
+	{  579121,     761, 0x96ff00ac, 0xee5e8b633ff896f6ull, 0x6cb2e9457cb1822aull, 0xf67dc12da51ff9a0ull, 0xecbf0c665dc36d31ull, 0x1ffa3bb83a54b03cull, 0x90794086cf32ced9ull, 0x43198ed4126ba48dull },
+	{  580644,     762, 0xcf771f06, 0xea17f2c251b58d27ull, 0x169294371d544140ull, 0x9b36f57e416a6d90ull, 0x9527318a7b3b2136ull, 0x7203363e480304c1ull, 0xb6bb97a0320aeaf7ull, 0x7003db7c6928b334ull },
+	{  582169,     763, 0xf90aedde, 0x3d02e5f4d12423f0ull, 0x8cd539faba8342faull, 0x87c2060ea5bbe4a7ull, 0x7bf2a9945721b4b1ull, 0x684de07049cb76a2ull, 0xcad3765194fb0b54ull, 0x1c1fd6b7ec2ca338ull },
+	{  583696,     764, 0x97bd9791, 0xbd4bff64196bce20ull, 0x1cf6c9383f5e6dcdull, 0x69cf2cd1fc462109ull, 0x6bfad99e846e16fcull, 0x0b1d7e23efcc4ac8ull, 0x5cd7fea5aaa0b3deull, 0x27bc9e9df17f6490ull },
+	{  585225,     765, 0x071e0834, 0xeecc5f0c26be34b8ull, 0xd4b14ea177f57ba0ull, 0x5ec8ec035f2e8c35ull, 0x4e5d14556b7fc71eull, 0xb38da3a7b9c37ae1ull, 0x6d1d36c4ad486cf5ull, 0xdf89b1fc1da703d5ull },
+	{  586756,     766, 0xc6869522, 0x790e311fc5a662b8ull, 0x1d067785fb8a0657ull, 0xe866c10a188049eaull, 0x73e2a0c57d0350a8ull, 0xd3ec15c8d1cbe615ull, 0xbcd91da86218c5d3ull, 0xf0a81a33e1586c15ull },
+	{  588289,     767, 0xdf354356, 0x467655a04cb55f12ull, 0x03fb952ea5b81880ull, 0x12f7b05a326236a0ull, 0x9c8f4f6d12ec01a2ull, 0x129dd7c2662f50a2ull, 0x07300d43932c9af6ull, 0xdacc9981fcfd83e3ull },
+	{  589824,     768, 0x37d6307c, 0x41b91c97fd789837ull, 0xbc030c4ede81a34full, 0x691eee07bdc0728cull, 0xf4f37a552356675dull, 0xb8a8da6dbc3d59f1ull, 0x64a15339cc39157full, 0xc900d0ab2d02aca9ull },
+	{  591361,     769, 0xf09ba047, 0x0429747b13d9776eull, 0xd870087cf2c7ba6eull, 0x909ef9f957569b79ull, 0x3de30f1395aabad9ull, 0x1c86911d62dcf550ull, 0x98ba8b54d2916660ull, 0xbf99ecbe0b050b46ull },
+	{  592900,     770, 0xd6f294b8, 0x79298144c5189055ull, 0x4863c6e16d42f1faull, 0x19b125f473723c41ull, 0x2c7244955bfda093ull, 0x97044b99d90a2bc8ull, 0xc91dba6c3be19098ull, 0x0d343e604d942244ull },
+	{  594441,     771, 0xfd9c68b6, 0x657006aaac731a2full, 0x9b089a6631c8cb8bull, 0x73f423acd5456409ull, 0xbe2339e700ae28fbull, 0x11a7f83b0689258bull, 0x34b0b345222101feull, 0x243e8043217cb101ull },
+	{  595984,     772, 0x4ee6aaa1, 0x55e5a707fbf6993bull, 0x3902a783c463cc2aull, 0x19b0b71c39d6ce5bull, 0x517c34df25442ae8ull, 0x9c20576a0aa0119bull, 0x377d5c8a8c8b3941ull, 0x009dbbfedf6ee6e4ull },
+	{  597529,     773, 0x05cb98c4, 0x2f2cf25786180efbull, 0xc853abf5f8758f8full, 0x95d21980322ee56eull, 0xe140619b97e58fa7ull, 0xda9dfa87d9793e67ull, 0x548d8084171a4597ull, 0x70f27475536079f7ull },
+	{  599076,     774, 0xbc2d2f80, 0x1b99c1af8a5029acull, 0x80f400b6afc69ae6ull, 0xf39c6237230d1904ull, 0x23d15a12959fab11ull, 0x14a47a7ee27491fdull, 0x8855248d55307368ull, 0x0f907ccec3d94c3aull },
+	{  600625,     775, 0x7a63c475, 0x25b7df2b24985f48ull, 0x39a5fb8af1789f66ull, 0xbb7152e94a6c9370ull, 0xd06cd1d85dbf3014ull, 0xe715670e3e402924ull, 0x91d8d541e26c962cull, 0xf111e0b2912e05d9ull },
+	{  602176,     776, 0x1793aa55, 0x740114faff2b1353ull, 0x69a5ef2f683ab5a2ull, 0x6d4a3420ff5f8531ull, 0xb368bc6ab893c1c1ull, 0xfa5162f1d900b9dbull, 0x27fb7ad859f44f18ull, 0x305efb466a79f073ull },
+	{  603729,     777, 0x2b6590aa, 0xfcc383573bb7a490ull, 0x88d06376620e318eull, 0xc8fb5d20e1641b46ull, 0x8b11e5178bc7c158ull, 0x5a12f4c3d41e4a1bull, 0x4f766ca596b5df76ull, 0x321ec2327c0aff4dull },
+	{  605284,     778, 0xa1dcaea4, 0x500f2d09501e9fd0ull, 0x97ba60129338ce04ull, 0xfcf1e73d5ea5a45cull, 0x9a9c7ef76f9adb36ull, 0xc1537b74cf3b5041ull, 0x2410db7f8dd7e2ceull, 0x0c76c64f47fea74aull },
+	{  606841,     779, 0xb05132da, 0x8fa34e7b6c971a14ull, 0x4d7b7199fea171b5ull, 0xd594088286ba15d6ull, 0xd40609d393b8b561ull, 0x7ee738cae39bf4b7ull, 0x6ca6437b33204469ull, 0x84526db069082d11ull },
+	{  608400,     780, 0x199abb3b, 0x06c8673c6d6a3d08ull, 0xd7581628b77aeb29ull, 0x50183a8ac7f359a9ull, 0x2f6ba9020f722a50ull, 0x49b144ecf0fa67cfull, 0xc7a94f8771c35e75ull, 0xf09653ad1c048c8bull },
+	{  609961,     781, 0xe18f6c93, 0x2de1c7d029be0ff4ull, 0x85ce198673ddbac5ull, 0xd8d57f929c8e8618ull, 0x1e0b949a4c1d188cull, 0x95534f755d4ec5a1ull, 0x7108b6b160c805f2ull, 0x7157f7d50f2727feull },
+	{  611524,     782, 0x48d1f8fe, 0x7c3b01ae6c5eed16ull, 0xca9f6bd99020d54full, 0x0f730d8ac109c205ull, 0x49c33b4c7948a151ull, 0x92c1bd2c61185f3eull, 0xc6e9caf7fa690c75ull, 0x420f80bff35ad5d9ull },
+	{  613089,     783, 0xd296ac50, 0x3a26a7bf42621c87ull, 0x1c221a9e09745e2aull, 0xb25a91c714740dd8ull, 0x23a1c582ba770e60ull, 0x492f148ccf3b1124ull, 0xc8505e589017215cull, 0xe4753f3a2a41cefcull },
+	{  614656,     784, 0xf81f25f6, 0xbb25e5a85ddfe4deull, 0xcdb9bad4d321ee3aull, 0xde7bfe35091bbbd5ull, 0xb6ccf875d136c236ull, 0x2033561949bb3062ull, 0x6818b33be7fe9e99ull, 0xfe2e4cea28afaab1ull },
+	{  616225,     785, 0xca149fd4, 0x9d96a9e5fdbd4d4bull, 0x516fe304ecb67330ull, 0xdee5dd87ea4b9268ull, 0x13596ad5b9e5cee7ull, 0xa5f7367d6486f99full, 0xe9c7f803dde92b8eull, 0xabf01419f241f18eull },
+	{  617796,     786, 0xa1390988, 0x60c95df186990400ull, 0xbe562d9db482b6bfull, 0x4a2befbed7e97f08ull, 0xbeb9182ce95ad39cull, 0x72554b3a0be5972full, 0x7420598bdb2fd932ull, 0x13e37d376f96efecull },
+	{  619369,     787, 0xf615d59d, 0x0b6c74e3bc01763cull, 0xcbe5c5ac1d2274caull, 0x79285fc0398514dfull, 0x09cb38e9fdefc46eull, 0x51b3db15ff8f29a8ull, 0x202761d1b2aeb760ull, 0xde47879f0162f36dull },
+	{  620944,     788, 0xfe2e870a, 0xee4a31fd75eca164ull, 0xe3b65be02fd9d0ddull, 0xed4a3f1db45c4c20ull, 0x8f16c91c4323f785ull, 0x647abc56537ad3c9ull, 0x641f505341ed2e12ull, 0xe6ed54305c84578full },
+	{  622521,     789, 0xe915a8b0, 0x30e4cd9942217fa7ull, 0x5aac94198f818d65ull, 0x3d4d33bd443745fdull, 0x4b8ba2f99fa4602aull, 0x8da386694b09ac36ull, 0xa3d325c1f4bee42cull, 0x1710c9a21989e9f6ull },
+	{  624100,     790, 0x8733e8cf, 0x377e1942040d7100ull, 0x34370efd1f14c241ull, 0x2d422983a55e6fafull, 0x33d980127a1a2bc2ull, 0x5d3e463133e1e3b0ull, 0x5daa60d07fce2853ull, 0x3be58f05606b56d4ull },
+	{  625681,     791, 0x8d64e50c, 0x43ef7b3e63bc8ae5ull, 0x3b5e46c244468334ull, 0x002ca7b9497e84c1ull, 0x6baaa2bc823ec86dull, 0x79ea891f8c6a4c05ull, 0x98d8c6c500209fedull, 0x957222e5e1074420ull },
+	{  627264,     792, 0xb2f713f2, 0xdfd91b17fa270399ull, 0x2b181a81d649ad88ull, 0x4869fd4e8e39d484ull, 0x801b68e86215b8d8ull, 0xe1d1c0808eba44bcull, 0x9f3a850622f4a919ull, 0x1cf88d62eb9fef06ull },
+	{  628849,     793, 0x603f42cc, 0x5843fa2dd276585full, 0xc48c130ee89ab5baull, 0x0edf4e80b9bb6638ull, 0x4236e0929177955full, 0x3bce6d87615d08afull, 0xa8caaaba1c8b02adull, 0xccdc93d96d9d7499ull },
+	{  630436,     794, 0x7e6f44c3, 0x82485462e820d765ull, 0xcdb31c68207b07fdull, 0x0d3220e71c561236ull, 0x6fbc230f02c462c2ull, 0x59989a60e12fe0f3ull, 0x206cc5d1207b9a90ull, 0x59b0844d9466de7dull },
+	{  632025,     795, 0xa276dfd9, 0xfae74d35695d848aull, 0x7db2bd5c87133878ull, 0x7d2b2d14ab94ab25ull, 0xe9c5b7d4b1156ddaull, 0x92ad73a68643bd72ull, 0x779a8e233cc4fc0bull, 0xe8ccb3d0e05c0e8dull },
+	{  633616,     796, 0x285d95da, 0x3ddd270408f3fa3full, 0xbc580f809a1e29a6ull, 0x56a6dcc7e015c0bdull, 0xfcf6d78ff3d5e4bcull, 0x0bdcd997283b7387ull, 0xabc92c4851d3f042ull, 0xf59e5a114384ee7full },
+	{  635209,     797, 0x91e70579, 0xaeba95151ac70741ull, 0x8b5146e504cd8991ull, 0xbb68d536126409b5ull, 0x6abc6e9ffa481517ull, 0xe27900d36adeef06ull, 0x234dfe8387a5bc8eull, 0xc3e4a445498ef3c3ull },
+	{  636804,     798, 0xbc2c1b15, 0xdc09fa37601192f3ull, 0x146a0d7158052388ull, 0x6cd45638c243cefbull, 0x530bed140d4969fdull, 0x07d409fde1977ad8ull, 0x9a831474885cda58ull, 0x2e97b3cc2a37e904ull },
+	{  638401,     799, 0x028f6b06, 0x5c487d99aca816e2ull, 0xf9769f6fdc9c09b5ull, 0xb037a30c084158daull, 0xf835f1082dd6295full, 0xbb370dd391452a41ull, 0xdc7ef00c57301061ull, 0xb830087c4ce75e42ull },
+	{  640000,     800, 0x60dd614b, 0xebac91868b9a450aull, 0xd2b9b5d8fd170026ull, 0x7d398e4a97f5f383ull, 0xb2b335868838a25dull, 0x19c73d32e22f7c01ull, 0xb85f8dced24f31baull, 0xd53acbda8f13754cull },
+	{  641601,     801, 0x3350cc8f, 0x029f65ca201249e7ull, 0x263546ca20453fd3ull, 0x559b81823594af90ull, 0xc34eab2a74b71fa7ull, 0x549fc4ae006fea53ull, 0x310f97b89f1ea567ull, 0xf46811f6d25c9f87ull },
+	{  643204,     802, 0x188936be, 0x2548cdb2dc48f889ull, 0xef58a56e345b0cbaull, 0xf5b0743598bb4bdfull, 0x22b6db0edc7b6a6aull, 0x6079c03f27badbe1ull, 0x97a915dc341b65b4ull, 0x9b71e456f906ac51ull },
+	{  644809,     803, 0x1f9ebbdf, 0xf5b1f38e72ee1e0bull, 0x10eca278fc88c81cull, 0x53677f543b658ee1ull, 0x9720c471dd032866ull, 0x2b0ee98247197fe0ull, 0xaceeee16a661713dull, 0xcfe99fe92fd4cfb5ull },
+	{  646416,     804, 0x4b4c9250, 0x341ae9d152511f25ull, 0x97edd4cc2f943878ull, 0xd188b238838054d5ull, 0x09d1d708a84abcdbull, 0x6c76de887f6a0c55ull, 0x581937425351c1ceull, 0x31f20307367eeceaull },
+	{  648025,     805, 0xbc04e06d, 0x928a1eb5d843034eull, 0xbf194919ce0d2010ull, 0x9d37495170ddfda3ull, 0xda05e6d81297b801ull, 0x756efaaa3806a9f5ull, 0xa779681210d0fcbbull, 0xa6837b0b8c046f39ull },
+	{  649636,     806, 0xd878116f, 0xe52d5e49c553ced8ull, 0x060f70d38c1bc070ull, 0x21b96b20a0018f37ull, 0x5d27dd5b232c13adull, 0xd769f5cd92d55219ull, 0x1785ed67834bba32ull, 0x3507305101dfba32ull },
+	{  651249,     807, 0x743310b1, 0x0cfd3e380cf159f4ull, 0xbfb08d1fa62988e9ull, 0x88e40a9108d66429ull, 0x194c5c7fc1a5c244ull, 0x62dde79d5473e238ull, 0xbbcce2fe859897c6ull, 0xab8a2ba9bbee750eull },
+	{  652864,     808, 0xead1affa, 0x824bd39dbb568814ull, 0x0b4b0046852b5e91ull, 0x7772f5867a186c9bull, 0x1297f7fa48334f7full, 0x3b53ae2c7fcc97efull, 0xa9db857a8d0e8a74ull, 0xf9f58b2533faf3c9ull },
+	{  654481,     809, 0x2bbdcbc6, 0x8201b5e6f2937ed0ull, 0x9e0e72281634a927ull, 0x61f2ccfb63efa414ull, 0x0fd096d6e292b843ull, 0xaeb2725b6c32fc40ull, 0x5a7b37f4cdeb9d4full, 0x13161172452ccdd0ull },
+	{  656100,     810, 0xa7e51d6e, 0x1925270757887fb3ull, 0x3cddb967e27c6b6cull, 0xfa522dbf61b4d79eull, 0xd6c56147f7545a33ull, 0xf97433fe5c05e879ull, 0xd11b39b851e7e1c7ull, 0xed16afbd98bbd371ull },
+	{  657721,     811, 0x07c36808, 0x4cd916b330d96f45ull, 0xcc9e7778f98deb24ull, 0x2a16783ab1d7f96full, 0x73adf89a0564066cull, 0x24b8435486c961f5ull, 0x93f226000d0f4d4full, 0x9aaa85413b50eebeull },
+	{  659344,     812, 0xff82335d, 0xdcdee0b166aad2deull, 0x8245b388e7c7a7b6ull, 0x283561367eaf3115ull, 0x4e3d5687e9b8fc25ull, 0x664c7ad9acc94579ull, 0x173aa9558316bf6cull, 0x5a2ac391547e84ebull },
+	{  660969,     813, 0xeb309b86, 0xb097e6728af3ab89ull, 0x5eb333b8566e8184ull, 0x8f177a5b87a2a1d0ull, 0x2006a43b795f5310ull, 0x5ddf49bd6ffd96eaull, 0xceaaec5aef3f4958ull, 0x378a8d2ab702228bull },
+	{  662596,     814, 0xd6e3d38b, 0xe8e2a6ab0c4f4dd3ull, 0x4397a9ae657b4f06ull, 0x37c2a486e77332f3ull, 0x1e031d84795711b4ull, 0xd5c192d483827905ull, 0x1747d2086948b398ull, 0x03234813c0c65f41ull },
+	{  664225,     815, 0x122cb858, 0xf53af710b52c88f2ull, 0xcdef182f79ea43b4ull, 0x3aaa2c032f8b99e9ull, 0xba217ad1cfeab325ull, 0x02c0bd7d54cb0e47ull, 0x11d31b188a43f40cull, 0x4f814110d13e42bcull },
+	{  665856,     816, 0x7204fe9e, 0xff94e1e323d223d1ull, 0x117644c30293c204ull, 0x64be42b2b7b28a2full, 0xf04130850bceb1a2ull, 0xacde54df868957abull, 0x69e933c2a22b4b40ull, 0xd552c53a8897c38dull },
+	{  667489,     817, 0x65bb16e4, 0x695925d624330acaull, 0x9db4106dc6472f13ull, 0x41beb86ee313f79full, 0x984304247ce8ec44ull, 0xdbe98403a50a8cd4ull, 0x6e2915be9ccbacb5ull, 0x14b49adb63ac64c0ull },
+	{  669124,     818, 0x6b2252f8, 0x10b08c0e57bdf2b6ull, 0x0f294d23ef07bca2ull, 0x258d494b771f9ffeull, 0x730e93062873c6bdull, 0xe8fcfcb02a7d64ecull, 0x2efc3037dd99042cull, 0x02b15cd99c49440dull },
+	{  670761,     819, 0xe13b84e5, 0x1e7d241415c27875ull, 0xa9f68de70bc13b6full, 0x1f8471f4ebee6ae1ull, 0xbc012dbdc71fbf42ull, 0x606dd8ca59165c62ull, 0x0af0dfbb7ec74e19ull, 0x206ebb98c70af94eull },
+	{  672400,     820, 0xf88826ab, 0x48671df266a95013ull, 0x8a92ce0c6cc43958ull, 0xb364d88a163bf264ull, 0xd1b87f9765d7e7b4ull, 0x3a62681301414e45ull, 0x6f64573f4e9b33baull, 0x3cca55567698683aull },
+	{  674041,     821, 0x033f09e4, 0xc2f4bbf06aeb0a21ull, 0x79d6689edbf5a0e8ull, 0xf62744c54bbb0efaull, 0x369ca43cee695b38ull, 0xe45c1503111bf901ull, 0x8c7ddc102e1c4343ull, 0x399076dc95d88bbeull },
+	{  675684,     822, 0x81f4fc8e, 0xbf8254a910c7f9c2ull, 0xe6ad1d3ed6036ceeull, 0xa20d98031aff0fb5ull, 0xe9cc0165faccb6edull, 0xdc26022e3319911cull, 0x2c6c4702c8f7d284ull, 0x544d582c82955a43ull },
+	{  677329,     823, 0x44ef8e8e, 0x1477fc76b4b53d02ull, 0xbb3d5e9d412f61b0ull, 0x649635a8cfa3eb4cull, 0xc9a562f2a549402full, 0x48b7eda1daf16e92ull, 0x0cc15ccf199f52c4ull, 0x7901a9b43ad29882ull },
+	{  678976,     824, 0xc11db1fa, 0xa9c3fee7a84004b1ull, 0x55e077a9926fbce1ull, 0x5d46066b32c5a640ull, 0x075bd9876cd87297ull, 0x471774d543391ab7ull, 0xf834f91472c6b967ull, 0x508677fe6981866aull },
+	{  680625,     825, 0x52e51ab9, 0x68704869e67a6200ull, 0x403b79ae5cec373full, 0x167b4a547ebf97b2ull, 0x1cffa6a1882f94e9ull, 0x0dd3e96d5fcb510bull, 0xa78110881335e69bull, 0x5064d3f3b2797a22ull },
+	{  682276,     826, 0xe485747d, 0x85411df7f6f8ad2full, 0x7cffd6825bc2ce54ull, 0xb967355d3f610627ull, 0xda60b3079629fa83ull, 0xc39d517232b64cf4ull, 0x3f9e8644dba42712ull, 0x50735313eb0de49bull },
+	{  683929,     827, 0xfe4f9ee1, 0x513b35b31ed38384ull, 0x2742aca7833c2851ull, 0x9976995ef3a0a8cdull, 0x5b82f0c957092163ull, 0x53d81af18c73aa26ull, 0xe70d51ec9ac0c86eull, 0x4560b328cfa403a1ull },
+	{  685584,     828, 0x97d19bd7, 0xf267215d127cdbdaull, 0x65ea33293dd04486ull, 0xdab1976d3f0671fcull, 0x3515fd7fc92c7cceull, 0xbc6b3e5a14dec4b6ull, 0xd858cc6b88617deaull, 0x0867b84480402f52ull },
+	{  687241,     829, 0x5a557e34, 0xf823a04e3d90e991ull, 0x8fa637ad6688d9fdull, 0x48487a372278a65bull, 0x51b46fd12c487397ull, 0x721629acbdc562a6ull, 0xb77f3925da494f89ull, 0x33745062a71c58a6ull },
+	{  688900,     830, 0x87c9a2b7, 0x7ea944c7f64ea1d5ull, 0x8a14259746f9709aull, 0x97a609bb3c0a08e9ull, 0xebbf5dd072210835ull, 0x5f02519e5197daf0ull, 0x23aa9338efd0e7c4ull, 0x3a924e9f95bd5f44ull },
+	{  690561,     831, 0xebacd885, 0x8ac3594b041b1fd6ull, 0xa22654dc22bca074ull, 0x445e21941ece665aull, 0x98cdb4e708479828ull, 0xe8966152acd0553cull, 0x8fba25cc48883228ull, 0xe64a413d9e17a228ull },
+	{  692224,     832, 0x1d657db2, 0x4b91b1b5bb9d2632ull, 0x0cfc9521367a9638ull, 0x0091acbe3ea59f64ull, 0xc07c832591f72209ull, 0x045488792cde9054ull, 0xb1c50216de2c5920ull, 0x19c352597e3d4475ull },
+	{  693889,     833, 0x35cd7e74, 0xe21a2849bd915c8dull, 0x772176bbe274db1aull, 0xcddd90e05a5b1d5full, 0x125d18d3f092d716ull, 0x26154dcb589f6925ull, 0xb1561e59802a99a1ull, 0xc0352501f3c288c9ull },
+	{  695556,     834, 0x518da261, 0xe70987186c69fc45ull, 0xea005adaf7418629ull, 0x2e193357ef1d9a54ull, 0xc16523b10e2296a4ull, 0xcc54b89ee2441853ull, 0xa0a8c6e731a0fd8bull, 0x84574a72a46becf9ull },
+	{  697225,     835, 0xd7d99ff9, 0xbe6373bf67ba5c87ull, 0xee87d895b5dd587bull, 0x03b1d6724df38c2full, 0xb42f42df561c7ebcull, 0x888352b0710f2d8bull, 0x3a750d7fb49f7567ull, 0x964b0d71a31e55f7ull },
+	{  698896,     836, 0x1837acef, 0x92eccfd7d011694cull, 0x70cd9957464be774ull, 0x7b8ab660c1608745ull, 0x61ba848c5ef801ecull, 0x7fc29986bcaa8cd7ull, 0xbc62d22ca76406dcull, 0x188989f730fbc44dull },
+	{  700569,     837, 0x39ac72d1, 0x2fa80c6187e0bc79ull, 0xc0fe8787baaed2d0ull, 0x22f94a92f509f543ull, 0x5162191d4c8a870bull, 0xb47efa963062c9cbull, 0x825c93a5de053c02ull, 0xf9e69fc2daab8611ull },
+	{  702244,     838, 0x07884b8d, 0xd6f3b79c61b55564ull, 0x59cd05ed2470cfaaull, 0x1f46425854c31450ull, 0x9a4ce83a06a95b53ull, 0x2dce5d480396963aull, 0x59e14b2ccf1c67ccull, 0x2e0cf8ee720b6312ull },
+	{  703921,     839, 0x5d016dc5, 0x72703b9633015e4cull, 0xd9a6b89d9bfc0835ull, 0x714f45464ca0758eull, 0x4906b284e457448cull, 0x982e671ef0dc58b3ull, 0x3294aea9b797afb8ull, 0xf78143b6350d7d55ull },
+	{  705600,     840, 0x2bb4e390, 0x09d70f605eb18bacull, 0x2d718a194661970eull, 0xce30e2bf2ff3d912ull, 0xe55bb40fb673c803ull, 0xbdbfe7b117dbaa9dull, 0x4b52c459a6a4f836ull, 0x16e04f72a7f4d119ull },
+	{  707281,     841, 0xa61d43e0, 0x8536ca336f4cf7a0ull, 0xce2466bbc2069da6ull, 0xda25ad9b2afe92b4ull, 0xe73bd9b837079be0ull, 0x2767145b959e38e4ull, 0xb6b1685d22c7e3c3ull, 0xcaa7494ae1bdbe27ull },
+	{  708964,     842, 0xcdb08772, 0xfa6d26f079dc1d77ull, 0x31bae0580a763b9bull, 0x1d6279fc01656941ull, 0xd1bc7049a8daeee4ull, 0x2c99dcc42815eafbull, 0x0653bd58827a4e44ull, 0xab2f8869af44d281ull },
+	{  710649,     843, 0x73070353, 0xc948fb0cb3547a50ull, 0xef0002ba5ec5b2f5ull, 0x7a0a84648ff7cb8dull, 0x44a45916594b3e5aull, 0x5e21a19358837dbbull, 0x9e24cdfbc6a8f2bbull, 0x60e3acb79c49f5a9ull },
+	{  712336,     844, 0x2aaab1d8, 0xe0bc95da3314f707ull, 0x9cd19099ee961165ull, 0x7912527d90c7cd45ull, 0xe1764c4b44441648ull, 0xeb4e9d51123e9fc1ull, 0xc7a34045cc610cb3ull, 0xf9141c2dbdc3c8c5ull },
+	{  714025,     845, 0x9bfdfca0, 0x3d2f4801198735e2ull, 0x041b22284532d893ull, 0xfe3d97975bd7932full, 0x8cdfa6ab5ea67e0dull, 0xf6bb34b4932ae908ull, 0xb33abd51b58abeafull, 0x9ed8d84e2fb293e7ull },
+	{  715716,     846, 0xb7b6c3c5, 0xecd14e24710221c3ull, 0xa59f379ee0722221ull, 0x72fdbb84ce3e5bc4ull, 0x077d7caf0d31545eull, 0xedc33e06e65a11ccull, 0xb60482533502c919ull, 0x8f234ea6f374f0d0ull },
+	{  717409,     847, 0xc65a9d50, 0x5a7baebdfad196f1ull, 0xb2d053300527ab55ull, 0xe24e31ce10c054bbull, 0xb7d636416a83347full, 0xa9545d9a82a06557ull, 0xcfb74503b4d9bc2full, 0x6bb17e2b09687234ull },
+	{  719104,     848, 0xece60b5a, 0x356e042345b23f62ull, 0x12342adeb90cc011ull, 0xa9c7ffd99f90acf7ull, 0x2d75221b147e26fbull, 0x340c180609887dedull, 0x58029abfbdaff066ull, 0xfe6993aecb0ea592ull },
+	{  720801,     849, 0x6ed2db6e, 0x74c98a9a1641a208ull, 0x1747a36026614f00ull, 0x41b70821229a6165ull, 0xea6fa2c643d041c8ull, 0x809c5b14d4cc9f47ull, 0xa5df324a1435edf7ull, 0x6c964f9a90413bfcull },
+	{  722500,     850, 0x804f635f, 0xaa683ce82803bddcull, 0xfcc57bfc71b0f44cull, 0x1f0d7c707735cbb7ull, 0x066da5e2befe3fffull, 0x06edd4d3ece20479ull, 0xc83dd1291c1e9763ull, 0x6c19c1f611d46c4full },
+	{  724201,     851, 0x33414e88, 0xc4df3f1d520a57c5ull, 0xc8a29f92b087fa4full, 0xe9dd54e99c58edc5ull, 0x8c640e19e2159088ull, 0xd6a517ac3fc26619ull, 0x3453108df694249bull, 0xa5a92470949a14e2ull },
+	{  725904,     852, 0xbd4c01bc, 0x4e2c05ec36463997ull, 0xc09352e8f90b8892ull, 0xba8c4346667005bfull, 0x906e75e8cf11559cull, 0x3f8cd88ca50b4e3full, 0xf722cefecfd136b8ull, 0xb55b61136e940f75ull },
+	{  727609,     853, 0x9d4d0ec3, 0x499e28dfb1d3ef6eull, 0x6ee641ada067fec6ull, 0xe3e0c175f5326526ull, 0xc634e71ff515be9aull, 0x86ad471184476defull, 0x2d7856e2bd3c5e51ull, 0xdb63b2111721e13full },
+	{  729316,     854, 0x9d79c4cf, 0x55159d0a03fbcf6dull, 0x0497be36b7d120fdull, 0xe5f1e8f08dd4cd26ull, 0x9c78ee8fa39f8bf1ull, 0x09e22e52b239adc6ull, 0x58cd3b71ebf7bf80ull, 0x156842b2d7b55112ull },
+	{  731025,     855, 0xd7d60b9e, 0x229d63e6e16c90d0ull, 0x7d3c45349acf8773ull, 0x06ad4e7b5f5e4febull, 0x404738a9bb494621ull, 0x7c580a28e8c5ccc9ull, 0x9ad72661b1a05725ull, 0x2edc6d471995695aull },
+	{  732736,     856, 0x3566d6d6, 0xf6e0916c6c4d5c73ull, 0xd1a054ce5c4e152aull, 0x35202395867b1313ull, 0x984a561a8c126b3bull, 0x302a2133c8575f64ull, 0xa0006633b053c758ull, 0x707f03e46f945e6eull },
+	{  734449,     857, 0x0ca2e95f, 0xe1778fe2893c263full, 0x91146e450dae8de2ull, 0xea7b73b5ea336ad1ull, 0xe33e9bc77c71e364ull, 0x211c4371a8b0d8c6ull, 0x708d29e03f450256ull, 0xed161a10fa9f05abull },
+	{  736164,     858, 0x54528a21, 0x4f4c0bd0dbb09913ull, 0x5099d65fb6c5b107ull, 0x0061c14e5f19e25cull, 0xa6fe2c9aaf318c0aull, 0x8fe54440e6ec73f1ull, 0xaf8fc47ff1527b23ull, 0x750239a5d9a6332eull },
+	{  737881,     859, 0x93336f88, 0x73fa5bfe7bae7874ull, 0xf7cf66be21fd4094ull, 0x6b8a43cac550b03bull, 0xae3457931f8c4d7cull, 0x41632b133eaf0927ull, 0xc1b853a95e4e688bull, 0x8e1de5dbe23ad583ull },
+	{  739600,     860, 0xbb7713ed, 0x4a87c1769e78c922ull, 0x2f3ed97c0bec7310ull, 0x4535617b6f6d3fe6ull, 0xef130abdd1360231ull, 0xe3ab6e3e0f5706b6ull, 0x3a7f3fdd73f28688ull, 0xc95049975c00e03dull },
+	{  741321,     861, 0x73017269, 0x780080d0dffa26d7ull, 0x3855dbcb5efef686ull, 0xe6180f02d1b6089eull, 0xdb551844ca625d5cull, 0xb0047828724f0a54ull, 0x04ecd7fb9fe90ebfull, 0x62f7c3a0ed48ae74ull },
+	{  743044,     862, 0xa0502dd9, 0xe2e83d6db66351bbull, 0xa25ba52260288e5dull, 0x11627b0922c472aeull, 0xe4ad88785d0c99f0ull, 0x4a1af441e026b4a2ull, 0xe35a58bcf81ad490ull, 0x367bee733f9bc21full },
+	{  744769,     863, 0x91a9e633, 0x308dece85c6fdbbaull, 0xbbbf803f4c4d463eull, 0xcd25dbbcfe7e11b5ull, 0x6075db4a2f5d92a4ull, 0x384f25afe0d7ea2bull, 0x34ebae2e2b7e6165ull, 0x220067c354be175eull },
+	{  746496,     864, 0xf6300cb1, 0x25fa620f8c5189adull, 0xa46a72dd6ed706d1ull, 0xfa51732692c8ee91ull, 0xf1482013a0d7dec4ull, 0x55d3ad219c20f997ull, 0x9d7068226d18fa25ull, 0xfc11e4d66a703363ull },
+	{  748225,     865, 0x3663147e, 0x86d088348a9db231ull, 0xdad8834eec42fc58ull, 0x14d6eb0360e8e2d2ull, 0x173f2b789dec7708ull, 0x692a87c33ce34262ull, 0x22e32b4f9f87caf7ull, 0x2503545767176cb9ull },
+	{  749956,     866, 0x51b6e12e, 0x0d8d335e67b56e6full, 0x78d5b9e2363753cfull, 0x2382f1783cf76dafull, 0xd28731cb42b14191ull, 0x02c0560444dfe011ull, 0xce96ee4a14c67a8bull, 0x4ee11bd8a66bc45aull },
+	{  751689,     867, 0xb31bec59, 0x9fed1b937ec3cac7ull, 0x271ebe2cdb009f8aull, 0xab08f7b2555108b9ull, 0xfde2badad54f2497ull, 0x24e7b5d43cb43ec9ull, 0xbf415f86b9958060ull, 0xf96ac9a4fb8401b4ull },
+	{  753424,     868, 0x616da4fc, 0xfa5d69e60a37ca4aull, 0x606c67e2bfa2e2d3ull, 0x75093b4393bdf065ull, 0x33981d8ad20e6484ull, 0x7b01da90b9e486d6ull, 0x557fd720031b9e8eull, 0xaa3bc1f70feb9793ull },
+	{  755161,     869, 0x3d2e3f20, 0xc8e721601ad49b4dull, 0x54757991bcec93fbull, 0x4fc7ab5b54013487ull, 0xf5a53106ff1adf08ull, 0xd7b785c5a0fbe397ull, 0x63153236d80c466cull, 0xccd46bc854cf0b0aull },
+	{  756900,     870, 0xdbba79c3, 0x70a5ed53910bc003ull, 0xa38d46305c118076ull, 0x5ad7bf29f32e1aabull, 0x1fb14655c9ae85acull, 0x3c1136cd533e1a21ull, 0xaecfeddc3bc0350full, 0x3da9cd544ed210d9ull },
+	{  758641,     871, 0x21d8c513, 0x67a329d1a802dba1ull, 0x0148ccf1af88438aull, 0xb08a6f3cbb349e1aull, 0x82d9a3cca2379984ull, 0x4290f96096a69947ull, 0xfaa8ba128a161f2dull, 0x2276963e9c55bdbcull },
+	{  760384,     872, 0x21762878, 0xe170639ae5bf6bfcull, 0x9cbc4cb65e0bf4c2ull, 0x8eb164ef568cdf88ull, 0xee6a3f4351bde234ull, 0x83c2b5ede483d79full, 0xb80ce01c9ba91238ull, 0x7444a86da9633641ull },
+	{  762129,     873, 0x304c453e, 0xe90695b5da15fd1dull, 0x02df64a268a76beeull, 0x039f807cf338817eull, 0xaf1b666b2c793b32ull, 0x1d7fcac8c99a682full, 0xe53d7a2a3a3f0530ull, 0xcc91fe4179a704fdull },
+	{  763876,     874, 0x8c3c17e9, 0x0f7cbb1040fb73c4ull, 0x1372e1b404ac41deull, 0x868574839a6c2728ull, 0x986c0ab661700da2ull, 0xd458e4480089f7e3ull, 0x724dba95339b03f5ull, 0x41c8b12abe21a3baull },
+	{  765625,     875, 0xdd4deab9, 0xd38db59100cebffdull, 0x87fdfdde7015136cull, 0x907d2324b3d592faull, 0x952e1a2e8e0c80f4ull, 0x82d6cf34eb899775ull, 0x2360883cd7e0c6f3ull, 0xd5f3abb9b2742736ull },
+	{  767376,     876, 0x64563ba1, 0x077356c9d736172dull, 0x740fa67cf854f754ull, 0x011afe8d64e1aff6ull, 0x609017e2a6f9a2baull, 0x7c1dd299d09501f6ull, 0xde1048dd57daddedull, 0x8c17107448068137ull },
+	{  769129,     877, 0x5b1f0bd1, 0x16207b2f1c24a9d8ull, 0x5eb35f3eb865eaf2ull, 0x00df9d9a7877ecdfull, 0x067aa461e9b35484ull, 0x10c56be7e14f475cull, 0xdbe0142a521f627full, 0xf79d4e7af9b33144ull },
+	{  770884,     878, 0xde23a205, 0x4eec718d2fc01153ull, 0x6e92c87f4aacf2f3ull, 0x244740297bcf9fc7ull, 0x4713050deba8b3adull, 0x7c045faad2bfe285ull, 0x8898077ac2cab890ull, 0x40285d30296e271bull },
+	{  772641,     879, 0x9930ae02, 0x3d30e7278899b3bdull, 0xd0ff2f355723070eull, 0xec3638aba8702bf9ull, 0x6e8083acaac9ae04ull, 0x9699d1f06e4dcc0aull, 0xa47d11274b98ab80ull, 0x823641b78248674cull },
+	{  774400,     880, 0x4cef2056, 0x19d27a0695e4ee1bull, 0xc2ed70def25297baull, 0xb69656e1ab7f354bull, 0x689686fab0c7934dull, 0x74e473a72ea181afull, 0x96d366eb8e8b64c1ull, 0xf1790132de7bb397ull },
+	{  776161,     881, 0xd75f7d0d, 0xd8bc986be035e083ull, 0x2984ee7b62c99c66ull, 0xb306159d9ea27a4full, 0x999aa97118f74531ull, 0x41f47cad302868d6ull, 0xf6aba83545f88415ull, 0x79ad2b17e856f221ull },
+	{  777924,     882, 0x1950186c, 0x3cefa13bbf49173dull, 0x36adb61c5e641ed4ull, 0xaae21d2a836926a8ull, 0xef2add8fca4883daull, 0x6c13a757e8204897ull, 0x7fce3c43be685963ull, 0xe44f19e27b564486ull },
+	{  779689,     883, 0x7613c1ff, 0x9bf160c9a36055e0ull, 0x4195a152fc0abfa9ull, 0xa7954bff8d09a671ull, 0xba6918738d5fd41aull, 0x02e0bfa8a8455f51ull, 0xffc22eb5810fb29cull, 0xd07f7836902041c4ull },
+	{  781456,     884, 0x609c89bb, 0x2def170585954191ull, 0x42758d2ac62cd0d2ull, 0x7728c2b50eed1fcbull, 0x06831196c1a0dfedull, 0x63a47bf6c97599d7ull, 0x503a0146238a23b8ull, 0x0a6e854e25bc9082ull },
+	{  783225,     885, 0xb2a853de, 0x903f0920081bce96ull, 0xf815787e1cbcf0f9ull, 0x362ff6a887e8b293ull, 0xd54cc2f2526c4950ull, 0x1e8695c1ae2be517ull, 0xd30645e441dbf926ull, 0x1efcea75b7a6c0a2ull },
+	{  784996,     886, 0x7753e641, 0xa4dd574370fe6fc1ull, 0x03812af683b9d0adull, 0x225a5ee0d355433dull, 0xde8c23e9d5e685b6ull, 0x629c4decd2120b6bull, 0x5327c7b8718a8e04ull, 0x50005dabd0bbd338ull },
+	{  786769,     887, 0xc6d2c36a, 0x9496b91e36addd4full, 0x6875a7f385bc8255ull, 0x42127d81b92f1bb1ull, 0xc12a5fdda3067d1full, 0x6986936151794e78ull, 0x0eb6ed20a1113412ull, 0x961c9c409e9aa1bbull },
+	{  788544,     888, 0xc2aae20e, 0x02d433056e8e7a89ull, 0xe0190abdcfc7c306ull, 0x980eaf0c8fcd1295ull, 0xc760bfc0048ba11full, 0x8b0ce308c4efaf1bull, 0xfbe1b19d8aa34bffull, 0x4d7fe8dad4606ee4ull },
+	{  790321,     889, 0xea272541, 0x3e17f2064a63a32bull, 0x8b331f6061f4f34bull, 0x55291f19b3aca4efull, 0xf01a9f2e3f950ac6ull, 0x1def9e9c8e26fa84ull, 0xc432b164cd8bd36bull, 0x35904c7ea851cd67ull },
+	{  792100,     890, 0xf8aa953b, 0xba72dd214c00c54bull, 0x69c9ebf925679c19ull, 0x20dd8b29b7a77596ull, 0x8a9393344067624aull, 0x93ef762af3abb714ull, 0xf948b9f2638bcf51ull, 0x4f4c8b6920080cc1ull },
+	{  793881,     891, 0xc80ebf02, 0x62a9707f9263bd04ull, 0xa295c767e8dae461ull, 0xac6ca2dd5d5523ffull, 0x18f976ed16dd75e7ull, 0xda212640e2d45357ull, 0x68cfab2446cb17c1ull, 0x5a90c3cc25745607ull },
+	{  795664,     892, 0x619570e5, 0xf3a217ba1fc883f1ull, 0x7861f3acf2ecde28ull, 0x09b3d0542aa1386cull, 0x67fb7198a2e1afdbull, 0x6810661f6070c12bull, 0x06916456fd2f93cfull, 0xcd56249c25ec5101ull },
+	{  797449,     893, 0x522e81df, 0x5e9c157e537eae39ull, 0x78045e3892830d7cull, 0x85aefe521a7393feull, 0xd7fe144e48d1ed4eull, 0xc13597e1a6a3344dull, 0x8253e4fb8b526686ull, 0xa807b8b78a83ac4eull },
+	{  799236,     894, 0xdd5c3d19, 0xe8c8ffe20e1c1a3bull, 0xc611ab399976f2edull, 0x251757e7b05099b7ull, 0x6dcf050fc0fb87c7ull, 0x54bd9a0b11f0734cull, 0xa9c1577baadd9e9full, 0xcc60b3035653398aull },
+	{  801025,     895, 0x434bfe27, 0x06e706ac64a29af8ull, 0xb237313142072e5cull, 0x9cd3acc7b791ae02ull, 0x94bb2aadccefeacdull, 0xb6b9e904bb604017ull, 0xc2c12c7661f16eb7ull, 0x9a687a9bd7c45627ull },
+	{  802816,     896, 0xc3812d3e, 0xf8aa0e8b0921ff2full, 0xf8bd246a914b97f6ull, 0xa036f1f03dabdbffull, 0xd83c8e5ddf4a5570ull, 0x124ed512d3cd7f7aull, 0xa3280508ec2a9e16ull, 0x29f4114ce04dbe74ull },
+	{  804609,     897, 0x6c197665, 0x4916a2f093374b71ull, 0x7421efbe3473cda6ull, 0x1b392b314f393b44ull, 0xf70bae5c1a41351full, 0xeb180f6310385de6ull, 0x26fc8f2442773ec8ull, 0xf2db8db86895d32bull },
+	{  806404,     898, 0x8e0342bf, 0x4ea9473bccb339abull, 0xfe6289cb4457b01full, 0x38ee4db3d876c362ull, 0xfdac9e489e23b38full, 0xbaa9ddaf55ca6e63ull, 0xbbe4f567e66b69ffull, 0x9b090a7c842a4c35ull },
+	{  808201,     899, 0x1f10e547, 0x2e736c9c9f20c837ull, 0xe80d0438c97b0f70ull, 0x551c7d874433bc19ull, 0x1620ba4ceb0cc166ull, 0xb2080fc36f81ca0dull, 0x6d0d47a8ba83a9e6ull, 0xcd20253d84eb3511ull },
+	{  810000,     900, 0x68d2c21f, 0x16360acd73fd3b67ull, 0xa58193efdd45333full, 0x28e0c90077d84945ull, 0x906b5e88ca913cf3ull, 0x676b78f554577793ull, 0x8f68d72e44753dedull, 0xc51766dee103185full },
+	{  811801,     901, 0xb1839e44, 0xd9e0beead51eaf3aull, 0x18faf246566af61bull, 0x73418ec1ea7bb565ull, 0x54b592c425c21b46ull, 0x8066cb959aed240full, 0x0c2832b9b7199f80ull, 0x1c50caa1d32d6628ull },
+	{  813604,     902, 0xf8e4471d, 0x71be33661ed772efull, 0x84689b1c041ff972ull, 0xe68dab4f630d12abull, 0xe397948b03d2a83cull, 0x9ead2a6fa48b0cd7ull, 0x5c633949be841929ull, 0x1628c51ef0d79b45ull },
+	{  815409,     903, 0xe19d370c, 0x04f6ffaeeccce889ull, 0xcccc938408051f17ull, 0xf5ee951ab8928f38ull, 0xd2a4fbc3bc498313ull, 0x3a8797d5fabded58ull, 0x5857b0496cfb967eull, 0x334d03954f33584bull },
+	{  817216,     904, 0x73433576, 0x1244b0ce407a09e1ull, 0xf71cb98b5859d9b1ull, 0x77b75f49f35ab4b7ull, 0x631090d98c61d54aull, 0xba16d36f46c56c04ull, 0x198a1d7b53ce6c3bull, 0xb9e3a412857e06e3ull },
+	{  819025,     905, 0x2e9a3f49, 0xda93c50910f19db2ull, 0x8e2d14bfaea0a6b4ull, 0xc81a53e0ed274f98ull, 0x5fe3d24316e70e77ull, 0x279dee47c82e78efull, 0x573d43885b5c8ef0ull, 0x3e92c79f1c2fdfdbull },
+	{  820836,     906, 0xd5b1222a, 0x805a124e06baec38ull, 0xfac39ad9dcceaccfull, 0x79f5ca113866c1b8ull, 0x7bc5963d3f324152ull, 0x96b56453f8f32df1ull, 0xca79b3f0a8bf17faull, 0x1371c03b1c7e16a8ull },
+	{  822649,     907, 0x8a492363, 0x1f04e37d5d5d6910ull, 0x95877702cebcea93ull, 0x4ec7406178ca53d2ull, 0x034aace25a4ebfa3ull, 0x24e397f713294ce7ull, 0x929fa8690b747cdfull, 0x93f636fb889160bbull },
+	{  824464,     908, 0x27fa3547, 0x4507aa31f6ae99a9ull, 0xbff3442a9857ceafull, 0x23f845ceca5e33eaull, 0x424a57b7b76c67bfull, 0xac9f244f0aadb003ull, 0xded43a9963e4ea31ull, 0x37ca8ede9d5caeffull },
+	{  826281,     909, 0xb6a8809e, 0xc37ab862e028e5f7ull, 0x915f98ae466931e5ull, 0x82df9ee42dfc0768ull, 0x40dcc345a7f5087cull, 0x405815c6e7032112ull, 0xdade0fcfd953f76bull, 0x7207447995209be4ull },
+	{  828100,     910, 0x9ce73adb, 0xdf84cc60092e2ff5ull, 0x8d031c7739591fd1ull, 0x4bc4159f86389b25ull, 0xbba9dfa79082d8d6ull, 0xa55422a7300a2de1ull, 0x2160ff6ac954426bull, 0x29e10ff771236e9aull },
+	{  829921,     911, 0x5cbb2847, 0x735fd1588f592ee9ull, 0x81e067007af488c1ull, 0xc195399f00f2a32dull, 0xd3f8b86d5951a9b0ull, 0xb495165d5445aebcull, 0x50008c344b590e39ull, 0x3aadfaa174b0acf6ull },
+	{  831744,     912, 0x80abe1dc, 0x3be9016202640448ull, 0x1d49fbf30ebe3874ull, 0x1cc45d169466b6ceull, 0x4f05e219c85aceefull, 0xb685e81a3bc859deull, 0xf008fb309a5a1d81ull, 0x1377cc74bfc196b1ull },
+	{  833569,     913, 0x180d0ee7, 0x5ee85402b883d847ull, 0x776f7bf0f09f5ce4ull, 0x6091ffc09c64c656ull, 0x4838586cd988820eull, 0x11060b55d8392f31ull, 0x821fac02f74be918ull, 0x8529d3693009119eull },
+	{  835396,     914, 0x75838832, 0xbf33847bf429cb76ull, 0x853f560e86151d07ull, 0xd08ce76468c3c2a0ull, 0x96130390c353f207ull, 0x76df94048886ad76ull, 0xb573c796895641e8ull, 0x1de33c8348edd286ull },
+	{  837225,     915, 0xabcc5e50, 0xe77d4b5ff07ae945ull, 0x5042bec317b6c859ull, 0x07489e6a20a060aeull, 0xb27470ab12f93988ull, 0xdd810260f5b28245ull, 0x232afbf0cab72f8eull, 0x1236fe274305119aull },
+	{  839056,     916, 0x0f6a5913, 0x04d3c9e21db3ac65ull, 0x836c437f27a64277ull, 0x02863bf6d3fda501ull, 0xd112074be347bbaeull, 0x90573f26b807074dull, 0x07a12ca558956acdull, 0x5692fec031a98059ull },
+	{  840889,     917, 0x951a4b66, 0xfacd157bc3c2a410ull, 0xb5ecf79f5de5e852ull, 0xc304fb09a81c2b4eull, 0xc97671043fa68e7full, 0x236aec3173038b36ull, 0xcd9419c9d4d1150cull, 0xd5f13e7dcb75ffa5ull },
+	{  842724,     918, 0x3d208788, 0x0435f26158e9e0feull, 0x42a9437748ce0e33ull, 0x3a8c9750ba0cb9ecull, 0xaf225c6cfa1cbd4dull, 0x4ee178813abcfd0bull, 0x346cdd9b8e7541beull, 0xf5bf6b3f969245e9ull },
+	{  844561,     919, 0x74ced34d, 0x53ff648ab7d04ab7ull, 0x72fc434097fa7df4ull, 0xae6efc910f838f29ull, 0xc034cdd22963f57bull, 0xa3d59f6ad2e7d376ull, 0x6a0ab8c14deca186ull, 0x94730e103f6219c9ull },
+	{  846400,     920, 0xf366acc8, 0x2780a9162a66aad7ull, 0x252b8b26f80c14cdull, 0xa9cd4231452f03a8ull, 0x07322245154aa7c1ull, 0x0c931e590f5df9ecull, 0x3f94b00db5ba877cull, 0xe3a6e2f4bc08a2eaull },
+	{  848241,     921, 0xbf0837dd, 0xefd48673b047d019ull, 0xe6bfa0d2977df4dbull, 0x3732179b79327ba3ull, 0x7a6ab81004ad606aull, 0xea71de1b7b701710ull, 0xbe495ea0e1509c47ull, 0xcde29b38ccd205afull },
+	{  850084,     922, 0x64bab5ad, 0x5d03bd586c12bc7cull, 0x2871cfee4fecfe1eull, 0xd6c6c87473b1b5e1ull, 0xdf025c2cfbb94fb4ull, 0xe1afa1d92fb2a2baull, 0xa455478dbf19ab20ull, 0x31291d9ca75a63d2ull },
+	{  851929,     923, 0x988a3cf9, 0x222238aa2be8ec19ull, 0x921671611dfa27b3ull, 0xab81261b6f336e53ull, 0xa8aba53a236903dcull, 0xdd61694b43e57122ull, 0x874c1ff5f4c77b35ull, 0xdf02cb61bd1e8acaull },
+	{  853776,     924, 0x6ca22aa9, 0x72fab18fafa70097ull, 0xb559f97ddc347547ull, 0x1918ec82b9f78b48ull, 0x6ad1a6e62f0f0fcbull, 0xa6873bceb6f5abffull, 0xf65ed085af9aa518ull, 0x8e73c893e1c01c20ull },
+	{  855625,     925, 0xae142d02, 0x9d02371c1fd6bd7bull, 0x8b482f13511046a4ull, 0x954245cd168b1d43ull, 0x9d92020bd0015e2dull, 0xb5465de43dd48c15ull, 0x26c856e2512dff18ull, 0xb037b1816565ce13ull },
+	{  857476,     926, 0x51be67f5, 0xa13cd16d79c72834ull, 0xe9832b24ec3cf1e9ull, 0x51121b0f7832acfcull, 0x59efa5ad1110ccb3ull, 0x35da11743664db6dull, 0x28c945579653c060ull, 0xd3a5f2b750f67768ull },
+	{  859329,     927, 0x43082b6f, 0x1e9ab5156ea7ccaeull, 0xeda64173d2fde601ull, 0xa91906b409f0b490ull, 0x8af5d5f4d4e5dfbcull, 0xb8f068e2646cb677ull, 0x3cadc233560cbe57ull, 0xd859efdca90ef2ceull },
+	{  861184,     928, 0xdcaf3c4d, 0xf4b1c65c15bb28fcull, 0x8fa45134a3221efeull, 0x1905d9a5c81368aaull, 0x5a89fb08e3ed795bull, 0x3f22c1eae9c82654ull, 0x02b16f95c6d515b8ull, 0x9f95cf52a7c36513ull },
+	{  863041,     929, 0x0a087945, 0x49a077c505e6683dull, 0x698545be9572ec06ull, 0xb5ba9e1cf85e25dfull, 0xfdd15be4a79426d4ull, 0x3474cb25e40b15c1ull, 0x12b64193afed8ed1ull, 0xf88facefd6a2f571ull },
+	{  864900,     930, 0x8fafd4ba, 0x230d0f69873479a4ull, 0xddc351222327d43dull, 0xa7a8c3519a1fa664ull, 0xee1bb65db9f74b79ull, 0x12041da9b9a97373ull, 0xbc1e71418cbfd6a4ull, 0x6076ba7f7e784ab1ull },
+	{  866761,     931, 0xf06fa85e, 0x040ff25d2656f49dull, 0x789a43f17b572801ull, 0x0a0f8afcbedfc855ull, 0xa1d66d7690346b3dull, 0x8671ecc41d910e57ull, 0x9f5301aef61cf8e8ull, 0xfd4afb1bb86e0d34ull },
+	{  868624,     932, 0xbd5af14d, 0xefb37a07ce061ec4ull, 0x2e1c929b4420374cull, 0xf33ff8a62ef36749ull, 0xd1dd8b3ca2f5e0f6ull, 0x54672060fe979ebeull, 0x16f16106de79a80full, 0x3fa5657d48f4e7d1ull },
+	{  870489,     933, 0x305209fb, 0x4115522a7b3c0b99ull, 0xcec11338de9210d3ull, 0xd8c091684885e388ull, 0x009407c018fddb28ull, 0x7d4c0869ca08e1afull, 0x4bb50dc51ac1e7d7ull, 0xab91c1f2bfd20132ull },
+	{  872356,     934, 0xb2516d50, 0x6ddb205eb9d55b9dull, 0xdbc4ea272b54d07eull, 0x1e25ac4b8446f933ull, 0x8a33143799992e97ull, 0x54b78082f5680f31ull, 0x887f0b01478aa01cull, 0x0fbdac032ef6839eull },
+	{  874225,     935, 0xfa9d4d0f, 0xc0f19f068235942bull, 0x3eb433923f61c84bull, 0xcc5718c8202f5370ull, 0xd25f0b44ed9018b6ull, 0x10e4d35be5bcfe7eull, 0xf759639fe176134aull, 0x17259042c148465eull },
+	{  876096,     936, 0x8f7d818d, 0x46949f563c2900b4ull, 0x8cd042ad98997b7cull, 0xe4076f2a19353b3eull, 0x4a5446dcead7e1f7ull, 0xaec8106cbc049e37ull, 0x09044edbb2776ce7ull, 0xd75cbbd0fad20257ull },
+	{  877969,     937, 0xae2e29b4, 0x4e7b47dcb1c84a07ull, 0x1134bf7a625eff63ull, 0x29bd45b208d8f7b5ull, 0xeacdca6a50c3023full, 0xf530066b9902fd37ull, 0x64a522d9065991cdull, 0x3cb7450c4a28f60cull },
+	{  879844,     938, 0xd0781de4, 0x27098d6d24fe2978ull, 0x491593311b7bbaeaull, 0xf80f09b3db3314ffull, 0x94c998e9ac740cebull, 0x9f59a19ee52077cdull, 0x064fa47a66354468ull, 0x55ab4ca57b006aebull },
+	{  881721,     939, 0xdf36c52e, 0xe41ab3b66dd85a40ull, 0xa7c6081ca20be3bfull, 0xb02915cdf5df9b94ull, 0xdaff606f1902daffull, 0xd5bbdaa581c89f1bull, 0x09f0bf7cc42042f9ull, 0xc546f27910243a72ull },
+	{  883600,     940, 0xc91763a2, 0x0457382195fc976dull, 0xf480c4529dfe9726ull, 0x3f46fe9733b6a9e9ull, 0x5d5e6abcb4b17c61ull, 0xebed978155c34829ull, 0xd47f63893086f2deull, 0x439ae5bc2720652aull },
+	{  885481,     941, 0x46b504d1, 0x08142402e994b387ull, 0x74d6db0922c99f49ull, 0x9cfd6f1058a750f9ull, 0x5bb264402b1a49e7ull, 0x732d54a2bd81d440ull, 0x3976c3101198ab1full, 0x050577e971390c39ull },
+	{  887364,     942, 0xd19bbd2b, 0x4a06a19f3b06244eull, 0x4cbf9632eb4c364cull, 0xb732ebd08e42d9b8ull, 0x6908cb8dfb51bcc7ull, 0x2c3a158fd80783cfull, 0x89233f7d94bb8ba8ull, 0xd3b7d771646cb1fcull },
+	{  889249,     943, 0x884877a5, 0x030231f0d4540b24ull, 0x1f729fbc94014d98ull, 0x8c2b092199271bd3ull, 0xfb829f172168ce23ull, 0x14663c2c32b27801ull, 0x0c73daba68c21431ull, 0x521a41faddff89f3ull },
+	{  891136,     944, 0x7bfdc115, 0x9d820f1f3357c089ull, 0x58d122659beed37cull, 0xae039b277a44e3bdull, 0xc365a56e506489a6ull, 0x48f3f322972f3263ull, 0xf7e747308d790ee0ull, 0x0913ba4b353a9e12ull },
+	{  893025,     945, 0xec50d1ac, 0xd517829afcb67341ull, 0xe01712c42dc36711ull, 0xdb96415a3da47b2bull, 0x043a81793d02db84ull, 0x92f41af441327720ull, 0xc116ef769ca3a909ull, 0x2de28637f8113922ull },
+	{  894916,     946, 0xf729ce70, 0x2940a1b3202d3efdull, 0x7cbc1c4a7290a493ull, 0xcda8f67d550977bcull, 0xe0446c16798544b6ull, 0x6a736ff41b8bff62ull, 0xfadc1aa5304fc685ull, 0xf82dcdd45502cda4ull },
+	{  896809,     947, 0x3d35d1c7, 0x3b7176dfe3e3ca47ull, 0x413d5d209effbf6full, 0x678839f04b462ca2ull, 0x8d851af069d3231aull, 0xca3bcaad0be864f9ull, 0x71c085163335570full, 0x0a3ccc7068cf90c4ull },
+	{  898704,     948, 0xc551fb83, 0x4924a20027961bb7ull, 0xa8df1bb5bd3cab84ull, 0x129228230583f788ull, 0xa1dfd8ae2563d61cull, 0x61d48a644618a9a2ull, 0x92ad146df7ba52fdull, 0xcba581f83eb998b7ull },
+	{  900601,     949, 0xe722b679, 0xac0bbe0d01f796a7ull, 0xcc7624f7c1d1d431ull, 0x7c445ef0d474973aull, 0x19809944cbb703bbull, 0x76c38a355041ecefull, 0x1c517b55b0267bbaull, 0x7289869c085c2ec6ull },
+	{  902500,     950, 0xcb2805ae, 0x7eb009db034017a1ull, 0x2fa8b91101f1f18bull, 0xcceee8b87298d638ull, 0xc25f3a247c4d68c5ull, 0x0fe85277d5dc4dd3ull, 0x6b96c9a646756e31ull, 0x315be70ba89ad808ull },
+	{  904401,     951, 0x8d529686, 0xe5d5eb5c418af156ull, 0x86f6382e37f82892ull, 0x9e34a86969e6ad6bull, 0x67b1fb409cb32166ull, 0x849a65e997ec05cdull, 0x84d692dcb3a54a64ull, 0x8ba587e2230e81e1ull },
+	{  906304,     952, 0x6af1d536, 0x65a109fe5059aef3ull, 0x46a5ff10eb1345c2ull, 0xf8cb2d630c6b84d1ull, 0x0bd51baefef1cfa0ull, 0x64bbdff23632de41ull, 0x5203bd0237dfe327ull, 0x2e06233769575325ull },
+	{  908209,     953, 0x0ac19228, 0xb9f7d36547d0e598ull, 0x28d0979b02b19d9eull, 0x43d5f00815dc239dull, 0x9085d444de2287bdull, 0x9f0e278c5da59641ull, 0xf501fe178137a583ull, 0xa103b646f5d7837dull },
+	{  910116,     954, 0x46ded95c, 0x9b578d6fe9734179ull, 0xf17d2455e4884e1aull, 0x63de56ca92aedda0ull, 0x208c4670a50b67dbull, 0x48c0d5f1449d1ce9ull, 0x37fddb05aea221cfull, 0x0a11122bdb25c870ull },
+	{  912025,     955, 0x6fa53a27, 0x951bb24138788146ull, 0xf55cf5e5c9cc7dc1ull, 0x1b802bcf45f989bcull, 0xa0f9eb54cb889331ull, 0xc042042b0f33647cull, 0x6431a41cae559c70ull, 0x3e8d1acf3481763aull },
+	{  913936,     956, 0xd487228b, 0x67e73a06264aeb65ull, 0x7379699b8e1cb515ull, 0xa52d4f50181f1093ull, 0xfb981b9d372c33ebull, 0x9a4a20ea947ef4ebull, 0x27207141863fdd7dull, 0xda46eca15de1f3efull },
+	{  915849,     957, 0xd5083d21, 0x74412a3d1fa753bdull, 0x3076e7e2b7524676ull, 0xb5c7e9ef4bed1310ull, 0x6832276181cb3b80ull, 0x528b9f577e54991cull, 0xdb89b0c18d2517bfull, 0x5df7f3b70269e0b5ull },
+	{  917764,     958, 0x4e7a41ef, 0x6e1fad50577d6508ull, 0x103a0f3330f1b941ull, 0x312b965ef15fb76full, 0x58194689496d8dadull, 0x9d8c20ff0f9f45f2ull, 0x064e9f9417083d7dull, 0x56345803cac4b0afull },
+	{  919681,     959, 0x46b84b3b, 0x98e83bd1272d665bull, 0x91af02f7fe385614ull, 0x8d88db4c92cdf66full, 0xc1d30cd3b688a2edull, 0x54d083ef691be225ull, 0x2a04d7abef0abedcull, 0x0e63cd928bd89b32ull },
+	{  921600,     960, 0x73886cd5, 0x37ff537f6ff4f098ull, 0xf49efbb202b48ffdull, 0xe2a984d96e163b0aull, 0x40313e0d96ef3cdcull, 0x8c56fbca1f7b55f7ull, 0xd6df018434255c76ull, 0x9b2597a716398a54ull },
+	{  923521,     961, 0x4b4fa038, 0xc8be3a4e77b0bd1eull, 0x665380b1dec1386dull, 0xaee67a3d124ea0e3ull, 0xe64fb0ddd4a7f6c5ull, 0x9029b46407557651ull, 0x651b28f05ca4710eull, 0x4edcce6328349c01ull },
+	{  925444,     962, 0x8ccbacc9, 0xfd1602e0e57d337dull, 0x33bc4a685fb7e59cull, 0xb2064df794fadee5ull, 0xbb6371eed5fded02ull, 0xb11e49a04c19573dull, 0xbcd0783d79e64f6cull, 0x5f1d3a85a7b330b1ull },
+	{  927369,     963, 0xaf34ed55, 0x16118af5a60c45e7ull, 0xa8240ef15de2c8e3ull, 0x2aa11b46fd20e7c5ull, 0x73ba26993998942aull, 0xeea97991db628031ull, 0x364d2dddaac1f34aull, 0xc959e85640347ae7ull },
+	{  929296,     964, 0xb64e2456, 0x5241011fc0478748ull, 0x06e3ed5da976d0daull, 0xb8c1ceea817dbfe7ull, 0xa113a8bd72043bb3ull, 0x429e1b6fc4377b0full, 0x790706e3f84dcef4ull, 0x817e20ec72f7ac93ull },
+	{  931225,     965, 0x0235cc6d, 0x8bff55934fb03cf7ull, 0x7909fc193b9d39b1ull, 0xc69efa65287fd0e7ull, 0x579fa7eefe2572e4ull, 0x28322aa1d75f9c80ull, 0x0b835a9321cc6671ull, 0xb9326c108f93759eull },
+	{  933156,     966, 0xb1d058b0, 0xa33e23d34bbcc8baull, 0x158bdfb367f6627cull, 0x29e0ff91741a7ba9ull, 0x68ead87fe88eda7aull, 0x9472d17e0b17281eull, 0xa43f977332025e78ull, 0xd1f6af29871b71a7ull },
+	{  935089,     967, 0xb11252bc, 0x9ea1b47004df74daull, 0xc71642029bcbb81dull, 0x4a78df1a78c75519ull, 0x4ec2fa46e630d108ull, 0x36f0a2a459c70f31ull, 0x7d188b8f8ac39038ull, 0x48bc11e8bf5e8c7full },
+	{  937024,     968, 0x829bf86f, 0xcfc1d13b5d26b7aaull, 0xe1a93b446abbe140ull, 0x8214dfe8df684305ull, 0xb61a58f1dd13b164ull, 0x1061b714d28a7bfbull, 0x1fc110e3c3aa81cdull, 0x55b20c9603165d05ull },
+	{  938961,     969, 0xc23d58dc, 0x937cfdf89ba2c7a7ull, 0xabfd7a23d36dec32ull, 0x28918e7a05264354ull, 0x355f4cd98ca88b0cull, 0x7833b2d4f17c9e7bull, 0xb3a10144aa0bf436ull, 0x1e04968f626e5927ull },
+	{  940900,     970, 0x9c794926, 0x77e33e91ad76b602ull, 0xcbc793f911749eb9ull, 0x29497517b94ad0e6ull, 0x8378099c4a52d9a0ull, 0x3ca2194fb390a19cull, 0x4e119392ed0bc464ull, 0x4189b9f74e97f52bull },
+	{  942841,     971, 0xa7a3e66f, 0xfb02f6df327a0302ull, 0xe4b4b0ce2f80af82ull, 0xe5f84eb05fae3117ull, 0xb40d6947b2db6743ull, 0xc369233f9104743aull, 0x7f33b34605ef1773ull, 0xeaeb3d13d4ea602dull },
+	{  944784,     972, 0x17bd4ee5, 0x88ff495623766ab0ull, 0xecf42357f9ca4ac0ull, 0xd5b762fdfe8dfb6bull, 0x89ed74d0deb21724ull, 0x79bfc4396a45557full, 0x875006af5b7d540dull, 0x3a5b8d0e995c039eull },
+	{  946729,     973, 0xb63eda02, 0x6c7df8caaf2d8f54ull, 0xd08049629f98942eull, 0x0f352da87be26452ull, 0xfc06955a374e1600ull, 0x6176db5a10a8e48bull, 0xe6566338d531b3a1ull, 0x02eae64dcd9ca9d9ull },
+	{  948676,     974, 0x2d1e9acb, 0x8eaed9066aa62087ull, 0x66554fe11f5e22fbull, 0x07441afdace2fdd6ull, 0xb60cbe5fa1baa445ull, 0x12e116c7c3d3681full, 0x153e115bcea9d69bull, 0x91579b2fa7618deaull },
+	{  950625,     975, 0x905ff9dd, 0x7632018a1d82c4beull, 0x753095c8af50398eull, 0x55a765afa521684bull, 0x03b52db0cfc289bfull, 0x539f43785220d7edull, 0xb6831e77cbee7a7bull, 0x66c186382897b861ull },
+	{  952576,     976, 0x5aed6998, 0xa5ff0ef208d97df3ull, 0x8e091ed27fcc0d0eull, 0x19a7570cd81c2946ull, 0x06f3d2d3903e97b6ull, 0xbf169a636774633aull, 0xe08b63b66cfc79aaull, 0x388cc7e80c1df54dull },
+	{  954529,     977, 0xe652a855, 0x0a6d22d93c2d27daull, 0x577939f71f7dd356ull, 0xc52d20ff543a1734ull, 0x44f8cac507dac94full, 0xaca9fceac59a01ccull, 0xfba97d61b8820badull, 0xa0c43b2f55347bdeull },
+	{  956484,     978, 0x33c4ea4c, 0x1dd73c1e2ced55deull, 0xbb0b10d50ac04c41ull, 0x7e5a722be56ed79bull, 0x0b6f5ca3d0367a50ull, 0x7b6bc45d1f7a038aull, 0x78ee4d429718fdafull, 0xb559e83d783b7e4cull },
+	{  958441,     979, 0xe8e5e745, 0x72a5f0d0ecf43c6cull, 0x832539bf6febd1dfull, 0xe551d7a531774133ull, 0xce8fc7be081e2be1ull, 0x7df19851bd801842ull, 0xba5ea2b84901ada5ull, 0x2b54932069eb2931ull },
+	{  960400,     980, 0x8b79d8fb, 0x732e7afc5f7a5d0dull, 0x2a2612fed34b141dull, 0xc18177a33856656eull, 0x7193856bb77756faull, 0x0d3e7b5b7001415eull, 0x61315f6096675b66ull, 0xae7874b7c82dc09cull },
+	{  962361,     981, 0x0c25f8ce, 0x8fde4104d3d2857eull, 0x4737d5b194077975ull, 0x80454ac1d1bd6daeull, 0xe7dfb5b5f612fd07ull, 0x098658b10c2a616cull, 0x17d53c509ba7ab68ull, 0x3871394cd5988311ull },
+	{  964324,     982, 0x7b8e5232, 0xd4f6208a3d653186ull, 0x61ad88adeec79d4dull, 0x60e033eca7e242deull, 0x8facdf94b31f11b5ull, 0x07cac6c4c403676cull, 0x579c5ab882a2ed72ull, 0xcaf16d667fa9ecccull },
+	{  966289,     983, 0x3e77902c, 0x22b5ff4c69dacd42ull, 0xaf5b89e6ce785c64ull, 0xd755bf4dd0bcd106ull, 0x3a24874c9712e395ull, 0xf60b36e31e2e0ba3ull, 0x2e9b9e61e9ee50a7ull, 0x4844f844827f35d9ull },
+	{  968256,     984, 0x70b9cdc5, 0xa45d2e7f8db7fe16ull, 0x562152359c03162cull, 0xf450e2dc0bbf2fd8ull, 0x4f5bc1d52439ec0cull, 0xdb965d953192a380ull, 0x22b75a0b06f6f567ull, 0xd2087181cd8276faull },
+	{  970225,     985, 0x3b685261, 0xa5bac7aeef828193ull, 0xa823e7311c5c81beull, 0x299917af82060dc0ull, 0x761951000d59a69eull, 0xab2b7048b425e70eull, 0xb4275176d22c72d2ull, 0xa80b7bdeddbc0d2dull },
+	{  972196,     986, 0xe79880bb, 0xc79264f7b37f4a14ull, 0x7f24c8b98435c767ull, 0x86325a7f451efa1cull, 0xfd93948f4c04fd66ull, 0x7c520ebbc9d157d8ull, 0x421d800c24bdf434ull, 0x083266ba2e89335full },
+	{  974169,     987, 0x177d3d08, 0x79aa90a4b40c868eull, 0x0a421e56813258beull, 0x96309c6bb856de8eull, 0x608928f7b59fb769ull, 0x729856de547f7e67ull, 0x7529e79c6ede93f5ull, 0x939e4b11d8b18613ull },
+	{  976144,     988, 0x73b1427f, 0x2de960a6639cb635ull, 0xbcf9aa5d7e229ebcull, 0x5b3935b634748512ull, 0x838e22fc5a6479acull, 0x171f26baef3f6c3cull, 0x8a65652eaa0ad939ull, 0xf0afd0e864ff3640ull },
+	{  978121,     989, 0xd35dfbc5, 0x7f230f7d970b91b2ull, 0xfb4374cd61653559ull, 0x096ef1a7c90b22a8ull, 0xd82ecb4ab5a1a96dull, 0x5d5a4dc5214cff3full, 0xece8cd36b880b596ull, 0xdffdf5de91b4d037ull },
+	{  980100,     990, 0x8a8cad17, 0x2658253919fbc51bull, 0xe7a64bcf82f2ea64ull, 0x89f43dcdcfd646fdull, 0xb5ef26f3a285bd94ull, 0xe77426c713e9af65ull, 0xe64e088b53e25f04ull, 0x6b93f996d878e15dull },
+	{  982081,     991, 0xc9257564, 0x98261d234719b1c6ull, 0x6d10e9e57734c84cull, 0x849aeb8af46b4da0ull, 0x066695a686474d98ull, 0x48004f2786627ff8ull, 0x59db3e876b210543ull, 0x02d348644ea37435ull },
+	{  984064,     992, 0xe3426e36, 0xbcfcd680ce9be138ull, 0xb3e5f47af494eb3bull, 0x075d9435f9c36d4bull, 0xf24d1edb2dbe9097ull, 0x81d55d2d29b83637ull, 0x976ed15492362455ull, 0xfdb7a4dc51a3a443ull },
+	{  986049,     993, 0x6ad3d6de, 0x578b5ca2b127a7d8ull, 0x0a5770fde80c93d4ull, 0xe0719919d7d863b5ull, 0x4fd209d6b25304a6ull, 0x22a5d2b478c9c312ull, 0x891b97c37f99d60full, 0xcbc176b9077d655bull },
+	{  988036,     994, 0x5f70b93c, 0x3bb0f2118ae3720cull, 0x7149b97815228c41ull, 0x775bfd700bfeb94dull, 0xbca0f9fbde88dd96ull, 0x38d1289bbef96308ull, 0xc8c7f3844a8f3643ull, 0x91bd37d36dca5eb1ull },
+	{  990025,     995, 0xf6d26ce3, 0xe0db1045646d7e25ull, 0x0ab57aeb5aadf7b3ull, 0xd0b9057d910933cfull, 0x9ea79436274fb17aull, 0x0e59e120442abe99ull, 0xf666dfde29e49854ull, 0x9ed05f887c6a76aaull },
+	{  992016,     996, 0x2c8351be, 0x3b13dd6c58c1efaaull, 0x2542859e985722f4ull, 0xb4dd69cb88ae8848ull, 0x0edafe0d37055a1full, 0x6433410272f9faabull, 0x0283c50d893725d3ull, 0x6168e7e89f097d97ull },
+	{  994009,     997, 0xbf47d399, 0x55999edb3752a0f9ull, 0xbafe382012e0ac4aull, 0x9a55d428c7aac670ull, 0x03629e5c20dbaaccull, 0xb8df0c387ecceeebull, 0x63b82fc9b556b702ull, 0xed3a3772631b5caaull },
+	{  996004,     998, 0x36b9905e, 0xd9719493cc862308ull, 0xb6375cdbc45be866ull, 0x946abc49b1244370ull, 0xf1f412e26d2e9571ull, 0x6715ded1e0c6e90bull, 0x979a40cc7e773a31ull, 0xb873c9e449f62291ull },
+	{  998001,     999, 0x462a7045, 0xde628204a9d8c512ull, 0x1f9454c9ba84e42full, 0xedacb17a278a1ed4ull, 0xd5f6ff03b08b62c2ull, 0xd3bc6f0deb909370ull, 0x0a44b0b4c016739cull, 0xe0b66a7040bc09d6ull },
+	{ 1000000,    1000, 0x1159f5a2, 0x10d71445d6484202ull, 0x24568d5ce617bb05ull, 0x1baa06951a374f23ull, 0xcbc92661458d03a8ull, 0xe4793420511eece6ull, 0x28ef553fcdbf0947ull, 0xb546135a99923646ull },
+	{ 1002001,    1001, 0x0da1c591, 0x7822b29501911961ull, 0xc044fbe5ef324bf8ull, 0xc97760123e7dcd43ull, 0x20ef6257af90c97cull, 0x833df55c0f997d43ull, 0xa2e418a4fc71cd82ull, 0x9d0ac396a316e3a3ull },
+	{ 1004004,    1002, 0xd6ef652e, 0xdb28149636e7aed3ull, 0x192b789b269ddcd9ull, 0x636a735631dd191aull, 0x059fbd6803e77123ull, 0x9906cd80e7963458ull, 0xf52698499c8b58a9ull, 0xb884f29f4e4e1893ull },
+	{ 1006009,    1003, 0x21be636f, 0x3796e57c51b4073eull, 0x13a53889ef7a9185ull, 0xc32b733c97a10ac9ull, 0xb4f184c0e27a7e77ull, 0x577e50132d938e2bull, 0x5fa241a14b4071acull, 0x6d3d408fba8f502eull },
+	{ 1008016,    1004, 0xa248546d, 0xa9485d288fc10175ull, 0x69422b8edd031685ull, 0x9a3af9b20a59ea70ull, 0xb7d0339b825b34adull, 0x8e4d79c289d9094full, 0x29d4507047040e14ull, 0x0a39597848e3da8dull },
+	{ 1010025,    1005, 0x7b1b562f, 0x358c7ad220bbd407ull, 0x0b568fa09ec9acceull, 0x97f00b1dad9226bdull, 0x15c8088611c364f8ull, 0xa791c29c4c2de68bull, 0x9a84bcc2fe14b07eull, 0xe8f9177e0ecedbd0ull },
+	{ 1012036,    1006, 0x2442f052, 0x240f5cc2bab289e0ull, 0x36e21724e3cc67cfull, 0x53ddb3673c72c3f5ull, 0x01c42ef5275a3ae5ull, 0x26691da81b46c488ull, 0xbf534a509ea277dfull, 0x4b63ead4dddb51f0ull },
+	{ 1014049,    1007, 0x8267d2db, 0x690e5e55ad79227dull, 0x60871e51d08c3fa2ull, 0xd3516b7751c7cfbdull, 0x1b9189cf388641b6ull, 0xd4f544139b20332full, 0xf9bee0ea4e1f0aa6ull, 0x73b3e3fd88c0ed6dull },
+	{ 1016064,    1008, 0x2ded11f8, 0x074f1ac1cda750b1ull, 0xa414d1a48352471bull, 0xc1302dc70a53fbf0ull, 0x07d5ad5ed16456ffull, 0x93b7c14a615cc9c7ull, 0xb39696a61f484d1bull, 0x4bc4b186ead7e1c9ull },
+	{ 1018081,    1009, 0xf6162943, 0x4216e04932aaa5d6ull, 0xaf446a79507fbdbbull, 0x3845de8d952f13a6ull, 0x32c89e518ede15feull, 0xae43d8b9b45c57ceull, 0xec3b6ae27abac3adull, 0x08c9236fa56e1f5full },
+	{ 1020100,    1010, 0xf3ce2019, 0x893a5a7e88d89319ull, 0xa353bb23b76aeaadull, 0x501efded7526369dull, 0x81e76a9be4bf98a8ull, 0x57b6b790b7757cf3ull, 0x1c75a62c82faf45aull, 0x20ca8fd541d63bd0ull },
+	{ 1022121,    1011, 0x7aed54e9, 0x829d4938d8f18e57ull, 0x1100cddae7a5ab0cull, 0x7be5c1bd70820a3full, 0xcfa5c30860ddedd8ull, 0x827abaf0ddcd8169ull, 0xafe72adb4e89af20ull, 0x187fe3ed48950078ull },
+	{ 1024144,    1012, 0x228656ff, 0x3673bfc53396a5d5ull, 0xb5a5146559b62b7aull, 0x9cb0cc1404f54181ull, 0x995eceb7f1927ec1ull, 0xc77270e3fb7a9e79ull, 0xb4f6e90d3888d85eull, 0xd9e36d63fe498854ull },
+	{ 1026169,    1013, 0xc30db641, 0xd8bf420cfa60a5f3ull, 0xdaf0231d5af59d11ull, 0x068ed94fd87f8635ull, 0xdc8ab772087b315full, 0x5e8f6f05eb5a65b3ull, 0xe39cbbcf967ff10eull, 0x56c3b2308402fc26ull },
+	{ 1028196,    1014, 0x40dc8fd7, 0xd33ba7052ff0aa41ull, 0x55b46ae3b4f3c2a8ull, 0x9d45264ce55e45eeull, 0xff3295ae19693dbbull, 0x96e963016315bc30ull, 0x1dd4d36dcba85859ull, 0x41d81c2fe2e1f494ull },
+	{ 1030225,    1015, 0x19b4f15c, 0x939ab82d449ee149ull, 0x247f3fc386f0dd1full, 0x5b2a0327ca59a4e8ull, 0x8c8cf4e2b806a585ull, 0x5468820a1ef181daull, 0x8214ea85d71775e0ull, 0x3c865913030d6383ull },
+	{ 1032256,    1016, 0x4d8da65d, 0x208a0b05d08f6d40ull, 0x84ef0f4d5a3327efull, 0x563c8a9c49c9426bull, 0x3f4b9a789e20b714ull, 0x5bb5b22c10447baeull, 0x1783b1c16698ab29ull, 0x4955b27f71b41d93ull },
+	{ 1034289,    1017, 0xa2ea4120, 0x18706510027c3c09ull, 0x0b2d25ff3150b614ull, 0x92c8875654c48e0cull, 0x7e20fbda6cbd20b1ull, 0xb433257a504186d7ull, 0x3b85d2146a68099full, 0x701e8da6f5006fabull },
+	{ 1036324,    1018, 0x18074bd8, 0x7bc10b49258cf602ull, 0x9e081063ef606fdfull, 0xc7391828f87fca92ull, 0x2d2f8b667fb4325dull, 0x4b175721b1e566bbull, 0xdd28313d105c596eull, 0x5fa23d1b7c088765ull },
+	{ 1038361,    1019, 0xee5d7542, 0x1c6bef558f820c46ull, 0x1674767b6824ca5eull, 0x3bf42f5cedbb4c50ull, 0xb6d704545997bf99ull, 0x361bcd92bb34fcdcull, 0xcc5a00efc27d2920ull, 0x8a66ac07efcfbb9bull },
+	{ 1040400,    1020, 0x08ff146c, 0x9500e6e2b116a63bull, 0x40eee0b11879f3ceull, 0x78f56ef8410d5c2aull, 0x42f5715cf833af04ull, 0x4215a946f3d6f0a5ull, 0x6504460e2ffce188ull, 0x5fbc2f75757341e3ull },
+	{ 1042441,    1021, 0x420e7ed8, 0x6668ad7c7b24b261ull, 0x7ea2ca2ef4094c7bull, 0x56661b937a3b71ecull, 0x1d9fbf59b31f7c16ull, 0xef2468d4f5230057ull, 0xc31ae7e8c06da453ull, 0x60670011c742089eull },
+	{ 1044484,    1022, 0x7423bb3d, 0x49c5be4c408408f1ull, 0x3c6a424345daed89ull, 0x96b7ab9e966d50c3ull, 0xd4add4aebaee1752ull, 0x61709649d7b8c7a8ull, 0xc5e43320574c57acull, 0x6efb9c4809ffb1b7ull },
+	{ 1046529,    1023, 0x77afc3db, 0x6ac5d5c224ebde2dull, 0x5edc18234c85abc5ull, 0x714ce9d2afc7218full, 0x1a52c49610a75d58ull, 0x1bd233d3d1496843ull, 0x2bc328220b97e6e7ull, 0x07361101c56d2129ull },
+	{    1024,    1024, 0xbabfda25, 0xaea08e6dbd74d3bfull, 0x3d39a9a04666cc2cull, 0xd2fc0634b115ed0eull, 0xa05cb2e07a4168beull, 0x35455fba3f72ed77ull, 0xff0e050538ecefbeull, 0x8bd63ee86af5a191ull },
+	{       0, 1048576, 0x5398210c, 0x5fb5e48ac7b7fa4full, 0xa96170f08f5acbc7ull, 0xbbf5c63d4f52a1e5ull, 0x6cc09e60700563e9ull, 0xd18f23221e964791ull, 0xffc23eeef7af26ebull, 0x693a954a3622a315ull },
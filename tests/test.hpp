@@ -0,0 +1,115 @@
+//////////////////////////////////////////////
+//	test.hpp								//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#ifndef LLCPP_CITY_TEST_HPP_
+#define LLCPP_CITY_TEST_HPP_
+
+#include "../llcityhash/city.hpp"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+// Buffer of the upstream city-test.cc, and the seeds it hashes it with
+constexpr len_t TEST_DATA_SIZE = 1 << 20;
+constexpr ui64 TEST_SEED0 = 1234567;
+constexpr ui64 TEST_SEED1 = llcpp::meta::hash::city::CityHash::k0;
+
+struct Options {
+	ui64 seed;			// Seed of the random keys
+	len_t iterations;	// Random keys checked by the differential tests
+	ll_bool_t verbose;	// Print every failure, not just the first ones
+};
+
+// Same bytes as fillTestData in the upstream city-test.cc
+void fillTestData(std::vector<ll_char_t>& buffer);
+
+// Runs body(thread) on "threads" threads and waits for all of them
+template<class Body>
+void runThreads(const len_t threads, Body&& body) {
+	std::vector<std::thread> workers;
+	workers.reserve(threads);
+	for (len_t t = 0; t < threads; ++t) workers.emplace_back(body, t);
+	for (std::thread& worker : workers) worker.join();
+}
+
+#pragma region Checker
+// Counts the checks of a test and prints the first failures
+class Checker {
+	private:
+		static constexpr len_t MAX_REPORTED = 10;
+
+	private:
+		ll_string_t name;
+		ll_bool_t verbose;
+		len_t checks;
+		len_t failures;
+
+	public:
+		Checker(ll_string_t name, const Options& options) noexcept
+			: name(name)
+			, verbose(options.verbose)
+			, checks(0)
+			, failures(0)
+		{}
+
+		// Records one comparison; "what" names the function and the input
+		__LL_INLINE__ ll_bool_t expect(const ll_bool_t ok, const std::string& what) noexcept {
+			++this->checks;
+			if (!ok && (this->failures++ < MAX_REPORTED || this->verbose))
+				std::printf("FAILED: %s: %s\n", this->name, what.c_str());
+			return ok;
+		}
+		// Same, building "what" only if it failed
+		template<class Describe>
+		__LL_INLINE__ ll_bool_t expectThat(const ll_bool_t ok, Describe&& describe) noexcept {
+			if (ok) {
+				++this->checks;
+				return true;
+			}
+			return this->expect(false, describe());
+		}
+
+		__LL_NODISCARD__ len_t getFailures() const noexcept { return this->failures; }
+		// Prints the totals; true if nothing failed
+		ll_bool_t finish() const noexcept {
+			std::printf("%-14s %10zu checks, %zu failed\n", this->name, this->checks, this->failures);
+			return this->failures == 0;
+		}
+};
+
+#pragma endregion
+#pragma region Tests
+// Every test returns false if any of its checks failed
+bool runGoldenTests(const Options& options);
+bool runDifferentialTests(const Options& options);
+bool runInstrumentTests(const Options& options);
+bool runMapTests(const Options& options);
+bool runHllTests(const Options& options);
+bool runTreeTests(const Options& options);
+bool runInternTests(const Options& options);
+bool runBloomTests(const Options& options);
+bool runShardTests(const Options& options);
+bool runCountMinTests(const Options& options);
+bool runMinHashTests(const Options& options);
+bool runCdcTests(const Options& options);
+bool runFieldsTests(const Options& options);
+bool runAsyncTests(const Options& options);
+bool runPipelineTests(const Options& options);
+
+#pragma endregion
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
+
+#endif // LLCPP_CITY_TEST_HPP_
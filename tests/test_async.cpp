@@ -0,0 +1,164 @@
+//////////////////////////////////////////////
+//	test_async.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_async.hpp"
+
+#include <cerrno>
+#include <filesystem>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+struct FileSet {
+	std::filesystem::path dir;
+	std::vector<std::string> paths;
+	std::vector<hash::Hash128> expected;	// CityHash128 of every file
+	len_t bytes;
+};
+
+struct Collected {
+	std::vector<CityFileDigest> results;
+	len_t calls;
+};
+
+void collect(const CityFileDigest& result, void* user) noexcept {
+	Collected& collected = *static_cast<Collected*>(user);
+	++collected.calls;
+	if (result.index < collected.results.size()) collected.results[result.index] = result;
+}
+
+// Writes "count" files of "size" bytes each (size + i % 4099 when ragged),
+//	cut from data at different offsets
+ll_bool_t writeFiles(FileSet& set, ll_string_t name, const std::vector<ll_char_t>& data, const len_t count, const len_t size, const ll_bool_t ragged) {
+	std::error_code error;
+	set.dir = std::filesystem::temp_directory_path() / name;
+	std::filesystem::remove_all(set.dir, error);
+	if (!std::filesystem::create_directories(set.dir, error)) return false;
+	set.bytes = 0;
+	for (len_t i = 0; i < count; ++i) {
+		len_t len = ragged ? size + (i * 977) % 4099 : size;
+		if (len > data.size()) len = data.size();
+		const len_t offset = (i * 4093) % (data.size() - len + 1);
+		const std::string path = (set.dir / ("file" + std::to_string(i) + ".bin")).string();
+		std::FILE* file = std::fopen(path.c_str(), "wb");
+		const ll_bool_t ok = file && std::fwrite(data.data() + offset, 1, len, file) == len;
+		if (file) std::fclose(file);
+		if (!ok) return false;
+		set.paths.push_back(path);
+		set.expected.push_back(*city::CityHash128(data.data() + offset, len));
+		set.bytes += len;
+	}
+	return true;
+}
+
+// Empty, short, round-sized and ragged files, some bigger than a buffer
+ll_bool_t writeCheckFiles(FileSet& set, const std::vector<ll_char_t>& data) {
+	ll_bool_t ok = writeFiles(set, "llcityhash_async_test", data, 40, 0, true);
+	for (const len_t size : { len_t(0), len_t(1), len_t(127), len_t(128), len_t(65536), len_t(1) << 20 }) {
+		FileSet more;
+		ok = ok && writeFiles(more, "llcityhash_async_test_more", data, 1, size, false);
+		if (ok) {
+			const std::filesystem::path path = set.dir / ("size" + std::to_string(size) + ".bin");
+			std::error_code error;
+			std::filesystem::rename(more.paths[0], path, error);
+			ok = !error;
+			set.paths.push_back(path.string());
+			set.expected.push_back(more.expected[0]);
+			set.bytes += more.bytes;
+		}
+		std::error_code error;
+		std::filesystem::remove_all(more.dir, error);
+	}
+	return ok;
+}
+
+ll_string_t backendName(const AsyncBackend backend) noexcept {
+	switch (backend) {
+		case AsyncBackend::IoUring:		return "io_uring";
+		case AsyncBackend::ThreadPool:	return "pool";
+		default:						return "auto";
+	}
+}
+
+void checkDigests(Checker& checker, const FileSet& set, CityAsyncHasher& hasher, const std::string& name) {
+	Collected collected{ std::vector<CityFileDigest>(set.paths.size()), 0 };
+	for (CityFileDigest& result : collected.results) result.error = -1;
+	if (!checker.expect(hasher.hashFiles(set.paths, collect, &collected) && collected.calls == set.paths.size(),
+		"CityAsyncHasher " + name + " did not report every file"))
+		return;
+	for (len_t i = 0; i < set.paths.size(); ++i) {
+		const CityFileDigest& result = collected.results[i];
+		if (!checker.expectThat(result.error == 0 && result.digest == set.expected[i], [&]() {
+			return "CityAsyncHasher " + name + " differs from CityHash128 for " + set.paths[i] + " (error " + std::to_string(result.error) + ")";
+		})) return;
+	}
+	checker.expectThat(hasher.stats().bytes == set.bytes && hasher.stats().failed == 0, [&]() {
+		return "CityAsyncHasher " + name + " counted " + std::to_string(hasher.stats().bytes) + " bytes of " + std::to_string(set.bytes);
+	});
+}
+
+// Missing files and directories are reported and do not stop the others
+void checkMissing(Checker& checker, const FileSet& set, const AsyncBackend backend) {
+	CityAsyncOptions options;
+	options.backend = backend;
+	CityAsyncHasher hasher(options);
+	const std::vector<std::string> paths = { set.paths[1], "/nonexistent/llcityhash", set.dir.string(), set.paths[2] };
+	Collected collected{ std::vector<CityFileDigest>(paths.size()), 0 };
+	const ll_bool_t done = hasher.hashFiles(paths, collect, &collected);
+	checker.expect(done && collected.calls == 4 && collected.results[0].digest == set.expected[1] && collected.results[3].digest == set.expected[2] &&
+		collected.results[1].error == ENOENT && collected.results[2].error == EISDIR && hasher.stats().failed == 2,
+		std::string("CityAsyncHasher ") + backendName(backend) + " mishandled missing files");
+}
+
+} // namespace
+
+bool runAsyncTests(const Options& options) {
+	std::vector<ll_char_t> data(len_t(2) << 20);
+	fillTestData(data);
+	Checker checker("async", options);
+	std::vector<AsyncBackend> backends = { AsyncBackend::ThreadPool };
+	if (CityAsyncHasher::isIoUringAvailable()) backends.insert(backends.begin(), AsyncBackend::IoUring);
+
+	FileSet set;
+	if (checker.expect(writeCheckFiles(set, data), "could not write files in " + set.dir.string())) {
+		struct Shape {
+			len_t buffer_size;
+			len_t buffer_count;
+			len_t threads;
+		};
+		constexpr Shape SHAPES[] = { { 4096, 1, 1 }, { 4096, 3, 1 }, { 65536, 32, 1 }, { 1 << 20, 8, 2 }, { 16384, 16, 4 } };
+		for (const AsyncBackend backend : backends) {
+			for (const Shape& shape : SHAPES) {
+				CityAsyncOptions async_options;
+				async_options.buffer_size = shape.buffer_size;
+				async_options.buffer_count = shape.buffer_count;
+				async_options.threads = shape.threads;
+				async_options.backend = backend;
+				CityAsyncHasher hasher(async_options);
+				const std::string name = std::string(backendName(backend)) + " buffers=" + std::to_string(shape.buffer_count) +
+					"x" + std::to_string(shape.buffer_size) + " threads=" + std::to_string(shape.threads);
+				checkDigests(checker, set, hasher, name);
+			}
+			checkMissing(checker, set, backend);
+		}
+	}
+	std::error_code error;
+	std::filesystem::remove_all(set.dir, error);
+
+	CityAsyncHasher hasher;
+	checker.expect(!hasher.hashFiles(nullptr, 1, collect) && !hasher.hashFiles(set.paths, nullptr), "CityAsyncHasher accepted null paths or callback");
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,135 @@
+//////////////////////////////////////////////
+//	test_bloom.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_bloom.hpp"
+#include "../llcityhash/city_cpu.hpp"
+
+#include <cmath>
+#include <memory>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+constexpr len_t N = 100000;
+constexpr len_t KEY_SIZE = 16;
+
+// Keys [0, N) are added, keys [N, 2N) never are
+struct BloomKeys {
+	std::vector<ll_char_t> data;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+};
+
+BloomKeys makeKeys() {
+	BloomKeys keys;
+	keys.data.resize(2 * N * KEY_SIZE);
+	fillTestData(keys.data);
+	keys.ptrs.resize(2 * N);
+	keys.lens.assign(2 * N, KEY_SIZE);
+	for (len_t i = 0; i < 2 * N; ++i) keys.ptrs[i] = keys.data.data() + i * KEY_SIZE;
+	return keys;
+}
+
+// No false negatives, and every kernel answers as mayContain
+void checkLookups(Checker& checker, const BloomKeys& keys, const CityBloomFilter& filter, ll_bool_t* out, const f64 bits_per_key) {
+	const std::string at = std::to_string(static_cast<len_t>(bits_per_key)) + " bits/key";
+	// Kernels the filter does not implement are refused, as in
+	//	CityHash64Batch
+	const BatchKernel unsupported[] = { BatchKernel::Sse41, static_cast<BatchKernel>(0xff) };
+	for (const BatchKernel kernel : unsupported) {
+		checker.expectThat(!filter.mayContainBatch(keys.ptrs.data(), keys.lens.data(), out, 2 * N, kernel), [&]() {
+			return "CityBloomFilter::mayContainBatch accepted kernel " + std::to_string(static_cast<int>(kernel));
+		});
+	}
+
+	const __internal__::CpuFeatures& cpu = __internal__::GetCpuFeatures();
+	std::vector<BatchKernel> kernels = { BatchKernel::Auto, BatchKernel::Scalar };
+	if (cpu.avx2) kernels.push_back(BatchKernel::Avx2);
+	if (cpu.avx2 && cpu.avx512) kernels.push_back(BatchKernel::Avx512);
+	else checker.expect(!filter.mayContainBatch(keys.ptrs.data(), keys.lens.data(), out, 2 * N, BatchKernel::Avx512),
+		"CityBloomFilter::mayContainBatch ran AVX-512 on a CPU without it");
+	for (const BatchKernel kernel : kernels) {
+		const std::string with = at + ", kernel " + std::to_string(static_cast<int>(kernel));
+		if (!checker.expect(filter.mayContainBatch(keys.ptrs.data(), keys.lens.data(), out, 2 * N, kernel), "CityBloomFilter::mayContainBatch refused " + with))
+			continue;
+		for (len_t i = 0; i < 2 * N; ++i) {
+			const ll_bool_t single = filter.mayContain(keys.ptrs[i], KEY_SIZE);
+			if (!checker.expectThat(out[i] == single && (i >= N || single), [&]() {
+				return "CityBloomFilter lookup of key " + std::to_string(i) + " at " + with;
+			})) break;
+		}
+	}
+}
+
+// A serialized copy, viewed and loaded, answers the same as the filter
+void checkSerialized(Checker& checker, const BloomKeys& keys, const CityBloomFilter& filter, const ll_bool_t* out, const f64 bits_per_key) {
+	const std::string at = std::to_string(static_cast<len_t>(bits_per_key)) + " bits/key";
+	const len_t size = filter.serializedSize();
+	std::unique_ptr<ui64[]> buffer(new ui64[size / sizeof(ui64)]);
+	std::optional<CityBloomFilter> view, loaded;
+	if (!checker.expect(filter.serialize(buffer.get(), size) && !filter.serialize(buffer.get(), size - 1) &&
+		(view = CityBloomFilter::view(buffer.get(), size)) && (loaded = CityBloomFilter::load(buffer.get(), size)) &&
+		!CityBloomFilter::view(buffer.get(), size - 1), "CityBloomFilter serialization at " + at))
+		return;
+	checker.expect(!view->add("key", 3) && view->isView() && !view->clear(), "CityBloomFilter view is not read-only at " + at);
+	for (len_t i = 0; i < 2 * N; ++i) {
+		if (!checker.expectThat(view->mayContain(keys.ptrs[i], KEY_SIZE) == out[i] && loaded->mayContain(keys.ptrs[i], KEY_SIZE) == out[i], [&]() {
+			return "serialized CityBloomFilter differs at key " + std::to_string(i) + ", " + at;
+		})) break;
+	}
+	reinterpret_cast<CityBloomHeader*>(buffer.get())->version += 1;
+	checker.expect(!CityBloomFilter::view(buffer.get(), size) && !CityBloomFilter::load(buffer.get(), size),
+		"CityBloomFilter accepted another version at " + at);
+}
+
+} // namespace
+
+bool runBloomTests(const Options& options) {
+	const BloomKeys keys = makeKeys();
+	Checker checker("bloom", options);
+	constexpr f64 BITS[] = { 4.0, 10.0, 16.0, 24.0 };
+	for (const f64 bits_per_key : BITS) {
+		CityBloomFilter filter(N, bits_per_key);
+		for (len_t i = 0; i < N; ++i) (void)filter.add(keys.ptrs[i], KEY_SIZE);
+		// Not std::vector<bool>: the batch writes a plain array
+		std::unique_ptr<ll_bool_t[]> out(new ll_bool_t[2 * N]);
+		checkLookups(checker, keys, filter, out.get(), bits_per_key);
+
+		// A blocked filter pays for its single cache line with a slightly
+		//	higher rate than a classic one: allow twice the classic rate
+		(void)filter.mayContainBatch(keys.ptrs.data(), keys.lens.data(), out.get(), 2 * N, BatchKernel::Scalar);
+		len_t false_positives = 0;
+		for (len_t i = N; i < 2 * N; ++i) false_positives += out[i];
+		const f64 rate = static_cast<f64>(false_positives) / N;
+		const f64 k = static_cast<f64>(filter.hashCount());
+		const f64 classic = std::pow(1.0 - std::exp(-k / bits_per_key), k);
+		checker.expectThat(rate <= 2.0 * classic + 0.001, [&]() {
+			return "CityBloomFilter false positive rate " + std::to_string(rate) + " at " + std::to_string(bits_per_key) +
+				" bits/key (classic " + std::to_string(classic) + ")";
+		});
+
+		checkSerialized(checker, keys, filter, out.get(), bits_per_key);
+	}
+
+	// Null keys are never contained and fail the batch
+	CityBloomFilter empty;
+	const ll_string_t ptrs[] = { "a", nullptr };
+	const len_t lens[] = { 1, 0 };
+	ll_bool_t out[] = { true, true };
+	checker.expect(!empty.add("a", 1) && !empty.mayContain("a", 1) && !empty.mayContainBatch(ptrs, lens, out, 2) && !out[0] && !out[1],
+		"empty CityBloomFilter");
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,215 @@
+//////////////////////////////////////////////
+//	test_cdc.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_cdc.hpp"
+#include "../llcityhash/city_flat_map.hpp"
+
+#include <bit>
+#include <filesystem>
+#include <random>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+constexpr len_t DATA_SIZE = len_t(8) << 20;
+
+ll_string_t kernelName(const BatchKernel kernel) noexcept {
+	switch (kernel) {
+		case BatchKernel::Scalar:	return "scalar";
+		case BatchKernel::Avx2:		return "avx2";
+		case BatchKernel::Avx512:	return "avx512";
+		default:					return "auto";
+	}
+}
+
+// The chunking documented in city_cdc.hpp, one byte at a time as FastCDC
+//	does it, followed by a second pass that fingerprints the chunks
+void referenceChunks(ll_string_t s, const len_t len, const CityChunker& chunker, std::vector<CityChunk>& out) {
+	const len_t min = chunker.minSize(), avg = chunker.avgSize(), max = chunker.maxSize();
+	const int bits = static_cast<int>(std::bit_width(avg)) - 1;
+	const ui64 mask_small = ~ui64(0) << (64 - (bits + 2));
+	const ui64 mask_large = ~ui64(0) << (64 - (bits - 2));
+	ui64 gear[256];
+	for (ui64 b = 0; b < 256; ++b) gear[b] = city::CityHash64Key(b);
+	for (len_t p = 0; p < len;) {
+		len_t end = p + max < len ? p + max : len;
+		ui64 h = 0;
+		for (len_t i = p; i < end; ++i) {
+			h = (h << 1) + gear[static_cast<ui8>(s[i])];
+			if (i + 1 - p < min) continue;
+			if ((h & (i + 1 - p < avg ? mask_small : mask_large)) == 0) {
+				end = i + 1;
+				break;
+			}
+		}
+		out.push_back(CityChunk{ p, end - p, hash::Hash128() });
+		p = end;
+	}
+	for (CityChunk& chunk : out) chunk.fingerprint = city::CityHash128Unchecked(s + chunk.offset, chunk.length);
+}
+
+bool sameChunks(const std::vector<CityChunk>& a, const std::vector<CityChunk>& b) noexcept {
+	if (a.size() != b.size()) return false;
+	for (len_t i = 0; i < a.size(); ++i)
+		if (a[i].offset != b[i].offset || a[i].length != b[i].length || a[i].fingerprint != b[i].fingerprint) return false;
+	return true;
+}
+
+// Every kernel, thread count and piece size against the reference
+void checkChunker(Checker& checker, const std::vector<ll_char_t>& data) {
+	constexpr BatchKernel KERNELS[] = { BatchKernel::Auto, BatchKernel::Scalar, BatchKernel::Avx2, BatchKernel::Avx512 };
+	struct Sizes {
+		len_t min, avg, max;
+	};
+	constexpr Sizes SIZES[] = { { 2048, 8192, 65536 }, { 256, 1024, 4096 }, { 4096, 16384, 65536 }, { 64, 64, 64 }, { 1000, 3000, 10000 } };
+	const len_t len = data.size();
+	for (const Sizes& sizes : SIZES) {
+		const std::string at = std::to_string(sizes.min) + "/" + std::to_string(sizes.avg) + "/" + std::to_string(sizes.max);
+		std::vector<CityChunk> expected, chunks;
+		referenceChunks(data.data(), len, CityChunker(sizes.min, sizes.avg, sizes.max), expected);
+		for (const BatchKernel kernel : KERNELS) {
+			const CityChunker chunker(sizes.min, sizes.avg, sizes.max, kernel);
+			chunks.clear();
+			if (!chunker.chunk(data.data(), len, chunks)) {
+				// Not supported by this CPU
+				checker.expectThat(kernel != BatchKernel::Scalar && kernel != BatchKernel::Auto, [&]() {
+					return std::string("CityChunker refused the ") + kernelName(kernel) + " kernel";
+				});
+				continue;
+			}
+			checker.expectThat(sameChunks(chunks, expected), [&]() {
+				return std::string("CityChunker (") + kernelName(kernel) + ") differs from FastCDC for " + at;
+			});
+		}
+
+		const CityChunker chunker(sizes.min, sizes.avg, sizes.max);
+		for (const len_t threads : { len_t(2), len_t(3), len_t(8), len_t(0) }) {
+			chunks.clear();
+			checker.expectThat(chunker.chunk(data.data(), len, chunks, threads) && sameChunks(chunks, expected), [&]() {
+				return "CityChunker on " + std::to_string(threads) + " threads differs from one thread for " + at;
+			});
+		}
+		// Pieces of 1 byte only over the first 256 KiB
+		for (const len_t piece : { len_t(1), len_t(1000), len_t(65536), len_t(3) << 20 }) {
+			const len_t stream_len = piece == 1 ? len_t(256) << 10 : len;
+			std::vector<CityChunk> whole;
+			(void)chunker.chunk(data.data(), stream_len, whole);
+			CityChunkerStream stream(chunker);
+			chunks.clear();
+			for (len_t i = 0; i < stream_len; i += piece)
+				(void)stream.update(data.data() + i, stream_len - i < piece ? stream_len - i : piece, chunks);
+			checker.expectThat(stream.finalize(chunks) && sameChunks(chunks, whole), [&]() {
+				return "CityChunkerStream with " + std::to_string(piece) + "-byte pieces differs from CityChunker for " + at;
+			});
+		}
+	}
+}
+
+void checkFile(Checker& checker, const std::vector<ll_char_t>& data) {
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "llcityhash_cdc_test.bin";
+	const len_t file_len = (len_t(3) << 20) + 12345;
+	std::FILE* file = std::fopen(path.string().c_str(), "wb");
+	const ll_bool_t written = file && std::fwrite(data.data(), 1, file_len, file) == file_len;
+	if (file) std::fclose(file);
+	std::vector<CityChunk> from_file, from_buffer;
+	const CityChunker chunker;
+	const ll_bool_t read = written && chunker.chunkFile(path.string().c_str(), from_file);
+	std::error_code ignored;
+	std::filesystem::remove(path, ignored);
+	(void)chunker.chunk(data.data(), file_len, from_buffer);
+	checker.expect(written, "could not write " + path.string());
+	checker.expect(!written || (read && sameChunks(from_file, from_buffer)), "CityChunker::chunkFile differs from CityChunker::chunk");
+	checker.expect(!chunker.chunk(nullptr, 1, from_buffer) && !chunker.chunkFile(nullptr, from_file) &&
+		!chunker.chunkFile("/nonexistent/llcityhash", from_file) && !CityChunkerStream().update(nullptr, 1, from_file),
+		"CityChunker accepted a null or missing input");
+}
+
+// Versions of a file, each one from the previous with a few small edits
+//	(inserted, deleted and overwritten runs of bytes)
+std::vector<std::vector<ll_char_t>> makeCorpus(const std::vector<ll_char_t>& data, const len_t size, const len_t versions, const len_t edits, const ui64 seed) {
+	std::mt19937_64 rng(seed);
+	std::vector<std::vector<ll_char_t>> corpus;
+	corpus.emplace_back(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+	for (len_t v = 1; v < versions; ++v) {
+		std::vector<ll_char_t> next = corpus.back();
+		for (len_t e = 0; e < edits; ++e) {
+			const len_t at = rng() % next.size();
+			const len_t run = 1 + rng() % 64;
+			const std::ptrdiff_t pos = static_cast<std::ptrdiff_t>(at);
+			switch (rng() % 3) {
+				case 0: {
+					const std::ptrdiff_t from = static_cast<std::ptrdiff_t>(rng() % (size - run));
+					next.insert(next.begin() + pos, data.begin() + from, data.begin() + from + static_cast<std::ptrdiff_t>(run));
+					break;
+				}
+				case 1:
+					next.erase(next.begin() + pos, next.begin() + pos + static_cast<std::ptrdiff_t>(run < next.size() - at ? run : next.size() - at));
+					break;
+				default:
+					for (len_t i = at; i < at + run && i < next.size(); ++i) next[i] = static_cast<ll_char_t>(rng());
+					break;
+			}
+		}
+		corpus.push_back(std::move(next));
+	}
+	return corpus;
+}
+
+// Total bytes over the bytes of distinct chunks
+f64 dedupRatio(const std::vector<std::vector<CityChunk>>& chunks) {
+	CityFlatSet<ui64> seen;
+	len_t total = 0, unique = 0;
+	for (const std::vector<CityChunk>& file : chunks) {
+		for (const CityChunk& chunk : file) {
+			total += chunk.length;
+			if (seen.insert(chunk.fingerprint.getLow() ^ chunk.fingerprint.getHigh()).second) unique += chunk.length;
+		}
+	}
+	return unique ? static_cast<f64>(total) / static_cast<f64>(unique) : 0.0;
+}
+
+// An insertion or deletion shifts every fixed block after it, but only
+//	changes the one or two chunks around it
+void checkDedup(Checker& checker, const std::vector<ll_char_t>& data, const ui64 seed) {
+	constexpr len_t VERSIONS = 16;
+	constexpr len_t SIZE = len_t(4) << 20;
+	const std::vector<std::vector<ll_char_t>> corpus = makeCorpus(data, SIZE, VERSIONS, 4, seed);
+	std::vector<std::vector<CityChunk>> fixed(VERSIONS), cdc(VERSIONS);
+	const CityChunker chunker;
+	for (len_t v = 0; v < VERSIONS; ++v) {
+		for (len_t p = 0; p < corpus[v].size(); p += 8192) {
+			const len_t n = corpus[v].size() - p < 8192 ? corpus[v].size() - p : 8192;
+			fixed[v].push_back(CityChunk{ p, n, city::CityHash128Unchecked(corpus[v].data() + p, n) });
+		}
+		(void)chunker.chunk(corpus[v].data(), corpus[v].size(), cdc[v]);
+	}
+	const f64 fixed_ratio = dedupRatio(fixed), cdc_ratio = dedupRatio(cdc);
+	checker.expectThat(cdc_ratio >= 2.0 * fixed_ratio, [&]() {
+		return "CityChunker dedup ratio " + std::to_string(cdc_ratio) + " (fixed blocks " + std::to_string(fixed_ratio) + ")";
+	});
+}
+
+} // namespace
+
+bool runCdcTests(const Options& options) {
+	std::vector<ll_char_t> data(DATA_SIZE);
+	fillTestData(data);
+	Checker checker("cdc", options);
+	checkChunker(checker, data);
+	checkFile(checker, data);
+	checkDedup(checker, data, options.seed);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
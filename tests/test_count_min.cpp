@@ -0,0 +1,189 @@
+//////////////////////////////////////////////
+//	test_count_min.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_count_min.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+constexpr ui32 WIDTH = 1 << 16;
+constexpr ui32 DEPTH = 4;
+constexpr ui32 TOP_K = 16;
+
+// A stream of events over "distinct" keys whose frequencies follow a Zipf
+//	law: key r (from 0) appears about 1 / (r + 1)^1.1 as often as key 0
+struct CountStream {
+	std::vector<std::string> keys;		// Distinct keys
+	std::vector<ui32> events;			// Index of the key of every event
+	std::vector<ll_string_t> ptrs;		// Per event
+	std::vector<len_t> lens;
+};
+
+CountStream makeStream(const len_t distinct, const len_t events, const ui64 seed) {
+	CountStream stream;
+	stream.keys.reserve(distinct);
+	for (len_t i = 0; i < distinct; ++i) stream.keys.push_back("user:" + std::to_string(i * 7919 % 1000003) + ":req");
+	std::vector<f64> cdf(distinct);
+	f64 sum = 0.0;
+	for (len_t i = 0; i < distinct; ++i) cdf[i] = sum += 1.0 / std::pow(static_cast<f64>(i + 1), 1.1);
+	std::mt19937_64 rng(seed);
+	std::uniform_real_distribution<f64> uniform(0.0, sum);
+	stream.events.resize(events);
+	stream.ptrs.resize(events);
+	stream.lens.resize(events);
+	for (len_t i = 0; i < events; ++i) {
+		const ui32 key = static_cast<ui32>(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+		stream.events[i] = key < distinct ? key : static_cast<ui32>(distinct - 1);
+		stream.ptrs[i] = stream.keys[stream.events[i]].data();
+		stream.lens[i] = stream.keys[stream.events[i]].size();
+	}
+	return stream;
+}
+
+std::vector<ui32> exactCounts(const CountStream& stream) {
+	std::vector<ui32> counts(stream.keys.size(), 0);
+	for (const ui32 key : stream.events) ++counts[key];
+	return counts;
+}
+
+// Estimates of every distinct key
+std::vector<ui32> estimates(const CityCountMinSketch& sketch, const CountStream& stream) {
+	std::vector<ll_string_t> ptrs(stream.keys.size());
+	std::vector<len_t> lens(stream.keys.size());
+	for (len_t i = 0; i < stream.keys.size(); ++i) {
+		ptrs[i] = stream.keys[i].data();
+		lens[i] = stream.keys[i].size();
+	}
+	std::vector<ui32> out(stream.keys.size());
+	if (!sketch.estimateBatch(ptrs.data(), lens.data(), out.data(), out.size())) out.clear();
+	return out;
+}
+
+void checkSketch(Checker& checker, const CountStream& stream, const std::vector<ui32>& exact) {
+	const len_t n = stream.events.size();
+	// e / w of the stream, which all but a fraction e^-d of the keys stay under
+	const f64 bound = 2.718281828459045 / WIDTH * static_cast<f64>(n);
+	f64 mean_error[2]{};
+	std::vector<ui32> standard;
+	for (const CountMinUpdate update : { CountMinUpdate::Standard, CountMinUpdate::Conservative }) {
+		const std::string name = update == CountMinUpdate::Standard ? "standard" : "conservative";
+		CityCountMinSketch one(WIDTH, DEPTH, update), batch(WIDTH, DEPTH, update);
+		std::vector<ui32> returned(n);
+		for (len_t i = 0; i < n; ++i) {
+			const std::optional<ui32> estimate = one.add(stream.ptrs[i], stream.lens[i]);
+			returned[i] = estimate ? *estimate : 0;
+		}
+		std::vector<ui32> batch_returned(n);
+		const ll_bool_t batch_ok = batch.addBatch(stream.ptrs.data(), stream.lens.data(), n, nullptr, batch_returned.data());
+		const std::vector<ui32> values = estimates(one, stream);
+		if (!checker.expect(batch_ok && !values.empty() && returned == batch_returned && estimates(batch, stream) == values,
+			"CityCountMinSketch add and addBatch differ, " + name))
+			continue;
+		len_t over_bound = 0;
+		for (len_t i = 0; i < exact.size(); ++i) {
+			if (!checker.expectThat(values[i] >= exact[i], [&]() {
+				return "CityCountMinSketch underestimates key " + std::to_string(i) + ": " + std::to_string(values[i]) + " < " + std::to_string(exact[i]) + ", " + name;
+			})) return;
+			over_bound += static_cast<f64>(values[i] - exact[i]) > bound;
+			mean_error[update == CountMinUpdate::Conservative] += static_cast<f64>(values[i] - exact[i]) / static_cast<f64>(exact.size());
+		}
+		// e^-4 is under 2%
+		checker.expectThat(static_cast<f64>(over_bound) <= 0.02 * static_cast<f64>(exact.size()), [&]() {
+			return std::to_string(over_bound) + " keys overestimated by more than e/w, " + name;
+		});
+		if (update == CountMinUpdate::Standard) standard = values;
+	}
+	checker.expect(mean_error[1] <= mean_error[0], "conservative update overestimates more than standard");
+
+	// Standard counts add up: per-thread sketches merged, and a shared sketch
+	//	fed by threads, match one sketch of the whole stream exactly
+	constexpr len_t THREADS = 8;
+	std::vector<CityCountMinSketch> locals(THREADS, CityCountMinSketch(WIDTH, DEPTH));
+	// Asking for conservative updates gets standard ones
+	CityCountMinSketch shared(WIDTH, DEPTH, CountMinUpdate::Conservative, true);
+	runThreads(THREADS, [&](const len_t t) {
+		const len_t begin = t * n / THREADS, end = (t + 1) * n / THREADS;
+		(void)locals[t].addBatch(stream.ptrs.data() + begin, stream.lens.data() + begin, end - begin);
+		(void)shared.addBatch(stream.ptrs.data() + begin, stream.lens.data() + begin, end - begin);
+	});
+	CityCountMinSketch merged(WIDTH, DEPTH);
+	ll_bool_t accepted = true;
+	for (const CityCountMinSketch& local : locals) accepted &= merged.merge(local);
+	checker.expect(accepted && estimates(merged, stream) == standard, "merged CityCountMinSketch differs from one sketch");
+	checker.expect(estimates(shared, stream) == standard && shared.getUpdate() == CountMinUpdate::Standard, "shared CityCountMinSketch differs from one sketch");
+
+	// Counters saturate, in add and in merge
+	constexpr ui32 BIG = std::numeric_limits<ui32>::max() - 10;
+	CityCountMinSketch a(64, 2), b(64, 2), other_shape(32, 2);
+	(void)a.add("hot", 3, BIG);
+	(void)b.add("hot", 3, BIG);
+	const std::optional<ui32> saturated = a.add("hot", 3, 100);
+	checker.expect(saturated && *saturated == std::numeric_limits<ui32>::max() && b.merge(a) &&
+		*b.estimate("hot", 3) == std::numeric_limits<ui32>::max() && *b.estimate("cold", 4) == 0,
+		"CityCountMinSketch saturation");
+	checker.expect(!a.merge(other_shape) && !a.add(nullptr, 0) && !a.estimate(nullptr, 0), "CityCountMinSketch invalid arguments");
+}
+
+void checkHeavyHitters(Checker& checker, const CountStream& stream, const std::vector<ui32>& exact) {
+	const len_t n = stream.events.size();
+	std::vector<ui32> order(exact.size());
+	for (ui32 i = 0; i < order.size(); ++i) order[i] = i;
+	std::partial_sort(order.begin(), order.begin() + TOP_K, order.end(), [&](const ui32 a, const ui32 b) { return exact[a] > exact[b]; });
+	std::vector<std::string> expected;
+	for (ui32 i = 0; i < TOP_K; ++i) expected.push_back(stream.keys[order[i]]);
+	std::sort(expected.begin(), expected.end());
+
+	auto keys = [](const CityHeavyHitters& tracker) {
+		std::vector<std::string> result;
+		for (const CityHeavyHitter& hitter : tracker.top()) result.push_back(hitter.key);
+		std::sort(result.begin(), result.end());
+		return result;
+	};
+	CityHeavyHitters one(TOP_K, WIDTH, DEPTH), batch(TOP_K, WIDTH, DEPTH);
+	for (len_t i = 0; i < n; ++i) (void)one.add(stream.ptrs[i], stream.lens[i]);
+	(void)batch.addBatch(stream.ptrs.data(), stream.lens.data(), n);
+	constexpr len_t THREADS = 4;
+	std::vector<CityHeavyHitters> locals(THREADS, CityHeavyHitters(TOP_K, WIDTH, DEPTH));
+	runThreads(THREADS, [&](const len_t t) {
+		const len_t begin = t * n / THREADS, end = (t + 1) * n / THREADS;
+		(void)locals[t].addBatch(stream.ptrs.data() + begin, stream.lens.data() + begin, end - begin);
+	});
+	CityHeavyHitters merged(TOP_K, WIDTH, DEPTH);
+	for (const CityHeavyHitters& local : locals) (void)merged.merge(local);
+
+	const std::vector<CityHeavyHitter> top = one.top();
+	checker.expect(keys(one) == expected && top.size() == TOP_K, "CityHeavyHitters top differs from the exact one");
+	checker.expect(keys(batch) == expected, "CityHeavyHitters::addBatch top differs from the exact one");
+	checker.expect(keys(merged) == expected, "merged CityHeavyHitters top differs from the exact one");
+	checker.expect(std::is_sorted(top.begin(), top.end(), [](const CityHeavyHitter& a, const CityHeavyHitter& b) { return a.count > b.count; }),
+		"CityHeavyHitters::top is not sorted by count");
+}
+
+} // namespace
+
+bool runCountMinTests(const Options& options) {
+	const CountStream stream = makeStream(100000, 1000000, options.seed);
+	const std::vector<ui32> exact = exactCounts(stream);
+	Checker checker("count", options);
+	checkSketch(checker, stream, exact);
+	checkHeavyHitters(checker, stream, exact);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,634 @@
+//////////////////////////////////////////////
+//	test_differential.cpp					//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Compares every alternative entry point and kernel with the scalar
+// functions the golden tests check (CityHash32, CityHash64,
+// CityHash64WithSeed(s), CityHash128 and CityHash128WithSeed), on every
+// length up to 1024 and then on random keys.  Each key sits in its own slot
+// between two pages that cannot be read, at the start of the slot, at its
+// end or in the middle at any alignment, so a kernel that reads a byte
+// outside its key crashes the test instead of passing by luck.
+
+#include "test.hpp"
+
+#include "../llcityhash/city_cpu.hpp"
+#include "../llcityhash/city_fields.hpp"
+#include "../llcityhash/city_internal.hpp"
+
+#include <array>
+#include <bit>
+#include <new>
+#include <random>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <sys/mman.h>
+	#include <unistd.h>
+	#define LL_CITY_TEST_POSIX
+#elif defined(WINDOWS_SYSTEM)
+	#define NOMINMAX
+	#include <windows.h>
+#endif // POSIX
+
+namespace llcpp {
+namespace city {
+
+#pragma region CrcReference
+namespace __internal__ {
+// The long-input core of CityHashCrc256 on a bit-at-a-time CRC32C, which
+//	both the table and the SSE4.2 kernels of city_crc.cpp must match
+namespace bitwise {
+
+__LL_NODISCARD__ __LL_INLINE__ ui64 Crc32u64(const ui64 crc, const ui64 v) noexcept {
+	ui32 c = static_cast<ui32>(crc);
+	for (len_t i = 0; i < 8; ++i) {
+		c ^= static_cast<ui8>(v >> (8 * i));
+		for (i32 bit = 0; bit < 8; ++bit)
+			c = (c >> 1) ^ (0x82f63b78u & (0u - (c & 1)));
+	}
+	return c;
+}
+
+#define LL_CITY_CRC_TARGET
+#include "../llcityhash/city_crc_kernels.inl"
+#undef LL_CITY_CRC_TARGET
+
+} // namespace bitwise
+} // namespace __internal__
+
+#pragma endregion
+
+namespace test {
+
+namespace {
+
+// Biggest key: long enough for several rounds of every loop
+constexpr len_t SLOT_SIZE = 16 * 1024;
+// Keys per batch, each in its own slot
+constexpr len_t GROUP_SIZE = 16;
+constexpr len_t MAX_FIXED = 128;
+constexpr len_t MAX_SEEDS = 19;
+
+#pragma region Arena
+// "count" slots of at least SLOT_SIZE bytes, each one between two pages that
+//	cannot be read.  Without mmap or VirtualAlloc the slots are not guarded.
+class GuardedArena {
+	private:
+		ll_char_t* memory;
+		len_t page;
+		len_t slot_size;	// SLOT_SIZE rounded up to whole pages
+		len_t size;
+		ll_bool_t mapped;	// By mmap or VirtualAlloc, else by new[]
+		ll_bool_t guarded;
+
+	public:
+		explicit GuardedArena(const len_t count) noexcept
+			: memory(nullptr)
+			, page(4096)
+			, slot_size(SLOT_SIZE)
+			, size(0)
+			, mapped(false)
+			, guarded(false)
+		{
+#if defined(LL_CITY_TEST_POSIX)
+			const long page_size = ::sysconf(_SC_PAGESIZE);
+			if (page_size > 0) this->page = static_cast<len_t>(page_size);
+#elif defined(WINDOWS_SYSTEM)
+			SYSTEM_INFO info;
+			::GetSystemInfo(&info);
+			this->page = info.dwPageSize;
+#endif // LL_CITY_TEST_POSIX
+			this->slot_size = (SLOT_SIZE + this->page - 1) / this->page * this->page;
+			this->size = this->page + count * (this->slot_size + this->page);
+#if defined(LL_CITY_TEST_POSIX)
+			void* mapped = ::mmap(nullptr, this->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (mapped != MAP_FAILED) {
+				this->memory = static_cast<ll_char_t*>(mapped);
+				this->mapped = true;
+				this->guarded = true;
+				for (len_t i = 0; i <= count; ++i)
+					this->guarded &= ::mprotect(this->memory + i * (this->slot_size + this->page), this->page, PROT_NONE) == 0;
+			}
+#elif defined(WINDOWS_SYSTEM)
+			this->memory = static_cast<ll_char_t*>(::VirtualAlloc(nullptr, this->size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+			if (this->memory) {
+				this->mapped = true;
+				this->guarded = true;
+				DWORD old = 0;
+				for (len_t i = 0; i <= count; ++i)
+					this->guarded &= ::VirtualProtect(this->memory + i * (this->slot_size + this->page), this->page, PAGE_NOACCESS, &old) != 0;
+			}
+#endif // LL_CITY_TEST_POSIX
+			if (!this->memory) this->memory = new (std::nothrow) ll_char_t[this->size];
+		}
+		GuardedArena(const GuardedArena&) = delete;
+		GuardedArena& operator=(const GuardedArena&) = delete;
+		~GuardedArena() noexcept {
+			if (!this->mapped) delete[] this->memory;
+#if defined(LL_CITY_TEST_POSIX)
+			else (void)::munmap(this->memory, this->size);
+#elif defined(WINDOWS_SYSTEM)
+			else (void)::VirtualFree(this->memory, 0, MEM_RELEASE);
+#endif // LL_CITY_TEST_POSIX
+		}
+
+		__LL_NODISCARD__ ll_bool_t isValid() const noexcept { return this->memory != nullptr; }
+		__LL_NODISCARD__ ll_bool_t isGuarded() const noexcept { return this->guarded; }
+		__LL_NODISCARD__ ll_char_t* slot(const len_t i) const noexcept {
+			return this->memory + this->page + i * (this->slot_size + this->page);
+		}
+		__LL_NODISCARD__ len_t getSlotSize() const noexcept { return this->slot_size; }
+};
+
+#pragma endregion
+#pragma region Keys
+enum class Placement : ui8 {
+	Start,		// First byte right after a guard page
+	End,		// Last byte right before a guard page
+	Middle		// Anywhere else, at any alignment
+};
+
+struct KeyCase {
+	ll_string_t s;
+	len_t len;
+	Placement placement;
+	ui64 seed0;
+	ui64 seed1;
+};
+
+std::string describe(ll_string_t function, const KeyCase& key) {
+	constexpr ll_string_t PLACEMENTS[] = { "start", "end", "middle" };
+	return std::string(function) + " len=" + std::to_string(key.len) +
+		" align=" + std::to_string(reinterpret_cast<std::uintptr_t>(key.s) % 64) +
+		" at " + PLACEMENTS[static_cast<ui8>(key.placement)] + " of a page";
+}
+
+// Lengths where a kernel changes path, and their neighbours
+constexpr len_t EDGE_LENGTHS[] = {
+	0, 1, 3, 4, 5, 7, 8, 9, 12, 13, 15, 16, 17, 23, 24, 25, 31, 32, 33, 63, 64, 65,
+	127, 128, 129, 191, 192, 193, 239, 240, 241, 255, 256, 257, 479, 480, 481, 899, 900, 901, 1024
+};
+
+len_t randomLength(std::mt19937_64& rng, const len_t max_len) noexcept {
+	const ui64 bucket = rng() % 100;
+	len_t len = 0;
+	if (bucket < 20) len = EDGE_LENGTHS[rng() % (sizeof(EDGE_LENGTHS) / sizeof(EDGE_LENGTHS[0]))];
+	else if (bucket < 55) len = rng() % 65;
+	else if (bucket < 75) len = 65 + rng() % 192;
+	else if (bucket < 90) len = 257 + rng() % 768;
+	else if (bucket < 97) len = 1025 + rng() % 3072;
+	else len = 4097 + rng() % (SLOT_SIZE - 4096);
+	return len < max_len ? len : max_len;
+}
+
+// Fills a key of "len" random bytes in slot "slot"
+KeyCase placeKey(std::mt19937_64& rng, ll_char_t* slot, const len_t slot_size, const len_t len, const Placement placement, const len_t align) noexcept {
+	const len_t room = slot_size - len;
+	len_t offset = 0;
+	if (placement == Placement::End) offset = room;
+	// At least 64 bytes past the guard page before the slot
+	else if (placement == Placement::Middle)
+		offset = room >= 128 ? 64 * (1 + rng() % ((room - 64) / 64)) + align % 64 : room / 2;
+	ll_char_t* s = slot + offset;
+	for (len_t i = 0; i < len; ++i) s[i] = static_cast<ll_char_t>(rng());
+	return KeyCase{ s, len, placement, rng(), rng() };
+}
+
+#pragma endregion
+#pragma region Reference
+struct Reference {
+	ui32 hash32;
+	ui64 hash64;
+	ui64 hash64_seed;
+	ui64 hash64_seeds;
+	hash::Hash128 hash128;
+	hash::Hash128 hash128_seed;
+};
+
+Reference computeReference(const KeyCase& key) noexcept {
+	const hash::Hash128 seed128(key.seed0, key.seed1);
+	return Reference{
+		city::CityHash32(key.s, key.len)->get(),
+		city::CityHash64(key.s, key.len)->get(),
+		city::CityHash64WithSeed(key.s, key.len, key.seed1)->get(),
+		city::CityHash64WithSeeds(key.s, key.len, key.seed0, key.seed1)->get(),
+		*city::CityHash128(key.s, key.len),
+		*city::CityHash128WithSeed(key.s, key.len, seed128)
+	};
+}
+
+// CityHashCrc256 on the bitwise CRC32C
+void referenceCrc256(ll_string_t s, const len_t len, ui64* result) noexcept {
+	if (len >= 240) {
+		__internal__::bitwise::CityHashCrc256Long(s, len, 0, result);
+		return;
+	}
+	ll_char_t buffer[240]{};
+	std::memcpy(buffer, s, len);
+	__internal__::bitwise::CityHashCrc256Long(buffer, 240, ~static_cast<ui32>(len), result);
+}
+
+using FixedFunction = ui64(*)(const void*) noexcept;
+template<len_t... N>
+constexpr std::array<FixedFunction, sizeof...(N)> makeFixedTable(std::index_sequence<N...>) noexcept {
+	return { &city::CityHash64Fixed<N>... };
+}
+// FIXED_FUNCTIONS[n] is CityHash64Fixed<n>
+constexpr std::array<FixedFunction, MAX_FIXED + 1> FIXED_FUNCTIONS = makeFixedTable(std::make_index_sequence<MAX_FIXED + 1>());
+
+#pragma endregion
+#pragma region Checks
+// Entry points that take one key
+void checkKey(Checker& checker, const KeyCase& key, const Reference& ref, std::mt19937_64& rng) {
+	ll_string_t s = key.s;
+	const len_t len = key.len;
+	const hash::Hash128 seed128(key.seed0, key.seed1);
+	const std::string_view view(s, len);
+	const auto check = [&](const ll_bool_t ok, ll_string_t function) {
+		checker.expectThat(ok, [&]() { return describe(function, key); });
+	};
+
+	// Inlined and constexpr copies
+	check(city::CityHash32Unchecked(s, len) == ref.hash32, "CityHash32Unchecked");
+	check(city::CityHash32Const(view) == ref.hash32, "CityHash32Const");
+	check(city::CityHash64Unchecked(s, len) == ref.hash64, "CityHash64Unchecked");
+	check(city::CityHash64Const(view) == ref.hash64, "CityHash64Const");
+	check(city::CityHash64WithSeedUnchecked(s, len, key.seed1) == ref.hash64_seed, "CityHash64WithSeedUnchecked");
+	check(city::CityHash64WithSeedConst(view, key.seed1) == ref.hash64_seed, "CityHash64WithSeedConst");
+	check(city::CityHash128Unchecked(s, len) == ref.hash128, "CityHash128Unchecked");
+	check(city::CityHash128WithSeedUnchecked(s, len, seed128) == ref.hash128_seed, "CityHash128WithSeedUnchecked");
+	if (len <= MAX_FIXED) check(FIXED_FUNCTIONS[len](s) == ref.hash64, "CityHash64Fixed<N>");
+
+	// String overloads
+	const std::string str(s, len);
+	check(city::CityHash64(str)->get() == ref.hash64, "CityHash64(std::string)");
+	check(city::CityHash64(meta::Str(s, len))->get() == ref.hash64, "CityHash64(meta::Str)");
+	check(city::CityHash64(meta::StrPair(s, len))->get() == ref.hash64, "CityHash64(meta::StrPair)");
+	const CityHashedString hashed(s, len);
+	check(hashed.hash() == ref.hash64 && city::CityHash64(hashed)->get() == ref.hash64, "CityHashedString");
+	check(city::CITYHASH_Hash64Function(s, len)->get() == ref.hash64, "CITYHASH_Hash64Function");
+
+	// Wide strings hash the little-endian bytes of their code units
+	const len_t units = len / sizeof(ll_wchar_t);
+	std::wstring wide(units, L'\0');
+	std::string wide_bytes(units * sizeof(ll_wchar_t), '\0');
+	for (len_t i = 0; i < units; ++i) {
+		std::memcpy(&wide[i], s + i * sizeof(ll_wchar_t), sizeof(ll_wchar_t));
+		const std::make_unsigned_t<ll_wchar_t> unit = static_cast<std::make_unsigned_t<ll_wchar_t>>(wide[i]);
+		for (len_t b = 0; b < sizeof(ll_wchar_t); ++b)
+			wide_bytes[i * sizeof(ll_wchar_t) + b] = static_cast<ll_char_t>(unit >> (8 * b));
+	}
+	const ui64 wide_ref = city::CityHash64(wide_bytes.data(), wide_bytes.size())->get();
+	check(city::CityHash64(wide.c_str(), units)->get() == wide_ref, "CityHash64(ll_wstring_t)");
+	check(city::CityHash64(wide)->get() == wide_ref, "CityHash64(std::wstring)");
+	check(city::CityHash64(meta::wStr(wide.c_str(), units))->get() == wide_ref, "CityHash64(meta::wStr)");
+	check(city::CityHash64(meta::wStrPair(wide.c_str(), units))->get() == wide_ref, "CityHash64(meta::wStrPair)");
+	// The block conversion of big-endian hosts, with and without the byte
+	//	swap: swapped code units swapped back give the same bytes
+	constexpr ll_bool_t BIG_ENDIAN_HOST = std::endian::native != std::endian::little;
+	std::wstring wide_swapped(units, L'\0');
+	for (len_t i = 0; i < units; ++i) {
+		using U = std::make_unsigned_t<ll_wchar_t>;
+		U unit = static_cast<U>(wide[i]);
+		U swapped = 0;
+		for (len_t b = 0; b < sizeof(ll_wchar_t); ++b, unit >>= 8)
+			swapped = static_cast<U>((swapped << 8) | (unit & 0xff));
+		wide_swapped[i] = static_cast<ll_wchar_t>(swapped);
+	}
+	const hash::OptionalHash64 converted = __internal__::CityHash64WideConverted(wide.c_str(), units, BIG_ENDIAN_HOST);
+	const hash::OptionalHash64 converted_swapped = __internal__::CityHash64WideConverted(wide_swapped.c_str(), units, !BIG_ENDIAN_HOST);
+	check(converted && converted->get() == wide_ref, "CityHash64WideConverted");
+	check(converted_swapped && converted_swapped->get() == wide_ref, "CityHash64WideConverted (byte swapped)");
+
+	// CRC variants: CityHash128 up to 900 bytes, then the CRC core
+	ui64 crc256[4]{};
+	ui64 crc256_ref[4]{};
+	referenceCrc256(s, len, crc256_ref);
+	check(city::CityHashCrc256(s, len, crc256) && std::memcmp(crc256, crc256_ref, sizeof(crc256)) == 0, "CityHashCrc256");
+	hash::Hash128 crc128_ref = ref.hash128;
+	hash::Hash128 crc128_seed_ref = ref.hash128_seed;
+	if (len > 900) {
+		ui64 long_ref[4]{};
+		__internal__::bitwise::CityHashCrc256Long(s, len, 0, long_ref);
+		crc128_ref = hash::Hash128(long_ref[2], long_ref[3]);
+		const ui64 u = seed128.getHigh() + long_ref[0];
+		const ui64 v = seed128.getLow() + long_ref[1];
+		crc128_seed_ref = hash::Hash128(
+			__internal__::HashLen16(u, v + long_ref[2]),
+			__internal__::HashLen16(__internal__::Rotate(v, 32), u * __internal__::k0 + long_ref[3]));
+	}
+	check(*city::CityHashCrc128(s, len) == crc128_ref, "CityHashCrc128");
+	check(*city::CityHashCrc128WithSeed(s, len, seed128) == crc128_seed_ref, "CityHashCrc128WithSeed");
+
+	// Streams, in chunks of random sizes
+	const len_t max_chunk = 1 + rng() % (len > 300 ? 300 : len + 1);
+	const len_t tail = len < 64 ? len : 64;
+	CityHash64Stream stream64(len, s + len - tail);
+	CityHash128Stream stream128(len);
+	CityHash128Stream stream128_seed(len, seed128);
+	ll_bool_t fed = true;
+	for (len_t done = 0; done < len; ) {
+		len_t chunk = 1 + rng() % max_chunk;
+		if (chunk > len - done) chunk = len - done;
+		fed &= stream64.update(s + done, chunk) && stream128.update(s + done, chunk) && stream128_seed.update(s + done, chunk);
+		done += chunk;
+	}
+	const hash::OptionalHash64 streamed64 = stream64.finalize();
+	const hash::OptionalHash128 streamed128 = stream128.finalize();
+	const hash::OptionalHash128 streamed128_seed = stream128_seed.finalize();
+	check(fed && streamed64 && streamed64->get() == ref.hash64, "CityHash64Stream");
+	check(fed && streamed128 && *streamed128 == ref.hash128, "CityHash128Stream");
+	check(fed && streamed128_seed && *streamed128_seed == ref.hash128_seed, "CityHash128Stream (seeded)");
+
+	// One key, many seeds, on every kernel this CPU has
+	const __internal__::CpuFeatures& cpu = __internal__::GetCpuFeatures();
+	const len_t n = 1 + rng() % MAX_SEEDS;
+	ui64 seeds0[MAX_SEEDS];
+	ui64 seeds1[MAX_SEEDS];
+	ui64 expected[MAX_SEEDS];
+	ui64 expected_seed[MAX_SEEDS];
+	for (len_t i = 0; i < n; ++i) {
+		seeds0[i] = i == 0 ? key.seed0 : rng();
+		seeds1[i] = i == 0 ? key.seed1 : rng();
+		expected[i] = city::CityHash64WithSeeds(s, len, seeds0[i], seeds1[i])->get();
+		expected_seed[i] = city::CityHash64WithSeed(s, len, seeds1[i])->get();
+	}
+	check(expected[0] == ref.hash64_seeds, "CityHash64WithSeeds");
+	constexpr ll_string_t MULTI_NAMES[] = {
+		"CityHash64WithSeedsMulti Auto", "CityHash64WithSeedsMulti Scalar", "CityHash64WithSeedsMulti Avx2", "CityHash64WithSeedsMulti Avx512"
+	};
+	const std::pair<BatchKernel, ll_bool_t> KERNELS[] = {
+		{ BatchKernel::Auto, true }, { BatchKernel::Scalar, true }, { BatchKernel::Avx2, cpu.avx2 }, { BatchKernel::Avx512, cpu.avx512 }
+	};
+	for (const auto& [kernel, supported] : KERNELS) {
+		if (!supported) continue;
+		ui64 out[MAX_SEEDS]{};
+		ui64 out_seed[MAX_SEEDS]{};
+		const ll_bool_t ok = city::CityHash64WithSeedsMulti(s, len, seeds0, seeds1, out, n, kernel) &&
+			city::CityHash64WithSeedsMulti(s, len, nullptr, seeds1, out_seed, n, kernel);
+		check(ok && std::memcmp(out, expected, n * sizeof(ui64)) == 0 && std::memcmp(out_seed, expected_seed, n * sizeof(ui64)) == 0,
+			MULTI_NAMES[static_cast<ui8>(kernel)]);
+	}
+}
+
+// CityHash64Batch and CityHash32Batch on every kernel and CityHash128Batch,
+//	over a group of keys
+void checkBatch(Checker& checker, const KeyCase* keys, const Reference* refs, const len_t count) {
+	const __internal__::CpuFeatures& cpu = __internal__::GetCpuFeatures();
+	ll_string_t ptrs[GROUP_SIZE];
+	len_t lens[GROUP_SIZE];
+	for (len_t i = 0; i < count; ++i) {
+		ptrs[i] = keys[i].s;
+		lens[i] = keys[i].len;
+	}
+	const auto describeBatch = [&](ll_string_t function, const len_t i) {
+		return describe(function, keys[i]) + " (key " + std::to_string(i) + " of " + std::to_string(count) + ")";
+	};
+
+	const std::pair<BatchKernel, ll_bool_t> KERNELS[] = {
+		{ BatchKernel::Auto, true }, { BatchKernel::Scalar, true }, { BatchKernel::Avx2, cpu.avx2 }, { BatchKernel::Avx512, cpu.avx512 }
+	};
+	constexpr ll_string_t NAMES[] = { "CityHash64Batch Auto", "CityHash64Batch Scalar", "CityHash64Batch Avx2", "CityHash64Batch Avx512" };
+	for (const auto& [kernel, supported] : KERNELS) {
+		ll_string_t name = NAMES[static_cast<ui8>(kernel)];
+		ui64 out[GROUP_SIZE]{};
+		const ll_bool_t ok = city::CityHash64Batch(ptrs, lens, out, count, kernel);
+		if (!supported) {
+			checker.expect(!ok, std::string(name) + " ran on a CPU without it");
+			continue;
+		}
+		if (!checker.expect(ok, std::string(name) + " failed")) continue;
+		for (len_t i = 0; i < count; ++i)
+			checker.expectThat(out[i] == refs[i].hash64, [&]() { return describeBatch(name, i); });
+	}
+	ui64 unused[GROUP_SIZE];
+	checker.expect(!city::CityHash64Batch(ptrs, lens, unused, count, BatchKernel::Sse41), "CityHash64Batch ran on SSE4.1, which has no kernels");
+
+	const std::pair<BatchKernel, ll_bool_t> KERNELS_32[] = {
+		{ BatchKernel::Auto, true }, { BatchKernel::Scalar, true }, { BatchKernel::Avx2, cpu.avx2 }, { BatchKernel::Avx512, cpu.avx512 }, { BatchKernel::Sse41, cpu.sse41 }
+	};
+	constexpr ll_string_t NAMES_32[] = {
+		"CityHash32Batch Auto", "CityHash32Batch Scalar", "CityHash32Batch Avx2", "CityHash32Batch Avx512", "CityHash32Batch Sse41"
+	};
+	for (const auto& [kernel, supported] : KERNELS_32) {
+		ll_string_t name = NAMES_32[static_cast<ui8>(kernel)];
+		ui32 out[GROUP_SIZE]{};
+		const ll_bool_t ok = city::CityHash32Batch(ptrs, lens, out, count, kernel);
+		if (!supported) {
+			checker.expect(!ok, std::string(name) + " ran on a CPU without it");
+			continue;
+		}
+		if (!checker.expect(ok, std::string(name) + " failed")) continue;
+		for (len_t i = 0; i < count; ++i)
+			checker.expectThat(out[i] == refs[i].hash32, [&]() { return describeBatch(name, i); });
+	}
+
+	hash::Hash128 out128[GROUP_SIZE];
+	if (checker.expect(city::CityHash128Batch(ptrs, lens, out128, count), "CityHash128Batch failed")) {
+		for (len_t i = 0; i < count; ++i)
+			checker.expectThat(out128[i] == refs[i].hash128, [&]() { return describeBatch("CityHash128Batch", i); });
+	}
+}
+
+// The Objects and Array templates hash the bytes of the value in memory
+template<class T>
+void checkObject(Checker& checker, const T& value, const ui64 seed0, const ui64 seed1, ll_string_t type) {
+	ll_string_t bytes = reinterpret_cast<ll_string_t>(&value);
+	const ui64 hash = city::CityHash64(bytes, sizeof(T))->get();
+	const ui64 hash_seed = city::CityHash64WithSeed(bytes, sizeof(T), seed1)->get();
+	const ui64 hash_seeds = city::CityHash64WithSeeds(bytes, sizeof(T), seed0, seed1)->get();
+	const std::string name = std::string(type) + " (" + std::to_string(sizeof(T)) + " bytes)";
+	if constexpr (std::is_array_v<T>) {
+		checker.expectThat(city::CityHash64(value)->get() == hash, [&]() { return "CityHash64 of " + name; });
+		checker.expectThat(city::CityHash64WithSeed(value, seed1)->get() == hash_seed, [&]() { return "CityHash64WithSeed of " + name; });
+		checker.expectThat(city::CityHash64WithSeeds(value, seed0, seed1)->get() == hash_seeds, [&]() { return "CityHash64WithSeeds of " + name; });
+	}
+	else {
+		checker.expectThat(city::CityHash64<T>(value)->get() == hash, [&]() { return "CityHash64<T> of " + name; });
+		checker.expectThat(city::CityHash64WithSeed<T>(value, seed1)->get() == hash_seed, [&]() { return "CityHash64WithSeed<T> of " + name; });
+		checker.expectThat(city::CityHash64WithSeeds<T>(value, seed0, seed1)->get() == hash_seeds, [&]() { return "CityHash64WithSeeds<T> of " + name; });
+		if constexpr (__internal__::header::IS_REGISTER_KEY<T>)
+			checker.expectThat(city::CityHash64Key(value) == hash, [&]() { return "CityHash64Key of " + name; });
+	}
+}
+
+enum class TestEnum : ui16 { A = 1 };
+
+struct Bytes3 {
+	ui8 a[3];
+};
+struct Words12 {
+	ui32 a, b, c;
+};
+struct Mixed24 {
+	ui64 a;
+	ui32 b;
+	ui16 c;
+	ui8 d, e;
+	ui64 f;
+};
+
+void checkObjects(Checker& checker, std::mt19937_64& rng) {
+	const ui64 seed0 = rng();
+	const ui64 seed1 = rng();
+	ui64 words[8];
+	for (ui64& word : words) word = rng();
+	const auto fill = [&](auto& value) { std::memcpy(&value, words, sizeof(value)); };
+
+	ui8 u8; fill(u8); checkObject(checker, u8, seed0, seed1, "ui8");
+	ui16 u16; fill(u16); checkObject(checker, u16, seed0, seed1, "ui16");
+	ui32 u32; fill(u32); checkObject(checker, u32, seed0, seed1, "ui32");
+	ui64 u64; fill(u64); checkObject(checker, u64, seed0, seed1, "ui64");
+	i64 s64; fill(s64); checkObject(checker, s64, seed0, seed1, "i64");
+	TestEnum e; fill(e); checkObject(checker, e, seed0, seed1, "enum");
+	const void* pointer; fill(pointer); checkObject(checker, pointer, seed0, seed1, "pointer");
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 u128; fill(u128); checkObject(checker, u128, seed0, seed1, "unsigned __int128");
+#endif // __SIZEOF_INT128__
+	Bytes3 b3; fill(b3); checkObject(checker, b3, seed0, seed1, "struct");
+	Words12 w12; fill(w12); checkObject(checker, w12, seed0, seed1, "struct");
+	Mixed24 m24; fill(m24); checkObject(checker, m24, seed0, seed1, "struct");
+
+	ui8 a8[13]; fill(a8); checkObject(checker, a8, seed0, seed1, "ui8[13]");
+	ui16 a16[9]; fill(a16); checkObject(checker, a16, seed0, seed1, "ui16[9]");
+	ui32 a32[5]; fill(a32); checkObject(checker, a32, seed0, seed1, "ui32[5]");
+	ui64 a64[8]; fill(a64); checkObject(checker, a64, seed0, seed1, "ui64[8]");
+
+	// Keys of two words and hashes of hashes
+	const ui64 low = words[0];
+	const ui64 high = words[1];
+	ll_char_t packed[16];
+	for (len_t b = 0; b < 8; ++b) {
+		packed[b] = static_cast<ll_char_t>(low >> (8 * b));
+		packed[8 + b] = static_cast<ll_char_t>(high >> (8 * b));
+	}
+	const ui64 pair_hash = city::CityHash64(packed, 16)->get();
+	checker.expect(city::CityHash64Key(low, high) == pair_hash, "CityHash64Key(low, high)");
+	checker.expect(city::CityHash64Key(hash::Hash128(low, high)) == pair_hash, "CityHash64Key(Hash128)");
+	checker.expect(city::CityHash64(hash::Hash64(low))->get() == city::CityHash64(packed, 8)->get(), "CityHash64(Hash64)");
+
+	// Composite keys hash their fields packed little-endian
+	const std::tuple<ui32, ui64, ui16> fields(static_cast<ui32>(words[2]), words[3], static_cast<ui16>(words[4]));
+	ll_char_t fields_packed[14];
+	for (len_t b = 0; b < 4; ++b) fields_packed[b] = static_cast<ll_char_t>(std::get<0>(fields) >> (8 * b));
+	for (len_t b = 0; b < 8; ++b) fields_packed[4 + b] = static_cast<ll_char_t>(std::get<1>(fields) >> (8 * b));
+	for (len_t b = 0; b < 2; ++b) fields_packed[12 + b] = static_cast<ll_char_t>(std::get<2>(fields) >> (8 * b));
+	checker.expect(city::CityHash64Fields(fields) == city::CityHash64(fields_packed, sizeof(fields_packed))->get(), "CityHash64Fields(std::tuple)");
+}
+
+#pragma endregion
+#pragma region Constant
+// The header code behind CityHash32Const / CityHash64Const reads bytes one
+//	at a time when constant evaluated and with std::memcpy at run time, where
+//	city.cpp runs it.  Both must agree on every length of EDGE_LENGTHS.
+constexpr len_t CONSTANT_TEXT_SIZE = 1024;
+constexpr ui64 CONSTANT_SEED = 0x243f6a8885a308d3ull;
+
+constexpr std::array<ll_char_t, CONSTANT_TEXT_SIZE> makeConstantText() noexcept {
+	std::array<ll_char_t, CONSTANT_TEXT_SIZE> text{};
+	ui64 x = CONSTANT_SEED;
+	for (ll_char_t& c : text) {
+		x = x * 6364136223846793005ull + 1442695040888963407ull;
+		c = static_cast<ll_char_t>(x >> 56);
+	}
+	return text;
+}
+constexpr std::array<ll_char_t, CONSTANT_TEXT_SIZE> CONSTANT_TEXT = makeConstantText();
+
+struct ConstantHashes {
+	ui32 hash32;
+	ui64 hash64;
+	ui64 hash64_seed;
+};
+constexpr ConstantHashes constantHashes(const len_t len) noexcept {
+	const std::string_view view(CONSTANT_TEXT.data(), len);
+	return ConstantHashes{ CityHash32Const(view), CityHash64Const(view), CityHash64WithSeedConst(view, CONSTANT_SEED) };
+}
+template<len_t... I>
+constexpr std::array<ConstantHashes, sizeof...(I)> makeConstantHashes(std::index_sequence<I...>) noexcept {
+	return { constantHashes(EDGE_LENGTHS[I])... };
+}
+constexpr len_t EDGE_COUNT = sizeof(EDGE_LENGTHS) / sizeof(EDGE_LENGTHS[0]);
+constexpr std::array<ConstantHashes, EDGE_COUNT> CONSTANT_HASHES = makeConstantHashes(std::make_index_sequence<EDGE_COUNT>());
+
+void checkConstant(Checker& checker) {
+	for (len_t i = 0; i < EDGE_COUNT; ++i) {
+		const len_t len = EDGE_LENGTHS[i];
+		const ConstantHashes& expected = CONSTANT_HASHES[i];
+		const std::string suffix = " constant evaluated, len=" + std::to_string(len);
+		checker.expectThat(city::CityHash32(CONSTANT_TEXT.data(), len)->get() == expected.hash32, [&]() { return "CityHash32Const" + suffix; });
+		checker.expectThat(city::CityHash64(CONSTANT_TEXT.data(), len)->get() == expected.hash64, [&]() { return "CityHash64Const" + suffix; });
+		checker.expectThat(city::CityHash64WithSeed(CONSTANT_TEXT.data(), len, CONSTANT_SEED)->get() == expected.hash64_seed,
+			[&]() { return "CityHash64WithSeedConst" + suffix; });
+	}
+}
+
+#pragma endregion
+
+} // namespace
+
+bool runDifferentialTests(const Options& options) {
+	GuardedArena arena(GROUP_SIZE);
+	if (!arena.isValid()) {
+		std::printf("FAILED: could not allocate the test slots\n");
+		return false;
+	}
+	if (!arena.isGuarded()) std::printf("Slots are not guarded here: reads past a key are not detected\n");
+	std::mt19937_64 rng(options.seed);
+	const len_t slot_size = arena.getSlotSize();
+
+	Checker checker("differential", options);
+	KeyCase keys[GROUP_SIZE];
+	Reference refs[GROUP_SIZE];
+	len_t count = 0;
+	const auto add = [&](const len_t len, const Placement placement, const len_t align) {
+		keys[count] = placeKey(rng, arena.slot(count), slot_size, len, placement, align);
+		refs[count] = computeReference(keys[count]);
+		checkKey(checker, keys[count], refs[count], rng);
+		if (++count == GROUP_SIZE) {
+			checkBatch(checker, keys, refs, count);
+			count = 0;
+		}
+	};
+
+	// Every length up to 1024, against both guard pages and at every alignment
+	for (len_t len = 0; len <= 1024; ++len) {
+		add(len, Placement::Start, 0);
+		add(len, Placement::End, 0);
+		add(len, Placement::Middle, len % 64);
+	}
+	// Random keys; half of the groups share a length bucket, as the SIMD
+	//	batch kernels only run on such runs.  CityHash32 splits keys of up to
+	//	24 bytes in buckets of its own.
+	for (len_t i = 0; i < options.iterations; ) {
+		if (count == 0 && rng() % 2 == 0) {
+			const len_t len = randomLength(rng, slot_size);
+			const ll_bool_t bucket32 = len <= 24 && rng() % 2 == 0;
+			const len_t low = bucket32 ? (len <= 4 ? 0 : len <= 12 ? 5 : 13) :
+				len <= 16 ? 0 : len <= 32 ? 17 : len <= 64 ? 33 : 65;
+			const len_t high = bucket32 ? (len <= 4 ? 4 : len <= 12 ? 12 : 24) :
+				len <= 16 ? 16 : len <= 32 ? 32 : len <= 64 ? 64 : slot_size;
+			for (len_t k = 0; k < GROUP_SIZE && i < options.iterations; ++k, ++i)
+				add(low + rng() % (high - low + 1), static_cast<Placement>(rng() % 3), rng() % 64);
+		}
+		else {
+			add(randomLength(rng, slot_size), static_cast<Placement>(rng() % 3), rng() % 64);
+			++i;
+		}
+	}
+	if (count) checkBatch(checker, keys, refs, count);
+
+	for (len_t i = 0; i < 256; ++i) checkObjects(checker, rng);
+	checkConstant(checker);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,184 @@
+//////////////////////////////////////////////
+//	test_fields.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_fields.hpp"
+
+#include <cstring>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+// 14 packed bytes in 24: 4 bytes of padding after customer, 6 at the end
+struct OrderKey {
+	ui32 customer;
+	ui64 order;
+	ui16 line;
+
+	bool operator==(const OrderKey&) const = default;
+};
+
+// No padding: hashed in place
+struct PlainKey {
+	ui32 region;
+	ui32 shard;
+	ui64 id;
+};
+
+// 26 packed bytes: a string, floating point and an array
+struct RowKey {
+	std::string name;
+	ui32 id;
+	f64 price;
+	std::array<ui16, 3> codes;
+};
+
+// Fields listed by hand, in an order other than the members'
+class Account {
+	private:
+		ui64 id;
+		std::string region;
+
+	public:
+		Account(const ui64 id, std::string region) : id(id), region(std::move(region)) {}
+		auto cityFields() const noexcept { return std::tie(this->region, this->id); }
+};
+
+// Packs the low SIZE bytes of v little-endian at out[0] ... out[SIZE - 1]
+template<len_t SIZE>
+ll_char_t* packBytes(ll_char_t* out, const ui64 v) noexcept {
+	if constexpr (std::endian::native == std::endian::little) std::memcpy(out, &v, SIZE);
+	else for (len_t i = 0; i < SIZE; ++i) out[i] = static_cast<ll_char_t>(v >> (8 * i));
+	return out + SIZE;
+}
+ui64 stringHash(const std::string_view str) noexcept {
+	return city::CityHash64Unchecked(str.data(), str.size());
+}
+
+// The fields packed by hand into a buffer
+void packOrder(const OrderKey& key, ll_char_t (&buffer)[14]) noexcept {
+	ll_char_t* p = packBytes<4>(buffer, key.customer);
+	p = packBytes<8>(p, key.order);
+	(void)packBytes<2>(p, key.line);
+}
+ui64 packedOrderHash(const OrderKey& key) noexcept {
+	ll_char_t buffer[14];
+	packOrder(key, buffer);
+	return city::CityHash64Unchecked(buffer, sizeof(buffer));
+}
+ui64 packedRowHash(const RowKey& key) noexcept {
+	ll_char_t buffer[26];
+	ll_char_t* p = packBytes<8>(buffer, stringHash(key.name));
+	p = packBytes<4>(p, key.id);
+	p = packBytes<8>(p, std::bit_cast<ui64>(key.price));
+	for (const ui16 code : key.codes) p = packBytes<2>(p, code);
+	return city::CityHash64Unchecked(buffer, sizeof(buffer));
+}
+
+OrderKey makeOrder(const ui64 i) noexcept {
+	OrderKey key;
+	// Garbage in the padding, which must not change the hash
+	std::memset(static_cast<void*>(&key), static_cast<int>(i * 37), sizeof(key));
+	key.customer = static_cast<ui32>(city::CityHash64Key(i));
+	key.order = city::CityHash64Key(i + 1);
+	key.line = static_cast<ui16>(i);
+	return key;
+}
+
+// tuple<ui8, array<ui8, N - 1>> packs to N bytes of data, through every
+//	length bucket and an in-place part at an odd offset
+template<len_t N>
+void checkLength(Checker& checker, const std::vector<ll_char_t>& data) {
+	std::tuple<ui8, std::array<ui8, N - 1>> key;
+	std::get<0>(key) = static_cast<ui8>(data[0]);
+	std::memcpy(std::get<1>(key).data(), data.data() + 1, N - 1);
+	static_assert(CITYHASH_FIELDS_SIZE<decltype(key)> == N);
+	checker.expectThat(city::CityHash64Fields(key) == city::CityHash64Unchecked(data.data(), N), [&]() {
+		return "CityHash64Fields of " + std::to_string(N) + " packed bytes differs from CityHash64";
+	});
+}
+template<len_t... N>
+void checkLengths(Checker& checker, const std::vector<ll_char_t>& data, std::index_sequence<N...>) {
+	(checkLength<N + 1>(checker, data), ...);
+}
+
+// Padding and layout do not count
+void checkPadding(Checker& checker) {
+	for (ui64 i = 0; i < 1000; ++i) {
+		const OrderKey key = makeOrder(i);
+		const ui64 expected = packedOrderHash(key);
+		OrderKey other = makeOrder(i + 1000);
+		other.customer = key.customer;
+		other.order = key.order;
+		other.line = key.line;
+		ll_char_t buffer[14];
+		packOrder(key, buffer);
+		const ll_bool_t ok = city::CityHash64Fields(key) == expected && city::CityHash64Fields(other) == expected &&
+			city::CityHash64Fields(std::make_tuple(key.customer, key.order, key.line)) == expected &&
+			city::CityHash64Fields(std::make_pair(key.customer, std::make_pair(key.order, key.line))) == expected &&
+			CityFieldsHasher()(key) == expected;
+		if (!checker.expectThat(ok, [&]() { return "CityHash64Fields of padded key " + std::to_string(i) + " differs from its packed fields"; })) break;
+		if (!checker.expectThat(city::CityHash64FieldsWithSeed(key, i) == city::CityHash64WithSeedUnchecked(buffer, sizeof(buffer), i),
+			[&]() { return "CityHash64FieldsWithSeed of key " + std::to_string(i); })) break;
+	}
+
+	// Padding-free keys are their own packed bytes
+	const PlainKey plain{ 7, 9, 0x0123456789abcdefull };
+	checker.expect(city::CityHash64Fields(plain) == city::CityHash64Unchecked(reinterpret_cast<ll_string_t>(&plain), sizeof(plain)) &&
+		city::CityHash64Fields(plain) == city::CityHash64Fields(std::make_tuple(plain.region, plain.shard, plain.id)),
+		"CityHash64Fields of a padding-free key");
+}
+
+void checkFields(Checker& checker, const std::vector<ll_char_t>& data) {
+	// Small keys, hashed from registers
+	const ui8 b[3] = { 1, 2, 3 };
+	checker.expect(city::CityHash64Fields(std::tuple<>()) == city::CityHash64Unchecked("", 0) &&
+		city::CityHash64Fields(std::make_pair(b[0], b[1])) == city::CityHash64Unchecked(reinterpret_cast<ll_string_t>(b), 2) &&
+		city::CityHash64Fields(std::make_tuple(b[0], static_cast<ui16>(b[1] | b[2] << 8))) == city::CityHash64Unchecked(reinterpret_cast<ll_string_t>(b), 3) &&
+		city::CityHash64Fields(ui64(42)) == city::CityHash64Key(ui64(42)),
+		"CityHash64Fields of small keys differs from CityHash64");
+
+	// Strings by contents, -0.0 as 0.0
+	const std::string name(data.data(), 40);
+	const RowKey row{ name, 5, 0.0, { 1, 2, 3 } };
+	const RowKey negative{ std::string(name), 5, -0.0, { 1, 2, 3 } };
+	const std::string copy = name;
+	checker.expect(city::CityHash64Fields(row) == packedRowHash(row) && city::CityHash64Fields(negative) == packedRowHash(row) &&
+		city::CityHash64Fields(std::make_tuple(std::string_view(copy), ui32(5), 0.0, row.codes)) == packedRowHash(row),
+		"CityHash64Fields of string or floating point fields");
+	checker.expect(city::CityHash64Fields(std::make_pair(copy.c_str(), ui32(5))) == city::CityHash64Fields(std::make_pair(CityHashedString(name), ui32(5))),
+		"CityHash64Fields of a C string and a CityHashedString differ");
+	checker.expect(city::CityHash64Fields(Account(3, "eu")) == city::CityHash64Fields(std::make_tuple(std::string("eu"), ui64(3))),
+		"CityHash64Fields of a class with cityFields()");
+
+	// A set of composite keys
+	CityFlatSet<OrderKey, CityFieldsHasher> set;
+	for (ui64 i = 0; i < 1000; ++i) (void)set.insert(makeOrder(i));
+	ll_bool_t found = set.size() == 1000;
+	for (ui64 i = 0; i < 1000; ++i) found = found && set.contains(makeOrder(i));
+	checker.expect(found, "CityFlatSet with CityFieldsHasher");
+}
+
+} // namespace
+
+bool runFieldsTests(const Options& options) {
+	std::vector<ll_char_t> data(1 << 12);
+	fillTestData(data);
+	Checker checker("fields", options);
+	checkLengths(checker, data, std::make_index_sequence<80>{});
+	checkPadding(checker);
+	checkFields(checker, data);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
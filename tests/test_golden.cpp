@@ -0,0 +1,89 @@
+//////////////////////////////////////////////
+//	test_golden.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+struct GoldenVector {
+	len_t offset;
+	len_t len;
+	ui32 hash32;
+	ui64 hash64;
+	ui64 hash64_seed;
+	ui64 hash64_seeds;
+	ui64 hash128_low;
+	ui64 hash128_high;
+	ui64 hash128_seed_low;
+	ui64 hash128_seed_high;
+};
+
+constexpr GoldenVector GOLDEN_VECTORS[] = {
+#include "golden_vectors.inl"
+};
+
+// The first row (the empty string) in constant expressions
+static_assert(CityHash32Const("") == 0xdc56d17a);
+static_assert(CityHash64Const("") == 0x9ae16a3b2f90404full);
+static_assert(CityHash64WithSeedConst("", TEST_SEED0) == 0x75106db890237a4aull);
+
+std::string describe(ll_string_t function, const GoldenVector& vector) {
+	return std::string(function) + " offset=" + std::to_string(vector.offset) + " len=" + std::to_string(vector.len);
+}
+
+} // namespace
+
+bool runGoldenTests(const Options& options) {
+	std::vector<ll_char_t> data(TEST_DATA_SIZE);
+	fillTestData(data);
+	const hash::Hash128 seed128(TEST_SEED0, TEST_SEED1);
+
+	Checker checker("golden", options);
+	for (const GoldenVector& vector : GOLDEN_VECTORS) {
+		ll_string_t s = data.data() + vector.offset;
+		const len_t len = vector.len;
+		const hash::OptionalHash32 h32 = city::CityHash32(s, len);
+		const hash::OptionalHash64 h64 = city::CityHash64(s, len);
+		const hash::OptionalHash64 h64_seed = city::CityHash64WithSeed(s, len, TEST_SEED0);
+		const hash::OptionalHash64 h64_seeds = city::CityHash64WithSeeds(s, len, TEST_SEED0, TEST_SEED1);
+		const hash::OptionalHash128 h128 = city::CityHash128(s, len);
+		const hash::OptionalHash128 h128_seed = city::CityHash128WithSeed(s, len, seed128);
+		const hash::OptionalHash128 crc128 = city::CityHashCrc128(s, len);
+		const hash::OptionalHash128 crc128_seed = city::CityHashCrc128WithSeed(s, len, seed128);
+
+		checker.expectThat(h32 && h32->get() == vector.hash32, [&]() { return describe("CityHash32", vector); });
+		checker.expectThat(h64 && h64->get() == vector.hash64, [&]() { return describe("CityHash64", vector); });
+		checker.expectThat(h64_seed && h64_seed->get() == vector.hash64_seed, [&]() { return describe("CityHash64WithSeed", vector); });
+		checker.expectThat(h64_seeds && h64_seeds->get() == vector.hash64_seeds, [&]() { return describe("CityHash64WithSeeds", vector); });
+		checker.expectThat(h128 && *h128 == hash::Hash128(vector.hash128_low, vector.hash128_high), [&]() { return describe("CityHash128", vector); });
+		checker.expectThat(h128_seed && *h128_seed == hash::Hash128(vector.hash128_seed_low, vector.hash128_seed_high),
+			[&]() { return describe("CityHash128WithSeed", vector); });
+		// The CRC variants are CityHash128 up to 900 bytes
+		if (len <= 900) {
+			checker.expectThat(crc128 && *crc128 == hash::Hash128(vector.hash128_low, vector.hash128_high),
+				[&]() { return describe("CityHashCrc128", vector); });
+			checker.expectThat(crc128_seed && *crc128_seed == hash::Hash128(vector.hash128_seed_low, vector.hash128_seed_high),
+				[&]() { return describe("CityHashCrc128WithSeed", vector); });
+		}
+	}
+
+	// Null input fails, whatever the length
+	constexpr ll_string_t null = nullptr;
+	checker.expect(!city::CityHash32(null, 0) && !city::CityHash64(null, 1) &&
+		!city::CityHash64WithSeed(null, 0, TEST_SEED0) && !city::CityHash64WithSeeds(null, 0, TEST_SEED0, TEST_SEED1) &&
+		!city::CityHash128(null, 0) && !city::CityHash128WithSeed(null, 0, seed128) && !city::CityHashCrc128(null, 0),
+		"null input returned a hash");
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////
+//	test_hll.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_hll.hpp"
+
+#include <cmath>
+#include <optional>
+#include <random>
+#include <unordered_set>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+// Key i is the 8 bytes of i
+struct HllKeys {
+	std::vector<ui64> values;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+};
+
+HllKeys makeKeys(const len_t n) {
+	HllKeys keys;
+	keys.values.resize(n);
+	keys.ptrs.resize(n);
+	keys.lens.assign(n, sizeof(ui64));
+	for (len_t i = 0; i < n; ++i) keys.values[i] = i;
+	for (len_t i = 0; i < n; ++i) keys.ptrs[i] = reinterpret_cast<ll_string_t>(&keys.values[i]);
+	return keys;
+}
+
+std::vector<ui8> serialized(const CityHyperLogLog& sketch) {
+	std::vector<ui8> bytes(sketch.serializedSize());
+	if (!sketch.serialize(bytes.data(), bytes.size())) bytes.clear();
+	return bytes;
+}
+
+// Random keys with repeats, counted by the sketch and by a std::unordered_set.
+//	Sparse sketches count almost exactly; dense ones stay within four
+//	standard errors (1.04 / sqrt(2^precision)).
+void checkAccuracy(Checker& checker, const ui64 seed) {
+	constexpr len_t DRAWS[] = { 1, 10, 100, 1000, 5000, 20000, 200000, 1000000 };
+	std::mt19937_64 rng(seed);
+	for (const ui32 precision : { ui32(10), CITYHASH_HLL_DEFAULT_PRECISION }) {
+		const len_t m = len_t(1) << precision;
+		const f64 sigma = 1.04 / std::sqrt(static_cast<f64>(m));
+		CityHyperLogLog empty(precision);
+		checker.expect(empty.isSparse() && empty.estimate() == 0.0, "CityHyperLogLog of no keys");
+		for (const len_t draws : DRAWS) {
+			CityHyperLogLog sketch(precision);
+			std::unordered_set<ui64> exact;
+			for (len_t i = 0; i < draws; ++i) {
+				const ui64 key = rng() % (2 * draws);
+				(void)sketch.add(reinterpret_cast<ll_string_t>(&key), sizeof(key));
+				exact.insert(key);
+			}
+			const len_t n = exact.size();
+			const f64 estimate = sketch.estimate();
+			const f64 error = std::fabs(estimate - static_cast<f64>(n)) / static_cast<f64>(n);
+			const f64 allowed = sketch.isSparse() ? 0.005 : 4.0 * sigma;
+			const auto at = [&]() {
+				return "precision " + std::to_string(precision) + ", " + std::to_string(n) + " distinct keys (estimate " +
+					std::to_string(estimate) + (sketch.isSparse() ? ", sparse)" : ", dense)");
+			};
+			checker.expectThat(error <= allowed + 1.0 / static_cast<f64>(n), [&]() { return "CityHyperLogLog estimate at " + at(); });
+			// One entry per key while sparse, which ends well before m / 4 keys
+			if (n < m / 8) checker.expectThat(sketch.isSparse(), [&]() { return "CityHyperLogLog went dense at " + at(); });
+			if (n > m / 2) checker.expectThat(!sketch.isSparse(), [&]() { return "CityHyperLogLog stayed sparse at " + at(); });
+		}
+	}
+}
+
+// add, addBatch, addHashes and merged per-thread sketches give the same
+//	registers, and serialized copies read back as the same sketch
+void checkConsistency(Checker& checker) {
+	for (const len_t n : { len_t(300), len_t(200000) }) {
+		const HllKeys keys = makeKeys(n);
+		for (const std::optional<ui64> seed : { std::optional<ui64>(), std::optional<ui64>(42) }) {
+			const std::string at = std::to_string(n) + (seed ? " keys, seeded" : " keys");
+			CityHyperLogLog one(12, seed), batch(12, seed), hashes(12, seed);
+			std::vector<ui64> values(n);
+			for (len_t i = 0; i < n; ++i) {
+				(void)one.add(keys.ptrs[i], keys.lens[i]);
+				values[i] = (seed ? *city::CityHash64WithSeed(keys.ptrs[i], keys.lens[i], *seed) : *city::CityHash64(keys.ptrs[i], keys.lens[i])).get();
+			}
+			checker.expect(batch.addBatch(keys.ptrs.data(), keys.lens.data(), n) && hashes.addHashes(values.data(), n), "CityHyperLogLog addBatch or addHashes failed: " + at);
+			const std::vector<ui8> bytes = serialized(one);
+			checker.expect(!bytes.empty() && one.isSparse() == (n < 1000), "CityHyperLogLog::serialize: " + at);
+			checker.expect(serialized(batch) == bytes && batch.estimate() == one.estimate(), "CityHyperLogLog add and addBatch differ: " + at);
+			checker.expect(serialized(hashes) == bytes && hashes.estimate() == one.estimate(), "CityHyperLogLog add and addHashes differ: " + at);
+
+			// Per-thread sketches over overlapping ranges, merged
+			constexpr len_t PARTS = 8;
+			CityHyperLogLog merged(12, seed);
+			ll_bool_t accepted = true;
+			for (len_t part = 0; part < PARTS; ++part) {
+				CityHyperLogLog local(12, seed);
+				const len_t begin = part * n / PARTS;
+				const len_t end = (part + 2) * n / PARTS < n ? (part + 2) * n / PARTS : n;
+				(void)local.addBatch(keys.ptrs.data() + begin, keys.lens.data() + begin, end - begin);
+				accepted &= merged.merge(local);
+			}
+			const CityHyperLogLog copy(merged);
+			checker.expect(accepted, "CityHyperLogLog::merge refused a matching sketch: " + at);
+			checker.expect(serialized(merged) == bytes && merged.estimate() == one.estimate(), "merged CityHyperLogLog differs from one sketch of the union: " + at);
+			checker.expect(serialized(copy) == bytes, "copied CityHyperLogLog differs: " + at);
+
+			const std::optional<CityHyperLogLog> back = CityHyperLogLog::deserialize(bytes.data(), bytes.size());
+			checker.expect(back && serialized(*back) == bytes && back->estimate() == one.estimate() &&
+				back->getSeed() == seed && back->getPrecision() == 12 && back->isSparse() == one.isSparse(),
+				"CityHyperLogLog::deserialize round trip: " + at);
+
+			// Header: magic, version, precision, flags
+			constexpr len_t CORRUPT_BYTES[] = { 0, 4, 5, 6 };
+			for (const len_t byte : CORRUPT_BYTES) {
+				std::vector<ui8> corrupt = bytes;
+				corrupt[byte] ^= byte == 6 ? 0x80 : 0x40;
+				checker.expectThat(!CityHyperLogLog::deserialize(corrupt.data(), corrupt.size()), [&]() {
+					return "CityHyperLogLog::deserialize accepted header byte " + std::to_string(byte) + " changed: " + at;
+				});
+			}
+			checker.expect(!CityHyperLogLog::deserialize(bytes.data(), bytes.size() - 1) &&
+				!CityHyperLogLog::deserialize(bytes.data(), 15) && !CityHyperLogLog::deserialize(nullptr, bytes.size()),
+				"CityHyperLogLog::deserialize accepted a short or null buffer: " + at);
+			// A dense register with a rank no hash can produce, or a sparse
+			//	entry that does not follow the previous one
+			std::vector<ui8> corrupt = bytes;
+			if (one.isSparse()) {
+				// Last varint delta replaced by 0
+				len_t last = corrupt.size() - 1;
+				while (corrupt[last - 1] & 0x80) --last;
+				corrupt.resize(last + 1);
+				corrupt[last] = 0;
+			}
+			else corrupt[16] = 0xff;
+			checker.expect(!CityHyperLogLog::deserialize(corrupt.data(), corrupt.size()), "CityHyperLogLog::deserialize accepted corrupt registers: " + at);
+		}
+	}
+
+	CityHyperLogLog seeded(12, 1), other_seed(12, 2), other_precision(13);
+	const ll_string_t ptrs[] = { "a", nullptr };
+	const len_t lens[] = { 1, 0 };
+	checker.expect(!seeded.merge(other_seed) && !seeded.merge(other_precision), "CityHyperLogLog merged a sketch with another seed or precision");
+	checker.expect(!seeded.add(nullptr, 0) && !seeded.addBatch(ptrs, lens, 2) && std::fabs(seeded.estimate() - 1.0) <= 0.01,
+		"CityHyperLogLog null keys");
+}
+
+} // namespace
+
+bool runHllTests(const Options& options) {
+	Checker checker("hll", options);
+	checkAccuracy(checker, options.seed);
+	checkConsistency(checker);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
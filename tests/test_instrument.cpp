@@ -0,0 +1,135 @@
+//////////////////////////////////////////////
+//	test_instrument.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_instrument.hpp"
+
+#include <thread>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+struct Call {
+	CityInstrumentApi api;
+	CityInstrumentBucket bucket;
+	len_t len;
+};
+
+// One call per entry, in the bucket the instrumentation has to put it
+constexpr Call CALLS[] = {
+	{ CityInstrumentApi::Hash32, CityInstrumentBucket::Hash32Len0to4, 3 },
+	{ CityInstrumentApi::Hash32, CityInstrumentBucket::Hash32Len5to12, 12 },
+	{ CityInstrumentApi::Hash32, CityInstrumentBucket::Hash32Len13to24, 13 },
+	{ CityInstrumentApi::Hash32, CityInstrumentBucket::Hash32Loop, 25 },
+	{ CityInstrumentApi::Hash64, CityInstrumentBucket::HashLen0to16, 16 },
+	{ CityInstrumentApi::Hash64, CityInstrumentBucket::HashLen17to32, 17 },
+	{ CityInstrumentApi::Hash64, CityInstrumentBucket::HashLen33to64, 64 },
+	{ CityInstrumentApi::Hash64, CityInstrumentBucket::Hash64Loop, 65 },
+	{ CityInstrumentApi::Hash128, CityInstrumentBucket::CityMurmur, 143 },
+	{ CityInstrumentApi::Hash128, CityInstrumentBucket::Hash128Loop, 144 },
+};
+
+void hashCalls(const std::vector<ll_char_t>& data) noexcept {
+	ll_string_t s = data.data();
+	for (const Call& call : CALLS) {
+		switch (call.api) {
+			case CityInstrumentApi::Hash32:
+				(void)city::CityHash32(s, call.len);
+				break;
+			case CityInstrumentApi::Hash64:
+				(void)city::CityHash64(s, call.len);
+				break;
+			default:
+				(void)city::CityHash128(s, call.len);
+				break;
+		}
+	}
+}
+
+} // namespace
+
+bool runInstrumentTests(const Options& options) {
+	std::vector<ll_char_t> data(1024);
+	fillTestData(data);
+	Checker checker("instrument", options);
+
+	CityInstrumentReset();
+	hashCalls(data);
+	std::thread other(hashCalls, std::cref(data));
+	other.join();
+	// Counted once each, as CityHash64 and CityHash128WithSeed
+	(void)city::CityHash64WithSeed(data.data(), 8, TEST_SEED0);
+	(void)city::CityHash128WithSeed(data.data(), 200, hash::Hash128(TEST_SEED0, TEST_SEED1));
+	const std::wstring wide(10, L'x');
+	(void)city::CityHash64(wide);
+	const CityInstrumentSnapshot snapshot = CityInstrumentGetSnapshot();
+
+	std::string text;
+	std::string json;
+	checker.expect(CityInstrumentFormatSnapshot(snapshot, CityInstrumentFormat::Text, text) && !text.empty(), "text dump");
+	checker.expect(CityInstrumentFormatSnapshot(snapshot, CityInstrumentFormat::Json, json) &&
+		json.front() == '{' && json.find(snapshot.enabled ? "\"enabled\":true" : "\"enabled\":false") != std::string::npos &&
+		json.find("\"HashLen33to64\":{\"calls\":") != std::string::npos, "JSON dump");
+	checker.expect(std::string(CityInstrumentBucketName(CityInstrumentBucket::Hash64Loop)) == "Hash64Loop", "bucket names");
+	if (options.verbose) std::printf("%s%s", text.c_str(), json.c_str());
+
+	if (!snapshot.enabled) {
+		// Built without LL_CITY_INSTRUMENT: nothing may be counted
+		bool empty = snapshot.threads == 0;
+		for (const CityInstrumentCounter& counter : snapshot.apis) empty &= counter.calls == 0 && counter.bytes == 0;
+		for (const CityInstrumentCounter& counter : snapshot.buckets) empty &= counter.calls == 0 && counter.bytes == 0;
+		checker.expect(empty, "counted calls without LL_CITY_INSTRUMENT");
+		return checker.finish();
+	}
+
+	CityInstrumentSnapshot expected{};
+	for (const Call& call : CALLS) {
+		CityInstrumentCounter& api = expected.apis[static_cast<len_t>(call.api)];
+		CityInstrumentCounter& bucket = expected.buckets[static_cast<len_t>(call.bucket)];
+		api.calls += 2;
+		api.bytes += 2 * call.len;
+		bucket.calls += 2;
+		bucket.bytes += 2 * call.len;
+	}
+	const auto add = [&](const CityInstrumentApi api, const CityInstrumentBucket bucket, const len_t len) {
+		expected.apis[static_cast<len_t>(api)].calls += 1;
+		expected.apis[static_cast<len_t>(api)].bytes += len;
+		expected.buckets[static_cast<len_t>(bucket)].calls += 1;
+		expected.buckets[static_cast<len_t>(bucket)].bytes += len;
+	};
+	add(CityInstrumentApi::Hash64, CityInstrumentBucket::HashLen0to16, 8);
+	add(CityInstrumentApi::Hash128, CityInstrumentBucket::Hash128Loop, 200);
+	add(CityInstrumentApi::WideString, CityInstrumentBucket::None, 10 * sizeof(ll_wchar_t));
+	// The wide string is hashed by CityHash64
+	add(CityInstrumentApi::Hash64, 10 * sizeof(ll_wchar_t) <= 32 ? CityInstrumentBucket::HashLen17to32 : CityInstrumentBucket::HashLen33to64, 10 * sizeof(ll_wchar_t));
+
+	for (len_t i = 0; i < CITY_INSTRUMENT_API_COUNT; ++i) {
+		const CityInstrumentApi api = static_cast<CityInstrumentApi>(i);
+		checker.expectThat(snapshot.apis[i].calls == expected.apis[i].calls && snapshot.apis[i].bytes == expected.apis[i].bytes,
+			[&]() { return std::string(CityInstrumentApiName(api)) + " counted " + std::to_string(snapshot.apis[i].calls) + " calls"; });
+	}
+	for (len_t i = 0; i < CITY_INSTRUMENT_BUCKET_COUNT; ++i) {
+		const CityInstrumentBucket bucket = static_cast<CityInstrumentBucket>(i);
+		checker.expectThat(snapshot.buckets[i].calls == expected.buckets[i].calls && snapshot.buckets[i].bytes == expected.buckets[i].bytes,
+			[&]() { return std::string(CityInstrumentBucketName(bucket)) + " counted " + std::to_string(snapshot.buckets[i].calls) + " calls"; });
+	}
+	checker.expect(snapshot.threads >= 2, "the thread that exited was not counted");
+	checker.expect(!snapshot.cycles || snapshot.apis[static_cast<len_t>(CityInstrumentApi::Hash64)].cycles > 0, "no cycles counted");
+
+	CityInstrumentReset();
+	const CityInstrumentSnapshot after = CityInstrumentGetSnapshot();
+	checker.expect(after.apis[static_cast<len_t>(CityInstrumentApi::Hash64)].calls == 0, "reset did not clear the counts");
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
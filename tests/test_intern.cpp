@@ -0,0 +1,78 @@
+//////////////////////////////////////////////
+//	test_intern.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_intern.hpp"
+
+#include <random>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+std::vector<std::string> makeStrings(const len_t count, const ui64 seed) {
+	std::vector<std::string> strings;
+	strings.reserve(count);
+	std::mt19937_64 rng(seed);
+	for (len_t i = 0; i < count; ++i)
+		strings.push_back("/intern/" + std::to_string(rng() % 100000) + "/" + std::to_string(i));
+	return strings;
+}
+
+void checkInterner(Checker& checker, const std::vector<std::string>& strings) {
+	CityStringInterner interner;
+	for (const std::string& s : strings) {
+		const std::optional<CityHashedString> first = interner.intern(s.data(), s.size());
+		const std::optional<CityHashedString> again = interner.intern(CityHashedString(std::string_view(s)));
+		const ll_bool_t ok = first && again && first->begin() != s.data() && first->begin() == again->begin() &&
+			first->view() == s && first->begin()[s.size()] == '\0' &&
+			first->hash() == *city::CityHash64(s.data(), s.size());
+		if (!checker.expectThat(ok, [&]() { return "CityStringInterner::intern(\"" + s + "\")"; })) return;
+	}
+	checker.expect(interner.size() == strings.size() && !interner.find(CityHashedString("not interned", 12)), "CityStringInterner size/find");
+	checker.expect(!interner.intern(nullptr, 0) && interner.intern("", 0), "CityStringInterner null or empty string");
+}
+
+// Threads interning overlapping halves must agree on every pointer
+void checkThreads(Checker& checker, const std::vector<std::string>& strings) {
+	constexpr len_t THREADS = 8;
+	CityStringInterner shared(4);
+	std::vector<std::vector<ll_string_t>> seen(THREADS, std::vector<ll_string_t>(strings.size(), nullptr));
+	runThreads(THREADS, [&](const len_t t) {
+		for (len_t i = 0; i < strings.size(); ++i) {
+			const len_t index = (i + t * strings.size() / THREADS) % strings.size();
+			if (index % 2 != t % 2 && index % 3 != 0) continue;
+			const std::optional<CityHashedString> str = shared.intern(strings[index].data(), strings[index].size());
+			seen[t][index] = str ? str->begin() : nullptr;
+		}
+	});
+	checker.expect(shared.size() == strings.size(), "CityStringInterner size after threads");
+	for (len_t i = 0; i < strings.size(); ++i) {
+		const std::optional<CityHashedString> str = shared.find(CityHashedString(std::string_view(strings[i])));
+		ll_bool_t same = str.has_value();
+		for (len_t t = 0; t < THREADS; ++t)
+			same = same && (seen[t][i] == nullptr || seen[t][i] == str->begin());
+		if (!checker.expectThat(same, [&]() { return "CityStringInterner gave different copies of \"" + strings[i] + "\" to different threads"; })) return;
+	}
+}
+
+} // namespace
+
+bool runInternTests(const Options& options) {
+	const std::vector<std::string> strings = makeStrings(100000, options.seed);
+	Checker checker("intern", options);
+	checkInterner(checker, strings);
+	checkThreads(checker, strings);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,120 @@
+//////////////////////////////////////////////
+//	test_map.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_flat_map.hpp"
+
+#include <random>
+#include <string_view>
+#include <unordered_map>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+using FlatMap = city::CityFlatMap<ui64, ui64>;
+using StdMap = std::unordered_map<ui64, ui64, city::CityHasher>;
+
+// Random inserts and erases on a small key space (so deleted slots are
+//	reused and rehashed away) against std::unordered_map
+void checkRandomOps(Checker& checker, const ui64 seed) {
+	FlatMap flat;
+	StdMap reference;
+	std::mt19937_64 rng(seed);
+	for (len_t op = 0; op < 200000; ++op) {
+		const ui64 key = rng() % 3000;
+		const ui64 action = rng() % 4;
+		const auto at = [&](ll_string_t what) { return std::string(what) + " differs from std::unordered_map at op " + std::to_string(op); };
+		ll_bool_t ok = true;
+		if (action < 2) {
+			const auto [value, inserted] = flat.emplace(key, op);
+			const ll_bool_t expected = reference.emplace(key, op).second;
+			ok = checker.expectThat(value && inserted == expected && *value == reference[key], [&]() { return at("CityFlatMap::emplace"); });
+		}
+		else if (action == 2)
+			ok = checker.expectThat(flat.erase(key) == (reference.erase(key) == 1), [&]() { return at("CityFlatMap::erase"); });
+		else {
+			const ui64* value = flat.find(key);
+			const auto it = reference.find(key);
+			ok = checker.expectThat((value == nullptr) == (it == reference.end()) && (!value || *value == it->second),
+				[&]() { return at("CityFlatMap::find"); });
+		}
+		ok &= checker.expectThat(flat.size() == reference.size(), [&]() { return at("CityFlatMap::size"); });
+		if (!ok) return;
+	}
+	len_t visited = 0;
+	ll_bool_t same = true;
+	flat.forEach([&](const ui64 key, const ui64 value) {
+		++visited;
+		const auto it = reference.find(key);
+		same = same && it != reference.end() && it->second == value;
+	});
+	checker.expect(same && visited == reference.size(), "CityFlatMap::forEach differs from std::unordered_map");
+
+	// Copies, moves and lookups with another integer type
+	FlatMap copy(flat);
+	FlatMap moved(std::move(copy));
+	for (const auto& [key, value] : reference) {
+		const ui64* found = moved.find(static_cast<i32>(key));
+		if (!checker.expectThat(found && *found == value, [&]() { return "copied CityFlatMap lost key " + std::to_string(key); })) break;
+	}
+	moved.clear();
+	checker.expect(moved.empty() && !moved.contains(reference.begin()->first) && flat.contains(reference.begin()->first), "CityFlatMap::clear");
+}
+
+void checkStrings(Checker& checker) {
+	city::CityFlatMap<std::string, len_t> map;
+	city::CityFlatSet<std::string> set;
+	for (len_t i = 0; i < 5000; ++i) {
+		const std::string key = "key-" + std::to_string(i);
+		(void)map.emplace(std::string_view(key), i);
+		(void)set.insert(key);
+	}
+	for (len_t i = 0; i < 5000; ++i) {
+		const std::string key = "key-" + std::to_string(i);
+		const meta::StrPair pair(key.data(), key.size());
+		const len_t* by_view = map.find(std::string_view(key));
+		const len_t* by_pair = map.find(pair);
+		const len_t* by_c_str = map.find(key.c_str());
+		if (!checker.expectThat(by_view && *by_view == i && by_pair == by_view && by_c_str == by_view && set.contains(pair),
+			[&]() { return "CityFlatMap heterogeneous lookup of \"" + key + "\""; })) break;
+	}
+	checker.expect(!map.find("key-5000") && map.erase(std::string_view("key-17")) && !map.contains("key-17") &&
+		set.erase("key-17") && !set.contains(std::string_view("key-17")) && map.size() == 4999 && set.size() == 4999,
+		"CityFlatMap string erase");
+
+	// A null C string hashes, compares and is stored as the empty string
+	constexpr ll_string_t null = nullptr;
+	ll_char_t* null_mutable = nullptr;
+	const city::CityHasher hasher;
+	const city::CityKeyEqual equal;
+	checker.expect(hasher(null) == hasher(std::string_view()) && hasher(null_mutable) == hasher(std::string()),
+		"CityHasher of a null C string is not the hash of the empty string");
+	checker.expect(equal(null, "") && equal(std::string(), null_mutable) && !equal(null, "key-1"),
+		"CityKeyEqual does not compare a null C string as the empty string");
+	checker.expect(!map.contains(null) && map.emplace(std::string(), 42).second && map.contains(null) &&
+		*map.find(null) == 42 && !map.emplace(null, 7).second && map.erase(null) && !map.contains(""),
+		"CityFlatMap lookups of a null C string");
+	checker.expect(set.insert(null).second && set.contains("") && set.contains(std::string_view()) && !set.insert("").second,
+		"CityFlatSet insertion of a null C string");
+}
+
+} // namespace
+
+bool runMapTests(const Options& options) {
+	Checker checker("map", options);
+	checkRandomOps(checker, options.seed);
+	checkStrings(checker);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
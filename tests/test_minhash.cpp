@@ -0,0 +1,151 @@
+//////////////////////////////////////////////
+//	test_minhash.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_minhash.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+constexpr ui32 SEEDS = 128;
+
+ll_string_t kernelName(const BatchKernel kernel) noexcept {
+	switch (kernel) {
+		case BatchKernel::Scalar:	return "scalar";
+		case BatchKernel::Avx2:		return "avx2";
+		case BatchKernel::Avx512:	return "avx512";
+		default:					return "auto";
+	}
+}
+
+void checkSeedsMulti(Checker& checker, const std::vector<ll_char_t>& data) {
+	constexpr BatchKernel KERNELS[] = { BatchKernel::Auto, BatchKernel::Scalar, BatchKernel::Avx2, BatchKernel::Avx512 };
+	constexpr len_t N = 131;	// Not a multiple of any lane count
+	std::vector<ui64> seeds0(N), seeds1(N), out(N);
+	for (len_t i = 0; i < N; ++i) {
+		seeds0[i] = city::CityHash64Key(i);
+		seeds1[i] = city::CityHash64Key(i + N);
+	}
+	for (const BatchKernel kernel : KERNELS) {
+		for (const len_t len : { len_t(0), len_t(3), len_t(16), len_t(64), len_t(1000) }) {
+			for (const ui64* s0 : { static_cast<const ui64*>(nullptr), static_cast<const ui64*>(seeds0.data()) }) {
+				if (!city::CityHash64WithSeedsMulti(data.data(), len, s0, seeds1.data(), out.data(), N, kernel)) {
+					// Not supported by this CPU
+					checker.expectThat(kernel != BatchKernel::Scalar && kernel != BatchKernel::Auto, [&]() {
+						return std::string("CityHash64WithSeedsMulti refused the ") + kernelName(kernel) + " kernel";
+					});
+					continue;
+				}
+				for (len_t i = 0; i < N; ++i) {
+					const ui64 expected = (s0
+						? *city::CityHash64WithSeeds(data.data(), len, seeds0[i], seeds1[i])
+						: *city::CityHash64WithSeed(data.data(), len, seeds1[i])).get();
+					if (!checker.expectThat(out[i] == expected, [&]() {
+						return std::string("CityHash64WithSeedsMulti (") + kernelName(kernel) + ") differs at seed " + std::to_string(i) +
+							" of a " + std::to_string(len) + "-byte key";
+					})) break;
+				}
+			}
+		}
+	}
+	checker.expect(!city::CityHash64WithSeedsMulti(nullptr, 0, nullptr, seeds1.data(), out.data(), N) &&
+		!city::CityHash64WithSeedsMulti(data.data(), 1, nullptr, nullptr, out.data(), N),
+		"CityHash64WithSeedsMulti accepted a null argument");
+}
+
+void checkSignature(Checker& checker, const std::vector<ll_char_t>& data) {
+	const CityMinHash minhash(SEEDS, 42);
+	// Overlapping 8-byte shingles of a 1000-byte document
+	constexpr len_t W = 8;
+	constexpr len_t LEN = 1000;
+	std::vector<ll_string_t> ptrs(LEN - W + 1);
+	std::vector<len_t> lens(ptrs.size(), W);
+	std::vector<ui64> hashes(ptrs.size());
+	for (len_t i = 0; i < ptrs.size(); ++i) {
+		ptrs[i] = data.data() + i;
+		hashes[i] = city::CityHash64Unchecked(ptrs[i], W);
+	}
+	std::vector<ui64> expected(SEEDS, ~ui64(0)), sig(SEEDS), from_hashes(SEEDS), from_shingles(SEEDS);
+	for (ui32 k = 0; k < SEEDS; ++k)
+		for (const ll_string_t p : ptrs)
+			expected[k] = std::min(expected[k], city::CityHash64WithSeedUnchecked(p, W, minhash.getSeeds()[k]));
+	checker.expect(minhash.signature(ptrs.data(), lens.data(), ptrs.size(), sig.data()) && sig == expected,
+		"CityMinHash::signature differs from a CityHash64WithSeed per seed");
+	checker.expect(minhash.signatureHashes(hashes.data(), hashes.size(), from_hashes.data()) && from_hashes == expected,
+		"CityMinHash::signatureHashes differs from a CityHash64WithSeed per seed");
+	checker.expect(minhash.signatureShingles(data.data(), LEN, W, from_shingles.data()) && from_shingles == expected,
+		"CityMinHash::signatureShingles differs from a CityHash64WithSeed per seed");
+}
+
+// Two sets of 20000 shingles (8-byte integers) with a given Jaccard similarity
+void checkSimilarity(Checker& checker) {
+	constexpr ui32 K = 512;
+	constexpr len_t SET = 20000;
+	const CityMinHash minhash(K);
+	for (const f64 jaccard : { 0.1, 0.5, 0.9 }) {
+		// |A & B| / |A | B| = shared / (2 * SET - shared)
+		const len_t shared = static_cast<len_t>(std::llround(2.0 * SET * jaccard / (1.0 + jaccard)));
+		std::vector<ui64> a(SET), b(SET);
+		for (len_t i = 0; i < SET; ++i) {
+			a[i] = city::CityHash64Key(i);
+			b[i] = city::CityHash64Key(i < shared ? i : i + SET);
+		}
+		std::vector<ui64> sig_a(K), sig_b(K);
+		(void)minhash.signatureHashes(a.data(), SET, sig_a.data());
+		(void)minhash.signatureHashes(b.data(), SET, sig_b.data());
+		const f64 exact = static_cast<f64>(shared) / static_cast<f64>(2 * SET - shared);
+		const f64 estimate = CityMinHashSimilarity(sig_a.data(), sig_b.data(), K);
+		const std::string at = "Jaccard " + std::to_string(exact);
+		checker.expectThat(std::fabs(estimate - exact) < 0.1, [&]() { return "MinHash estimate " + std::to_string(estimate) + " of " + at; });
+		for (const ui32 bits : { 1u, 2u, 8u }) {
+			std::vector<ui64> packed_a(CityMinHashPackedWords(K, bits)), packed_b(packed_a.size());
+			(void)CityMinHashPack(sig_a.data(), K, bits, packed_a.data());
+			(void)CityMinHashPack(sig_b.data(), K, bits, packed_b.data());
+			const f64 packed = CityMinHashPackedSimilarity(packed_a.data(), packed_b.data(), K, bits);
+			// 1-bit values match half the time by chance: twice the noise
+			checker.expectThat(std::fabs(packed - exact) < (bits == 1 ? 0.2 : 0.1), [&]() {
+				return std::to_string(bits) + "-bit MinHash estimate " + std::to_string(packed) + " of " + at;
+			});
+		}
+
+		// 32 bands of 4 rows (of the first 128 values)
+		ui64 bands_a[32], bands_b[32];
+		(void)CityLshBands(sig_a.data(), 32, 4, bands_a);
+		(void)CityLshBands(sig_b.data(), 32, 4, bands_b);
+		len_t matching = 0;
+		for (len_t i = 0; i < 32; ++i) matching += bands_a[i] == bands_b[i];
+		// A 0.9 pair matches some band except with probability ~1e-28, a 0.1 pair
+		//	matches one with probability ~0.3%
+		checker.expectThat(!(jaccard > 0.8 && matching == 0) && !(jaccard < 0.2 && matching > 1), [&]() {
+			return "CityLshBands matched " + std::to_string(matching) + " bands of a " + at + " pair";
+		});
+	}
+	checker.expect(std::fabs(CityLshProbability(0.5, 20, 5) - (1.0 - std::pow(1.0 - 1.0 / 32.0, 20.0))) <= 1e-12, "CityLshProbability");
+}
+
+} // namespace
+
+bool runMinHashTests(const Options& options) {
+	std::vector<ll_char_t> data(1 << 16);
+	fillTestData(data);
+	Checker checker("minhash", options);
+	checkSeedsMulti(checker, data);
+	checkSignature(checker, data);
+	checkSimilarity(checker);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
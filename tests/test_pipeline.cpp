@@ -0,0 +1,161 @@
+//////////////////////////////////////////////
+//	test_pipeline.cpp						//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_pipeline.hpp"
+
+#include <random>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+constexpr ui64 NOT_FOUND = ~ui64(0);
+
+// Open addressing with linear probing.  Keys are the 8 bytes of an integer,
+//	identified by their CityHash64 (0 marks an empty bucket).
+struct Bucket {
+	ui64 tag;
+	ui64 value;
+};
+
+__LL_NODISCARD__ __LL_INLINE__ ui64 TagOf(const ui64 hash) noexcept { return hash ? hash : 1; }
+
+class Table {
+	private:
+		std::vector<Bucket> buckets;
+		len_t mask;
+
+	public:
+		explicit Table(const len_t bits) : buckets(len_t(1) << bits, Bucket{ 0, 0 }), mask((len_t(1) << bits) - 1) {}
+		__LL_NODISCARD__ len_t capacity() const noexcept { return this->mask + 1; }
+
+		void insert(const ui64 hash, const ui64 value) noexcept {
+			const ui64 tag = TagOf(hash);
+			const Bucket* b = this->locate(hash);
+			while (b->tag != 0 && b->tag != tag) b = this->next(b);
+			this->buckets[static_cast<len_t>(b - this->buckets.data())] = Bucket{ tag, value };
+		}
+		__LL_NODISCARD__ const Bucket* locate(const ui64 hash) const noexcept {
+			return this->buckets.data() + (hash & this->mask);
+		}
+		__LL_NODISCARD__ const Bucket* next(const Bucket* b) const noexcept {
+			return this->buckets.data() + ((static_cast<len_t>(b - this->buckets.data()) + 1) & this->mask);
+		}
+		// Checks one bucket: nullptr once the key is found (out = its value)
+		//	or known to be missing (out = NOT_FOUND), else the next bucket
+		__LL_NODISCARD__ const Bucket* probe(const ui64 hash, const Bucket* b, ui64& out) const noexcept {
+			if (b->tag == TagOf(hash)) out = b->value;
+			else if (b->tag == 0) out = NOT_FOUND;
+			else return this->next(b);
+			return nullptr;
+		}
+};
+
+// Integer keys looked up as 8-byte strings
+struct Queries {
+	std::vector<ui64> keys;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+
+	Queries(const len_t n, const ui64 key_space, const ui64 seed)
+		: keys(n), ptrs(n), lens(n, sizeof(ui64))
+	{
+		std::mt19937_64 rng(seed);
+		for (len_t i = 0; i < n; ++i) {
+			this->keys[i] = rng() % key_space;
+			this->ptrs[i] = reinterpret_cast<ll_string_t>(&this->keys[i]);
+		}
+	}
+};
+
+__LL_NODISCARD__ ui64 HashKey(const ui64& key) noexcept {
+	return city::CityHash64(reinterpret_cast<ll_string_t>(&key), sizeof(key))->get();
+}
+
+// Keys 0 to inserted - 1 map to themselves; probe calls are counted per key
+struct Lookups {
+	std::vector<ui64> out;
+	std::vector<len_t> probes;
+	std::vector<len_t> finished;
+	ll_bool_t accepted;
+};
+
+Lookups lookup(const Table& table, const Queries& queries, const len_t window) {
+	const len_t n = queries.ptrs.size();
+	Lookups result{ std::vector<ui64>(n, 0), std::vector<len_t>(n, 0), std::vector<len_t>(n, 0), false };
+	result.accepted = city::CityLookupPipeline(queries.ptrs.data(), queries.lens.data(), n,
+		[&](const ui64 hash) noexcept -> const void* { return table.locate(hash); },
+		[&](const len_t i, const ui64 hash, const void* bucket) noexcept -> const void* {
+			++result.probes[i];
+			const Bucket* next = table.probe(hash, static_cast<const Bucket*>(bucket), result.out[i]);
+			if (!next) ++result.finished[i];
+			return next;
+		}, window);
+	return result;
+}
+
+} // namespace
+
+bool runPipelineTests(const Options& options) {
+	Checker checker("pipeline", options);
+	Table table(12);
+	const len_t inserted = table.capacity() / 2;
+	for (ui64 key = 0; key < inserted; ++key) table.insert(HashKey(key), key);
+
+	// Every window, clamped ones included, finds what the plain loop of a
+	//	window of 1 finds, and every lookup ends exactly once
+	const Queries queries(5000, 2 * inserted, options.seed);
+	const Lookups plain = lookup(table, queries, 1);
+	constexpr len_t WINDOWS[] = { 0, 1, 2, 3, 16, 63, 64, CITYHASH_PIPELINE_DEFAULT_WINDOW, CITYHASH_PIPELINE_MAX_WINDOW, 1000 };
+	for (const len_t window : WINDOWS) {
+		const Lookups result = window == 1 ? plain : lookup(table, queries, window);
+		const std::string name = "CityLookupPipeline window=" + std::to_string(window);
+		checker.expect(result.accepted, name + " rejected valid keys");
+		checker.expect(result.out == plain.out && result.probes == plain.probes, name + " differs from a window of 1");
+		for (len_t i = 0; i < queries.keys.size(); ++i) {
+			const ui64 expected = queries.keys[i] < inserted ? queries.keys[i] : NOT_FOUND;
+			if (!checker.expectThat(result.out[i] == expected && result.finished[i] == 1, [&]() {
+				return name + " found " + std::to_string(result.out[i]) + " for key " + std::to_string(queries.keys[i]);
+			})) break;
+		}
+	}
+
+	// Null keys are skipped and never probed, every other key is still
+	//	looked up once
+	for (const len_t window : { len_t(1), CITYHASH_PIPELINE_DEFAULT_WINDOW }) {
+		Queries with_nulls(200, 2 * inserted, options.seed + 1);
+		for (len_t i = 0; i < with_nulls.ptrs.size(); i += 7) with_nulls.ptrs[i] = nullptr;
+		const Lookups result = lookup(table, with_nulls, window);
+		checker.expect(!result.accepted, "CityLookupPipeline accepted null keys, window=" + std::to_string(window));
+		for (len_t i = 0; i < with_nulls.ptrs.size(); ++i) {
+			const ui64 expected = with_nulls.keys[i] < inserted ? with_nulls.keys[i] : NOT_FOUND;
+			const ll_bool_t ok = with_nulls.ptrs[i] ? result.finished[i] == 1 && result.out[i] == expected : result.probes[i] == 0;
+			if (!checker.expectThat(ok, [&]() {
+				return "CityLookupPipeline with null keys, key " + std::to_string(i) + " window=" + std::to_string(window);
+			})) break;
+		}
+	}
+
+	// An empty batch is accepted without a call; null arrays are not
+	len_t calls = 0;
+	const auto locate = [&](const ui64) noexcept -> const void* { ++calls; return nullptr; };
+	const auto probe = [&](const len_t, const ui64, const void*) noexcept -> const void* { ++calls; return nullptr; };
+	checker.expect(city::CityLookupPipeline(queries.ptrs.data(), queries.lens.data(), 0, locate, probe) && calls == 0,
+		"CityLookupPipeline rejected an empty batch");
+	checker.expect(!city::CityLookupPipeline(nullptr, queries.lens.data(), 1, locate, probe) &&
+		!city::CityLookupPipeline(queries.ptrs.data(), nullptr, 1, locate, probe) && calls == 0,
+		"CityLookupPipeline accepted null arrays");
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
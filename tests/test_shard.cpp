@@ -0,0 +1,150 @@
+//////////////////////////////////////////////
+//	test_shard.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+#include "../llcityhash/city_shard.hpp"
+
+#include <cmath>
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+constexpr len_t KEY_SIZE = 16;
+
+struct ShardKeys {
+	std::vector<ll_char_t> data;
+	std::vector<ll_string_t> ptrs;
+	std::vector<len_t> lens;
+	std::vector<ui64> hashes;
+};
+
+ShardKeys makeKeys(const len_t n) {
+	ShardKeys keys;
+	keys.data.resize(n * KEY_SIZE);
+	fillTestData(keys.data);
+	keys.ptrs.resize(n);
+	keys.lens.assign(n, KEY_SIZE);
+	keys.hashes.resize(n);
+	for (len_t i = 0; i < n; ++i) {
+		keys.ptrs[i] = keys.data.data() + i * KEY_SIZE;
+		keys.hashes[i] = city::CityHash64Unchecked(keys.ptrs[i], KEY_SIZE);
+	}
+	return keys;
+}
+
+std::vector<ui64> makeIds(const ui32 count) {
+	std::vector<ui64> ids(count);
+	for (ui32 i = 0; i < count; ++i) ids[i] = 0x5eed000000000000ull + i;
+	return ids;
+}
+
+// Largest relative gap between a node's share and its expected one
+f64 worstShare(const std::vector<ui32>& nodes, const std::vector<f64>& expected) {
+	std::vector<f64> counts(expected.size(), 0.0);
+	for (const ui32 node : nodes) counts[node] += 1.0;
+	f64 worst = 0.0;
+	for (len_t i = 0; i < expected.size(); ++i) {
+		const f64 gap = std::fabs(counts[i] / static_cast<f64>(nodes.size()) - expected[i]) / expected[i];
+		worst = gap > worst ? gap : worst;
+	}
+	return worst;
+}
+
+void checkJump(Checker& checker, const ShardKeys& keys) {
+	const len_t n = keys.hashes.size();
+	std::vector<ui32> out(n);
+	checker.expect(city::CityJumpHashBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n, 1000), "CityJumpHashBatch");
+	for (len_t i = 0; i < n; ++i) {
+		const ui32 bucket = city::CityJumpHash(keys.hashes[i], 1000);
+		// Adding a bucket moves a key to the new bucket or nowhere
+		const ui32 grown = city::CityJumpHash(keys.hashes[i], 1001);
+		if (!checker.expectThat(out[i] == bucket && *city::CityJumpHash(keys.ptrs[i], KEY_SIZE, 1000) == bucket &&
+			(grown == bucket || grown == 1000), [&]() { return "CityJumpHash of key " + std::to_string(i); }))
+			break;
+	}
+	std::vector<ui32> nodes(n);
+	for (len_t i = 0; i < n; ++i) nodes[i] = city::CityJumpHash(keys.hashes[i], 10);
+	checker.expect(worstShare(nodes, std::vector<f64>(10, 0.1)) <= 0.05, "CityJumpHash balance");
+	checker.expect(city::CityJumpHash(keys.hashes[0], 0) == 0, "CityJumpHash of no buckets");
+}
+
+void checkRendezvous(Checker& checker, const ShardKeys& keys) {
+	const len_t n = keys.hashes.size();
+	const std::vector<ui64> ids = makeIds(10);
+	const CityRendezvous all(ids.data(), 10);
+	// Node 3 leaves: only its keys move
+	std::vector<ui64> fewer_ids = ids;
+	fewer_ids.erase(fewer_ids.begin() + 3);
+	const CityRendezvous fewer(fewer_ids.data(), 9);
+	std::vector<ui32> out(n);
+	checker.expect(all.pickBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n), "CityRendezvous::pickBatch");
+	for (len_t i = 0; i < n; ++i) {
+		const ui32 node = all.pick(keys.hashes[i]);
+		const ui32 after = fewer.pick(keys.hashes[i]);
+		if (!checker.expectThat(out[i] == node && (node == 3 || fewer_ids[after] == ids[node]), [&]() {
+			return "CityRendezvous moved key " + std::to_string(i);
+		})) break;
+	}
+	checker.expect(worstShare(out, std::vector<f64>(10, 0.1)) <= 0.05, "CityRendezvous balance");
+
+	const f64 weights[] = { 1.0, 2.0, 3.0, 4.0 };
+	const CityRendezvous weighted(ids.data(), 4, weights);
+	checker.expect(weighted.pickBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n), "weighted CityRendezvous::pickBatch");
+	std::vector<ui32> single(n);
+	for (len_t i = 0; i < n; ++i) single[i] = weighted.pick(keys.hashes[i]);
+	checker.expect(single == out && worstShare(out, { 0.1, 0.2, 0.3, 0.4 }) <= 0.05, "weighted CityRendezvous shares");
+	const f64 bad_weights[] = { 1.0, 0.0 };
+	checker.expect(CityRendezvous(ids.data(), 2, bad_weights).nodeCount() == 0 && CityRendezvous(nullptr, 0).pick(1) == CITYHASH_SHARD_NONE,
+		"CityRendezvous accepted a zero weight or no nodes");
+}
+
+void checkMaglev(Checker& checker, const ShardKeys& keys) {
+	const len_t n = keys.hashes.size();
+	const std::vector<ui64> ids = makeIds(100);
+	const CityMaglev all(ids.data(), 100);
+	std::vector<ui64> fewer_ids = ids;
+	fewer_ids.erase(fewer_ids.begin() + 42);
+	const CityMaglev fewer(fewer_ids.data(), 99);
+	std::vector<ui32> out(n);
+	if (!checker.expect(all.tableSize() == 65537 && all.nodeCount() == 100 &&
+		all.pickBatch(keys.ptrs.data(), keys.lens.data(), out.data(), n), "CityMaglev table"))
+		return;
+	len_t moved = 0, others = 0;
+	for (len_t i = 0; i < n; ++i) {
+		const ui32 node = all.pick(keys.hashes[i]);
+		if (!checker.expectThat(out[i] == node && node < 100, [&]() { return "CityMaglev::pickBatch differs at key " + std::to_string(i); }))
+			return;
+		if (node == 42) continue;
+		++others;
+		moved += fewer_ids[fewer.pick(keys.hashes[i])] != ids[node];
+	}
+	// Maglev trades a little disruption for balance: a few percent of the
+	//	keys of the remaining nodes move
+	checker.expectThat(static_cast<f64>(moved) <= 0.05 * static_cast<f64>(others), [&]() {
+		return "CityMaglev moved " + std::to_string(moved) + " of " + std::to_string(others) + " keys";
+	});
+	checker.expect(worstShare(out, std::vector<f64>(100, 0.01)) <= 0.1, "CityMaglev balance");
+}
+
+} // namespace
+
+bool runShardTests(const Options& options) {
+	const ShardKeys keys = makeKeys(len_t(1) << 20);
+	Checker checker("shard", options);
+	checkJump(checker, keys);
+	checkRendezvous(checker, keys);
+	checkMaglev(checker, keys);
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,99 @@
+//////////////////////////////////////////////
+//	test_tree.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+#include "test.hpp"
+
+namespace llcpp {
+namespace city {
+namespace test {
+
+namespace {
+
+constexpr len_t LEAF = 4096;
+
+// The layout documented in city.hpp, computed one leaf at a time
+hash::Hash128 referenceTree(ll_string_t s, const len_t len, const len_t leaf_size) {
+	std::vector<ll_char_t> digests;
+	for (len_t begin = 0, leaf = 0; begin < len; begin += leaf_size, ++leaf) {
+		const len_t size = len - begin < leaf_size ? len - begin : leaf_size;
+		const hash::Hash128 h = *city::CityHash128WithSeed(s + begin, size, hash::Hash128(leaf, leaf_size));
+		for (const ui64 half : { h.getLow(), h.getHigh() })
+			for (len_t i = 0; i < 8; ++i) digests.push_back(static_cast<ll_char_t>(half >> (8 * i)));
+	}
+	ll_char_t empty = 0;
+	return *city::CityHash128WithSeed(digests.empty() ? &empty : digests.data(), digests.size(), hash::Hash128(len, city::CITYHASH_TREE_VERSION));
+}
+
+struct Change {
+	ll_string_t name;
+	len_t begin, end, new_len;
+};
+
+// Applied one after another to a buffer of 64 leaves
+constexpr Change CHANGES[] = {
+	{ "one byte", 10, 11, 64 * LEAF },
+	{ "across two leaves", LEAF - 8, LEAF + 8, 64 * LEAF },
+	{ "append covered by the range", 64 * LEAF, 66 * LEAF + 5, 66 * LEAF + 5 },
+	// The new bytes and the old partial last leaf are rehashed anyway
+	{ "append outside the range", 10, 11, 67 * LEAF + 100 },
+	{ "append, nothing changed", 0, 0, 68 * LEAF },
+	{ "truncate inside a leaf", 0, 0, 60 * LEAF + 7 },
+	{ "truncate, range past the end", 61 * LEAF, 63 * LEAF, 59 * LEAF },
+	{ "truncate to nothing", 0, 0, 0 },
+	{ "grow from nothing", 0, 0, 3 * LEAF + 1 },
+	{ "nothing", 2 * LEAF, 2 * LEAF, 3 * LEAF + 1 },
+};
+constexpr len_t MAX_LEN = 68 * LEAF;
+
+} // namespace
+
+bool runTreeTests(const Options& options) {
+	std::vector<ll_char_t> buffer(MAX_LEN);
+	fillTestData(buffer);
+	Checker checker("tree", options);
+
+	constexpr len_t LENGTHS[] = { 0, 1, LEAF - 1, LEAF, LEAF + 1, 5 * LEAF + LEAF / 2, 64 * LEAF };
+	constexpr len_t THREADS[] = { 1, 2, 3, 8, 0 };
+	for (const len_t len : LENGTHS) {
+		const hash::Hash128 expected = referenceTree(buffer.data(), len, LEAF);
+		for (const len_t threads : THREADS) {
+			const hash::OptionalHash128 h = city::CityHashTree(buffer.data(), len, LEAF, threads);
+			checker.expectThat(h && *h == expected, [&]() {
+				return "CityHashTree differs from its layout at len=" + std::to_string(len) + " threads=" + std::to_string(threads);
+			});
+		}
+	}
+
+	// Partial updates against a full hash of the changed buffer
+	std::vector<hash::Hash128> leaves(city::CityHashTreeLeafCount(MAX_LEN, LEAF));
+	len_t len = 64 * LEAF;
+	(void)city::CityHashTree(buffer.data(), len, leaves.data(), LEAF, 0);
+	len_t threads = 0;
+	for (const Change& change : CHANGES) {
+		for (len_t i = change.begin; i < change.end && i < change.new_len; ++i) buffer[i] ^= 0x5a;
+		const hash::OptionalHash128 updated = city::CityHashTreeUpdate(buffer.data(), change.new_len, leaves.data(), len, change.begin, change.end, LEAF, threads);
+		const hash::Hash128 expected = referenceTree(buffer.data(), change.new_len, LEAF);
+		checker.expectThat(updated && *updated == expected, [&]() {
+			return std::string("CityHashTreeUpdate differs from CityHashTree: ") + change.name;
+		});
+		len = change.new_len;
+		threads = threads ? 0 : 3;
+	}
+
+	const ll_string_t null = nullptr;
+	checker.expect(!city::CityHashTree(null, 0) && !city::CityHashTree(buffer.data(), 1, len_t(0), 1), "CityHashTree accepted a null input or leaf_size 0");
+	checker.expect(!city::CityHashTree(buffer.data(), 1, nullptr, LEAF) &&
+		!city::CityHashTreeUpdate(buffer.data(), 1, nullptr, 1, 0, 1, LEAF) &&
+		!city::CityHashTreeUpdate(null, 1, leaves.data(), 1, 0, 1, LEAF) &&
+		!city::CityHashTreeUpdate(buffer.data(), 1, leaves.data(), 1, 0, 1, 0),
+		"CityHashTreeUpdate accepted null arrays or leaf_size 0");
+	return checker.finish();
+}
+
+} // namespace test
+} // namespace city
+} // namespace llcpp
@@ -0,0 +1,341 @@
+//////////////////////////////////////////////
+//	cityhashsum.cpp							//
+//											//
+//	Author: Francisco Julio Ruiz Fernandez	//
+//	Author: llanyro							//
+//////////////////////////////////////////////
+
+// Prints or checks CityHash digests of files, in the format of sha256sum.
+// Files are mapped with mmap and hashed in parallel, one file per task.
+
+#include "../llcityhash/city.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/resource.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define LL_CITY_SUM_POSIX
+#endif // POSIX
+
+namespace {
+
+namespace city = llcpp::city;
+namespace hash = llcpp::meta::hash;
+
+enum class Algorithm {
+	City64,
+	City128,
+	Crc128
+};
+
+struct Options {
+	Algorithm algorithm;
+	len_t threads;
+	bool check;				// Inputs are checksum files
+	bool quiet;				// --check: do not print OK lines
+	bool stats;				// Print throughput to stderr
+	std::vector<std::string> inputs;
+};
+
+struct Job {
+	Algorithm algorithm;
+	std::string path;
+	std::string expected;	// --check only
+	std::string digest;
+	std::string error;		// Empty on success
+	len_t bytes;
+};
+
+#pragma region Hashing
+std::string toHex(const hash::Hash64& h) {
+	char buffer[17];
+	std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(h.get()));
+	return buffer;
+}
+std::string toHex(const hash::Hash128& h) {
+	char buffer[33];
+	std::snprintf(buffer, sizeof(buffer), "%016llx%016llx",
+		static_cast<unsigned long long>(h.getHigh()), static_cast<unsigned long long>(h.getLow()));
+	return buffer;
+}
+
+std::string digestOf(const Algorithm algorithm, ll_string_t s, const len_t len) {
+	switch (algorithm) {
+		case Algorithm::City64:		return toHex(*city::CityHash64(s, len));
+		case Algorithm::Crc128:		return toHex(*city::CityHashCrc128(s, len));
+		case Algorithm::City128:
+		default:					return toHex(*city::CityHash128(s, len));
+	}
+}
+
+// Reads a whole stream; used for stdin, pipes and files mmap refuses
+bool readAll(std::FILE* file, std::vector<ll_char_t>& data) {
+	ll_char_t chunk[1 << 16];
+	len_t read = 0;
+	while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+		data.insert(data.end(), chunk, chunk + read);
+	return !std::ferror(file);
+}
+
+void hashJob(Job& job) {
+	// Any non-null pointer does for empty inputs
+	static constexpr ll_char_t EMPTY[1] = {};
+	std::vector<ll_char_t> data;
+
+	if (job.path == "-") {
+		if (!readAll(stdin, data)) {
+			job.error = std::strerror(errno);
+			return;
+		}
+	}
+	else {
+#if defined(LL_CITY_SUM_POSIX)
+		const int fd = ::open(job.path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			job.error = std::strerror(errno);
+			return;
+		}
+		struct stat st{};
+		if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			const len_t size = static_cast<len_t>(st.st_size);
+			void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (map != MAP_FAILED) {
+				::close(fd);
+				// Read-ahead as far as the kernel allows; THP for the page cache
+				//	is only honoured by some kernels and filesystems
+				(void)::madvise(map, size, MADV_SEQUENTIAL);
+	#if defined(MADV_HUGEPAGE)
+				(void)::madvise(map, size, MADV_HUGEPAGE);
+	#endif // MADV_HUGEPAGE
+				job.digest = digestOf(job.algorithm, static_cast<ll_string_t>(map), size);
+				job.bytes = size;
+				(void)::munmap(map, size);
+				return;
+			}
+		}
+		::close(fd);
+#endif // LL_CITY_SUM_POSIX
+		std::FILE* file = std::fopen(job.path.c_str(), "rb");
+		if (!file) {
+			job.error = std::strerror(errno);
+			return;
+		}
+		const bool ok = readAll(file, data);
+		std::fclose(file);
+		if (!ok) {
+			job.error = "read error";
+			return;
+		}
+	}
+	job.digest = digestOf(job.algorithm, data.empty() ? EMPTY : data.data(), data.size());
+	job.bytes = data.size();
+}
+
+// Every worker takes the next pending file until none is left, so one big
+//	file never holds back the small ones behind it
+void hashAll(const Options& options, std::vector<Job>& jobs) {
+	std::atomic<len_t> next{ 0 };
+	auto worker = [&]() {
+		for (len_t i = next++; i < jobs.size(); i = next++)
+			hashJob(jobs[i]);
+	};
+	len_t threads = options.threads < jobs.size() ? options.threads : jobs.size();
+	std::vector<std::thread> pool;
+	for (len_t i = 1; i < threads; ++i) pool.emplace_back(worker);
+	worker();
+	for (std::thread& t : pool) t.join();
+}
+
+#pragma endregion
+#pragma region Check
+// Lines are "<digest>  <path>" or "<digest> *<path>", as sha256sum writes them
+bool parseChecksumLine(const std::string& line, Job& job) {
+	const len_t space = line.find(' ');
+	if (space == std::string::npos || space + 2 > line.size()) return false;
+	if (line[space + 1] != ' ' && line[space + 1] != '*') return false;
+	job.expected = line.substr(0, space);
+	job.path = line.substr(space + 2);
+	if (!job.path.empty() && job.path.back() == '\r') job.path.pop_back();
+	return !job.path.empty();
+}
+
+// Reads one line without the trailing newline; false at end of file
+bool readLine(std::FILE* file, std::string& line) {
+	line.clear();
+	int c = 0;
+	while ((c = std::fgetc(file)) != EOF && c != '\n')
+		line.push_back(static_cast<ll_char_t>(c));
+	return c != EOF || !line.empty();
+}
+
+// 16 hex digits are CityHash64; 32 are CityHash128, or CityHashCrc128 if
+//	that was requested
+bool algorithmOf(const Options& options, const std::string& digest, Algorithm& algorithm) {
+	for (const ll_char_t c : digest)
+		if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) return false;
+	if (digest.size() == 16) algorithm = Algorithm::City64;
+	else if (digest.size() == 32) algorithm = options.algorithm == Algorithm::Crc128 ? Algorithm::Crc128 : Algorithm::City128;
+	else return false;
+	return true;
+}
+
+bool readChecksumFile(const Options& options, const std::string& input, std::vector<Job>& jobs, len_t& malformed) {
+	std::FILE* file = input == "-" ? stdin : std::fopen(input.c_str(), "r");
+	if (!file) {
+		std::fprintf(stderr, "cityhashsum: %s: %s\n", input.c_str(), std::strerror(errno));
+		return false;
+	}
+	std::string line;
+	while (readLine(file, line)) {
+		if (line.empty()) continue;
+		Job job{};
+		if (!parseChecksumLine(line, job) || !algorithmOf(options, job.expected, job.algorithm)) ++malformed;
+		else jobs.push_back(std::move(job));
+	}
+	if (file != stdin) std::fclose(file);
+	return true;
+}
+
+#pragma endregion
+#pragma region Stats
+struct Usage {
+	f64 user;		// Seconds in user space: hashing
+	f64 system;		// Seconds in the kernel: page faults, reads
+	long major_faults;
+};
+
+Usage getUsage() noexcept {
+	Usage result{};
+#if defined(LL_CITY_SUM_POSIX)
+	struct rusage usage{};
+	(void)::getrusage(RUSAGE_SELF, &usage);
+	result.user = static_cast<f64>(usage.ru_utime.tv_sec) + static_cast<f64>(usage.ru_utime.tv_usec) * 1e-6;
+	result.system = static_cast<f64>(usage.ru_stime.tv_sec) + static_cast<f64>(usage.ru_stime.tv_usec) * 1e-6;
+	result.major_faults = usage.ru_majflt;
+#endif // LL_CITY_SUM_POSIX
+	return result;
+}
+
+// Threads busy for most of the wall time are limited by the CPU: by the hash
+//	if user time dominates, by page faults and copies if system time does.
+//	Idle threads are waiting for the disk.
+void printStats(const Options& options, const std::vector<Job>& jobs, const f64 wall, const Usage& begin, const Usage& end) noexcept {
+	len_t bytes = 0;
+	for (const Job& job : jobs) bytes += job.bytes;
+	len_t threads = options.threads < jobs.size() ? options.threads : jobs.size();
+	if (threads == 0) threads = 1;
+	const f64 user = end.user - begin.user;
+	const f64 system = end.system - begin.system;
+	// Threads beyond the core count cannot be busy at the same time
+	len_t cores = std::thread::hardware_concurrency();
+	if (cores == 0 || cores > threads) cores = threads;
+	const f64 busy = wall > 0 ? 100.0 * (user + system) / (wall * static_cast<f64>(cores)) : 0.0;
+	ll_string_t bound = busy < 80.0 ? "io" : (system > user ? "kernel" : "cpu");
+	std::fprintf(stderr,
+		"cityhashsum: %zu files, %.3f GB in %.3f s: %.3f GB/s\n"
+		"cityhashsum: %zu threads on %zu cores %.0f%% busy (user %.3f s, sys %.3f s), %ld major faults: %s-bound\n",
+		jobs.size(), static_cast<f64>(bytes) * 1e-9, wall, wall > 0 ? static_cast<f64>(bytes) * 1e-9 / wall : 0.0,
+		threads, cores, busy, user, system, end.major_faults - begin.major_faults, bound);
+}
+
+#pragma endregion
+
+void usage(ll_string_t program) noexcept {
+	std::printf(
+		"usage: %s [--algorithm=64|128|crc128] [--threads=N] [--stats] [FILE]...\n"
+		"       %s -c|--check [--quiet] [--algorithm=crc128] [--threads=N] [--stats] [FILE]...\n"
+		"Prints or checks CityHash digests (default CityHash128).  With no FILE, or\n"
+		"when FILE is -, reads standard input.  crc128 is CityHashCrc128; it uses\n"
+		"the crc32 instruction when this CPU has it (%s here).\n",
+		program, program, city::CityHashCrcIsAccelerated() ? "yes" : "no");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	Options options{};
+	options.algorithm = Algorithm::City128;
+	options.threads = std::thread::hardware_concurrency();
+	if (options.threads == 0) options.threads = 1;
+
+	bool only_files = false;
+	for (int i = 1; i < argc; ++i) {
+		ll_string_t arg = argv[i];
+		if (only_files || arg[0] != '-' || arg[1] == '\0') options.inputs.push_back(arg);
+		else if (std::strcmp(arg, "--") == 0) only_files = true;
+		else if (std::strcmp(arg, "-c") == 0 || std::strcmp(arg, "--check") == 0) options.check = true;
+		else if (std::strcmp(arg, "--quiet") == 0) options.quiet = true;
+		else if (std::strcmp(arg, "--stats") == 0) options.stats = true;
+		else if (std::strncmp(arg, "--threads=", 10) == 0) {
+			options.threads = std::strtoull(arg + 10, nullptr, 10);
+			if (options.threads == 0) options.threads = 1;
+		}
+		else if (std::strcmp(arg, "--algorithm=64") == 0) options.algorithm = Algorithm::City64;
+		else if (std::strcmp(arg, "--algorithm=128") == 0) options.algorithm = Algorithm::City128;
+		else if (std::strcmp(arg, "--algorithm=crc128") == 0) options.algorithm = Algorithm::Crc128;
+		else {
+			usage(argv[0]);
+			return std::strcmp(arg, "--help") == 0 ? 0 : 1;
+		}
+	}
+	if (options.inputs.empty()) options.inputs.push_back("-");
+
+	std::vector<Job> jobs;
+	len_t malformed = 0;
+	bool ok = true;
+	if (options.check) {
+		for (const std::string& input : options.inputs)
+			ok &= readChecksumFile(options, input, jobs, malformed);
+	}
+	else {
+		for (const std::string& input : options.inputs) {
+			Job job{};
+			job.path = input;
+			job.algorithm = options.algorithm;
+			jobs.push_back(std::move(job));
+		}
+	}
+
+	const Usage begin = getUsage();
+	const auto t0 = std::chrono::steady_clock::now();
+	hashAll(options, jobs);
+	const f64 wall = std::chrono::duration<f64>(std::chrono::steady_clock::now() - t0).count();
+
+	len_t failed = 0;
+	len_t unreadable = 0;
+	for (const Job& job : jobs) {
+		if (!job.error.empty()) {
+			std::fprintf(stderr, "cityhashsum: %s: %s\n", job.path.c_str(), job.error.c_str());
+			if (options.check) std::printf("%s: FAILED open or read\n", job.path.c_str());
+			++unreadable;
+		}
+		else if (!options.check) std::printf("%s  %s\n", job.digest.c_str(), job.path.c_str());
+		else if (job.digest != job.expected) {
+			std::printf("%s: FAILED\n", job.path.c_str());
+			++failed;
+		}
+		else if (!options.quiet) std::printf("%s: OK\n", job.path.c_str());
+	}
+	std::fflush(stdout);
+
+	if (malformed)
+		std::fprintf(stderr, "cityhashsum: WARNING: %zu line%s improperly formatted\n", malformed, malformed == 1 ? " is" : "s are");
+	if (unreadable && options.check)
+		std::fprintf(stderr, "cityhashsum: WARNING: %zu listed file%s could not be read\n", unreadable, unreadable == 1 ? "" : "s");
+	if (failed)
+		std::fprintf(stderr, "cityhashsum: WARNING: %zu computed checksum%s did NOT match\n", failed, failed == 1 ? "" : "s");
+	if (options.stats) printStats(options, jobs, wall, begin, getUsage());
+	return ok && !failed && !unreadable && !malformed ? 0 : 1;
+}